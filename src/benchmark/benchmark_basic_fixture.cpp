@@ -24,11 +24,14 @@ void BenchmarkBasicFixture::SetUp(::benchmark::State& state) {
   _table_wrapper_b = std::make_shared<TableWrapper>(table_generator2->generate_table(_chunk_size));
   _table_dict_wrapper =
       std::make_shared<TableWrapper>(table_generator->generate_table(_chunk_size, EncodingType::Dictionary));
+  _table_dict_simd_bp128_wrapper = std::make_shared<TableWrapper>(table_generator->generate_table(
+      _chunk_size, ColumnEncodingSpec{EncodingType::Dictionary, VectorCompressionType::SimdBp128}));
   _table_deprecated_dict_wrapper =
       std::make_shared<TableWrapper>(table_generator->generate_table(_chunk_size, EncodingType::DeprecatedDictionary));
   _table_wrapper_a->execute();
   _table_wrapper_b->execute();
   _table_dict_wrapper->execute();
+  _table_dict_simd_bp128_wrapper->execute();
   _table_deprecated_dict_wrapper->execute();
 }
 
@@ -22,6 +22,7 @@ class BenchmarkBasicFixture : public benchmark::Fixture {
   std::shared_ptr<TableWrapper> _table_wrapper_a;
   std::shared_ptr<TableWrapper> _table_wrapper_b;
   std::shared_ptr<TableWrapper> _table_dict_wrapper;
+  std::shared_ptr<TableWrapper> _table_dict_simd_bp128_wrapper;
   std::shared_ptr<TableWrapper> _table_deprecated_dict_wrapper;
   ChunkID _chunk_size;
 };
@@ -0,0 +1,46 @@
+#include <memory>
+#include <optional>
+
+#include "benchmark/benchmark.h"
+
+#include "benchmark_basic_fixture.hpp"
+#include "storage/base_encoded_column.hpp"
+#include "storage/base_value_column.hpp"
+#include "storage/column_encoding_utils.hpp"
+#include "storage/table.hpp"
+#include "table_generator.hpp"
+
+namespace opossum {
+
+/**
+ * Encodes the first column of the first chunk of a generated table. Besides the encoding time, the memory usage
+ * of the encoded column and of the value column it was created from are reported as counters.
+ */
+static void BM_ColumnEncoding(benchmark::State& state, const EncodingType encoding_type,
+                              const std::optional<VectorCompressionType> vector_compression_type) {
+  const auto chunk_size = static_cast<ChunkID>(state.range(0));
+  const auto table = TableGenerator{}.generate_table(chunk_size);
+  const auto value_column =
+      std::dynamic_pointer_cast<const BaseValueColumn>(table->get_chunk(ChunkID{0})->get_column(ColumnID{0}));
+
+  auto memory_usage = size_t{0u};
+  while (state.KeepRunning()) {
+    const auto encoded_column = encode_column(encoding_type, DataType::Int, value_column, vector_compression_type);
+    memory_usage = encoded_column->estimate_memory_usage();
+  }
+
+  state.counters["memory_usage"] = memory_usage;
+  state.counters["value_column_memory_usage"] = value_column->estimate_memory_usage();
+}
+
+BENCHMARK_CAPTURE(BM_ColumnEncoding, DeprecatedDictionary, EncodingType::DeprecatedDictionary, std::nullopt)
+    ->Apply(BenchmarkBasicFixture::ChunkSizeIn);
+BENCHMARK_CAPTURE(BM_ColumnEncoding, DictionaryFixedSizeByteAligned, EncodingType::Dictionary,
+                  VectorCompressionType::FixedSizeByteAligned)
+    ->Apply(BenchmarkBasicFixture::ChunkSizeIn);
+BENCHMARK_CAPTURE(BM_ColumnEncoding, DictionarySimdBp128, EncodingType::Dictionary, VectorCompressionType::SimdBp128)
+    ->Apply(BenchmarkBasicFixture::ChunkSizeIn);
+BENCHMARK_CAPTURE(BM_ColumnEncoding, RunLength, EncodingType::RunLength, std::nullopt)
+    ->Apply(BenchmarkBasicFixture::ChunkSizeIn);
+
+}  // namespace opossum
@@ -25,6 +25,9 @@ class OperatorsProjectionBenchmark : public BenchmarkBasicFixture {
     _tables.emplace_back(_table_wrapper_a);  // 0
     _tables.emplace_back(_table_wrapper_b);  // 1
     _tables.emplace_back(_table_ref);        // 2
+
+    _tables.emplace_back(_table_dict_wrapper);             // 3
+    _tables.emplace_back(_table_deprecated_dict_wrapper);  // 4
   }
 
  protected:
@@ -74,7 +77,7 @@ BENCHMARK_DEFINE_F(OperatorsProjectionBenchmark, BM_ProjectionConstantTerm)(benc
 
 static void CustomArguments(benchmark::internal::Benchmark* b) {
   for (ChunkID chunk_size : {ChunkID(0), ChunkID(10000), ChunkID(100000)}) {
-    for (int column_type = 0; column_type <= 2; column_type++) {
+    for (int column_type = 0; column_type <= 4; column_type++) {
       b->Args({static_cast<int>(chunk_size), column_type});
     }
   }
@@ -1,4 +1,5 @@
 #include <memory>
+#include <vector>
 
 #include "benchmark/benchmark.h"
 
@@ -21,6 +22,20 @@ BENCHMARK_DEFINE_F(BenchmarkBasicFixture, BM_Sort_ChunkSizeOut)(benchmark::State
   }
 }
 
+BENCHMARK_DEFINE_F(BenchmarkBasicFixture, BM_Sort_MultipleColumns)(benchmark::State& state) {
+  clear_cache();
+
+  const auto sort_definitions = std::vector<SortColumnDefinition>{{ColumnID{0} /* "a" */, OrderByMode::Ascending},
+                                                                  {ColumnID{1} /* "b" */, OrderByMode::Descending}};
+
+  auto warm_up = std::make_shared<Sort>(_table_wrapper_a, sort_definitions);
+  warm_up->execute();
+  while (state.KeepRunning()) {
+    auto sort = std::make_shared<Sort>(_table_wrapper_a, sort_definitions);
+    sort->execute();
+  }
+}
+
 static void ChunkSizeOut(benchmark::internal::Benchmark* b) {
   for (ChunkID chunk_size_in : {ChunkID(0), ChunkID(10000), ChunkID(100000)}) {
     for (ChunkID chunk_size_out : {ChunkID(0), ChunkID(10000), ChunkID(100000)}) {
@@ -30,5 +45,6 @@ static void ChunkSizeOut(benchmark::internal::Benchmark* b) {
 }
 
 BENCHMARK_REGISTER_F(BenchmarkBasicFixture, BM_Sort_ChunkSizeOut)->Apply(ChunkSizeOut);
+BENCHMARK_REGISTER_F(BenchmarkBasicFixture, BM_Sort_MultipleColumns)->Apply(BenchmarkBasicFixture::ChunkSizeIn);
 
 }  // namespace opossum
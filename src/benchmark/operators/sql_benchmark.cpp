@@ -6,6 +6,7 @@
 #include "benchmark/benchmark.h"
 #include "logical_query_plan/lqp_translator.hpp"
 #include "sql/sql_query_operator.hpp"
+#include "sql/sql_query_plan.hpp"
 #include "sql/sql_translator.hpp"
 #include "storage/storage_manager.hpp"
 #include "utils/load_table.hpp"
@@ -61,6 +62,20 @@ class SQLBenchmark : public BenchmarkBasicFixture {
     }
   }
 
+  // Run a benchmark that instantiates the cached query plan of the given query, i.e., recreates its operators and
+  // wraps them in tasks, as it is done for every execution of a cached query.
+  void BM_InstantiateQuery(benchmark::State& st, const std::string& query) {
+    SQLParserResult result;
+    SQLParser::parseSQLString(query, &result);
+    auto result_node = SQLTranslator{false}.translate_parse_result(result)[0];
+    SQLQueryPlan plan;
+    plan.add_tree_by_root(LQPTranslator{}.translate_node(result_node));
+
+    while (st.KeepRunning()) {
+      benchmark::DoNotOptimize(plan.recreate().create_tasks());
+    }
+  }
+
   // Run a benchmark that executes the query operator with the given query.
   void BM_SQLOperatorQuery(benchmark::State& st, const std::string& query) {
     while (st.KeepRunning()) {
@@ -136,6 +151,9 @@ class SQLBenchmark : public BenchmarkBasicFixture {
         GROUP BY customer.c_custkey, customer.c_name
         HAVING COUNT(orderitems.orders.o_orderkey) >= 100;)";
 
+  // The predicates on the same input are translated to a DAG of table scans and a UnionPositions.
+  const std::string Q5 = "SELECT * FROM customer WHERE c_custkey < 100 OR c_nationkey = 0;";
+
   const std::string Q4Param =
       R"(SELECT customer.c_custkey, customer.c_name, COUNT(orderitems.orders.o_orderkey)
         FROM customer
@@ -151,6 +169,7 @@ class SQLBenchmark : public BenchmarkBasicFixture {
 BENCHMARK_F(SQLBenchmark, BM_CompileQ1)(benchmark::State& st) { BM_CompileQuery(st, Q1); }
 BENCHMARK_F(SQLBenchmark, BM_ParseQ1)(benchmark::State& st) { BM_ParseQuery(st, Q1); }
 BENCHMARK_F(SQLBenchmark, BM_PlanQ1)(benchmark::State& st) { BM_PlanQuery(st, Q1); }
+BENCHMARK_F(SQLBenchmark, BM_InstantiateQ1)(benchmark::State& st) { BM_InstantiateQuery(st, Q1); }
 BENCHMARK_F(SQLBenchmark, BM_SQLOperatorQ1)(benchmark::State& st) { BM_SQLOperatorQuery(st, Q1); }
 BENCHMARK_F(SQLBenchmark, BM_PrepareExecuteQ1)(benchmark::State& st) { BM_PrepareAndExecute(st, Q1, QExec); }
 BENCHMARK_F(SQLBenchmark, BM_ParseTreeCacheQ1)(benchmark::State& st) { BM_ParseTreeCache(st, Q1); }
@@ -160,6 +179,7 @@ BENCHMARK_F(SQLBenchmark, BM_QueryPlanCacheQ1)(benchmark::State& st) { BM_QueryP
 BENCHMARK_F(SQLBenchmark, BM_CompileQ2)(benchmark::State& st) { BM_CompileQuery(st, Q2); }
 BENCHMARK_F(SQLBenchmark, BM_ParseQ2)(benchmark::State& st) { BM_ParseQuery(st, Q2); }
 BENCHMARK_F(SQLBenchmark, BM_PlanQ2)(benchmark::State& st) { BM_PlanQuery(st, Q2); }
+BENCHMARK_F(SQLBenchmark, BM_InstantiateQ2)(benchmark::State& st) { BM_InstantiateQuery(st, Q2); }
 BENCHMARK_F(SQLBenchmark, BM_SQLOperatorQ2)(benchmark::State& st) { BM_SQLOperatorQuery(st, Q2); }
 BENCHMARK_F(SQLBenchmark, BM_PrepareExecuteQ2)(benchmark::State& st) { BM_PrepareAndExecute(st, Q2, QExec); }
 BENCHMARK_F(SQLBenchmark, BM_ParseTreeCacheQ2)(benchmark::State& st) { BM_ParseTreeCache(st, Q2); }
@@ -169,6 +189,7 @@ BENCHMARK_F(SQLBenchmark, BM_QueryPlanCacheQ2)(benchmark::State& st) { BM_QueryP
 BENCHMARK_F(SQLBenchmark, BM_CompileQ3)(benchmark::State& st) { BM_CompileQuery(st, Q3); }
 BENCHMARK_F(SQLBenchmark, BM_ParseQ3)(benchmark::State& st) { BM_ParseQuery(st, Q3); }
 BENCHMARK_F(SQLBenchmark, BM_PlanQ3)(benchmark::State& st) { BM_PlanQuery(st, Q3); }
+BENCHMARK_F(SQLBenchmark, BM_InstantiateQ3)(benchmark::State& st) { BM_InstantiateQuery(st, Q3); }
 BENCHMARK_F(SQLBenchmark, BM_SQLOperatorQ3)(benchmark::State& st) { BM_SQLOperatorQuery(st, Q3); }
 BENCHMARK_F(SQLBenchmark, BM_PrepareExecuteQ3)(benchmark::State& st) { BM_PrepareAndExecute(st, Q3, QExec); }
 BENCHMARK_F(SQLBenchmark, BM_ParseTreeCacheQ3)(benchmark::State& st) { BM_ParseTreeCache(st, Q3); }
@@ -178,11 +199,15 @@ BENCHMARK_F(SQLBenchmark, BM_QueryPlanCacheQ3)(benchmark::State& st) { BM_QueryP
 BENCHMARK_F(SQLBenchmark, BM_CompileQ4)(benchmark::State& st) { BM_CompileQuery(st, Q4); }
 BENCHMARK_F(SQLBenchmark, BM_ParseQ4)(benchmark::State& st) { BM_ParseQuery(st, Q4); }
 BENCHMARK_F(SQLBenchmark, BM_PlanQ4)(benchmark::State& st) { BM_PlanQuery(st, Q4); }
+BENCHMARK_F(SQLBenchmark, BM_InstantiateQ4)(benchmark::State& st) { BM_InstantiateQuery(st, Q4); }
 BENCHMARK_F(SQLBenchmark, BM_SQLOperatorQ4)(benchmark::State& st) { BM_SQLOperatorQuery(st, Q4); }
 BENCHMARK_F(SQLBenchmark, BM_PrepareExecuteQ4)(benchmark::State& st) { BM_PrepareAndExecute(st, Q4, QExec); }
 BENCHMARK_F(SQLBenchmark, BM_ParseTreeCacheQ4)(benchmark::State& st) { BM_ParseTreeCache(st, Q4); }
 BENCHMARK_F(SQLBenchmark, BM_QueryPlanCacheQ4)(benchmark::State& st) { BM_QueryPlanCache(st, Q4); }
 
+// Run the instantiation benchmark for a plan with an operator that is the input of multiple operators.
+BENCHMARK_F(SQLBenchmark, BM_InstantiateQ5)(benchmark::State& st) { BM_InstantiateQuery(st, Q5); }
+
 // Benchmark the parsing time of the EXECUTE statement.
 BENCHMARK_F(SQLBenchmark, BM_ParseQExec)(benchmark::State& st) { BM_ParseQuery(st, QExec); }
 
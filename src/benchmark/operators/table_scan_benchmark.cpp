@@ -33,6 +33,18 @@ BENCHMARK_DEFINE_F(BenchmarkBasicFixture, BM_TableScanConstantOnDict)(benchmark:
   }
 }
 
+BENCHMARK_DEFINE_F(BenchmarkBasicFixture, BM_TableScanConstantOnDictSimdBp128)(benchmark::State& state) {
+  clear_cache();
+  auto warm_up = std::make_shared<TableScan>(_table_dict_simd_bp128_wrapper, ColumnID{0} /* "a" */,
+                                             PredicateCondition::GreaterThanEquals, 7);
+  warm_up->execute();
+  while (state.KeepRunning()) {
+    auto table_scan = std::make_shared<TableScan>(_table_dict_simd_bp128_wrapper, ColumnID{0} /* "a" */,
+                                                  PredicateCondition::GreaterThanEquals, 7);
+    table_scan->execute();
+  }
+}
+
 BENCHMARK_DEFINE_F(BenchmarkBasicFixture, BM_TableScanConstantOnDeprecatedDict)(benchmark::State& state) {
   clear_cache();
   auto warm_up = std::make_shared<TableScan>(_table_deprecated_dict_wrapper, ColumnID{0} /* "a" */,
@@ -69,11 +81,41 @@ BENCHMARK_DEFINE_F(BenchmarkBasicFixture, BM_TableScanVariableOnDict)(benchmark:
   }
 }
 
+BENCHMARK_DEFINE_F(BenchmarkBasicFixture, BM_TableScanVariableOnDictSimdBp128)(benchmark::State& state) {
+  clear_cache();
+  auto warm_up = std::make_shared<TableScan>(_table_dict_simd_bp128_wrapper, ColumnID{0} /* "a" */,
+                                             PredicateCondition::GreaterThanEquals, ColumnID{1} /* "b" */);
+  warm_up->execute();
+  while (state.KeepRunning()) {
+    auto table_scan = std::make_shared<TableScan>(_table_dict_simd_bp128_wrapper, ColumnID{0} /* "a" */,
+                                                  PredicateCondition::GreaterThanEquals, ColumnID{1} /* "b" */);
+    table_scan->execute();
+  }
+}
+
+BENCHMARK_DEFINE_F(BenchmarkBasicFixture, BM_TableScanVariableOnDeprecatedDict)(benchmark::State& state) {
+  clear_cache();
+  auto warm_up = std::make_shared<TableScan>(_table_deprecated_dict_wrapper, ColumnID{0} /* "a" */,
+                                             PredicateCondition::GreaterThanEquals, ColumnID{1} /* "b" */);
+  warm_up->execute();
+  while (state.KeepRunning()) {
+    auto table_scan = std::make_shared<TableScan>(_table_deprecated_dict_wrapper, ColumnID{0} /* "a" */,
+                                                  PredicateCondition::GreaterThanEquals, ColumnID{1} /* "b" */);
+    table_scan->execute();
+  }
+}
+
 BENCHMARK_REGISTER_F(BenchmarkBasicFixture, BM_TableScanConstant)->Apply(BenchmarkBasicFixture::ChunkSizeIn);
 BENCHMARK_REGISTER_F(BenchmarkBasicFixture, BM_TableScanConstantOnDict)->Apply(BenchmarkBasicFixture::ChunkSizeIn);
+BENCHMARK_REGISTER_F(BenchmarkBasicFixture, BM_TableScanConstantOnDictSimdBp128)
+    ->Apply(BenchmarkBasicFixture::ChunkSizeIn);
 BENCHMARK_REGISTER_F(BenchmarkBasicFixture, BM_TableScanConstantOnDeprecatedDict)
     ->Apply(BenchmarkBasicFixture::ChunkSizeIn);
 BENCHMARK_REGISTER_F(BenchmarkBasicFixture, BM_TableScanVariable)->Apply(BenchmarkBasicFixture::ChunkSizeIn);
 BENCHMARK_REGISTER_F(BenchmarkBasicFixture, BM_TableScanVariableOnDict)->Apply(BenchmarkBasicFixture::ChunkSizeIn);
+BENCHMARK_REGISTER_F(BenchmarkBasicFixture, BM_TableScanVariableOnDictSimdBp128)
+    ->Apply(BenchmarkBasicFixture::ChunkSizeIn);
+BENCHMARK_REGISTER_F(BenchmarkBasicFixture, BM_TableScanVariableOnDeprecatedDict)
+    ->Apply(BenchmarkBasicFixture::ChunkSizeIn);
 
 }  // namespace opossum
@@ -0,0 +1,75 @@
+#include <cmath>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "sql/gdfs_cache.hpp"
+#include "sql/lru_cache.hpp"
+#include "sql/lru_k_cache.hpp"
+#include "sql/sharded_cache.hpp"
+#include "sql/sql_query_cache.hpp"
+#include "sql/sql_query_plan.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto cache_capacity = size_t{1024};
+constexpr auto distinct_query_count = size_t{4096};
+
+using LRUQueryPlanCache = LRUCache<std::string, SQLQueryPlan>;
+using LRUKQueryPlanCache = LRUKCache<2, std::string, SQLQueryPlan>;
+using GDFSQueryPlanCache = GDFSCache<std::string, SQLQueryPlan>;
+using ShardedQueryPlanCache = ShardedCache<std::string, SQLQueryPlan>;
+
+std::vector<std::string> generate_queries() {
+  auto queries = std::vector<std::string>{};
+  queries.reserve(distinct_query_count);
+  for (auto query_id = size_t{0}; query_id < distinct_query_count; ++query_id) {
+    queries.emplace_back("SELECT a, b FROM table_" + std::to_string(query_id) + " WHERE a = ? AND b < ?");
+  }
+  return queries;
+}
+
+}  // namespace
+
+/**
+ * Looks up query plans in an SQLQueryCache from multiple threads, with the cache using the given implementation.
+ * Like in a real workload, some queries are far more frequent than others. Plans that are not found are inserted.
+ */
+template <typename CacheType>
+static void BM_SQLQueryCache(benchmark::State& state) {
+  static const auto queries = generate_queries();
+  static auto cache = std::unique_ptr<SQLQueryCache<SQLQueryPlan>>{};
+
+  // Google benchmark starts the measured loop of all threads together, i.e., after the cache was created
+  if (state.thread_index == 0) {
+    cache = std::make_unique<SQLQueryCache<SQLQueryPlan>>(cache_capacity);
+    cache->replace_cache_impl<CacheType>(cache_capacity);
+  }
+
+  auto generator = std::mt19937{static_cast<std::mt19937::result_type>(state.thread_index)};
+  auto distribution = std::uniform_real_distribution<double>{0.0, 1.0};
+  const auto plan = SQLQueryPlan{};
+
+  while (state.KeepRunning()) {
+    const auto query_id = static_cast<size_t>(std::pow(distribution(generator), 3.0) * distinct_query_count);
+    const auto& query = queries[query_id];
+    if (!cache->try_get(query)) cache->set(query, plan);
+  }
+
+  if (state.thread_index == 0) {
+    state.counters["hit_rate"] = static_cast<double>(cache->hits()) / (cache->hits() + cache->misses());
+    cache.reset();
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_SQLQueryCache, LRUQueryPlanCache)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SQLQueryCache, LRUKQueryPlanCache)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SQLQueryCache, GDFSQueryPlanCache)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_SQLQueryCache, ShardedQueryPlanCache)->ThreadRange(1, 16)->UseRealTime();
+
+}  // namespace opossum
@@ -19,7 +19,7 @@
 namespace opossum {
 
 std::shared_ptr<Table> TableGenerator::generate_table(const ChunkID chunk_size,
-                                                      std::optional<EncodingType> encoding_type) {
+                                                      std::optional<ColumnEncodingSpec> encoding_spec) {
   std::shared_ptr<Table> table = std::make_shared<Table>(chunk_size);
   std::vector<tbb::concurrent_vector<int>> value_vectors;
   auto vector_size = std::min(static_cast<size_t>(chunk_size), _num_rows);
@@ -65,8 +65,8 @@ std::shared_ptr<Table> TableGenerator::generate_table(const ChunkID chunk_size,
     table->emplace_chunk(std::move(chunk));
   }
 
-  if (encoding_type.has_value()) {
-    ChunkEncoder::encode_all_chunks(table, {encoding_type.value()});
+  if (encoding_spec.has_value()) {
+    ChunkEncoder::encode_all_chunks(table, encoding_spec.value());
   }
 
   return table;
@@ -3,7 +3,7 @@
 #include <memory>
 #include <optional>
 
-#include "storage/encoding_type.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -13,7 +13,7 @@ class Table;
 class TableGenerator {
  public:
   std::shared_ptr<Table> generate_table(const ChunkID chunk_size,
-                                        std::optional<EncodingType> encoding_type = std::nullopt);
+                                        std::optional<ColumnEncodingSpec> encoding_spec = std::nullopt);
 
  protected:
   const size_t _num_columns = 10;
@@ -0,0 +1,74 @@
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "concurrency/transaction_manager.hpp"
+#include "tpcc/constants.hpp"
+#include "tpcc/helper.hpp"
+#include "tpcc/new_order.hpp"
+#include "tpcc/tpcc_random_generator.hpp"
+#include "tpcc_base_fixture.hpp"
+
+namespace opossum {
+
+/**
+ * Measures how well concurrent INSERTs into the same table scale. Each client thread runs transactions that insert a
+ * single row into ORDER_LINE, just like the last step of NEW-ORDER does. The number of client threads is the
+ * benchmark's argument, so comparing the items per second of the different runs shows whether the inserts contend.
+ */
+class TPCCInsertBenchmark : public TPCCBenchmarkFixture {
+ public:
+  void benchmark_concurrent_order_line_inserts(benchmark::State& state) {
+    const auto client_count = static_cast<uint32_t>(state.range(0));
+
+    while (state.KeepRunning()) {
+      auto clients = std::vector<std::thread>{};
+      clients.reserve(client_count);
+
+      for (auto client_id = 0u; client_id < client_count; ++client_id) {
+        clients.emplace_back([&, client_id]() {
+          // Each client uses its own generator, as they are not thread-safe
+          auto random_gen = tpcc::TpccRandomGenerator{client_id};
+
+          for (auto insert_id = 0u; insert_id < inserts_per_client; ++insert_id) {
+            const auto o_id = static_cast<int32_t>(random_gen.random_number(0, tpcc::NUM_ORDERS - 1));
+            const auto d_id = static_cast<int32_t>(random_gen.random_number(0, tpcc::NUM_DISTRICTS_PER_WAREHOUSE - 1));
+            const auto w_id = static_cast<int32_t>(random_gen.random_number(0, _gen._warehouse_size - 1));
+            const auto i_id = static_cast<int32_t>(random_gen.random_number(0, tpcc::NUM_ITEMS - 1));
+            const auto quantity = static_cast<int32_t>(random_gen.random_number(1, tpcc::MAX_ORDER_LINE_QUANTITY));
+            const auto dist_info = random_gen.astring(24, 24);
+
+            TransactionManager::get().run_transaction([&](std::shared_ptr<TransactionContext> t_context) {
+              auto tasks = _ref_impl.get_create_order_line_tasks(o_id, d_id, w_id, 1, i_id, 0, 0, quantity,
+                                                                  quantity * 10.0f, dist_info);
+              tpcc::execute_tasks_with_context(tasks, t_context);
+            });
+          }
+        });
+      }
+
+      for (auto& client : clients) {
+        client.join();
+      }
+    }
+
+    state.SetItemsProcessed(state.iterations() * client_count * inserts_per_client);
+  }
+
+ protected:
+  static constexpr auto inserts_per_client = 1'000u;
+
+  tpcc::NewOrderRefImpl _ref_impl;
+};
+
+BENCHMARK_DEFINE_F(TPCCInsertBenchmark, BM_TPCC_ConcurrentOrderLineInserts)(benchmark::State& state) {
+  benchmark_concurrent_order_line_inserts(state);
+}
+BENCHMARK_REGISTER_F(TPCCInsertBenchmark, BM_TPCC_ConcurrentOrderLineInserts)
+    ->RangeMultiplier(2)
+    ->Range(1, 16)
+    ->UseRealTime();
+
+}  // namespace opossum
@@ -9,6 +9,7 @@ extern "C" {
 #include <utility>
 
 #include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 
 /**
@@ -193,8 +194,8 @@ std::unordered_map<TpchTable, std::string> tpch_table_names = {
     {TpchTable::Customer, "customer"}, {TpchTable::Orders, "orders"},     {TpchTable::LineItem, "lineitem"},
     {TpchTable::Nation, "nation"},     {TpchTable::Region, "region"}};
 
-TpchDbGenerator::TpchDbGenerator(float scale_factor, uint32_t chunk_size)
-    : _scale_factor(scale_factor), _chunk_size(chunk_size) {}
+TpchDbGenerator::TpchDbGenerator(float scale_factor, uint32_t chunk_size, const ColumnEncodingSpec& encoding_spec)
+    : _scale_factor(scale_factor), _chunk_size(chunk_size), _encoding_spec(encoding_spec) {}
 
 std::unordered_map<TpchTable, std::shared_ptr<Table>> TpchDbGenerator::generate() {
   TableBuilder customer_builder{_chunk_size, customer_column_types, customer_column_names, UseMvcc::Yes};
@@ -296,11 +297,17 @@ std::unordered_map<TpchTable, std::shared_ptr<Table>> TpchDbGenerator::generate(
    */
   _dbgen_cleanup();
 
-  return {
+  auto tables = std::unordered_map<TpchTable, std::shared_ptr<Table>>{
       {TpchTable::Customer, customer_builder.finish_table()}, {TpchTable::Orders, order_builder.finish_table()},
       {TpchTable::LineItem, lineitem_builder.finish_table()}, {TpchTable::Part, part_builder.finish_table()},
       {TpchTable::PartSupp, partsupp_builder.finish_table()}, {TpchTable::Supplier, supplier_builder.finish_table()},
       {TpchTable::Nation, nation_builder.finish_table()},     {TpchTable::Region, region_builder.finish_table()}};
+
+  for (auto& table : tables) {
+    ChunkEncoder::encode_all_chunks(table.second, _encoding_spec);
+  }
+
+  return tables;
 }
 
 void TpchDbGenerator::generate_and_store() {
@@ -11,6 +11,7 @@
 
 #include "resolve_type.hpp"
 #include "storage/chunk.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/table.hpp"
 #include "storage/value_column.hpp"
 #include "types.hpp"
@@ -32,7 +33,12 @@ extern std::unordered_map<opossum::TpchTable, std::string> tpch_table_names;
  */
 class TpchDbGenerator final {
  public:
-  explicit TpchDbGenerator(float scale_factor, uint32_t chunk_size = Chunk::MAX_SIZE);
+  /**
+   * @param encoding_spec is applied to all columns of the generated tables. Pass EncodingType::Unencoded to keep them
+   *                      as ValueColumns.
+   */
+  explicit TpchDbGenerator(float scale_factor, uint32_t chunk_size = Chunk::MAX_SIZE,
+                           const ColumnEncodingSpec& encoding_spec = {});
 
   std::unordered_map<TpchTable, std::shared_ptr<Table>> generate();
 
@@ -44,5 +50,6 @@ class TpchDbGenerator final {
  private:
   float _scale_factor;
   size_t _chunk_size;
+  ColumnEncodingSpec _encoding_spec;
 };
 }  // namespace opossum
@@ -122,6 +122,12 @@ const std::unordered_map<JoinMode, std::string> join_mode_to_string = {
 
 const std::unordered_map<UnionMode, std::string> union_mode_to_string = {{UnionMode::Positions, "UnionPositions"}};
 
+const std::unordered_map<SetOperationMode, std::string> set_operation_mode_to_string = {
+    {SetOperationMode::Union, "Union"},
+    {SetOperationMode::Intersect, "Intersect"},
+    {SetOperationMode::Except, "Except"},
+};
+
 const boost::bimap<AggregateFunction, std::string> aggregate_function_to_string =
     make_bimap<AggregateFunction, std::string>({
         {AggregateFunction::Min, "MIN"},
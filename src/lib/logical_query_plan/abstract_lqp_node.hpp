@@ -21,11 +21,13 @@ enum class LQPNodeType {
   Aggregate,
   CreateView,
   Delete,
+  Distinct,
   DropView,
   DummyTable,
   Insert,
   Join,
   Limit,
+  Materialize,
   Predicate,
   Projection,
   Root,
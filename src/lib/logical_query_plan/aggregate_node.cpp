@@ -42,7 +42,9 @@ std::shared_ptr<AbstractLQPNode> AggregateNode::_deep_copy_impl(
         adapt_column_reference_to_different_lqp(groupby_column_reference, left_child(), copied_left_child));
   }
 
-  return AggregateNode::make(aggregate_expressions, groupby_column_references);
+  const auto aggregate_node = AggregateNode::make(aggregate_expressions, groupby_column_references);
+  if (_fused_predicate_count) aggregate_node->set_fused_predicate_count(*_fused_predicate_count);
+  return aggregate_node;
 }
 
 const std::vector<std::shared_ptr<LQPExpression>>& AggregateNode::aggregate_expressions() const {
@@ -93,9 +95,17 @@ std::string AggregateNode::description() const {
     s << "]";
   }
 
+  if (_fused_predicate_count) s << " (Fused with " << *_fused_predicate_count << " predicates)";
+
   return s.str();
 }
 
+const std::optional<size_t>& AggregateNode::fused_predicate_count() const { return _fused_predicate_count; }
+
+void AggregateNode::set_fused_predicate_count(const size_t fused_predicate_count) {
+  _fused_predicate_count = fused_predicate_count;
+}
+
 std::string AggregateNode::get_verbose_column_name(ColumnID column_id) const {
   DebugAssert(left_child(), "Need input to generate name");
 
@@ -56,6 +56,12 @@ class AggregateNode : public EnableMakeForLQPNode<AggregateNode>, public Abstrac
 
   std::string get_verbose_column_name(ColumnID column_id) const override;
 
+  // If set, the LQPTranslator fuses this node and the given number of PredicateNodes directly below it into a
+  // FusedAggregate instead of translating them into TableScans, a Projection, and an Aggregate. Set by the
+  // PipelineFusionRule.
+  const std::optional<size_t>& fused_predicate_count() const;
+  void set_fused_predicate_count(const size_t fused_predicate_count);
+
   bool shallow_equals(const AbstractLQPNode& rhs) const override;
 
  protected:
@@ -67,6 +73,7 @@ class AggregateNode : public EnableMakeForLQPNode<AggregateNode>, public Abstrac
  private:
   std::vector<std::shared_ptr<LQPExpression>> _aggregate_expressions;
   std::vector<LQPColumnReference> _groupby_column_references;
+  std::optional<size_t> _fused_predicate_count;
 
   mutable std::optional<std::vector<std::string>> _output_column_names;
 
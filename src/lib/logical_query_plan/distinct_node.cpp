@@ -0,0 +1,24 @@
+#include "distinct_node.hpp"
+
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+DistinctNode::DistinctNode() : AbstractLQPNode(LQPNodeType::Distinct) {}
+
+std::shared_ptr<AbstractLQPNode> DistinctNode::_deep_copy_impl(
+    const std::shared_ptr<AbstractLQPNode>& copied_left_child,
+    const std::shared_ptr<AbstractLQPNode>& copied_right_child) const {
+  return DistinctNode::make();
+}
+
+std::string DistinctNode::description() const { return "[Distinct]"; }
+
+bool DistinctNode::shallow_equals(const AbstractLQPNode& rhs) const {
+  Assert(rhs.type() == type(), "Can only compare nodes of the same type()");
+  return true;
+}
+
+}  // namespace opossum
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <string>
+
+#include "abstract_lqp_node.hpp"
+
+namespace opossum {
+
+/**
+ * This node type represents removing duplicate rows, as in SELECT DISTINCT.
+ */
+class DistinctNode : public EnableMakeForLQPNode<DistinctNode>, public AbstractLQPNode {
+ public:
+  DistinctNode();
+
+  std::string description() const override;
+
+  bool shallow_equals(const AbstractLQPNode& rhs) const override;
+
+ protected:
+  std::shared_ptr<AbstractLQPNode> _deep_copy_impl(
+      const std::shared_ptr<AbstractLQPNode>& copied_left_child,
+      const std::shared_ptr<AbstractLQPNode>& copied_right_child) const override;
+};
+
+}  // namespace opossum
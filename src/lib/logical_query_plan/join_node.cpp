@@ -43,7 +43,9 @@ std::shared_ptr<AbstractLQPNode> JoinNode::_deep_copy_impl(
         adapt_column_reference_to_different_lqp(_join_column_references->first, left_child(), copied_left_child),
         adapt_column_reference_to_different_lqp(_join_column_references->first, right_child(), copied_right_child),
     };
-    return JoinNode::make(_join_mode, join_column_references, *_predicate_condition);
+    const auto join_node = JoinNode::make(_join_mode, join_column_references, *_predicate_condition);
+    if (_join_type) join_node->set_join_type(*_join_type);
+    return join_node;
   }
 }
 
@@ -105,6 +107,10 @@ const std::optional<PredicateCondition>& JoinNode::predicate_condition() const {
 
 JoinMode JoinNode::join_mode() const { return _join_mode; }
 
+const std::optional<JoinType>& JoinNode::join_type() const { return _join_type; }
+
+void JoinNode::set_join_type(const JoinType join_type) { _join_type = join_type; }
+
 std::string JoinNode::get_verbose_column_name(ColumnID column_id) const {
   Assert(left_child() && right_child(), "Can't generate column names without children being set");
 
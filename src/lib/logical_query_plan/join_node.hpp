@@ -15,6 +15,9 @@ namespace opossum {
 
 using LQPColumnReferencePair = std::pair<LQPColumnReference, LQPColumnReference>;
 
+// Physical join implementation, chosen by the JoinAlgorithmRule
+enum class JoinType : uint8_t { Hash, SortMerge, NestedLoop, Index };
+
 /**
  * This node type is used to represent any type of Join, including cross products.
  * The idea is that the optimizer is able to decide on the physical join implementation.
@@ -32,6 +35,11 @@ class JoinNode : public EnableMakeForLQPNode<JoinNode>, public AbstractLQPNode {
   const std::optional<PredicateCondition>& predicate_condition() const;
   JoinMode join_mode() const;
 
+  // If no JoinType is set, the LQPTranslator uses JoinHash for equi joins that are not full outer joins and
+  // JoinSortMerge otherwise
+  const std::optional<JoinType>& join_type() const;
+  void set_join_type(const JoinType join_type);
+
   std::string description() const override;
   const std::vector<std::string>& output_column_names() const override;
   const std::vector<LQPColumnReference>& output_column_references() const override;
@@ -54,6 +62,7 @@ class JoinNode : public EnableMakeForLQPNode<JoinNode>, public AbstractLQPNode {
   JoinMode _join_mode;
   std::optional<LQPColumnReferencePair> _join_column_references;
   std::optional<PredicateCondition> _predicate_condition;
+  std::optional<JoinType> _join_type;
 
   mutable std::optional<std::vector<std::string>> _output_column_names;
 
@@ -10,30 +10,38 @@
 #include "constant_mappings.hpp"
 #include "create_view_node.hpp"
 #include "delete_node.hpp"
+#include "distinct_node.hpp"
 #include "drop_view_node.hpp"
 #include "dummy_table_node.hpp"
 #include "insert_node.hpp"
 #include "join_node.hpp"
 #include "limit_node.hpp"
 #include "lqp_expression.hpp"
+#include "materialize_node.hpp"
 #include "operators/aggregate.hpp"
 #include "operators/delete.hpp"
+#include "operators/distinct.hpp"
+#include "operators/fused_aggregate.hpp"
 #include "operators/get_table.hpp"
 #include "operators/index_scan.hpp"
 #include "operators/insert.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
+#include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/limit.hpp"
 #include "operators/maintenance/create_view.hpp"
 #include "operators/maintenance/drop_view.hpp"
 #include "operators/maintenance/show_columns.hpp"
 #include "operators/maintenance/show_tables.hpp"
+#include "operators/materialize.hpp"
 #include "operators/pqp_expression.hpp"
 #include "operators/product.hpp"
 #include "operators/projection.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
 #include "operators/union_positions.hpp"
 #include "operators/update.hpp"
 #include "operators/validate.hpp"
@@ -186,27 +194,17 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_projection_node(
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto sort_node = std::dynamic_pointer_cast<SortNode>(node);
-  auto input_operator = translate_node(node->left_child());
-
-  /**
-   * Go through all the order descriptions and create a sort operator for each of them.
-   * Iterate in reverse because the sort operator does not support multiple columns, and instead relies on stable sort.
-   * We therefore sort by the n+1-th column before sorting by the n-th column.
-   */
+  const auto input_operator = translate_node(node->left_child());
 
-  std::shared_ptr<AbstractOperator> result_operator;
-  const auto& definitions = sort_node->order_by_definitions();
-  if (definitions.size() > 1) {
-    PerformanceWarning("Multiple ORDER BYs are executed one-by-one");
-  }
-  for (auto it = definitions.rbegin(); it != definitions.rend(); it++) {
-    const auto& definition = *it;
-    result_operator = std::make_shared<Sort>(input_operator, node->get_output_column_id(definition.column_reference),
-                                             definition.order_by_mode);
-    input_operator = result_operator;
+  auto sort_definitions = std::vector<SortColumnDefinition>{};
+  for (const auto& definition : sort_node->order_by_definitions()) {
+    sort_definitions.emplace_back(
+        SortColumnDefinition{node->get_output_column_id(definition.column_reference), definition.order_by_mode});
   }
 
-  return result_operator;
+  if (sort_node->top_k()) return std::make_shared<TopK>(input_operator, sort_definitions, *sort_node->top_k());
+
+  return std::make_shared<Sort>(input_operator, sort_definitions);
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
@@ -228,20 +226,38 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
   join_column_ids.first = join_node->left_child()->get_output_column_id(join_node->join_column_references()->first);
   join_column_ids.second = join_node->right_child()->get_output_column_id(join_node->join_column_references()->second);
 
-  if (*join_node->predicate_condition() == PredicateCondition::Equals && join_node->join_mode() != JoinMode::Outer) {
-    return std::make_shared<JoinHash>(input_left_operator, input_right_operator, join_node->join_mode(),
-                                      join_column_ids, *(join_node->predicate_condition()));
+  auto join_type = join_node->join_type();
+  if (!join_type) {
+    const auto use_hash_join =
+        *join_node->predicate_condition() == PredicateCondition::Equals && join_node->join_mode() != JoinMode::Outer;
+    join_type = use_hash_join ? JoinType::Hash : JoinType::SortMerge;
   }
 
-  return std::make_shared<JoinSortMerge>(input_left_operator, input_right_operator, join_node->join_mode(),
+  switch (*join_type) {
+    case JoinType::Hash:
+      return std::make_shared<JoinHash>(input_left_operator, input_right_operator, join_node->join_mode(),
+                                        join_column_ids, *(join_node->predicate_condition()));
+    case JoinType::SortMerge:
+      return std::make_shared<JoinSortMerge>(input_left_operator, input_right_operator, join_node->join_mode(),
+                                             join_column_ids, *(join_node->predicate_condition()));
+    case JoinType::NestedLoop:
+      return std::make_shared<JoinNestedLoop>(input_left_operator, input_right_operator, join_node->join_mode(),
+                                              join_column_ids, *(join_node->predicate_condition()));
+    case JoinType::Index:
+      return std::make_shared<JoinIndex>(input_left_operator, input_right_operator, join_node->join_mode(),
                                          join_column_ids, *(join_node->predicate_condition()));
+  }
+
+  Fail("Unknown JoinType");
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto aggregate_node = std::dynamic_pointer_cast<AggregateNode>(node);
+  if (aggregate_node->fused_predicate_count()) return _translate_aggregate_node_to_fused_aggregate(aggregate_node);
+
   const auto input_operator = translate_node(node->left_child());
 
-  const auto aggregate_node = std::dynamic_pointer_cast<AggregateNode>(node);
   auto aggregate_expressions = _translate_expressions(aggregate_node->aggregate_expressions(), node);
 
   std::vector<ColumnID> groupby_columns;
@@ -340,13 +356,131 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
   return std::make_shared<Aggregate>(aggregate_input_operator, aggregate_definitions, groupby_columns);
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node_to_fused_aggregate(
+    const std::shared_ptr<AggregateNode>& aggregate_node) const {
+  // The fused PredicateNodes are not translated, their input is the input of the FusedAggregate. As PredicateNodes
+  // do not change the columns, ColumnIDs refer to the same columns below and above them.
+  auto predicate_nodes = std::vector<std::shared_ptr<PredicateNode>>{};
+  auto input_node = aggregate_node->left_child();
+  for (auto predicate_index = size_t{0}; predicate_index < *aggregate_node->fused_predicate_count();
+       ++predicate_index) {
+    const auto predicate_node = std::dynamic_pointer_cast<PredicateNode>(input_node);
+    DebugAssert(predicate_node, "Only PredicateNodes can be fused into a FusedAggregate");
+    predicate_nodes.emplace_back(predicate_node);
+    input_node = input_node->left_child();
+  }
+
+  const auto input_operator = translate_node(input_node);
+
+  const auto create_column = [&](const LQPColumnReference& column_reference) {
+    return PQPExpression::create_column(input_node->get_output_column_id(column_reference));
+  };
+
+  /**
+   * 1. Combine the predicates into a conjunction of comparisons, starting with the lowest one, which would be
+   * executed first
+   */
+  auto predicate = std::shared_ptr<PQPExpression>{};
+  const auto add_comparison = [&](const ExpressionType type, const std::shared_ptr<PQPExpression>& left,
+                                  const std::shared_ptr<PQPExpression>& right) {
+    const auto comparison = PQPExpression::create_binary_operator(type, left, right);
+    predicate = predicate ? PQPExpression::create_binary_operator(ExpressionType::And, predicate, comparison)
+                          : comparison;
+  };
+
+  for (auto predicate_node_it = predicate_nodes.rbegin(); predicate_node_it != predicate_nodes.rend();
+       ++predicate_node_it) {
+    const auto& predicate_node = **predicate_node_it;
+    const auto column = create_column(predicate_node.column_reference());
+
+    const auto& value = predicate_node.value();
+    const auto operand = is_lqp_column_reference(value)
+                             ? create_column(boost::get<LQPColumnReference>(value))
+                             : PQPExpression::create_literal(boost::get<AllTypeVariant>(value));
+
+    switch (predicate_node.predicate_condition()) {
+      case PredicateCondition::Equals:
+        add_comparison(ExpressionType::Equals, column, operand);
+        break;
+      case PredicateCondition::NotEquals:
+        add_comparison(ExpressionType::NotEquals, column, operand);
+        break;
+      case PredicateCondition::LessThan:
+        add_comparison(ExpressionType::LessThan, column, operand);
+        break;
+      case PredicateCondition::LessThanEquals:
+        add_comparison(ExpressionType::LessThanEquals, column, operand);
+        break;
+      case PredicateCondition::GreaterThan:
+        add_comparison(ExpressionType::GreaterThan, column, operand);
+        break;
+      case PredicateCondition::GreaterThanEquals:
+        add_comparison(ExpressionType::GreaterThanEquals, column, operand);
+        break;
+      case PredicateCondition::Between:
+        add_comparison(ExpressionType::GreaterThanEquals, column, operand);
+        add_comparison(ExpressionType::LessThanEquals, column, PQPExpression::create_literal(*predicate_node.value2()));
+        break;
+      default:
+        Fail("Predicate condition cannot be fused: " + predicate_condition_to_string.left.at(
+                                                             predicate_node.predicate_condition()));
+    }
+  }
+
+  /**
+   * 2. Translate the aggregates, whose arguments are evaluated by the FusedAggregate itself
+   */
+  auto aggregate_definitions = std::vector<FusedAggregateColumnDefinition>{};
+  const auto aggregate_expressions = _translate_expressions(aggregate_node->aggregate_expressions(), aggregate_node);
+  for (const auto& aggregate_expression : aggregate_expressions) {
+    DebugAssert(aggregate_expression->type() == ExpressionType::Function, "Only functions are supported in Aggregates");
+
+    const auto argument_expression =
+        std::dynamic_pointer_cast<PQPExpression>(aggregate_expression->aggregate_function_arguments()[0]);
+    DebugAssert(argument_expression, "Couldn't cast Expression to PQPExpression.");
+
+    if (argument_expression->type() == ExpressionType::Star) {
+      aggregate_definitions.emplace_back(std::nullopt, aggregate_expression->aggregate_function(),
+                                         aggregate_expression->alias());
+    } else {
+      aggregate_definitions.emplace_back(argument_expression, aggregate_expression->aggregate_function(),
+                                         aggregate_expression->alias());
+    }
+  }
+
+  auto groupby_column_ids = std::vector<ColumnID>{};
+  for (const auto& groupby_column_reference : aggregate_node->groupby_column_references()) {
+    groupby_column_ids.emplace_back(input_node->get_output_column_id(groupby_column_reference));
+  }
+
+  return std::make_shared<FusedAggregate>(input_operator, predicate, aggregate_definitions, groupby_column_ids);
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_limit_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto input_operator = translate_node(node->left_child());
   auto limit_node = std::dynamic_pointer_cast<LimitNode>(node);
+
+  // TopK already returns only the rows the Limit would pass on
+  if (const auto top_k = std::dynamic_pointer_cast<const TopK>(input_operator)) {
+    if (top_k->k() <= limit_node->num_rows()) return input_operator;
+  }
+
   return std::make_shared<Limit>(input_operator, limit_node->num_rows());
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_distinct_node(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto input_operator = translate_node(node->left_child());
+  return std::make_shared<Distinct>(input_operator);
+}
+
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_materialize_node(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto input_operator = translate_node(node->left_child());
+  return std::make_shared<Materialize>(input_operator);
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_insert_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto input_operator = translate_node(node->left_child());
@@ -441,6 +575,10 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_by_node_type(
       return _translate_aggregate_node(node);
     case LQPNodeType::Limit:
       return _translate_limit_node(node);
+    case LQPNodeType::Distinct:
+      return _translate_distinct_node(node);
+    case LQPNodeType::Materialize:
+      return _translate_materialize_node(node);
     case LQPNodeType::Insert:
       return _translate_insert_node(node);
     case LQPNodeType::Delete:
@@ -0,0 +1,24 @@
+#include "materialize_node.hpp"
+
+#include <string>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+MaterializeNode::MaterializeNode() : AbstractLQPNode(LQPNodeType::Materialize) {}
+
+std::shared_ptr<AbstractLQPNode> MaterializeNode::_deep_copy_impl(
+    const std::shared_ptr<AbstractLQPNode>& copied_left_child,
+    const std::shared_ptr<AbstractLQPNode>& copied_right_child) const {
+  return MaterializeNode::make();
+}
+
+std::string MaterializeNode::description() const { return "[Materialize]"; }
+
+bool MaterializeNode::shallow_equals(const AbstractLQPNode& rhs) const {
+  Assert(rhs.type() == type(), "Can only compare nodes of the same type()");
+  return true;
+}
+
+}  // namespace opossum
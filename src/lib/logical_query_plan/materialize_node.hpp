@@ -0,0 +1,27 @@
+#pragma once
+
+#include <string>
+
+#include "abstract_lqp_node.hpp"
+
+namespace opossum {
+
+/**
+ * This node type represents gathering the values of all columns its input only references, see Materialize. It does
+ * not occur in translated SQL statements but is placed by the MaterializationRule.
+ */
+class MaterializeNode : public EnableMakeForLQPNode<MaterializeNode>, public AbstractLQPNode {
+ public:
+  MaterializeNode();
+
+  std::string description() const override;
+
+  bool shallow_equals(const AbstractLQPNode& rhs) const override;
+
+ protected:
+  std::shared_ptr<AbstractLQPNode> _deep_copy_impl(
+      const std::shared_ptr<AbstractLQPNode>& copied_left_child,
+      const std::shared_ptr<AbstractLQPNode>& copied_right_child) const override;
+};
+
+}  // namespace opossum
@@ -27,7 +27,9 @@ std::shared_ptr<AbstractLQPNode> SortNode::_deep_copy_impl(
     order_by_definitions.emplace_back(column_reference, order_by_definition.order_by_mode);
   }
 
-  return SortNode::make(order_by_definitions);
+  const auto sort_node = SortNode::make(order_by_definitions);
+  if (_top_k) sort_node->set_top_k(*_top_k);
+  return sort_node;
 }
 
 std::string SortNode::description() const {
@@ -51,15 +53,22 @@ std::string SortNode::description() const {
     stream_aggregate(*it);
   }
 
+  if (_top_k) s << " (Top " << *_top_k << ")";
+
   return s.str();
 }
 
 const OrderByDefinitions& SortNode::order_by_definitions() const { return _order_by_definitions; }
 
+const std::optional<size_t>& SortNode::top_k() const { return _top_k; }
+
+void SortNode::set_top_k(const size_t top_k) { _top_k = top_k; }
+
 bool SortNode::shallow_equals(const AbstractLQPNode& rhs) const {
   Assert(rhs.type() == type(), "Can only compare nodes of the same type()");
   const auto& sort_node = static_cast<const SortNode&>(rhs);
 
+  if (_top_k != sort_node._top_k) return false;
   if (_order_by_definitions.size() != sort_node._order_by_definitions.size()) return false;
 
   for (size_t definition_idx = 0; definition_idx < sort_node._order_by_definitions.size(); ++definition_idx) {
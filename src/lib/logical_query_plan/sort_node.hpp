@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -33,6 +34,11 @@ class SortNode : public EnableMakeForLQPNode<SortNode>, public AbstractLQPNode {
 
   const OrderByDefinitions& order_by_definitions() const;
 
+  // If set, only the first top_k rows of the sorted output are needed, as a LimitNode follows this node. The
+  // LQPTranslator then uses TopK instead of Sort and Limit. Set by the TopKRule.
+  const std::optional<size_t>& top_k() const;
+  void set_top_k(const size_t top_k);
+
   bool shallow_equals(const AbstractLQPNode& rhs) const override;
 
  protected:
@@ -42,6 +48,7 @@ class SortNode : public EnableMakeForLQPNode<SortNode>, public AbstractLQPNode {
 
  private:
   const OrderByDefinitions _order_by_definitions;
+  std::optional<size_t> _top_k;
 };
 
 }  // namespace opossum
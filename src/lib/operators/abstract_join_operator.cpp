@@ -5,6 +5,7 @@
 #include <utility>
 
 #include "constant_mappings.hpp"
+#include "storage/reference_column.hpp"
 
 namespace opossum {
 
@@ -38,4 +39,42 @@ const std::string AbstractJoinOperator::description(DescriptionMode description_
          predicate_condition_to_string.left.at(_predicate_condition) + " " + column_name_right + ")";
 }
 
+void AbstractJoinOperator::_write_output_chunks(const std::shared_ptr<Chunk>& output_chunk,
+                                                const std::shared_ptr<const Table> input_table,
+                                                std::shared_ptr<PosList> pos_list) {
+  // Add columns from table to output chunk
+  for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
+    std::shared_ptr<BaseColumn> column;
+
+    if (auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(
+            input_table->get_chunk(ChunkID{0})->get_column(column_id))) {
+      auto new_pos_list = std::make_shared<PosList>();
+
+      ChunkID current_chunk_id{0};
+
+      // de-reference to the correct RowID so the output can be used in a Multi Join
+      for (const auto row : *pos_list) {
+        if (row.chunk_id != current_chunk_id) {
+          current_chunk_id = row.chunk_id;
+
+          reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(
+              input_table->get_chunk(current_chunk_id)->get_column(column_id));
+        }
+        if (row.chunk_offset == INVALID_CHUNK_OFFSET) {
+          new_pos_list->push_back(RowID{ChunkID{0}, INVALID_CHUNK_OFFSET});
+        } else {
+          new_pos_list->push_back(reference_column->pos_list()->at(row.chunk_offset));
+        }
+      }
+
+      column = std::make_shared<ReferenceColumn>(reference_column->referenced_table(),
+                                                 reference_column->referenced_column_id(), new_pos_list);
+    } else {
+      column = std::make_shared<ReferenceColumn>(input_table, column_id, pos_list);
+    }
+
+    output_chunk->add_column(column);
+  }
+}
+
 }  // namespace opossum
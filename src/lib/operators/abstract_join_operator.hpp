@@ -38,6 +38,12 @@ class AbstractJoinOperator : public AbstractReadOnlyOperator {
   const ColumnIDPair _column_ids;
   const PredicateCondition _predicate_condition;
 
+  // Adds a ReferenceColumn for every column of input_table to output_chunk, pointing to the rows in pos_list.
+  // If input_table itself consists of ReferenceColumns, they are de-referenced so that the output references the
+  // underlying data table (e.g., for multi joins). Rows with an INVALID_CHUNK_OFFSET are NULL rows of outer joins.
+  static void _write_output_chunks(const std::shared_ptr<Chunk>& output_chunk,
+                                   const std::shared_ptr<const Table> input_table, std::shared_ptr<PosList> pos_list);
+
   // Some operators need an internal implementation class, mostly in cases where
   // their execute method depends on a template parameter. An example for this is
   // found in join_hash.hpp.
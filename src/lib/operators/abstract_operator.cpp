@@ -1,5 +1,6 @@
 #include "abstract_operator.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <memory>
 #include <string>
@@ -68,6 +69,41 @@ std::shared_ptr<const Table> AbstractOperator::get_output() const {
 const std::string AbstractOperator::description(DescriptionMode description_mode) const { return name(); }
 
 std::shared_ptr<AbstractOperator> AbstractOperator::recreate(const std::vector<AllParameterVariant>& args) const {
+  auto recreated_operators = RecreatedOperators{};
+  return _recreate(args, recreated_operators);
+}
+
+std::shared_ptr<AbstractOperator> AbstractOperator::_recreate(const std::vector<AllParameterVariant>& args,
+                                                              RecreatedOperators& recreated_operators) const {
+  const auto recreated_input_left = _recreate_input(_input_left, args, recreated_operators);
+  const auto recreated_input_right = _recreate_input(_input_right, args, recreated_operators);
+
+  return _on_recreate(args, recreated_input_left, recreated_input_right);
+}
+
+std::shared_ptr<AbstractOperator> AbstractOperator::_recreate_input(
+    const std::shared_ptr<const AbstractOperator>& input, const std::vector<AllParameterVariant>& args,
+    RecreatedOperators& recreated_operators) {
+  if (!input) return nullptr;
+
+  // An input that is only held by the operator that is recreated cannot be reached again, so it is neither looked up
+  // nor remembered. Thus, recreating a plan without shared operators does not allocate anything besides the new
+  // operators.
+  if (input.use_count() == 1) return input->_recreate(args, recreated_operators);
+
+  const auto recreated_operator_iter =
+      std::find_if(recreated_operators.cbegin(), recreated_operators.cend(),
+                   [&](const auto& recreated_operator) { return recreated_operator.first == input.get(); });
+  if (recreated_operator_iter != recreated_operators.cend()) return recreated_operator_iter->second;
+
+  auto recreated_input = input->_recreate(args, recreated_operators);
+  recreated_operators.emplace_back(input.get(), recreated_input);
+  return recreated_input;
+}
+
+std::shared_ptr<AbstractOperator> AbstractOperator::_on_recreate(
+    const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+    const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
   Fail("Operator " + name() + " does not implement recreation.");
 }
 
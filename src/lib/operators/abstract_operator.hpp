@@ -3,6 +3,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "all_parameter_variant.hpp"
@@ -60,9 +61,12 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
 
   // Returns a new instance of the same operator with the same configuration.
   // The given arguments are used to replace the ValuePlaceholder objects within the new operator, if applicable.
-  // Recursively recreates the input operators and passes the argument list along.
-  // An operator needs to implement this method in order to be cacheable.
-  virtual std::shared_ptr<AbstractOperator> recreate(const std::vector<AllParameterVariant>& args = {}) const;
+  // Recursively recreates the input operators and passes the argument list along. An operator that is the input of
+  // multiple operators is only recreated once, so that it is executed only once in the new plan, too.
+  // Operators without placeholders are recreated as well and not shared with the original plan, as every operator
+  // holds its own output and execution state.
+  // An operator needs to implement _on_recreate in order to be cacheable.
+  std::shared_ptr<AbstractOperator> recreate(const std::vector<AllParameterVariant>& args = {}) const;
 
   // Get the input operators.
   std::shared_ptr<const AbstractOperator> input_left() const;
@@ -90,6 +94,20 @@ class AbstractOperator : public std::enable_shared_from_this<AbstractOperator>,
   // asynchronous execution
   virtual std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> context) = 0;
 
+  // Creates the new operator for recreate, given its already recreated input operators (nullptr if there is none).
+  virtual std::shared_ptr<AbstractOperator> _on_recreate(
+      const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+      const std::shared_ptr<AbstractOperator>& recreated_input_right) const;
+
+  // Operators of the plan that is currently recreated that might be the input of multiple operators, with their new
+  // instances. Plans rarely share operators, so this stays small and is searched linearly.
+  using RecreatedOperators = std::vector<std::pair<const AbstractOperator*, std::shared_ptr<AbstractOperator>>>;
+  std::shared_ptr<AbstractOperator> _recreate(const std::vector<AllParameterVariant>& args,
+                                              RecreatedOperators& recreated_operators) const;
+  static std::shared_ptr<AbstractOperator> _recreate_input(const std::shared_ptr<const AbstractOperator>& input,
+                                                           const std::vector<AllParameterVariant>& args,
+                                                           RecreatedOperators& recreated_operators);
+
   // method that allows operator-specific cleanups for temporary data.
   // separate from _on_execute for readability and as a reminder to
   // clean up after execution (if it makes sense)
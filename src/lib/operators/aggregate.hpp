@@ -87,13 +87,15 @@ class Aggregate : public AbstractReadOnlyOperator {
 
   const std::string name() const override;
   const std::string description(DescriptionMode description_mode) const override;
-  std::shared_ptr<AbstractOperator> recreate(const std::vector<AllParameterVariant>& args) const override;
 
   // write the aggregated output for a given aggregate column
   template <typename ColumnType, AggregateFunction function>
   void write_aggregate_output(ColumnID column_index);
 
  protected:
+  std::shared_ptr<AbstractOperator> _on_recreate(
+      const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+      const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
   std::shared_ptr<const Table> _on_execute() override;
 
   template <typename ColumnType>
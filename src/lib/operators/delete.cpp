@@ -63,6 +63,8 @@ void Delete::_on_commit_records(const CommitID cid) {
       // We do not unlock the rows so subsequent transactions properly fail when attempting to update these rows.
     }
   }
+
+  _table->update_last_modified_commit_id(cid);
 }
 
 void Delete::_finish_commit() {
@@ -122,8 +124,10 @@ bool Delete::_execution_input_valid(const std::shared_ptr<TransactionContext>& c
   return true;
 }
 
-std::shared_ptr<AbstractOperator> Delete::recreate(const std::vector<AllParameterVariant>& args) const {
-  return std::make_shared<Delete>(_table_name, _input_left->recreate(args));
+std::shared_ptr<AbstractOperator> Delete::_on_recreate(
+    const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+    const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
+  return std::make_shared<Delete>(_table_name, recreated_input_left);
 }
 
 }  // namespace opossum
@@ -21,8 +21,10 @@ Difference::Difference(const std::shared_ptr<const AbstractOperator> left_in,
 
 const std::string Difference::name() const { return "Difference"; }
 
-std::shared_ptr<AbstractOperator> Difference::recreate(const std::vector<AllParameterVariant>& args) const {
-  return std::make_shared<Difference>(_input_left->recreate(args), _input_right->recreate(args));
+std::shared_ptr<AbstractOperator> Difference::_on_recreate(
+    const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+    const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
+  return std::make_shared<Difference>(recreated_input_left, recreated_input_right);
 }
 
 std::shared_ptr<const Table> Difference::_on_execute() {
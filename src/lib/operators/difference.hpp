@@ -20,9 +20,11 @@ class Difference : public AbstractReadOnlyOperator {
              const std::shared_ptr<const AbstractOperator> right_in);
 
   const std::string name() const override;
-  std::shared_ptr<AbstractOperator> recreate(const std::vector<AllParameterVariant>& args = {}) const override;
 
  protected:
+  std::shared_ptr<AbstractOperator> _on_recreate(
+      const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+      const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
   std::shared_ptr<const Table> _on_execute() override;
 
  private:
@@ -0,0 +1,59 @@
+#include "distinct.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "set_operations/partitioned_rows.hpp"
+#include "sort/sort_output.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+Distinct::Distinct(const std::shared_ptr<const AbstractOperator> in) : AbstractReadOnlyOperator(in) {}
+
+const std::string Distinct::name() const { return "Distinct"; }
+
+std::shared_ptr<AbstractOperator> Distinct::_on_recreate(
+    const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+    const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
+  return std::make_shared<Distinct>(recreated_input_left);
+}
+
+std::shared_ptr<const Table> Distinct::_on_execute() {
+  const auto table_in = _input_table_left();
+  const auto rows = PartitionedRows(table_in);
+
+  // Find the first row of every group of equal rows, one task per partition
+  auto partition_row_ids = std::vector<PosList>(PartitionedRows::PARTITION_COUNT);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(PartitionedRows::PARTITION_COUNT);
+  for (auto partition_id = size_t{0}; partition_id < PartitionedRows::PARTITION_COUNT; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      auto row_set = PartitionedRowSet(rows);
+      for (const auto& row : rows.partition(partition_id)) {
+        if (row_set.insert(row)) partition_row_ids[partition_id].emplace_back(row.row_id);
+      }
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  // Restore the order of the input
+  auto distinct_row_ids = PosList{};
+  for (const auto& row_ids : partition_row_ids) {
+    distinct_row_ids.insert(distinct_row_ids.end(), row_ids.begin(), row_ids.end());
+  }
+  std::sort(distinct_row_ids.begin(), distinct_row_ids.end());
+
+  if (const auto output = write_reference_output(table_in, distinct_row_ids, Chunk::MAX_SIZE)) return output;
+
+  return write_materialized_output(table_in, distinct_row_ids, Chunk::MAX_SIZE);
+}
+
+}  // namespace opossum
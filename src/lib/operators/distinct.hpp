@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Operator that removes duplicate rows from its input, as needed for SELECT DISTINCT. Of every group of equal rows,
+ * the first one is kept and the order of the input is preserved. NULLs are equal to each other.
+ *
+ * The rows are hashed and partitioned in parallel (see PartitionedRows). Then, the duplicates of every partition are
+ * found with a hash set by a task of its own. The output consists of ReferenceColumns whenever the input allows it.
+ */
+class Distinct : public AbstractReadOnlyOperator {
+ public:
+  explicit Distinct(const std::shared_ptr<const AbstractOperator> in);
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<AbstractOperator> _on_recreate(
+      const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+      const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
+  std::shared_ptr<const Table> _on_execute() override;
+};
+
+}  // namespace opossum
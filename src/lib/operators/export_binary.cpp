@@ -2,13 +2,16 @@
 
 #include <cstring>
 #include <fstream>
+#include <limits>
 #include <memory>
 #include <string>
 #include <vector>
 
 #include "import_export/binary.hpp"
 #include "storage/deprecated_dictionary_column/fitted_attribute_vector.hpp"
+#include "storage/dictionary_column.hpp"
 #include "storage/reference_column.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 
 #include "constant_mappings.hpp"
 #include "resolve_type.hpp"
@@ -106,6 +109,26 @@ template <typename T>
 void _export_value(std::ofstream& ofstream, const T& value) {
   ofstream.write(reinterpret_cast<const char*>(&value), sizeof(T));
 }
+
+/* Writes the compressed attribute vector of a DictionaryColumn in the same format as a FittedAttributeVector<uintX_t>,
+ * i.e., the null value id is written as max(uintX_t).
+ */
+template <typename uintX_t>
+void _export_compressed_attribute_vector(std::ofstream& ofstream, const opossum::BaseCompressedVector& attribute_vector,
+                                         const opossum::ValueID null_value_id) {
+  auto values = std::vector<uintX_t>();
+  values.reserve(attribute_vector.size());
+
+  opossum::resolve_compressed_vector_type(attribute_vector, [&](const auto& vector) {
+    for (auto it = vector.cbegin(); it != vector.cend(); ++it) {
+      const auto value_id = static_cast<opossum::ValueID>(*it);
+      const auto is_null = (value_id == null_value_id);
+      values.push_back(is_null ? std::numeric_limits<uintX_t>::max() : static_cast<uintX_t>(value_id));
+    }
+  });
+
+  _export_values(ofstream, values);
+}
 }  // namespace
 
 namespace opossum {
@@ -240,7 +263,39 @@ void ExportBinary::ExportBinaryVisitor<T>::handle_column(const BaseDeprecatedDic
 template <typename T>
 void ExportBinary::ExportBinaryVisitor<T>::handle_column(const BaseDictionaryColumn& base_column,
                                                          std::shared_ptr<ColumnVisitableContext> base_context) {
-  Fail("Binary export not implemented yet for new version of dictionary column.");
+  auto context = std::static_pointer_cast<ExportContext>(base_context);
+  const auto& column = static_cast<const DictionaryColumn<T>&>(base_column);
+
+  // The column is written in the format of DeprecatedDictionaryColumn so that the compression of the attribute vector
+  // does not leak into the file format. The width is chosen like in the DeprecatedDictionaryEncoder.
+  const auto unique_values_count = column.unique_values_count();
+  auto attribute_vector_width = AttributeVectorWidth{4u};
+  if (unique_values_count <= std::numeric_limits<uint8_t>::max()) {
+    attribute_vector_width = 1u;
+  } else if (unique_values_count <= std::numeric_limits<uint16_t>::max()) {
+    attribute_vector_width = 2u;
+  }
+
+  _export_value(context->ofstream, BinaryColumnType::dictionary_column);
+  _export_value(context->ofstream, attribute_vector_width);
+
+  // Write the dictionary size and dictionary
+  _export_value(context->ofstream, static_cast<ValueID>(unique_values_count));
+  _export_values(context->ofstream, *column.dictionary());
+
+  const auto& attribute_vector = *column.attribute_vector();
+  switch (attribute_vector_width) {
+    case 1:
+      _export_compressed_attribute_vector<uint8_t>(context->ofstream, attribute_vector, column.null_value_id());
+      break;
+    case 2:
+      _export_compressed_attribute_vector<uint16_t>(context->ofstream, attribute_vector, column.null_value_id());
+      break;
+    case 4:
+    default:
+      _export_compressed_attribute_vector<uint32_t>(context->ofstream, attribute_vector, column.null_value_id());
+      break;
+  }
 }
 
 template <typename T>
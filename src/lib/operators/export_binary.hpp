@@ -152,6 +152,11 @@ class ExportBinary::ExportBinaryVisitor : public ColumnVisitable {
   void handle_column(const BaseDeprecatedDictionaryColumn& base_column,
                      std::shared_ptr<ColumnVisitableContext> base_context) override;
 
+  /**
+   * DictionaryColumns are dumped in the same layout as DeprecatedDictionaryColumns (see above). The compressed
+   * attribute vector is widened to the width the DeprecatedDictionaryEncoder would have chosen and the null value id
+   * is written as the largest value of that width.
+   */
   void handle_column(const BaseDictionaryColumn& base_column,
                      std::shared_ptr<ColumnVisitableContext> base_context) override;
 
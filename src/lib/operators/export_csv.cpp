@@ -10,10 +10,12 @@
 #include "json.hpp"
 #include "storage/deprecated_dictionary_column.hpp"
 #include "storage/deprecated_dictionary_column/base_attribute_vector.hpp"
+#include "storage/dictionary_column.hpp"
 #include "storage/reference_column.hpp"
 
 #include "constant_mappings.hpp"
 #include "resolve_type.hpp"
+#include "type_cast.hpp"
 
 namespace opossum {
 
@@ -122,11 +124,20 @@ class ExportCsv::ExportCsvVisitor : public ColumnVisitable {
 
   void handle_column(const BaseDictionaryColumn& base_column,
                      std::shared_ptr<ColumnVisitableContext> base_context) final {
-    Fail("CSV export not implemented yet for new version of dictionary column.");
+    handle_column(static_cast<const BaseEncodedColumn&>(base_column), base_context);
   }
 
   void handle_column(const BaseEncodedColumn& base_column, std::shared_ptr<ColumnVisitableContext> base_context) final {
-    Fail("CSV export not implemented yet for encoded columns.");
+    auto context = std::static_pointer_cast<ExportCsv::ExportCsvContext>(base_context);
+
+    const auto value = base_column[context->current_row];
+
+    if (variant_is_null(value)) {
+      // Write an empty field for a null value
+      context->csv_writer.write("");
+    } else {
+      context->csv_writer.write(type_cast<T>(value));
+    }
   }
 };
 
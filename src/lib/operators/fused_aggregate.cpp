@@ -0,0 +1,599 @@
+#include "fused_aggregate.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <map>
+#include <memory>
+#include <numeric>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "constant_mappings.hpp"
+#include "operators/pqp_expression.hpp"
+#include "operators/projection/expression_evaluator.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/chunk.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto BLOCK_SIZE = ExpressionEvaluator::BLOCK_SIZE;
+
+// The type in which an aggregate function accumulates values of type T, as in the Aggregate
+template <typename T, AggregateFunction function>
+using AggregateDataType = std::conditional_t<
+    function == AggregateFunction::Count, int64_t,
+    std::conditional_t<function == AggregateFunction::Min || function == AggregateFunction::Max, T,
+                       std::conditional_t<std::is_integral_v<T>, int64_t, double>>>;
+
+DataType aggregate_data_type(const DataType argument_data_type, const AggregateFunction function) {
+  switch (function) {
+    case AggregateFunction::Min:
+    case AggregateFunction::Max:
+      return argument_data_type;
+    case AggregateFunction::Sum:
+      return argument_data_type == DataType::Int || argument_data_type == DataType::Long ? DataType::Long
+                                                                                          : DataType::Double;
+    case AggregateFunction::Avg:
+      return DataType::Double;
+    case AggregateFunction::Count:
+      return DataType::Long;
+    case AggregateFunction::CountDistinct:
+      break;
+  }
+  Fail("FusedAggregate does not support COUNT(DISTINCT)");
+}
+
+// Converts the literals that are compared to columns into the data types of the columns, as the TableScan does, so
+// that, e.g., a float column is compared to 0.07f and not to the double 0.07
+std::shared_ptr<PQPExpression> cast_literals_to_column_types(const std::shared_ptr<PQPExpression>& expression,
+                                                             const Table& table) {
+  switch (expression->type()) {
+    case ExpressionType::And:
+    case ExpressionType::Or:
+      return PQPExpression::create_binary_operator(
+          expression->type(), cast_literals_to_column_types(expression->left_child(), table),
+          cast_literals_to_column_types(expression->right_child(), table), expression->alias());
+    case ExpressionType::Not:
+      return PQPExpression::create_unary_operator(
+          expression->type(), cast_literals_to_column_types(expression->left_child(), table), expression->alias());
+    default:
+      break;
+  }
+
+  if (!expression->is_binary_operator() || expression->is_arithmetic_operator()) return expression;
+
+  const auto& left = expression->left_child();
+  const auto& right = expression->right_child();
+  const auto cast_literal = [&](const PQPExpression& column, const PQPExpression& literal) {
+    auto value = literal.value();
+    resolve_data_type(table.column_type(column.column_id()),
+                      [&](auto type) { value = type_cast<typename decltype(type)::type>(literal.value()); });
+    return PQPExpression::create_literal(value);
+  };
+  const auto is_literal = [](const PQPExpression& operand) {
+    return operand.type() == ExpressionType::Literal && !variant_is_null(operand.value());
+  };
+
+  if (left->type() == ExpressionType::Column && is_literal(*right)) {
+    return PQPExpression::create_binary_operator(expression->type(), left, cast_literal(*left, *right),
+                                                 expression->alias());
+  }
+  if (is_literal(*left) && right->type() == ExpressionType::Column) {
+    return PQPExpression::create_binary_operator(expression->type(), cast_literal(*right, *left), right,
+                                                 expression->alias());
+  }
+  return expression;
+}
+
+}  // namespace
+
+class FusedAggregate::BaseGroupByColumn {
+ public:
+  virtual ~BaseGroupByColumn() = default;
+
+  // Maps the values of the selected rows of the block to ids, which are dense per column and chunk
+  virtual void map_block(ExpressionEvaluator& evaluator, const ChunkOffset begin, const size_t row_count,
+                         const std::vector<ChunkOffset>& selected_rows, std::vector<uint32_t>& value_ids) = 0;
+
+  virtual size_t value_count() const = 0;
+  virtual const AllTypeVariant& value(const uint32_t value_id) const = 0;
+};
+
+template <typename T>
+class FusedAggregate::GroupByColumn : public FusedAggregate::BaseGroupByColumn {
+ public:
+  explicit GroupByColumn(const ColumnID column_id) : _expression(PQPExpression::create_column(column_id)) {}
+
+  void map_block(ExpressionEvaluator& evaluator, const ChunkOffset begin, const size_t row_count,
+                 const std::vector<ChunkOffset>& selected_rows, std::vector<uint32_t>& value_ids) override {
+    auto values = std::vector<T>(row_count);
+    auto null_values = std::make_unique<bool[]>(row_count);
+    evaluator.evaluate_block(*_expression, begin, row_count, values.data(), null_values.get());
+
+    for (auto index = size_t{0}; index < selected_rows.size(); ++index) {
+      const auto row = selected_rows[index];
+
+      if (null_values[row]) {
+        if (!_null_value_id) {
+          _null_value_id = static_cast<uint32_t>(_values.size());
+          _values.emplace_back(NULL_VALUE);
+        }
+        value_ids[index] = *_null_value_id;
+        continue;
+      }
+
+      const auto value_id_it = _value_ids.try_emplace(values[row], static_cast<uint32_t>(_values.size())).first;
+      if (value_id_it->second == _values.size()) _values.emplace_back(values[row]);
+      value_ids[index] = value_id_it->second;
+    }
+  }
+
+  size_t value_count() const override { return _values.size(); }
+
+  const AllTypeVariant& value(const uint32_t value_id) const override { return _values[value_id]; }
+
+ protected:
+  const std::shared_ptr<PQPExpression> _expression;
+  std::unordered_map<T, uint32_t> _value_ids;
+  std::optional<uint32_t> _null_value_id;
+  std::vector<AllTypeVariant> _values;
+};
+
+class FusedAggregate::BaseAccumulator {
+ public:
+  virtual ~BaseAccumulator() = default;
+
+  // Adds the values of the selected rows of the block to the aggregates of their groups
+  virtual void aggregate_block(ExpressionEvaluator& evaluator, const ChunkOffset begin, const size_t row_count,
+                               const std::vector<ChunkOffset>& selected_rows, const std::vector<uint32_t>& group_ids,
+                               const size_t group_count) = 0;
+
+  // Adds the aggregates of another accumulator of the same type to those of the groups its groups are mapped to
+  virtual void merge(const BaseAccumulator& other, const std::vector<size_t>& group_mapping,
+                     const size_t group_count) = 0;
+
+  // Writes the results of the groups in the given order
+  virtual std::shared_ptr<BaseColumn> write_column(const std::vector<size_t>& group_order) const = 0;
+};
+
+template <typename T, AggregateFunction function>
+class FusedAggregate::Accumulator : public FusedAggregate::BaseAccumulator {
+ public:
+  using AggregateType = AggregateDataType<T, function>;
+  // AVG accumulates the sum, but its result is a double, as in the Aggregate
+  using ResultType = std::conditional_t<function == AggregateFunction::Avg, double, AggregateType>;
+
+  // The argument is nullptr for COUNT(*)
+  explicit Accumulator(const std::shared_ptr<PQPExpression>& argument) : _argument(argument) {}
+
+  void aggregate_block(ExpressionEvaluator& evaluator, const ChunkOffset begin, const size_t row_count,
+                       const std::vector<ChunkOffset>& selected_rows, const std::vector<uint32_t>& group_ids,
+                       const size_t group_count) override {
+    _resize(group_count);
+
+    if (!_argument) {
+      for (const auto group_id : group_ids) {
+        ++_counts[group_id];
+      }
+      return;
+    }
+
+    auto values = std::vector<T>(row_count);
+    auto null_values = std::make_unique<bool[]>(row_count);
+    evaluator.evaluate_block(*_argument, begin, row_count, values.data(), null_values.get());
+
+    // As in the Aggregate, NULLs are ignored
+    for (auto index = size_t{0}; index < selected_rows.size(); ++index) {
+      const auto row = selected_rows[index];
+      if (null_values[row]) continue;
+
+      if constexpr (function == AggregateFunction::Count) {
+        ++_counts[group_ids[index]];
+      } else {
+        _add(group_ids[index], values[row], 1);
+      }
+    }
+  }
+
+  void merge(const BaseAccumulator& other, const std::vector<size_t>& group_mapping,
+             const size_t group_count) override {
+    const auto& other_accumulator = static_cast<const Accumulator<T, function>&>(other);
+    _resize(group_count);
+
+    for (auto group_id = size_t{0}; group_id < group_mapping.size(); ++group_id) {
+      const auto count = other_accumulator._counts[group_id];
+      if (count == 0) continue;
+
+      if constexpr (function == AggregateFunction::Count) {
+        _counts[group_mapping[group_id]] += count;
+      } else {
+        _add(group_mapping[group_id], other_accumulator._aggregates[group_id], count);
+      }
+    }
+  }
+
+  std::shared_ptr<BaseColumn> write_column(const std::vector<size_t>& group_order) const override {
+    auto values = pmr_concurrent_vector<ResultType>(group_order.size());
+
+    if constexpr (function == AggregateFunction::Count) {
+      for (auto row = size_t{0}; row < group_order.size(); ++row) {
+        values[row] = _counts[group_order[row]];
+      }
+      return std::make_shared<ValueColumn<ResultType>>(std::move(values));
+    } else {
+      // The aggregate of a group without values is NULL
+      auto null_values = pmr_concurrent_vector<bool>(group_order.size());
+      for (auto row = size_t{0}; row < group_order.size(); ++row) {
+        const auto group_id = group_order[row];
+        if (_counts[group_id] == 0) {
+          null_values[row] = true;
+        } else if constexpr (function == AggregateFunction::Avg) {
+          values[row] = static_cast<double>(_aggregates[group_id]) / static_cast<double>(_counts[group_id]);
+        } else {
+          values[row] = _aggregates[group_id];
+        }
+      }
+      return std::make_shared<ValueColumn<ResultType>>(std::move(values), std::move(null_values));
+    }
+  }
+
+ protected:
+  void _resize(const size_t group_count) {
+    if (_counts.size() >= group_count) return;
+    _counts.resize(group_count);
+    if constexpr (function != AggregateFunction::Count) _aggregates.resize(group_count);
+  }
+
+  // Adds the aggregate of count values to the aggregate of the group
+  void _add(const size_t group_id, const AggregateType& aggregate, const int64_t count) {
+    if constexpr (function == AggregateFunction::Min) {
+      if (_counts[group_id] == 0 || aggregate < _aggregates[group_id]) _aggregates[group_id] = aggregate;
+    } else if constexpr (function == AggregateFunction::Max) {
+      if (_counts[group_id] == 0 || aggregate > _aggregates[group_id]) _aggregates[group_id] = aggregate;
+    } else {
+      _aggregates[group_id] += aggregate;
+    }
+    _counts[group_id] += count;
+  }
+
+  const std::shared_ptr<PQPExpression> _argument;
+
+  // The number of values of every group and, except for COUNT, their aggregate
+  std::vector<int64_t> _counts;
+  std::vector<AggregateType> _aggregates;
+};
+
+FusedAggregate::FusedAggregate(const std::shared_ptr<const AbstractOperator> in,
+                               const std::shared_ptr<PQPExpression>& predicate,
+                               const std::vector<FusedAggregateColumnDefinition>& aggregates,
+                               const std::vector<ColumnID>& groupby_column_ids)
+    : AbstractReadOnlyOperator(in),
+      _predicate(predicate),
+      _aggregates(aggregates),
+      _groupby_column_ids(groupby_column_ids) {
+  Assert(!(aggregates.empty() && groupby_column_ids.empty()),
+         "Neither aggregate nor groupby columns have been specified");
+
+  for (const auto& aggregate : _aggregates) {
+    Assert(aggregate.column || aggregate.function == AggregateFunction::Count,
+           "FusedAggregate: Asterisk is only valid with COUNT");
+    Assert(aggregate.function != AggregateFunction::CountDistinct, "FusedAggregate does not support COUNT(DISTINCT)");
+  }
+}
+
+const std::shared_ptr<PQPExpression>& FusedAggregate::predicate() const { return _predicate; }
+
+const std::vector<FusedAggregateColumnDefinition>& FusedAggregate::aggregates() const { return _aggregates; }
+
+const std::vector<ColumnID>& FusedAggregate::groupby_column_ids() const { return _groupby_column_ids; }
+
+const std::string FusedAggregate::name() const { return "FusedAggregate"; }
+
+const std::string FusedAggregate::description(DescriptionMode description_mode) const {
+  std::stringstream desc;
+  desc << "[FusedAggregate] Predicate: " << (_predicate ? _predicate->to_string() : "-");
+
+  desc << " GroupBy ColumnIDs: ";
+  for (size_t groupby_column_idx = 0; groupby_column_idx < _groupby_column_ids.size(); ++groupby_column_idx) {
+    desc << _groupby_column_ids[groupby_column_idx];
+    if (groupby_column_idx + 1 < _groupby_column_ids.size()) desc << ", ";
+  }
+
+  desc << " Aggregates: ";
+  for (size_t aggregate_idx = 0; aggregate_idx < _aggregates.size(); ++aggregate_idx) {
+    const auto& aggregate = _aggregates[aggregate_idx];
+    desc << aggregate_function_to_string.left.at(aggregate.function) << "("
+         << (aggregate.column ? (*aggregate.column)->to_string() : "*") << ")";
+    if (aggregate.alias) desc << " AS " << *aggregate.alias;
+    if (aggregate_idx + 1 < _aggregates.size()) desc << ", ";
+  }
+  return desc.str();
+}
+
+std::shared_ptr<AbstractOperator> FusedAggregate::_on_recreate(
+    const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+    const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
+  return std::make_shared<FusedAggregate>(recreated_input_left, _predicate, _aggregates, _groupby_column_ids);
+}
+
+std::shared_ptr<const Table> FusedAggregate::_on_execute() {
+  const auto input_table = _input_table_left();
+
+  auto predicate = std::shared_ptr<PQPExpression>{};
+  if (_predicate) {
+    const auto predicate_data_type = ExpressionEvaluator::data_type_of(*_predicate, *input_table);
+    Assert(predicate_data_type == DataType::Int || predicate_data_type == DataType::Null,
+           "The predicate of the FusedAggregate has to return an int");
+    predicate = cast_literals_to_column_types(_predicate, *input_table);
+  }
+  for (const auto& aggregate : _aggregates) {
+    Assert(_argument_data_type(aggregate) != DataType::String ||
+               (aggregate.function != AggregateFunction::Sum && aggregate.function != AggregateFunction::Avg),
+           "FusedAggregate: Cannot calculate SUM or AVG on strings");
+  }
+
+  // 1. Aggregate every chunk in a task of its own
+  const auto chunk_count = input_table->chunk_count();
+  auto chunk_results = std::vector<ChunkResult>(chunk_count);
+
+  // Exceptions (e.g., on a division by zero) must not escape on the worker threads of the scheduler. They are
+  // rethrown once all tasks are done.
+  auto exceptions = std::vector<std::exception_ptr>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      try {
+        _process_chunk(chunk_id, predicate, chunk_results[chunk_id]);
+      } catch (...) {
+        exceptions[chunk_id] = std::current_exception();
+      }
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  for (const auto& exception : exceptions) {
+    if (exception) std::rethrow_exception(exception);
+  }
+
+  // 2. Merge the groups of all chunks. The groups are ordered by their group-by values like those of the Aggregate.
+  auto groups = std::map<AggregateKey, size_t>{};
+
+  auto accumulators = std::vector<std::shared_ptr<BaseAccumulator>>{};
+  for (const auto& aggregate : _aggregates) {
+    accumulators.emplace_back(_create_accumulator(aggregate));
+  }
+
+  for (auto& chunk_result : chunk_results) {
+    auto group_mapping = std::vector<size_t>(chunk_result.group_count);
+
+    for (auto group_id = size_t{0}; group_id < chunk_result.group_count; ++group_id) {
+      // Collect the group-by values of the group, starting with those of the last column
+      auto key = AggregateKey(_groupby_column_ids.size());
+      auto previous_group_id = static_cast<uint32_t>(group_id);
+      for (auto column_index = key.size(); column_index > 1; --column_index) {
+        const auto& [origin_group_id, value_id] = chunk_result.group_origins[column_index - 2][previous_group_id];
+        key[column_index - 1] = chunk_result.groupby_columns[column_index - 1]->value(value_id);
+        previous_group_id = origin_group_id;
+      }
+      if (!key.empty()) key[0] = chunk_result.groupby_columns[0]->value(previous_group_id);
+
+      group_mapping[group_id] = groups.try_emplace(std::move(key), groups.size()).first->second;
+    }
+
+    for (auto aggregate_index = size_t{0}; aggregate_index < _aggregates.size(); ++aggregate_index) {
+      accumulators[aggregate_index]->merge(*chunk_result.accumulators[aggregate_index], group_mapping, groups.size());
+    }
+
+    chunk_result = ChunkResult{};
+  }
+
+  auto group_order = std::vector<size_t>{};
+  group_order.reserve(groups.size());
+  for (const auto& group : groups) {
+    group_order.emplace_back(group.second);
+  }
+
+  // 3. Write the output, the group-by columns followed by the aggregates
+  auto output = std::make_shared<Table>();
+  auto chunk_out = std::make_shared<Chunk>();
+
+  for (auto column_index = size_t{0}; column_index < _groupby_column_ids.size(); ++column_index) {
+    const auto column_id = _groupby_column_ids[column_index];
+    const auto data_type = input_table->column_type(column_id);
+    output->add_column_definition(input_table->column_name(column_id), data_type, true);
+
+    resolve_data_type(data_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      auto values = pmr_concurrent_vector<ColumnDataType>(groups.size());
+      auto null_values = pmr_concurrent_vector<bool>(groups.size());
+      auto row = size_t{0};
+      for (const auto& group : groups) {
+        const auto& value = group.first[column_index];
+        if (variant_is_null(value)) {
+          null_values[row] = true;
+        } else {
+          values[row] = boost::get<ColumnDataType>(value);
+        }
+        ++row;
+      }
+      chunk_out->add_column(std::make_shared<ValueColumn<ColumnDataType>>(std::move(values), std::move(null_values)));
+    });
+  }
+
+  for (auto aggregate_index = size_t{0}; aggregate_index < _aggregates.size(); ++aggregate_index) {
+    const auto& aggregate = _aggregates[aggregate_index];
+
+    // Use the alias or generate the name like the Aggregate does for the columns written by a Projection
+    auto column_name = std::string{};
+    if (aggregate.alias) {
+      column_name = *aggregate.alias;
+    } else if (!aggregate.column) {
+      column_name = "COUNT(*)";
+    } else {
+      const auto& argument = **aggregate.column;
+      auto argument_name = std::string{};
+      if (argument.type() == ExpressionType::Column) {
+        argument_name = input_table->column_name(argument.column_id());
+      } else {
+        argument_name = argument.alias() ? *argument.alias() : argument.to_string(input_table->column_names());
+      }
+      column_name = aggregate_function_to_string.left.at(aggregate.function) + "(" + argument_name + ")";
+    }
+
+    const auto data_type = aggregate_data_type(_argument_data_type(aggregate), aggregate.function);
+    output->add_column_definition(column_name, data_type, aggregate.function != AggregateFunction::Count);
+    chunk_out->add_column(accumulators[aggregate_index]->write_column(group_order));
+  }
+
+  output->emplace_chunk(std::move(chunk_out));
+  return output;
+}
+
+void FusedAggregate::_process_chunk(const ChunkID chunk_id, const std::shared_ptr<PQPExpression>& predicate,
+                                    ChunkResult& result) const {
+  const auto input_table = _input_table_left();
+  const auto row_count = static_cast<size_t>(input_table->get_chunk(chunk_id)->size());
+  auto evaluator = ExpressionEvaluator{input_table, chunk_id};
+
+  for (const auto column_id : _groupby_column_ids) {
+    resolve_data_type(input_table->column_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      result.groupby_columns.emplace_back(std::make_shared<GroupByColumn<ColumnDataType>>(column_id));
+    });
+  }
+  for (const auto& aggregate : _aggregates) {
+    result.accumulators.emplace_back(_create_accumulator(aggregate));
+  }
+
+  // Groups of more than one column are identified by the group of the previous columns and the value id of the last
+  // column, which are mapped to dense group ids column by column
+  const auto origin_count = _groupby_column_ids.empty() ? size_t{0} : _groupby_column_ids.size() - 1;
+  result.group_origins.resize(origin_count);
+  auto group_ids_by_origin = std::vector<std::unordered_map<uint64_t, uint32_t>>(origin_count);
+
+  auto predicate_values = std::vector<int32_t>(BLOCK_SIZE);
+  auto predicate_null_values = std::make_unique<bool[]>(BLOCK_SIZE);
+  auto selected_rows = std::vector<ChunkOffset>{};
+  selected_rows.reserve(BLOCK_SIZE);
+  auto group_ids = std::vector<uint32_t>{};
+  auto value_ids = std::vector<uint32_t>{};
+
+  for (auto begin = size_t{0}; begin < row_count; begin += BLOCK_SIZE) {
+    const auto block_begin = static_cast<ChunkOffset>(begin);
+    const auto block_row_count = std::min(BLOCK_SIZE, row_count - begin);
+
+    // 1. Select the rows of the block that satisfy the predicate, i.e., for which it is neither false nor NULL
+    selected_rows.resize(block_row_count);
+    std::iota(selected_rows.begin(), selected_rows.end(), ChunkOffset{0});
+
+    if (predicate) {
+      evaluator.evaluate_block(*predicate, block_begin, block_row_count, predicate_values.data(),
+                               predicate_null_values.get());
+      const auto selected_rows_end =
+          std::remove_if(selected_rows.begin(), selected_rows.end(),
+                         [&](const ChunkOffset row) { return !predicate_values[row] || predicate_null_values[row]; });
+      selected_rows.erase(selected_rows_end, selected_rows.end());
+    }
+
+    if (selected_rows.empty()) continue;
+
+    // 2. Find the groups of the selected rows
+    group_ids.assign(selected_rows.size(), 0);
+
+    if (_groupby_column_ids.empty()) {
+      result.group_count = 1;
+    } else {
+      result.groupby_columns[0]->map_block(evaluator, block_begin, block_row_count, selected_rows, group_ids);
+      result.group_count = result.groupby_columns[0]->value_count();
+
+      value_ids.resize(selected_rows.size());
+      for (auto column_index = size_t{1}; column_index < _groupby_column_ids.size(); ++column_index) {
+        result.groupby_columns[column_index]->map_block(evaluator, block_begin, block_row_count, selected_rows,
+                                                        value_ids);
+
+        auto& origins = result.group_origins[column_index - 1];
+        auto& group_ids_of_origins = group_ids_by_origin[column_index - 1];
+        for (auto index = size_t{0}; index < selected_rows.size(); ++index) {
+          const auto origin = (static_cast<uint64_t>(group_ids[index]) << 32) | value_ids[index];
+          const auto group_id_it =
+              group_ids_of_origins.try_emplace(origin, static_cast<uint32_t>(origins.size())).first;
+          if (group_id_it->second == origins.size()) origins.emplace_back(group_ids[index], value_ids[index]);
+          group_ids[index] = group_id_it->second;
+        }
+        result.group_count = origins.size();
+      }
+    }
+
+    // 3. Aggregate the values of the selected rows
+    for (const auto& accumulator : result.accumulators) {
+      accumulator->aggregate_block(evaluator, block_begin, block_row_count, selected_rows, group_ids,
+                                   result.group_count);
+    }
+  }
+}
+
+std::shared_ptr<FusedAggregate::BaseAccumulator> FusedAggregate::_create_accumulator(
+    const FusedAggregateColumnDefinition& aggregate) const {
+  const auto argument = aggregate.column.value_or(nullptr);
+  auto accumulator = std::shared_ptr<BaseAccumulator>{};
+
+  resolve_data_type(_argument_data_type(aggregate), [&](auto type) {
+    using ArgumentDataType = typename decltype(type)::type;
+
+    switch (aggregate.function) {
+      case AggregateFunction::Min:
+        accumulator = std::make_shared<Accumulator<ArgumentDataType, AggregateFunction::Min>>(argument);
+        break;
+      case AggregateFunction::Max:
+        accumulator = std::make_shared<Accumulator<ArgumentDataType, AggregateFunction::Max>>(argument);
+        break;
+      case AggregateFunction::Count:
+        accumulator = std::make_shared<Accumulator<ArgumentDataType, AggregateFunction::Count>>(argument);
+        break;
+      case AggregateFunction::Sum:
+      case AggregateFunction::Avg:
+        if constexpr (std::is_arithmetic_v<ArgumentDataType>) {
+          if (aggregate.function == AggregateFunction::Sum) {
+            accumulator = std::make_shared<Accumulator<ArgumentDataType, AggregateFunction::Sum>>(argument);
+          } else {
+            accumulator = std::make_shared<Accumulator<ArgumentDataType, AggregateFunction::Avg>>(argument);
+          }
+        } else {
+          Fail("FusedAggregate: Cannot calculate SUM or AVG on strings");
+        }
+        break;
+      case AggregateFunction::CountDistinct:
+        Fail("FusedAggregate does not support COUNT(DISTINCT)");
+    }
+  });
+
+  return accumulator;
+}
+
+DataType FusedAggregate::_argument_data_type(const FusedAggregateColumnDefinition& aggregate) const {
+  if (!aggregate.column) return DataType::Int;
+
+  // NULL arguments are aggregated like an int column that only contains NULLs, as the Projection would create one
+  const auto data_type = ExpressionEvaluator::data_type_of(**aggregate.column, *_input_table_left());
+  return data_type == DataType::Null ? DataType::Int : data_type;
+}
+
+}  // namespace opossum
@@ -0,0 +1,92 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "aggregate.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class PQPExpression;
+
+using FusedAggregateColumnDefinition = AggregateColumnDefinitionTemplate<std::shared_ptr<PQPExpression>>;
+
+/**
+ * Executes a pipeline of scans, the arithmetic of the aggregate arguments, and an aggregate, e.g., that of TPC-H Q1
+ * or Q6, in a single pass over the input. The results are the same as those of TableScans, a Projection, and an
+ * Aggregate, but no intermediate position lists or columns are written and no column is visited row by row.
+ *
+ * Every chunk is processed by a task of its own, in blocks of ExpressionEvaluator::BLOCK_SIZE rows:
+ *  1. The predicate, e.g., a conjunction of comparisons, is evaluated for all rows of the block and the rows that
+ *     qualify are collected.
+ *  2. The group-by values of these rows are mapped to dense group ids, column by column.
+ *  3. The arguments of the aggregates are evaluated and the values of the qualifying rows are added to the
+ *     aggregates of their groups, in a loop that is specialized for the data type and the aggregate function.
+ * Finally, the groups of all chunks are merged.
+ *
+ * The aggregates are defined like those of the Aggregate, but by an expression on the input instead of a column.
+ * Literals compared to columns in the predicate are converted to the data types of the columns like in the TableScan.
+ * As in the Aggregate, the output is ordered by the group-by values and does not contain rows if no input row
+ * qualifies. COUNT(DISTINCT) is not supported.
+ *
+ * The LQPTranslator creates FusedAggregates for the AggregateNodes marked by the PipelineFusionRule.
+ */
+class FusedAggregate : public AbstractReadOnlyOperator {
+ public:
+  // The predicate can be nullptr if all rows qualify
+  FusedAggregate(const std::shared_ptr<const AbstractOperator> in, const std::shared_ptr<PQPExpression>& predicate,
+                 const std::vector<FusedAggregateColumnDefinition>& aggregates,
+                 const std::vector<ColumnID>& groupby_column_ids);
+
+  const std::shared_ptr<PQPExpression>& predicate() const;
+  const std::vector<FusedAggregateColumnDefinition>& aggregates() const;
+  const std::vector<ColumnID>& groupby_column_ids() const;
+
+  const std::string name() const override;
+  const std::string description(DescriptionMode description_mode) const override;
+
+ protected:
+  class BaseGroupByColumn;
+
+  template <typename T>
+  class GroupByColumn;
+
+  class BaseAccumulator;
+
+  template <typename T, AggregateFunction function>
+  class Accumulator;
+
+  // The groups and aggregates found by the task of one chunk
+  struct ChunkResult {
+    std::vector<std::shared_ptr<BaseGroupByColumn>> groupby_columns;
+    std::vector<std::shared_ptr<BaseAccumulator>> accumulators;
+    size_t group_count = 0;
+
+    // For every group-by column but the first, the group of the previous columns and the value id of this column
+    // that every group was created from
+    std::vector<std::vector<std::pair<uint32_t, uint32_t>>> group_origins;
+  };
+
+  std::shared_ptr<AbstractOperator> _on_recreate(
+      const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+      const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
+  std::shared_ptr<const Table> _on_execute() override;
+
+  void _process_chunk(const ChunkID chunk_id, const std::shared_ptr<PQPExpression>& predicate,
+                      ChunkResult& result) const;
+
+  std::shared_ptr<BaseAccumulator> _create_accumulator(const FusedAggregateColumnDefinition& aggregate) const;
+
+  // The data type of the argument of an aggregate, DataType::Int for COUNT(*) and NULL arguments
+  DataType _argument_data_type(const FusedAggregateColumnDefinition& aggregate) const;
+
+  const std::shared_ptr<PQPExpression> _predicate;
+  const std::vector<FusedAggregateColumnDefinition> _aggregates;
+  const std::vector<ColumnID> _groupby_column_ids;
+};
+
+}  // namespace opossum
@@ -18,9 +18,10 @@ class GetTable : public AbstractReadOnlyOperator {
 
   const std::string& table_name() const;
 
-  std::shared_ptr<AbstractOperator> recreate(const std::vector<AllParameterVariant>& args = {}) const override;
-
  protected:
+  std::shared_ptr<AbstractOperator> _on_recreate(
+      const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+      const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
   std::shared_ptr<const Table> _on_execute() override;
 
   // name of the table to retrieve
@@ -0,0 +1,121 @@
+#include "hash_set_operation.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "constant_mappings.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "set_operations/partitioned_rows.hpp"
+#include "sort/sort_output.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Concatenates the rows found in the partitions and restores the order of the input
+PosList merge_partitions(const std::vector<PosList>& partition_row_ids) {
+  auto row_ids = PosList{};
+  for (const auto& partition : partition_row_ids) {
+    row_ids.insert(row_ids.end(), partition.begin(), partition.end());
+  }
+  std::sort(row_ids.begin(), row_ids.end());
+  return row_ids;
+}
+
+std::shared_ptr<Table> write_output(const std::shared_ptr<const Table>& table_in, const PosList& row_ids) {
+  if (const auto output = write_reference_output(table_in, row_ids, Chunk::MAX_SIZE)) return output;
+
+  return write_materialized_output(table_in, row_ids, Chunk::MAX_SIZE);
+}
+
+}  // namespace
+
+HashSetOperation::HashSetOperation(const std::shared_ptr<const AbstractOperator> left_in,
+                                   const std::shared_ptr<const AbstractOperator> right_in,
+                                   const SetOperationMode mode)
+    : AbstractReadOnlyOperator(left_in, right_in), _mode(mode) {}
+
+SetOperationMode HashSetOperation::mode() const { return _mode; }
+
+const std::string HashSetOperation::name() const { return "HashSetOperation"; }
+
+const std::string HashSetOperation::description(DescriptionMode description_mode) const {
+  const auto separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+  return name() + separator + "(" + set_operation_mode_to_string.at(_mode) + ")";
+}
+
+std::shared_ptr<AbstractOperator> HashSetOperation::_on_recreate(
+    const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+    const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
+  return std::make_shared<HashSetOperation>(recreated_input_left, recreated_input_right, _mode);
+}
+
+std::shared_ptr<const Table> HashSetOperation::_on_execute() {
+  const auto left_in = _input_table_left();
+  const auto right_in = _input_table_right();
+
+  Assert(left_in->column_types() == right_in->column_types(), "Inputs of set operations need the same column types");
+
+  const auto left_rows = PartitionedRows(left_in);
+  const auto right_rows = PartitionedRows(right_in);
+
+  // 1. Find the output rows of every partition in a task of its own
+  auto left_partition_row_ids = std::vector<PosList>(PartitionedRows::PARTITION_COUNT);
+  auto right_partition_row_ids = std::vector<PosList>(PartitionedRows::PARTITION_COUNT);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(PartitionedRows::PARTITION_COUNT);
+  for (auto partition_id = size_t{0}; partition_id < PartitionedRows::PARTITION_COUNT; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      auto right_row_set = PartitionedRowSet(right_rows);
+      auto distinct_right_rows = std::vector<PartitionedRows::Row>{};
+      for (const auto& row : right_rows.partition(partition_id)) {
+        if (right_row_set.insert(row)) distinct_right_rows.emplace_back(row);
+      }
+
+      auto left_row_set = PartitionedRowSet(left_rows);
+      for (const auto& row : left_rows.partition(partition_id)) {
+        if (!left_row_set.insert(row)) continue;
+
+        if (_mode == SetOperationMode::Union ||
+            (_mode == SetOperationMode::Intersect) == right_row_set.contains(left_rows, row)) {
+          left_partition_row_ids[partition_id].emplace_back(row.row_id);
+        }
+      }
+
+      if (_mode == SetOperationMode::Union) {
+        for (const auto& row : distinct_right_rows) {
+          if (!left_row_set.contains(right_rows, row)) right_partition_row_ids[partition_id].emplace_back(row.row_id);
+        }
+      }
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  // 2. Write the output. Its columns are nullable if the columns of either input are.
+  auto output = std::make_shared<Table>();
+  for (ColumnID column_id{0}; column_id < left_in->column_count(); ++column_id) {
+    const auto nullable = left_in->column_is_nullable(column_id) ||
+                          (_mode == SetOperationMode::Union && right_in->column_is_nullable(column_id));
+    output->add_column_definition(left_in->column_name(column_id), left_in->column_type(column_id), nullable);
+  }
+
+  const auto left_output = write_output(left_in, merge_partitions(left_partition_row_ids));
+  const auto right_output = write_output(right_in, merge_partitions(right_partition_row_ids));
+  for (const auto& partial_output : {left_output, right_output}) {
+    for (ChunkID chunk_id{0}; chunk_id < partial_output->chunk_count(); ++chunk_id) {
+      if (partial_output->get_chunk(chunk_id)->size() > 0) output->emplace_chunk(partial_output->get_chunk(chunk_id));
+    }
+  }
+
+  return output;
+}
+
+}  // namespace opossum
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Operator for the set operations UNION, INTERSECT, and EXCEPT over full rows, with set semantics:
+ *  - Union returns the distinct rows of both inputs, first those of the left input, then those only found in the
+ *    right input.
+ *  - Intersect returns the distinct rows of the left input that are also found in the right input.
+ *  - Except returns the distinct rows of the left input that are not found in the right input.
+ * Both inputs need to have the same column types. Rows are compared value by value, with NULLs being equal to each
+ * other. Unlike UnionPositions and Difference, the rows do not need to come from the same table.
+ *
+ * Like Distinct, the rows of both inputs are hashed and partitioned in parallel (see PartitionedRows). Every partition
+ * is then processed by a task of its own, which builds a hash set of the rows of the partition of the right input and
+ * probes it with the rows of the partition of the left input. The rows of each input keep their order in the output.
+ */
+class HashSetOperation : public AbstractReadOnlyOperator {
+ public:
+  HashSetOperation(const std::shared_ptr<const AbstractOperator> left_in,
+                   const std::shared_ptr<const AbstractOperator> right_in, const SetOperationMode mode);
+
+  SetOperationMode mode() const;
+
+  const std::string name() const override;
+  const std::string description(DescriptionMode description_mode) const override;
+
+ protected:
+  std::shared_ptr<AbstractOperator> _on_recreate(
+      const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+      const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const SetOperationMode _mode;
+};
+
+}  // namespace opossum
@@ -2,8 +2,10 @@
 
 #include <boost/hana/for_each.hpp>
 
+#include <algorithm>
 #include <cstdint>
 #include <fstream>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <optional>
@@ -15,8 +17,8 @@
 #include "import_export/binary.hpp"
 #include "resolve_type.hpp"
 #include "storage/chunk.hpp"
-#include "storage/deprecated_dictionary_column/fitted_attribute_vector.hpp"
 #include "storage/storage_manager.hpp"
+#include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -154,20 +156,32 @@ std::shared_ptr<BaseColumn> ImportBinary::_import_column(std::ifstream& file, Ch
   }
 }
 
-std::shared_ptr<BaseAttributeVector> ImportBinary::_import_attribute_vector(
-    std::ifstream& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width) {
+std::shared_ptr<BaseCompressedVector> ImportBinary::_import_attribute_vector(
+    std::ifstream& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width, ValueID null_value_id) {
   switch (attribute_vector_width) {
     case 1:
-      return std::make_shared<FittedAttributeVector<uint8_t>>(_read_values<uint8_t>(file, row_count));
+      return _import_fixed_size_byte_aligned_vector<uint8_t>(file, row_count, null_value_id);
     case 2:
-      return std::make_shared<FittedAttributeVector<uint16_t>>(_read_values<uint16_t>(file, row_count));
+      return _import_fixed_size_byte_aligned_vector<uint16_t>(file, row_count, null_value_id);
     case 4:
-      return std::make_shared<FittedAttributeVector<uint32_t>>(_read_values<uint32_t>(file, row_count));
+      return _import_fixed_size_byte_aligned_vector<uint32_t>(file, row_count, null_value_id);
     default:
       Fail("Cannot import attribute vector with width: " + std::to_string(attribute_vector_width));
   }
 }
 
+template <typename uintX_t>
+std::shared_ptr<BaseCompressedVector> ImportBinary::_import_fixed_size_byte_aligned_vector(std::ifstream& file,
+                                                                                         ChunkOffset row_count,
+                                                                                         ValueID null_value_id) {
+  auto values = _read_values<uintX_t>(file, row_count);
+
+  // NULL values are stored as max(uintX_t) in the file, while the DictionaryColumn uses the dictionary size
+  std::replace(values.begin(), values.end(), std::numeric_limits<uintX_t>::max(), static_cast<uintX_t>(null_value_id));
+
+  return std::make_shared<FixedSizeByteAlignedVector<uintX_t>>(std::move(values));
+}
+
 template <typename T>
 std::shared_ptr<ValueColumn<T>> ImportBinary::_import_value_column(std::ifstream& file, ChunkOffset row_count,
                                                                    bool is_nullable) {
@@ -185,13 +199,14 @@ std::shared_ptr<ValueColumn<T>> ImportBinary::_import_value_column(std::ifstream
 }
 
 template <typename T>
-std::shared_ptr<DeprecatedDictionaryColumn<T>> ImportBinary::_import_dictionary_column(std::ifstream& file,
-                                                                                       ChunkOffset row_count) {
+std::shared_ptr<DictionaryColumn<T>> ImportBinary::_import_dictionary_column(std::ifstream& file,
+                                                                             ChunkOffset row_count) {
   const auto attribute_vector_width = _read_value<AttributeVectorWidth>(file);
   const auto dictionary_size = _read_value<ValueID>(file);
-  auto dictionary = _read_values<T>(file, dictionary_size);
-  auto attribute_vector = _import_attribute_vector(file, row_count, attribute_vector_width);
-  return std::make_shared<DeprecatedDictionaryColumn<T>>(std::move(dictionary), std::move(attribute_vector));
+  const auto null_value_id = dictionary_size;
+  auto dictionary = std::make_shared<pmr_vector<T>>(_read_values<T>(file, dictionary_size));
+  auto attribute_vector = _import_attribute_vector(file, row_count, attribute_vector_width, null_value_id);
+  return std::make_shared<DictionaryColumn<T>>(dictionary, attribute_vector, null_value_id);
 }
 
 }  // namespace opossum
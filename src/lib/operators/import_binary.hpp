@@ -11,7 +11,7 @@
 #include "import_export/binary.hpp"
 #include "storage/base_column.hpp"
 #include "storage/column_visitable.hpp"
-#include "storage/deprecated_dictionary_column.hpp"
+#include "storage/dictionary_column.hpp"
 #include "storage/reference_column.hpp"
 #include "storage/value_column.hpp"
 #include "utils/assert.hpp"
@@ -117,7 +117,8 @@ class ImportBinary : public AbstractReadOnlyOperator {
                                                               bool is_nullable);
 
   /*
-   * Imports a serialized DeprecatedDictionaryColumn from the given file.
+   * Imports a serialized dictionary column from the given file as a DictionaryColumn.
+   * The attribute vector is compressed using a FixedSizeByteAlignedVector of the stored width.
    * The file must contain data in the following format:
    *
    * Description           | Type                                  | Size in bytes
@@ -133,12 +134,19 @@ class ImportBinary : public AbstractReadOnlyOperator {
    * °: This field is needed if the type of the column is NOT a string
    */
   template <typename T>
-  static std::shared_ptr<DeprecatedDictionaryColumn<T>> _import_dictionary_column(std::ifstream& file,
-                                                                                  ChunkOffset row_count);
-
-  // Calls the _import_attribute_vector<uintX_t> function that corresponds to the given attribute_vector_width.
-  static std::shared_ptr<BaseAttributeVector> _import_attribute_vector(std::ifstream& file, ChunkOffset row_count,
-                                                                       AttributeVectorWidth attribute_vector_width);
+  static std::shared_ptr<DictionaryColumn<T>> _import_dictionary_column(std::ifstream& file, ChunkOffset row_count);
+
+  // Calls the _import_fixed_size_byte_aligned_vector<uintX_t> function that corresponds to the given
+  // attribute_vector_width.
+  static std::shared_ptr<BaseCompressedVector> _import_attribute_vector(std::ifstream& file, ChunkOffset row_count,
+                                                                        AttributeVectorWidth attribute_vector_width,
+                                                                        ValueID null_value_id);
+
+  // Reads row_count many value ids of type uintX_t and replaces the clamped NULL value id by null_value_id
+  template <typename uintX_t>
+  static std::shared_ptr<BaseCompressedVector> _import_fixed_size_byte_aligned_vector(std::ifstream& file,
+                                                                                      ChunkOffset row_count,
+                                                                                      ValueID null_value_id);
 
   // Reads row_count many values from type T and returns them in a vector
   template <typename T>
@@ -8,9 +8,9 @@
 #include "concurrency/transaction_context.hpp"
 #include "resolve_type.hpp"
 #include "storage/base_encoded_column.hpp"
+#include "storage/base_value_column.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/value_column.hpp"
-#include "type_cast.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -18,74 +18,22 @@ namespace opossum {
 // We need these classes to perform the dynamic cast into a templated ValueColumn
 class AbstractTypedColumnProcessor {
  public:
-  virtual void resize_vector(std::shared_ptr<BaseColumn> column, size_t new_size) = 0;
-  virtual void copy_data(std::shared_ptr<const BaseColumn> source, size_t source_start_index,
-                         std::shared_ptr<BaseColumn> target, size_t target_start_index, size_t length) = 0;
+  virtual void grow_vector_to_at_least(std::shared_ptr<BaseColumn> column, size_t new_size) = 0;
 };
 
 template <typename T>
 class TypedColumnProcessor : public AbstractTypedColumnProcessor {
  public:
-  void resize_vector(std::shared_ptr<BaseColumn> column, size_t new_size) override {
+  // Unlike resize(), grow_to_at_least() may be called concurrently by multiple inserts into the same chunk
+  void grow_vector_to_at_least(std::shared_ptr<BaseColumn> column, size_t new_size) override {
     auto val_column = std::dynamic_pointer_cast<ValueColumn<T>>(column);
     DebugAssert(static_cast<bool>(val_column), "Type mismatch");
     auto& values = val_column->values();
 
-    values.resize(new_size);
+    values.grow_to_at_least(new_size);
 
     if (val_column->is_nullable()) {
-      val_column->null_values().resize(new_size);
-    }
-  }
-
-  // this copies
-  void copy_data(std::shared_ptr<const BaseColumn> source, size_t source_start_index,
-                 std::shared_ptr<BaseColumn> target, size_t target_start_index, size_t length) override {
-    auto casted_target = std::dynamic_pointer_cast<ValueColumn<T>>(target);
-    DebugAssert(static_cast<bool>(casted_target), "Type mismatch");
-    auto& values = casted_target->values();
-
-    auto target_is_nullable = casted_target->is_nullable();
-
-    if (auto casted_source = std::dynamic_pointer_cast<const ValueColumn<T>>(source)) {
-      std::copy_n(casted_source->values().begin() + source_start_index, length, values.begin() + target_start_index);
-
-      if (casted_source->is_nullable()) {
-        // Values to insert contain null, copy them
-        if (target_is_nullable) {
-          std::copy_n(casted_source->null_values().begin() + source_start_index, length,
-                      casted_target->null_values().begin() + target_start_index);
-        } else {
-          for (const auto null_value : casted_source->null_values()) {
-            Assert(!null_value, "Trying to insert NULL into non-NULL column");
-          }
-        }
-      }
-    } else if (auto casted_dummy_source = std::dynamic_pointer_cast<const ValueColumn<int32_t>>(source)) {
-      // We use the column type of the Dummy table used to insert a single null value.
-      // A few asserts are needed to guarantee correct behaviour.
-      Assert(length == 1, "Cannot insert multiple unknown null values at once.");
-      Assert(casted_dummy_source->size() == 1, "Source column is of wrong type.");
-      Assert(casted_dummy_source->null_values().front() == true, "Only value in dummy table must be NULL!");
-      Assert(target_is_nullable, "Cannot insert NULL into NOT NULL target.");
-
-      // Ignore source value and only set null to true
-      casted_target->null_values()[target_start_index] = true;
-    } else {
-      // } else if(auto casted_source = std::dynamic_pointer_cast<ReferenceColumn>(source)){
-      // since we have no guarantee that a referenceColumn references only a single other column,
-      // this would require us to find out the referenced column's type for each single row.
-      // instead, we just use the slow path below.
-      for (auto i = 0u; i < length; i++) {
-        auto ref_value = (*source)[source_start_index + i];
-        if (variant_is_null(ref_value)) {
-          Assert(target_is_nullable, "Cannot insert NULL into NOT NULL target");
-          values[target_start_index + i] = T{};
-          casted_target->null_values()[target_start_index + i] = true;
-        } else {
-          values[target_start_index + i] = type_cast<T>(ref_value);
-        }
-      }
+      val_column->null_values().grow_to_at_least(new_size);
     }
   }
 };
@@ -108,99 +56,77 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
   }
 
   auto total_rows_to_insert = static_cast<uint32_t>(_input_table_left()->row_count());
+  _inserted_rows.reserve(total_rows_to_insert);
+
+  /**
+   * Rows are reserved at the end of the target table without locking it: within the last chunk, row ranges are
+   * reserved with an atomic compare-and-swap (see Chunk::reserve_rows()). If the last chunk is full or encoded, a new
+   * chunk is appended, which is synchronized via compare-and-swap as well (see Table::append_tail_chunk()).
+   * Thus, concurrent inserts into the same table only contend on these two atomics.
+   */
+  auto remaining_rows = total_rows_to_insert;
+  auto source_chunk_id = ChunkID{0};
+  auto source_chunk_offset = ChunkOffset{0};
 
-  // First, allocate space for all the rows to insert. Do so while locking the table to prevent multiple threads
-  // modifying the table's size simultaneously.
-  auto start_index = 0u;
-  auto start_chunk_id = ChunkID{0};
-  auto total_chunks_inserted = 0u;
-  {
-    auto scoped_lock = _target_table->acquire_append_mutex();
-
-    start_chunk_id = _target_table->chunk_count() - 1;
-    auto last_chunk = _target_table->get_chunk(start_chunk_id);
-    start_index = last_chunk->size();
-
-    // If last chunk is compressed, add a new uncompressed chunk
-    if (std::dynamic_pointer_cast<const BaseEncodedColumn>(last_chunk->get_column(ColumnID{0})) != nullptr) {
-      _target_table->create_new_chunk();
-      total_chunks_inserted++;
-    }
-
-    auto remaining_rows = total_rows_to_insert;
-    while (remaining_rows > 0) {
-      auto current_chunk = _target_table->get_chunk(static_cast<ChunkID>(_target_table->chunk_count() - 1));
-      auto rows_to_insert_this_loop = std::min(_target_table->max_chunk_size() - current_chunk->size(), remaining_rows);
-
-      // Resize MVCC vectors.
-      current_chunk->grow_mvcc_column_size_by(rows_to_insert_this_loop, Chunk::MAX_COMMIT_ID);
-
-      // Resize current chunk to full size.
-      auto old_size = current_chunk->size();
-      for (ColumnID column_id{0}; column_id < current_chunk->column_count(); ++column_id) {
-        typed_column_processors[column_id]->resize_vector(current_chunk->get_mutable_column(column_id),
-                                                          old_size + rows_to_insert_this_loop);
-      }
-
-      remaining_rows -= rows_to_insert_this_loop;
+  while (remaining_rows > 0) {
+    const auto target_chunk_id = _target_table->tail_chunk_id();
+    const auto target_chunk = _target_table->get_chunk(target_chunk_id);
 
-      // Create new chunk if necessary.
-      if (remaining_rows > 0) {
-        _target_table->create_new_chunk();
-        total_chunks_inserted++;
-      }
+    // TODO(all): make compress chunk thread-safe; if it gets called here by another thread, things will likely break.
+    if (std::dynamic_pointer_cast<const BaseEncodedColumn>(target_chunk->get_column(ColumnID{0})) != nullptr) {
+      _target_table->append_tail_chunk(target_chunk_id);
+      continue;
     }
-  }
-  // TODO(all): make compress chunk thread-safe; if it gets called here by another thread, things will likely break.
-
-  // Then, actually insert the data.
-  auto input_offset = 0u;
-  auto source_chunk_id = ChunkID{0};
-  auto source_chunk_start_index = 0u;
 
-  for (auto target_chunk_id = start_chunk_id; target_chunk_id <= start_chunk_id + total_chunks_inserted;
-       target_chunk_id++) {
-    auto target_chunk = _target_table->get_chunk(target_chunk_id);
+    const auto [target_begin, reserved_row_count] =
+        target_chunk->reserve_rows(remaining_rows, _target_table->max_chunk_size());
 
-    const auto current_num_rows_to_insert =
-        std::min(target_chunk->size() - start_index, total_rows_to_insert - input_offset);
+    if (reserved_row_count == 0) {
+      _target_table->append_tail_chunk(target_chunk_id);
+      continue;
+    }
 
-    auto target_start_index = start_index;
-    auto still_to_insert = current_num_rows_to_insert;
+    // The MVCC columns have already been grown by reserve_rows(), now make room in the data columns.
+    const auto target_end = target_begin + reserved_row_count;
+    for (ColumnID column_id{0}; column_id < target_chunk->column_count(); ++column_id) {
+      typed_column_processors[column_id]->grow_vector_to_at_least(target_chunk->get_mutable_column(column_id),
+                                                                   target_end);
+    }
 
-    // while target chunk is not full
-    while (target_start_index != target_chunk->size()) {
+    // Then, actually insert the data, which might come from multiple input chunks.
+    for (auto target_offset = target_begin; target_offset < target_end;) {
       const auto source_chunk = _input_table_left()->get_chunk(source_chunk_id);
-      auto num_to_insert = std::min(source_chunk->size() - source_chunk_start_index, still_to_insert);
+      const auto num_to_insert = std::min(source_chunk->size() - source_chunk_offset, target_end - target_offset);
+
       for (ColumnID column_id{0}; column_id < target_chunk->column_count(); ++column_id) {
-        const auto& source_column = source_chunk->get_column(column_id);
-        typed_column_processors[column_id]->copy_data(source_column, source_chunk_start_index,
-                                                      target_chunk->get_mutable_column(column_id), target_start_index,
-                                                      num_to_insert);
+        // Values are copied (or decoded) column-wise, see BaseValueColumn::copy_values()
+        const auto target_column =
+            std::static_pointer_cast<BaseValueColumn>(target_chunk->get_mutable_column(column_id));
+        target_column->copy_values(*source_chunk->get_column(column_id), source_chunk_offset, num_to_insert,
+                                   target_offset);
       }
-      still_to_insert -= num_to_insert;
-      target_start_index += num_to_insert;
-      source_chunk_start_index += num_to_insert;
 
-      bool source_chunk_depleted = source_chunk_start_index == source_chunk->size();
-      if (source_chunk_depleted) {
+      target_offset += num_to_insert;
+      source_chunk_offset += num_to_insert;
+
+      if (source_chunk_offset == source_chunk->size()) {
         source_chunk_id++;
-        source_chunk_start_index = 0u;
+        source_chunk_offset = 0u;
       }
     }
 
-    for (auto i = start_index; i < start_index + current_num_rows_to_insert; i++) {
+    auto mvcc_columns = target_chunk->mvcc_columns();
+    for (auto chunk_offset = target_begin; chunk_offset < target_end; chunk_offset++) {
       // we do not need to check whether other operators have locked the rows, we have just created them
       // and they are not visible for other operators.
       // the transaction IDs are set here and not during the resize, because
       // tbb::concurrent_vector::grow_to_at_least(n, t)" does not work with atomics, since their copy constructor is
       // deleted.
-      target_chunk->mvcc_columns()->tids[i] = context->transaction_id();
-      _inserted_rows.emplace_back(RowID{target_chunk_id, i});
+      mvcc_columns->tids[chunk_offset] = context->transaction_id();
+      _inserted_rows.emplace_back(RowID{target_chunk_id, chunk_offset});
     }
 
-    input_offset += current_num_rows_to_insert;
-    start_index = 0u;
+    remaining_rows -= reserved_row_count;
   }
 
   return nullptr;
@@ -214,6 +140,8 @@ void Insert::_on_commit_records(const CommitID cid) {
     mvcc_columns->begin_cids[row_id.chunk_offset] = cid;
     mvcc_columns->tids[row_id.chunk_offset] = 0u;
   }
+
+  _target_table->update_last_modified_commit_id(cid);
 }
 
 void Insert::_on_rollback_records() {
@@ -229,8 +157,10 @@ void Insert::_on_rollback_records() {
   }
 }
 
-std::shared_ptr<AbstractOperator> Insert::recreate(const std::vector<AllParameterVariant>& args) const {
-  return std::make_shared<Insert>(_target_table_name, _input_left->recreate(args));
+std::shared_ptr<AbstractOperator> Insert::_on_recreate(
+    const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+    const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
+  return std::make_shared<Insert>(_target_table_name, recreated_input_left);
 }
 
 }  // namespace opossum
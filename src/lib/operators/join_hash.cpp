@@ -35,8 +35,10 @@ JoinHash::JoinHash(const std::shared_ptr<const AbstractOperator> left,
 
 const std::string JoinHash::name() const { return "JoinHash"; }
 
-std::shared_ptr<AbstractOperator> JoinHash::recreate(const std::vector<AllParameterVariant>& args) const {
-  return std::make_shared<JoinHash>(_input_left->recreate(args), _input_right->recreate(args), _mode, _column_ids,
+std::shared_ptr<AbstractOperator> JoinHash::_on_recreate(
+    const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+    const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
+  return std::make_shared<JoinHash>(recreated_input_left, recreated_input_right, _mode, _column_ids,
                                     _predicate_condition);
 }
 
@@ -725,12 +727,12 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
             std::dynamic_pointer_cast<const ReferenceColumn>(input_table->get_chunk(ChunkID{0})->get_column(column_id));
 
         // Get all the input pos lists so that we only have to pointer cast the columns once
-        auto input_pos_lists = std::vector<std::shared_ptr<const PosList>>();
+        auto input_pos_lists = std::vector<std::shared_ptr<const AbstractPosList>>();
         for (ChunkID chunk_id{0}; chunk_id < input_table->chunk_count(); chunk_id++) {
           // This works because we assume that the columns have to be either all ReferenceColumns or none.
           auto ref_column =
               std::dynamic_pointer_cast<const ReferenceColumn>(input_table->get_chunk(chunk_id)->get_column(column_id));
-          input_pos_lists.push_back(ref_column->pos_list());
+          input_pos_lists.push_back(ref_column->abstract_pos_list());
         }
 
         // Get the row ids that are referenced
@@ -739,7 +741,7 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
           if (row.chunk_offset == INVALID_CHUNK_OFFSET) {
             new_pos_list->push_back(row);
           } else {
-            new_pos_list->push_back(input_pos_lists.at(row.chunk_id)->at(row.chunk_offset));
+            new_pos_list->push_back((*input_pos_lists.at(row.chunk_id))[row.chunk_offset]);
           }
         }
         column = std::make_shared<ReferenceColumn>(ref_col->referenced_table(), ref_col->referenced_column_id(),
@@ -0,0 +1,352 @@
+#include "join_index.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/create_iterable_from_column.hpp"
+#include "storage/index/base_index.hpp"
+#include "storage/index/column_index_type.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/reference_column/single_chunk_pos_list.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Calls func(range_begin, range_end) for all ranges of the index that contain the positions of right values for which
+// `left_value <predicate_condition> right_value` holds.
+template <typename Functor>
+void for_each_matching_index_range(const BaseIndex& index, const PredicateCondition predicate_condition,
+                                   const std::vector<AllTypeVariant>& left_value, const Functor& func) {
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+      func(index.lower_bound(left_value), index.upper_bound(left_value));
+      break;
+    case PredicateCondition::NotEquals:
+      func(index.cbegin(), index.lower_bound(left_value));
+      func(index.upper_bound(left_value), index.cend());
+      break;
+    case PredicateCondition::LessThan:
+      func(index.upper_bound(left_value), index.cend());
+      break;
+    case PredicateCondition::LessThanEquals:
+      func(index.lower_bound(left_value), index.cend());
+      break;
+    case PredicateCondition::GreaterThan:
+      func(index.cbegin(), index.lower_bound(left_value));
+      break;
+    case PredicateCondition::GreaterThanEquals:
+      func(index.cbegin(), index.upper_bound(left_value));
+      break;
+    default:
+      Fail("Unsupported predicate condition encountered");
+  }
+}
+
+// Calls func(begin_index, end_index) for all ranges of left_values, which are sorted by value, that contain the values
+// for which `left_value <predicate_condition> right_value` holds
+template <typename LeftValues, typename RightType, typename Functor>
+void for_each_matching_left_range(const LeftValues& left_values, const PredicateCondition predicate_condition,
+                                  const RightType& right_value, const Functor& func) {
+  const auto lower = static_cast<size_t>(
+      std::partition_point(left_values.begin(), left_values.end(),
+                           [&](const auto& left_value) { return left_value.first < right_value; }) -
+      left_values.begin());
+  const auto upper = static_cast<size_t>(
+      std::partition_point(left_values.begin() + lower, left_values.end(),
+                           [&](const auto& left_value) { return !(right_value < left_value.first); }) -
+      left_values.begin());
+
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+      func(lower, upper);
+      break;
+    case PredicateCondition::NotEquals:
+      func(size_t{0}, lower);
+      func(upper, left_values.size());
+      break;
+    case PredicateCondition::LessThan:
+      func(size_t{0}, lower);
+      break;
+    case PredicateCondition::LessThanEquals:
+      func(size_t{0}, upper);
+      break;
+    case PredicateCondition::GreaterThan:
+      func(upper, left_values.size());
+      break;
+    case PredicateCondition::GreaterThanEquals:
+      func(lower, left_values.size());
+      break;
+    default:
+      Fail("Unsupported predicate condition encountered");
+  }
+}
+
+// For a ReferenceColumn whose positions all lie in one chunk of the referenced table, e.g., one created by a Validate
+// on a stored table, returns the ID of that chunk and, for each of its rows, the offset of the row in the
+// ReferenceColumn (INVALID_CHUNK_OFFSET if the row is not referenced). As this offset is unique, nothing is returned
+// if a row is referenced more than once, e.g., by the output of a join or a UnionAll.
+std::optional<std::pair<ChunkID, std::vector<ChunkOffset>>> map_single_referenced_chunk(
+    const ReferenceColumn& reference_column) {
+  if (reference_column.size() == 0) return std::nullopt;
+
+  const auto& referenced_table = *reference_column.referenced_table();
+
+  if (const auto single_chunk_pos_list =
+          std::dynamic_pointer_cast<const SingleChunkPosList>(reference_column.abstract_pos_list())) {
+    const auto referenced_chunk_id = single_chunk_pos_list->chunk_id();
+    auto chunk_offsets = std::vector<ChunkOffset>(referenced_table.get_chunk(referenced_chunk_id)->size(),
+                                                  INVALID_CHUNK_OFFSET);
+
+    auto reference_chunk_offset = ChunkOffset{0};
+    auto contains_duplicates = false;
+    single_chunk_pos_list->for_each_chunk_offset([&](const auto chunk_offset) {
+      if (chunk_offsets[chunk_offset] != INVALID_CHUNK_OFFSET) contains_duplicates = true;
+      chunk_offsets[chunk_offset] = reference_chunk_offset++;
+    });
+    if (contains_duplicates) return std::nullopt;
+
+    return std::make_pair(referenced_chunk_id, std::move(chunk_offsets));
+  }
+
+  const auto& pos_list = *reference_column.pos_list();
+  const auto referenced_chunk_id = pos_list.front().chunk_id;
+  auto chunk_offsets =
+      std::vector<ChunkOffset>(referenced_table.get_chunk(referenced_chunk_id)->size(), INVALID_CHUNK_OFFSET);
+
+  for (auto reference_chunk_offset = ChunkOffset{0}; reference_chunk_offset < pos_list.size();
+       ++reference_chunk_offset) {
+    const auto& row_id = pos_list[reference_chunk_offset];
+    if (row_id.chunk_id != referenced_chunk_id || row_id.chunk_offset >= chunk_offsets.size()) return std::nullopt;
+    if (chunk_offsets[row_id.chunk_offset] != INVALID_CHUNK_OFFSET) return std::nullopt;
+    chunk_offsets[row_id.chunk_offset] = reference_chunk_offset;
+  }
+
+  return std::make_pair(referenced_chunk_id, std::move(chunk_offsets));
+}
+
+}  // namespace
+
+JoinIndex::JoinIndex(const std::shared_ptr<const AbstractOperator> left,
+                     const std::shared_ptr<const AbstractOperator> right, const JoinMode mode,
+                     const ColumnIDPair& column_ids, const PredicateCondition predicate_condition)
+    : AbstractJoinOperator(left, right, mode, column_ids, predicate_condition) {
+  DebugAssert(mode == JoinMode::Inner || mode == JoinMode::Left, "Join mode not supported by Index Join.");
+  DebugAssert(predicate_condition != PredicateCondition::Like && predicate_condition != PredicateCondition::NotLike &&
+                  predicate_condition != PredicateCondition::Between,
+              "Operator not supported by Index Join.");
+}
+
+const std::string JoinIndex::name() const { return "JoinIndex"; }
+
+std::shared_ptr<AbstractOperator> JoinIndex::_on_recreate(
+    const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+    const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
+  return std::make_shared<JoinIndex>(recreated_input_left, recreated_input_right, _mode, _column_ids,
+                                     _predicate_condition);
+}
+
+std::shared_ptr<const Table> JoinIndex::_on_execute() {
+  const auto left_table = _input_table_left();
+  const auto right_table = _input_table_right();
+
+  _pos_list_left = std::make_shared<PosList>();
+  _pos_list_right = std::make_shared<PosList>();
+
+  resolve_data_type(left_table->column_type(_column_ids.first), [&](auto left_type) {
+    using LeftType = typename decltype(left_type)::type;
+    _perform_join<LeftType>();
+  });
+
+  auto output_table = std::make_shared<Table>();
+
+  for (ColumnID column_id{0}; column_id < left_table->column_count(); ++column_id) {
+    output_table->add_column_definition(left_table->column_name(column_id), left_table->column_type(column_id),
+                                        left_table->column_is_nullable(column_id));
+  }
+
+  for (ColumnID column_id{0}; column_id < right_table->column_count(); ++column_id) {
+    const auto nullable = _mode == JoinMode::Left || right_table->column_is_nullable(column_id);
+    output_table->add_column_definition(right_table->column_name(column_id), right_table->column_type(column_id),
+                                        nullable);
+  }
+
+  auto output_chunk = std::make_shared<Chunk>();
+  _write_output_chunks(output_chunk, left_table, _pos_list_left);
+  _write_output_chunks(output_chunk, right_table, _pos_list_right);
+  output_table->emplace_chunk(std::move(output_chunk));
+
+  return output_table;
+}
+
+template <typename LeftType>
+void JoinIndex::_perform_join() {
+  const auto left_table = _input_table_left();
+  const auto right_table = _input_table_right();
+  const auto left_column_id = _column_ids.first;
+  const auto right_column_id = _column_ids.second;
+
+  // Materialize the left join column and sort it by value, so that rows with the same value share one index probe
+  auto left_values = std::vector<std::pair<LeftType, RowID>>{};
+  left_values.reserve(left_table->row_count());
+  auto left_null_rows = PosList{};
+
+  for (ChunkID chunk_id{0}; chunk_id < left_table->chunk_count(); ++chunk_id) {
+    const auto column = left_table->get_chunk(chunk_id)->get_column(left_column_id);
+
+    resolve_column_type<LeftType>(*column, [&](auto& typed_column) {
+      auto iterable = create_iterable_from_column<LeftType>(typed_column);
+
+      iterable.for_each([&](const auto& left_value) {
+        if (left_value.is_null()) {
+          left_null_rows.emplace_back(RowID{chunk_id, left_value.chunk_offset()});
+        } else {
+          left_values.emplace_back(left_value.value(), RowID{chunk_id, left_value.chunk_offset()});
+        }
+      });
+    });
+  }
+
+  std::sort(left_values.begin(), left_values.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+  // for Left joins, remember the matches on the left side
+  auto left_matches = std::vector<bool>(_mode == JoinMode::Left ? left_values.size() : 0);
+
+  const auto right_data_type = right_table->column_type(right_column_id);
+
+  // Indexes are probed with the left values as they are, so they can only be used if both columns have the same type
+  const auto types_match = left_table->column_type(left_column_id) == right_data_type;
+
+  // Except for the GroupKeyIndex, which does not index NULLs, indexes keep NULLs behind all values (e.g., the
+  // CompositeGroupKeyIndex under the null value id of the dictionary), so ranges reaching up to their end might
+  // contain them
+  const auto range_reaches_end = _predicate_condition == PredicateCondition::NotEquals ||
+                                 _predicate_condition == PredicateCondition::LessThan ||
+                                 _predicate_condition == PredicateCondition::LessThanEquals;
+  const auto index_is_usable = [&](const BaseIndex& index) {
+    if (!types_match) return false;
+    return !range_reaches_end || index.type() == ColumnIndexType::GroupKey ||
+           !right_table->column_is_nullable(right_column_id);
+  };
+
+  for (ChunkID chunk_id{0}; chunk_id < right_table->chunk_count(); ++chunk_id) {
+    const auto chunk = right_table->get_chunk_with_access_counting(chunk_id);
+
+    /**
+     * Only the chunks of stored tables have indexes. If the right input references a single chunk of a stored table,
+     * e.g., because it is the output of a Validate, the index of that chunk is used. The positions it returns are
+     * mapped to the rows of the reference chunk, rows that are not referenced (e.g., invisible ones) are skipped.
+     */
+    auto indices = std::vector<std::shared_ptr<BaseIndex>>{};
+    auto referenced_chunk_offsets = std::optional<std::pair<ChunkID, std::vector<ChunkOffset>>>{};
+
+    const auto reference_column =
+        std::dynamic_pointer_cast<const ReferenceColumn>(chunk->get_column(right_column_id));
+    if (!reference_column) {
+      indices = chunk->get_indices(std::vector<ColumnID>{right_column_id});
+    } else {
+      referenced_chunk_offsets = map_single_referenced_chunk(*reference_column);
+      if (referenced_chunk_offsets) {
+        const auto referenced_chunk =
+            reference_column->referenced_table()->get_chunk(referenced_chunk_offsets->first);
+        indices = referenced_chunk->get_indices(std::vector<ColumnID>{reference_column->referenced_column_id()});
+      }
+    }
+
+    if (!indices.empty() && index_is_usable(*indices.front())) {
+      const auto& index = *indices.front();
+
+      for (auto run_begin = size_t{0}; run_begin < left_values.size();) {
+        auto run_end = run_begin + 1;
+        while (run_end < left_values.size() && left_values[run_end].first == left_values[run_begin].first) {
+          ++run_end;
+        }
+
+        const auto probe_value = std::vector<AllTypeVariant>{AllTypeVariant{left_values[run_begin].first}};
+        auto run_matched = false;
+
+        for_each_matching_index_range(index, _predicate_condition, probe_value, [&](auto range_begin, auto range_end) {
+          for (auto range_it = range_begin; range_it != range_end; ++range_it) {
+            auto chunk_offset = *range_it;
+            if (referenced_chunk_offsets) {
+              chunk_offset = referenced_chunk_offsets->second[chunk_offset];
+              if (chunk_offset == INVALID_CHUNK_OFFSET) continue;
+            }
+
+            for (auto left_index = run_begin; left_index < run_end; ++left_index) {
+              _pos_list_left->emplace_back(left_values[left_index].second);
+              _pos_list_right->emplace_back(RowID{chunk_id, chunk_offset});
+            }
+            run_matched = true;
+          }
+        });
+
+        if (run_matched && !left_matches.empty()) {
+          std::fill(left_matches.begin() + run_begin, left_matches.begin() + run_end, true);
+        }
+
+        run_begin = run_end;
+      }
+    } else {
+      const auto column = chunk->get_column(right_column_id);
+
+      resolve_data_and_column_type(right_data_type, *column, [&](auto right_type, auto& typed_column) {
+        using RightType = typename decltype(right_type)::type;
+
+        // make sure that we do not compile invalid versions of these lambdas
+        constexpr auto left_is_string_column = std::is_same<LeftType, std::string>{};
+        constexpr auto right_is_string_column = std::is_same<RightType, std::string>{};
+
+        // clang-format off
+        if constexpr (left_is_string_column == right_is_string_column) {
+          auto iterable = create_iterable_from_column<RightType>(typed_column);
+
+          // The left values are sorted, so the matches of a right value are found by binary search
+          iterable.for_each([&](const auto& right_value) {
+            if (right_value.is_null()) return;
+
+            const auto right_row_id = RowID{chunk_id, right_value.chunk_offset()};
+            for_each_matching_left_range(left_values, _predicate_condition, right_value.value(),
+                                         [&](const size_t begin_index, const size_t end_index) {
+              for (auto left_index = begin_index; left_index < end_index; ++left_index) {
+                _pos_list_left->emplace_back(left_values[left_index].second);
+                _pos_list_right->emplace_back(right_row_id);
+              }
+
+              if (!left_matches.empty()) {
+                std::fill(left_matches.begin() + begin_index, left_matches.begin() + end_index, true);
+              }
+            });
+          });
+        } else {
+          Fail("Cannot join a string column with a numerical column");
+        }
+        // clang-format on
+      });
+    }
+  }
+
+  if (_mode == JoinMode::Left) {
+    // add unmatched rows and rows with a NULL value on the left
+    for (auto left_index = size_t{0}; left_index < left_values.size(); ++left_index) {
+      if (left_matches[left_index]) continue;
+      _pos_list_left->emplace_back(left_values[left_index].second);
+      _pos_list_right->emplace_back(RowID{ChunkID{0}, INVALID_CHUNK_OFFSET});
+    }
+
+    for (const auto& row_id : left_null_rows) {
+      _pos_list_left->emplace_back(row_id);
+      _pos_list_right->emplace_back(RowID{ChunkID{0}, INVALID_CHUNK_OFFSET});
+    }
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_join_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Index nested loop join that probes the indexes of the right input's chunks with the values of the left input.
+ *
+ * The left input's join column is materialized and sorted first. Thus, the probes for a chunk are done in one batch
+ * in which every distinct left value is looked up only once. If a chunk of the right input references a single chunk
+ * of a stored table, as the output of a Validate does, the index of the referenced chunk is probed. Chunks of the
+ * right input without a usable index (e.g., the mutable last chunk of a stored table) are scanned instead, and the
+ * matches of each of their values are found by binary search in the sorted left values.
+ *
+ * Supports Inner and Left joins with all predicate conditions that an index can answer, i.e., all but Like, NotLike,
+ * and Between. As the index lookups are cheap compared to building a hash table of the right input, the
+ * JoinAlgorithmRule chooses this join if the left input is much smaller than the indexed right input.
+ */
+class JoinIndex : public AbstractJoinOperator {
+ public:
+  JoinIndex(const std::shared_ptr<const AbstractOperator> left, const std::shared_ptr<const AbstractOperator> right,
+            const JoinMode mode, const ColumnIDPair& column_ids, const PredicateCondition predicate_condition);
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<AbstractOperator> _on_recreate(
+      const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+      const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
+  std::shared_ptr<const Table> _on_execute() override;
+
+  template <typename LeftType>
+  void _perform_join();
+
+  std::shared_ptr<PosList> _pos_list_left;
+  std::shared_ptr<PosList> _pos_list_right;
+};
+
+}  // namespace opossum
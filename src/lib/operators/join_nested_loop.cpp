@@ -20,7 +20,7 @@ namespace opossum {
  * This is a Nested Loop Join implementation completely based on iterables.
  * It supports all current join and predicate conditions, as well as NULL values.
  * Because this is a Nested Loop Join, the performance is going to be far inferior to JoinHash and JoinSortMerge,
- * so only use this for testing or benchmarking purposes.
+ * so the JoinAlgorithmRule only chooses it for very small inputs or for joins the others do not support.
  */
 
 JoinNestedLoop::JoinNestedLoop(const std::shared_ptr<const AbstractOperator> left,
@@ -30,8 +30,10 @@ JoinNestedLoop::JoinNestedLoop(const std::shared_ptr<const AbstractOperator> lef
 
 const std::string JoinNestedLoop::name() const { return "JoinNestedLoop"; }
 
-std::shared_ptr<AbstractOperator> JoinNestedLoop::recreate(const std::vector<AllParameterVariant>& args) const {
-  return std::make_shared<JoinNestedLoop>(_input_left->recreate(args), _input_right->recreate(args), _mode, _column_ids,
+std::shared_ptr<AbstractOperator> JoinNestedLoop::_on_recreate(
+    const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+    const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
+  return std::make_shared<JoinNestedLoop>(recreated_input_left, recreated_input_right, _mode, _column_ids,
                                           _predicate_condition);
 }
 
@@ -218,42 +220,4 @@ void JoinNestedLoop::_perform_join() {
   _output_table->emplace_chunk(std::move(output_chunk));
 }
 
-void JoinNestedLoop::_write_output_chunks(const std::shared_ptr<Chunk>& output_chunk,
-                                          const std::shared_ptr<const Table> input_table,
-                                          std::shared_ptr<PosList> pos_list) {
-  // Add columns from table to output chunk
-  for (ColumnID column_id{0}; column_id < input_table->column_count(); ++column_id) {
-    std::shared_ptr<BaseColumn> column;
-
-    if (auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(
-            input_table->get_chunk(ChunkID{0})->get_column(column_id))) {
-      auto new_pos_list = std::make_shared<PosList>();
-
-      ChunkID current_chunk_id{0};
-
-      // de-reference to the correct RowID so the output can be used in a Multi Join
-      for (const auto row : *pos_list) {
-        if (row.chunk_id != current_chunk_id) {
-          current_chunk_id = row.chunk_id;
-
-          reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(
-              input_table->get_chunk(current_chunk_id)->get_column(column_id));
-        }
-        if (row.chunk_offset == INVALID_CHUNK_OFFSET) {
-          new_pos_list->push_back(RowID{ChunkID{0}, INVALID_CHUNK_OFFSET});
-        } else {
-          new_pos_list->push_back(reference_column->pos_list()->at(row.chunk_offset));
-        }
-      }
-
-      column = std::make_shared<ReferenceColumn>(reference_column->referenced_table(),
-                                                 reference_column->referenced_column_id(), new_pos_list);
-    } else {
-      column = std::make_shared<ReferenceColumn>(input_table, column_id, pos_list);
-    }
-
-    output_chunk->add_column(column);
-  }
-}
-
 }  // namespace opossum
@@ -26,9 +26,11 @@ class JoinSortMerge : public AbstractJoinOperator {
   JoinSortMerge(const std::shared_ptr<const AbstractOperator> left, const std::shared_ptr<const AbstractOperator> right,
                 const JoinMode mode, const ColumnIDPair& column_ids, const PredicateCondition op);
 
+  std::shared_ptr<AbstractOperator> _on_recreate(
+      const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+      const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
   std::shared_ptr<const Table> _on_execute() override;
   void _on_cleanup() override;
-  std::shared_ptr<AbstractOperator> recreate(const std::vector<AllParameterVariant>& args = {}) const override;
   const std::string name() const override;
 
  protected:
@@ -8,6 +8,8 @@
 #include "scheduler/current_scheduler.hpp"
 #include "scheduler/job_task.hpp"
 #include "storage/create_iterable_from_column.hpp"
+#include "storage/deprecated_dictionary_column/deprecated_attribute_vector_iterable.hpp"
+#include "storage/dictionary_column/attribute_vector_iterable.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -97,8 +99,9 @@ class ColumnMaterializer {
     });
 
     if (_sort) {
-      std::sort(output.begin(), output.end(),
-                [](const auto& left, const auto& right) { return left.value < right.value; });
+      // Inputs that are already sorted (e.g., the output of a Sort) only need to be checked
+      const auto compare = [](const auto& left, const auto& right) { return left.value < right.value; };
+      if (!std::is_sorted(output.begin(), output.end(), compare)) std::sort(output.begin(), output.end(), compare);
     }
 
     return std::make_shared<MaterializedColumn<T>>(std::move(output));
@@ -107,45 +110,56 @@ class ColumnMaterializer {
   /**
    * Specialization for dictionary columns
    */
+  std::shared_ptr<MaterializedColumn<T>> _materialize_column(const DictionaryColumn<T>& column, ChunkID chunk_id,
+                                                             std::unique_ptr<PosList>& null_rows_output) {
+    auto attribute_vector_iterable = AttributeVectorIterable{*column.attribute_vector(), column.null_value_id()};
+    return _materialize_dictionary_column(column, *column.dictionary(), attribute_vector_iterable, chunk_id,
+                                          null_rows_output);
+  }
+
   std::shared_ptr<MaterializedColumn<T>> _materialize_column(const DeprecatedDictionaryColumn<T>& column,
                                                              ChunkID chunk_id,
                                                              std::unique_ptr<PosList>& null_rows_output) {
+    auto attribute_vector_iterable = DeprecatedAttributeVectorIterable{*column.attribute_vector()};
+    return _materialize_dictionary_column(column, *column.dictionary(), attribute_vector_iterable, chunk_id,
+                                          null_rows_output);
+  }
+
+  template <typename ColumnType, typename AttributeVectorIterableType>
+  std::shared_ptr<MaterializedColumn<T>> _materialize_dictionary_column(
+      const ColumnType& column, const pmr_vector<T>& dict, AttributeVectorIterableType attribute_vector_iterable,
+      ChunkID chunk_id, std::unique_ptr<PosList>& null_rows_output) {
     auto output = MaterializedColumn<T>{};
     output.reserve(column.size());
 
-    auto value_ids = column.attribute_vector();
-    auto dict = column.dictionary();
-
     if (_sort) {
       // Works like Bucket Sort
       // Collect for every value id, the set of rows that this value appeared in
       // value_count is used as an inverted index
-      auto rows_with_value = std::vector<std::vector<RowID>>(dict->size());
+      auto rows_with_value = std::vector<std::vector<RowID>>(dict.size());
 
       // Reserve correct size of the vectors by assuming a uniform distribution
       for (auto& row : rows_with_value) {
-        row.reserve(value_ids->size() / dict->size());
+        row.reserve(column.size() / dict.size());
       }
 
       // Collect the rows for each value id
-      for (ChunkOffset chunk_offset{0}; chunk_offset < value_ids->size(); ++chunk_offset) {
-        auto value_id = value_ids->get(chunk_offset);
+      attribute_vector_iterable.for_each([&](const auto& value_id) {
+        const auto row_id = RowID{chunk_id, value_id.chunk_offset()};
 
-        if (value_id != NULL_VALUE_ID) {
-          rows_with_value[value_id].push_back(RowID{chunk_id, chunk_offset});
+        if (!value_id.is_null()) {
+          rows_with_value[value_id.value()].push_back(row_id);
         } else {
           if (_materialize_null) {
-            null_rows_output->emplace_back(RowID{chunk_id, chunk_offset});
+            null_rows_output->emplace_back(row_id);
           }
         }
-      }
+      });
 
       // Now that we know the row ids for every value, we can output all the materialized values in a sorted manner.
-      ChunkOffset chunk_offset{0};
-      for (ValueID value_id{0}; value_id < dict->size(); ++value_id) {
+      for (ValueID value_id{0}; value_id < dict.size(); ++value_id) {
         for (auto& row_id : rows_with_value[value_id]) {
-          output.emplace_back(row_id, (*dict)[value_id]);
-          ++chunk_offset;
+          output.emplace_back(row_id, dict[value_id]);
         }
       }
     } else {
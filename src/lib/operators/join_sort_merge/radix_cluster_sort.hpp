@@ -320,8 +320,11 @@ class RadixClusterSort {
   * Sorts all clusters of a materialized table.
   **/
   void _sort_clusters(std::unique_ptr<MaterializedColumnList<T>>& clusters) {
+    const auto compare = [](const auto& left, const auto& right) { return left.value < right.value; };
     for (auto cluster : *clusters) {
-      std::sort(cluster->begin(), cluster->end(), [](auto& left, auto& right) { return left.value < right.value; });
+      // Clustering keeps the order of the values, so the clusters of sorted inputs are already sorted
+      if (std::is_sorted(cluster->begin(), cluster->end(), compare)) continue;
+      std::sort(cluster->begin(), cluster->end(), compare);
     }
   }
 
@@ -355,7 +358,8 @@ class RadixClusterSort {
     }
 
     // Sort each cluster (right now std::sort -> but maybe can be replaced with
-    // an more efficient algorithm, if subparts are already sorted [InsertionSort?!])
+    // an more efficient algorithm, if subparts are already sorted [InsertionSort?!]).
+    // Clusters that are already sorted are skipped.
     _sort_clusters(output.clusters_left);
     _sort_clusters(output.clusters_right);
 
@@ -1,12 +1,15 @@
 #include "limit.hpp"
 
 #include <algorithm>
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "storage/reference_column.hpp"
+#include "storage/reference_column/row_id_pos_list.hpp"
+#include "storage/reference_column/single_chunk_pos_list.hpp"
 #include "storage/table.hpp"
 
 namespace opossum {
@@ -16,8 +19,10 @@ Limit::Limit(const std::shared_ptr<const AbstractOperator> in, const size_t num_
 
 const std::string Limit::name() const { return "Limit"; }
 
-std::shared_ptr<AbstractOperator> Limit::recreate(const std::vector<AllParameterVariant>& args) const {
-  return std::make_shared<Limit>(_input_left->recreate(args), _num_rows);
+std::shared_ptr<AbstractOperator> Limit::_on_recreate(
+    const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+    const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
+  return std::make_shared<Limit>(recreated_input_left, _num_rows);
 }
 
 size_t Limit::num_rows() const { return _num_rows; }
@@ -34,23 +39,44 @@ std::shared_ptr<const Table> Limit::_on_execute() {
 
     size_t output_chunk_row_count = std::min<size_t>(input_chunk->size(), _num_rows - i);
 
+    // Columns sharing their positions in the input share them in the output, too
+    auto output_pos_lists = std::map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<const AbstractPosList>>{};
+    auto stored_table_pos_list = std::shared_ptr<const AbstractPosList>{};
+
     for (ColumnID column_id{0}; column_id < input_table->column_count(); column_id++) {
       const auto input_base_column = input_chunk->get_column(column_id);
-      auto output_pos_list = std::make_shared<PosList>(output_chunk_row_count);
+      std::shared_ptr<const AbstractPosList> output_pos_list;
       std::shared_ptr<const Table> referenced_table;
       ColumnID output_column_id = column_id;
 
       if (auto input_ref_column = std::dynamic_pointer_cast<const ReferenceColumn>(input_base_column)) {
         output_column_id = input_ref_column->referenced_column_id();
         referenced_table = input_ref_column->referenced_table();
-        // TODO(all): optimize using whole chunk whenever possible
-        auto begin = input_ref_column->pos_list()->begin();
-        std::copy(begin, begin + output_chunk_row_count, output_pos_list->begin());
+
+        const auto input_pos_list = input_ref_column->abstract_pos_list();
+        auto& pos_list = output_pos_lists[input_pos_list];
+        if (!pos_list) {
+          if (output_chunk_row_count == input_pos_list->size()) {
+            // The whole chunk is part of the output, so that its positions can be used as they are
+            pos_list = input_pos_list;
+          } else if (const auto single_chunk_pos_list =
+                         std::dynamic_pointer_cast<const SingleChunkPosList>(input_pos_list)) {
+            auto chunk_offsets = single_chunk_pos_list->chunk_offsets();
+            chunk_offsets.resize(output_chunk_row_count);
+            pos_list = SingleChunkPosList::create(single_chunk_pos_list->chunk_id(), std::move(chunk_offsets));
+          } else {
+            const auto begin = input_pos_list->row_ids()->begin();
+            pos_list = std::make_shared<RowIDPosList>(std::make_shared<PosList>(begin, begin + output_chunk_row_count));
+          }
+        }
+        output_pos_list = pos_list;
       } else {
         referenced_table = input_table;
-        for (ChunkOffset chunk_offset = 0; chunk_offset < output_chunk_row_count; chunk_offset++) {
-          (*output_pos_list)[chunk_offset] = RowID{chunk_id, chunk_offset};
+        if (!stored_table_pos_list) {
+          stored_table_pos_list = std::make_shared<SingleChunkPosList>(
+              chunk_id, ChunkOffset{0}, static_cast<ChunkOffset>(output_chunk_row_count));
         }
+        output_pos_list = stored_table_pos_list;
       }
 
       output_chunk->add_column(std::make_shared<ReferenceColumn>(referenced_table, output_column_id, output_pos_list));
@@ -13,11 +13,13 @@ class Limit : public AbstractReadOnlyOperator {
   explicit Limit(const std::shared_ptr<const AbstractOperator> in, const size_t num_rows);
 
   const std::string name() const override;
-  std::shared_ptr<AbstractOperator> recreate(const std::vector<AllParameterVariant>& args = {}) const override;
 
   size_t num_rows() const;
 
  protected:
+  std::shared_ptr<AbstractOperator> _on_recreate(
+      const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+      const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
   std::shared_ptr<const Table> _on_execute() override;
 
  private:
@@ -13,7 +13,9 @@ DropView::DropView(const std::string& view_name) : _view_name(view_name) {}
 
 const std::string DropView::name() const { return "DropView"; }
 
-std::shared_ptr<AbstractOperator> DropView::recreate(const std::vector<AllParameterVariant>& args) const {
+std::shared_ptr<AbstractOperator> DropView::_on_recreate(
+    const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+    const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
   Fail("This operator cannot be recreated");
   // ... because it makes no sense to do so.
 }
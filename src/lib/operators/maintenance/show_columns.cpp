@@ -20,7 +20,9 @@ ShowColumns::ShowColumns(const std::string& table_name) : _table_name(table_name
 
 const std::string ShowColumns::name() const { return "ShowColumns"; }
 
-std::shared_ptr<AbstractOperator> ShowColumns::recreate(const std::vector<AllParameterVariant>& args) const {
+std::shared_ptr<AbstractOperator> ShowColumns::_on_recreate(
+    const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+    const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
   return std::make_shared<ShowColumns>(_table_name);
 }
 
@@ -0,0 +1,109 @@
+#include "materialize.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/create_iterable_from_column.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <typename T>
+std::shared_ptr<BaseColumn> materialize_column(const ReferenceColumn& reference_column, const bool nullable) {
+  auto values = pmr_concurrent_vector<T>(reference_column.size());
+  auto null_values = pmr_concurrent_vector<bool>(reference_column.size());
+  auto contains_null = false;
+
+  auto iterable = create_iterable_from_column<T>(reference_column);
+  iterable.for_each([&](const auto& value) {
+    if (value.is_null()) {
+      null_values[value.chunk_offset()] = true;
+      contains_null = true;
+    } else {
+      values[value.chunk_offset()] = value.value();
+    }
+  });
+
+  // Some operators (e.g., the Projection) produce NULLs in columns not defined as nullable. They are kept, too.
+  if (nullable || contains_null) return std::make_shared<ValueColumn<T>>(std::move(values), std::move(null_values));
+  return std::make_shared<ValueColumn<T>>(std::move(values));
+}
+
+}  // namespace
+
+Materialize::Materialize(const std::shared_ptr<const AbstractOperator> in) : AbstractReadOnlyOperator(in) {}
+
+const std::string Materialize::name() const { return "Materialize"; }
+
+std::shared_ptr<AbstractOperator> Materialize::_on_recreate(
+    const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+    const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
+  return std::make_shared<Materialize>(recreated_input_left);
+}
+
+std::shared_ptr<const Table> Materialize::_on_execute() {
+  const auto table_in = _input_table_left();
+  const auto chunk_count = table_in->chunk_count();
+  const auto column_count = table_in->column_count();
+
+  auto contains_references = false;
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count && !contains_references; ++chunk_id) {
+    const auto chunk = table_in->get_chunk(chunk_id);
+    for (ColumnID column_id{0}; column_id < column_count && !contains_references; ++column_id) {
+      contains_references = std::dynamic_pointer_cast<const ReferenceColumn>(chunk->get_column(column_id)) != nullptr;
+    }
+  }
+  if (!contains_references) return table_in;
+
+  // Gather the values of every column of every chunk, one task per column and chunk
+  auto columns_out = std::vector<std::vector<std::shared_ptr<BaseColumn>>>(
+      chunk_count, std::vector<std::shared_ptr<BaseColumn>>(column_count));
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count * column_count);
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table_in->get_chunk(chunk_id);
+
+    for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
+      // We have to use get_mutable_column here because we cannot add a const column to the chunk
+      const auto column = chunk->get_mutable_column(column_id);
+      const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(column);
+      if (!reference_column) {
+        columns_out[chunk_id][column_id] = column;
+        continue;
+      }
+
+      jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id, column_id, reference_column]() {
+        resolve_data_type(table_in->column_type(column_id), [&](auto type) {
+          using ColumnDataType = typename decltype(type)::type;
+          columns_out[chunk_id][column_id] =
+              materialize_column<ColumnDataType>(*reference_column, table_in->column_is_nullable(column_id));
+        });
+      }));
+      jobs.back()->schedule();
+    }
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  auto output = Table::create_with_layout_from(table_in, table_in->max_chunk_size());
+  for (auto& columns : columns_out) {
+    auto chunk_out = std::make_shared<Chunk>();
+    for (auto& column : columns) {
+      chunk_out->add_column(std::move(column));
+    }
+    output->emplace_chunk(std::move(chunk_out));
+  }
+
+  return output;
+}
+
+}  // namespace opossum
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Operator that replaces the ReferenceColumns of its input by ValueColumns containing the referenced values. All
+ * other columns are passed on unchanged, so the output of operators that already produce values is not copied.
+ *
+ * Most operators only output positions and leave the columns they have not touched to be gathered later (late
+ * materialization). The MaterializationRule places this operator on top of plans whose results are large, so that
+ * the remaining columns are gathered column-wise in parallel, one task per column and chunk, instead of being
+ * dereferenced value by value by whoever consumes the result.
+ */
+class Materialize : public AbstractReadOnlyOperator {
+ public:
+  explicit Materialize(const std::shared_ptr<const AbstractOperator> in);
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<AbstractOperator> _on_recreate(
+      const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+      const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
+  std::shared_ptr<const Table> _on_execute() override;
+};
+
+}  // namespace opossum
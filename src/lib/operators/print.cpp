@@ -20,8 +20,10 @@ Print::Print(const std::shared_ptr<const AbstractOperator> in, std::ostream& out
 
 const std::string Print::name() const { return "Print"; }
 
-std::shared_ptr<AbstractOperator> Print::recreate(const std::vector<AllParameterVariant>& args) const {
-  return std::make_shared<Print>(_input_left->recreate(args), _out);
+std::shared_ptr<AbstractOperator> Print::_on_recreate(
+    const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+    const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
+  return std::make_shared<Print>(recreated_input_left, _out);
 }
 
 void Print::print(std::shared_ptr<const Table> table, uint32_t flags, std::ostream& out) {
@@ -18,7 +18,6 @@ class Print : public AbstractReadOnlyOperator {
   explicit Print(const std::shared_ptr<const AbstractOperator> in, std::ostream& out = std::cout, uint32_t flags = 0);
 
   const std::string name() const override;
-  std::shared_ptr<AbstractOperator> recreate(const std::vector<AllParameterVariant>& args) const override;
 
   static void print(std::shared_ptr<const Table> table, uint32_t flags = 0, std::ostream& out = std::cout);
   static void print(std::shared_ptr<const AbstractOperator> in, uint32_t flags = 0, std::ostream& out = std::cout);
@@ -26,6 +25,9 @@ class Print : public AbstractReadOnlyOperator {
  protected:
   std::vector<uint16_t> _column_string_widths(uint16_t min, uint16_t max, std::shared_ptr<const Table> t) const;
   std::string _truncate_cell(const AllTypeVariant& cell, uint16_t max_width) const;
+  std::shared_ptr<AbstractOperator> _on_recreate(
+      const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+      const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
   std::shared_ptr<const Table> _on_execute() override;
 
   // stream to print the result
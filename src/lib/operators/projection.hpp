@@ -23,7 +23,10 @@ class PQPExpression;
 /**
  * Operator to select a subset of the set of all columns found in the table
  *
- * Note: Projection does not support null values at the moment
+ * Columns that are selected without modification are passed on without being copied. Only the computed columns are
+ * materialized, chunk by chunk in parallel, by an ExpressionEvaluator. If the input consists of ReferenceColumns, the
+ * computed columns are referenced by the output, too, so that the columns passed on are only materialized once the
+ * result is returned (see Materialize).
  */
 class Projection : public AbstractReadOnlyOperator {
  public:
@@ -36,8 +39,6 @@ class Projection : public AbstractReadOnlyOperator {
 
   const ColumnExpressions& column_expressions() const;
 
-  std::shared_ptr<AbstractOperator> recreate(const std::vector<AllParameterVariant>& args) const override;
-
   /**
    * The dummy table is used for literal projections that have no input table.
    * This was introduce to allow queries like INSERT INTO tbl VALUES (1, 2, 3);
@@ -60,23 +61,9 @@ class Projection : public AbstractReadOnlyOperator {
  protected:
   ColumnExpressions _column_expressions;
 
-  template <typename T>
-  static void _create_column(boost::hana::basic_type<T> type, const std::shared_ptr<Chunk>& chunk,
-                             const ChunkID chunk_id, const std::shared_ptr<PQPExpression>& expression,
-                             std::shared_ptr<const Table> input_table_left, bool reuse_column_from_input);
-
-  static DataType _get_type_of_expression(const std::shared_ptr<PQPExpression>& expression,
-                                          const std::shared_ptr<const Table>& table);
-
-  /**
-   * This function evaluates the given expression on a single chunk.
-   * It returns a vector containing the materialized values resulting from the expression.
-   */
-  template <typename T>
-  static const pmr_concurrent_vector<std::optional<T>> _evaluate_expression(
-      const std::shared_ptr<PQPExpression>& expression, const std::shared_ptr<const Table> table,
-      const ChunkID chunk_id);
-
+  std::shared_ptr<AbstractOperator> _on_recreate(
+      const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+      const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
   std::shared_ptr<const Table> _on_execute() override;
 };
 
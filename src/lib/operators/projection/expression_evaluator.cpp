@@ -0,0 +1,475 @@
+#include "expression_evaluator.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "operators/pqp_expression.hpp"
+#include "resolve_type.hpp"
+#include "storage/deprecated_dictionary_column.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/run_length_column.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// The buffer of the arena holds the intermediate results of typical expressions. Only larger expressions make the
+// arena fall back to malloc.
+constexpr size_t ARENA_SIZE = ExpressionEvaluator::BLOCK_SIZE * 64;
+
+// Used as the NULL flag of all rows of operands without NULLs
+constexpr bool NOT_NULL = false;
+
+bool is_comparison(const ExpressionType type) {
+  switch (type) {
+    case ExpressionType::Equals:
+    case ExpressionType::NotEquals:
+    case ExpressionType::LessThan:
+    case ExpressionType::LessThanEquals:
+    case ExpressionType::GreaterThan:
+    case ExpressionType::GreaterThanEquals:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool is_logical(const ExpressionType type) {
+  return type == ExpressionType::And || type == ExpressionType::Or || type == ExpressionType::Not;
+}
+
+// The data type both operands of an arithmetic operator or a comparison are promoted to
+DataType promote(const DataType left, const DataType right) {
+  if (left == DataType::Null) return right;
+  if (right == DataType::Null) return left;
+
+  Assert((left == DataType::String) == (right == DataType::String),
+         "Strings can only be combined with strings in expressions");
+
+  // The numeric data types are ordered from the narrowest to the widest
+  return std::max(left, right);
+}
+
+/**
+ * Applies the functor to all rows of two operands. A literal operand consists of a single value for all rows. The
+ * loops for all combinations of literals and arrays are written out, so that each of them can be vectorized.
+ */
+template <typename Result, typename Left, typename Right, typename Functor>
+void apply_binary(const Left* left, const bool left_is_literal, const Right* right, const bool right_is_literal,
+                  Result* result, const size_t row_count, const Functor& functor) {
+  if (left_is_literal && right_is_literal) {
+    result[0] = functor(left[0], right[0]);
+  } else if (left_is_literal) {
+    const auto& left_value = left[0];
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      result[row] = functor(left_value, right[row]);
+    }
+  } else if (right_is_literal) {
+    const auto& right_value = right[0];
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      result[row] = functor(left[row], right_value);
+    }
+  } else {
+    for (auto row = size_t{0}; row < row_count; ++row) {
+      result[row] = functor(left[row], right[row]);
+    }
+  }
+}
+
+}  // namespace
+
+template <typename T>
+struct ExpressionEvaluator::Block {
+  // One value per row, or a single value for all rows if is_literal is set. NULLs have undefined values.
+  pmr_vector<T> values;
+
+  // One flag per row (or a single one if is_literal is set), or nullptr if none of the values is NULL
+  bool* null_values;
+
+  bool is_literal;
+
+  size_t size() const { return values.size(); }
+  bool is_null(const size_t row) const { return null_values && null_values[is_literal ? 0 : row]; }
+};
+
+ExpressionEvaluator::ExpressionEvaluator(const std::shared_ptr<const Table>& table, const ChunkID chunk_id)
+    : _table(table), _chunk_id(chunk_id), _arena(ARENA_SIZE) {}
+
+DataType ExpressionEvaluator::data_type_of(const PQPExpression& expression, const Table& table) {
+  if (expression.type() == ExpressionType::Literal) return data_type_from_all_type_variant(expression.value());
+  if (expression.type() == ExpressionType::Column) return table.column_type(expression.column_id());
+
+  if (expression.type() == ExpressionType::Not) {
+    const auto operand_data_type = data_type_of(*expression.left_child(), table);
+    Assert(operand_data_type == DataType::Int || operand_data_type == DataType::Null,
+           "The operand of NOT has to be an int");
+    return DataType::Int;
+  }
+
+  Assert(expression.is_arithmetic_operator() || is_comparison(expression.type()) || is_logical(expression.type()),
+         "Projection only supports literals, columns, arithmetic operators, comparisons, and logical operators");
+
+  const auto left_data_type = data_type_of(*expression.left_child(), table);
+  const auto right_data_type = data_type_of(*expression.right_child(), table);
+
+  if (is_logical(expression.type())) {
+    Assert((left_data_type == DataType::Int || left_data_type == DataType::Null) &&
+               (right_data_type == DataType::Int || right_data_type == DataType::Null),
+           "The operands of AND and OR have to be ints");
+    return DataType::Int;
+  }
+
+  const auto data_type = promote(left_data_type, right_data_type);
+  if (is_comparison(expression.type())) return DataType::Int;
+
+  Assert(expression.type() != ExpressionType::Power, "Projection does not support the power operator");
+  Assert(data_type != DataType::String || expression.type() == ExpressionType::Addition,
+         "Arithmetic operators except for addition are not defined for strings");
+  return data_type;
+}
+
+std::shared_ptr<BaseColumn> ExpressionEvaluator::evaluate(const PQPExpression& expression, const DataType data_type) {
+  const auto row_count = static_cast<size_t>(_table->get_chunk(_chunk_id)->size());
+  auto column = std::shared_ptr<BaseColumn>{};
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    auto values = pmr_concurrent_vector<ColumnDataType>(row_count);
+    auto null_values = pmr_concurrent_vector<bool>(row_count);
+
+    for (auto begin = size_t{0}; begin < row_count; begin += BLOCK_SIZE) {
+      const auto block_row_count = std::min(BLOCK_SIZE, row_count - begin);
+
+      {
+        auto block = _evaluate_block_as<ColumnDataType>(expression, static_cast<ChunkOffset>(begin), block_row_count);
+        _write_block(block, block_row_count, values.begin() + begin, null_values.begin() + begin);
+      }
+
+      // The intermediate results of the block are gone, so the next block can reuse their memory
+      _arena.release();
+    }
+
+    column = std::make_shared<ValueColumn<ColumnDataType>>(std::move(values), std::move(null_values));
+  });
+
+  return column;
+}
+
+template <typename T>
+void ExpressionEvaluator::evaluate_block(const PQPExpression& expression, const ChunkOffset begin,
+                                         const size_t row_count, T* values, bool* null_values) {
+  DebugAssert(row_count <= BLOCK_SIZE, "Blocks cannot be larger than BLOCK_SIZE");
+
+  {
+    auto block = _evaluate_block_as<T>(expression, begin, row_count);
+    _write_block(block, row_count, values, null_values);
+  }
+
+  _arena.release();
+}
+
+template <typename T, typename ValuesIterator, typename NullValuesIterator>
+void ExpressionEvaluator::_write_block(Block<T>& block, const size_t row_count, ValuesIterator values_out,
+                                       NullValuesIterator null_values_out) {
+  if (block.is_literal) {
+    std::fill_n(values_out, row_count, block.values[0]);
+    std::fill_n(null_values_out, row_count, block.is_null(0));
+    return;
+  }
+
+  std::move(block.values.begin(), block.values.end(), values_out);
+  if (block.null_values) {
+    std::copy_n(block.null_values, row_count, null_values_out);
+  } else {
+    std::fill_n(null_values_out, row_count, false);
+  }
+}
+
+template <typename T>
+ExpressionEvaluator::Block<T> ExpressionEvaluator::_evaluate_block(const PQPExpression& expression,
+                                                                   const ChunkOffset begin, const size_t row_count) {
+  if (expression.type() == ExpressionType::Literal) return _literal_block<T>(boost::get<T>(expression.value()), false);
+  if (expression.type() == ExpressionType::Column) {
+    return _read_column_block<T>(expression.column_id(), begin, row_count);
+  }
+  if (expression.is_arithmetic_operator()) return _evaluate_arithmetic_block<T>(expression, begin, row_count);
+
+  if constexpr (std::is_same_v<T, int32_t>) {
+    if (is_comparison(expression.type())) return _evaluate_comparison_block(expression, begin, row_count);
+    if (is_logical(expression.type())) return _evaluate_logical_block(expression, begin, row_count);
+  }
+
+  Fail("Expression type is not supported by the Projection");
+}
+
+template <typename T>
+ExpressionEvaluator::Block<T> ExpressionEvaluator::_evaluate_block_as(const PQPExpression& expression,
+                                                                      const ChunkOffset begin,
+                                                                      const size_t row_count) {
+  const auto data_type = _data_type_of(expression);
+  if (data_type == DataType::Null) return _literal_block<T>(T{}, true);
+
+  // Blocks are not assigned but constructed in place, as moving them keeps the allocator of their values
+  auto result = std::optional<Block<T>>{};
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ExpressionDataType = typename decltype(type)::type;
+
+    if constexpr (std::is_same_v<ExpressionDataType, T>) {
+      result.emplace(_evaluate_block<T>(expression, begin, row_count));
+    } else if constexpr (std::is_same_v<ExpressionDataType, std::string> || std::is_same_v<T, std::string>) {
+      Fail("Strings cannot be converted to other data types in expressions");
+    } else {
+      const auto block = _evaluate_block<ExpressionDataType>(expression, begin, row_count);
+
+      auto values = pmr_vector<T>(block.size(), PolymorphicAllocator<T>{&_arena});
+      std::transform(block.values.begin(), block.values.end(), values.begin(),
+                     [](const ExpressionDataType value) { return static_cast<T>(value); });
+      result.emplace(Block<T>{std::move(values), block.null_values, block.is_literal});
+    }
+  });
+
+  return std::move(*result);
+}
+
+template <typename T>
+ExpressionEvaluator::Block<T> ExpressionEvaluator::_read_column_block(const ColumnID column_id,
+                                                                      const ChunkOffset begin,
+                                                                      const size_t row_count) {
+  const auto column = _table->get_chunk(_chunk_id)->get_column(column_id);
+
+  auto block =
+      Block<T>{pmr_vector<T>(row_count, PolymorphicAllocator<T>{&_arena}), _allocate_null_values(row_count), false};
+  auto values = block.values.data();
+
+  if (const auto value_column = std::dynamic_pointer_cast<const ValueColumn<T>>(column)) {
+    value_column->decode_block(begin, row_count, values, block.null_values);
+  } else if (const auto dictionary_column = std::dynamic_pointer_cast<const DictionaryColumn<T>>(column)) {
+    dictionary_column->decode_block(begin, row_count, values, block.null_values);
+  } else if (const auto deprecated_dictionary_column =
+                 std::dynamic_pointer_cast<const DeprecatedDictionaryColumn<T>>(column)) {
+    deprecated_dictionary_column->decode_block(begin, row_count, values, block.null_values);
+  } else if (const auto run_length_column = std::dynamic_pointer_cast<const RunLengthColumn<T>>(column)) {
+    run_length_column->decode_block(begin, row_count, values, block.null_values);
+  } else if (const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(column)) {
+    reference_column->decode_block<T>(begin, row_count, values, block.null_values);
+  } else {
+    Fail("Unknown column type");
+  }
+
+  // Operators can skip the NULL flags of operands without NULLs
+  if (std::none_of(block.null_values, block.null_values + row_count, [](const bool is_null) { return is_null; })) {
+    block.null_values = nullptr;
+  }
+
+  return block;
+}
+
+template <typename T>
+ExpressionEvaluator::Block<T> ExpressionEvaluator::_evaluate_arithmetic_block(const PQPExpression& expression,
+                                                                              const ChunkOffset begin,
+                                                                              const size_t row_count) {
+  const auto left = _evaluate_block_as<T>(*expression.left_child(), begin, row_count);
+  const auto right = _evaluate_block_as<T>(*expression.right_child(), begin, row_count);
+
+  if constexpr (std::is_same_v<T, std::string>) {
+    return _combine<T>(left, right, row_count, std::plus<T>{});
+  } else {
+    switch (expression.type()) {
+      case ExpressionType::Addition:
+        return _combine<T>(left, right, row_count, std::plus<T>{});
+      case ExpressionType::Subtraction:
+        return _combine<T>(left, right, row_count, std::minus<T>{});
+      case ExpressionType::Multiplication:
+        return _combine<T>(left, right, row_count, std::multiplies<T>{});
+      default:
+        break;
+    }
+
+    Assert(expression.type() == ExpressionType::Division || expression.type() == ExpressionType::Modulo,
+           "Unknown arithmetic operator");
+
+    if constexpr (std::is_floating_point_v<T>) {
+      if (expression.type() == ExpressionType::Division) return _combine<T>(left, right, row_count, std::divides<T>{});
+      return _combine<T>(left, right, row_count, [](const T lhs, const T rhs) { return std::fmod(lhs, rhs); });
+    } else {
+      // Integers cannot be divided by 0. The divisors of NULLs are replaced, as their values are undefined.
+      const auto result_row_count = left.is_literal && right.is_literal ? size_t{1} : row_count;
+      for (auto row = size_t{0}; row < result_row_count; ++row) {
+        if (right.values[right.is_literal ? 0 : row] == 0 && !left.is_null(row) && !right.is_null(row)) {
+          throw std::runtime_error("Cannot divide integers by 0.");
+        }
+      }
+
+      if (expression.type() == ExpressionType::Division) {
+        return _combine<T>(left, right, row_count, [](const T lhs, const T rhs) { return rhs == 0 ? 0 : lhs / rhs; });
+      }
+      return _combine<T>(left, right, row_count, [](const T lhs, const T rhs) { return rhs == 0 ? 0 : lhs % rhs; });
+    }
+  }
+}
+
+ExpressionEvaluator::Block<int32_t> ExpressionEvaluator::_evaluate_comparison_block(const PQPExpression& expression,
+                                                                                    const ChunkOffset begin,
+                                                                                    const size_t row_count) {
+  const auto data_type = promote(_data_type_of(*expression.left_child()), _data_type_of(*expression.right_child()));
+  if (data_type == DataType::Null) return _literal_block<int32_t>(0, true);
+
+  auto result = std::optional<Block<int32_t>>{};
+
+  resolve_data_type(data_type, [&](auto type) {
+    using OperandDataType = typename decltype(type)::type;
+
+    const auto left = _evaluate_block_as<OperandDataType>(*expression.left_child(), begin, row_count);
+    const auto right = _evaluate_block_as<OperandDataType>(*expression.right_child(), begin, row_count);
+
+    // The comparisons return int32_t, so that their results are written without conversion
+    const auto compare = [&](const auto& comparator) {
+      result.emplace(_combine<int32_t>(left, right, row_count,
+                                       [&](const OperandDataType& lhs, const OperandDataType& rhs) -> int32_t {
+                                         return comparator(lhs, rhs);
+                                       }));
+    };
+
+    switch (expression.type()) {
+      case ExpressionType::Equals:
+        compare(std::equal_to<OperandDataType>{});
+        break;
+      case ExpressionType::NotEquals:
+        compare(std::not_equal_to<OperandDataType>{});
+        break;
+      case ExpressionType::LessThan:
+        compare(std::less<OperandDataType>{});
+        break;
+      case ExpressionType::LessThanEquals:
+        compare(std::less_equal<OperandDataType>{});
+        break;
+      case ExpressionType::GreaterThan:
+        compare(std::greater<OperandDataType>{});
+        break;
+      case ExpressionType::GreaterThanEquals:
+        compare(std::greater_equal<OperandDataType>{});
+        break;
+      default:
+        Fail("Unknown comparison");
+    }
+  });
+
+  return std::move(*result);
+}
+
+ExpressionEvaluator::Block<int32_t> ExpressionEvaluator::_evaluate_logical_block(const PQPExpression& expression,
+                                                                                 const ChunkOffset begin,
+                                                                                 const size_t row_count) {
+  const auto left = _evaluate_block_as<int32_t>(*expression.left_child(), begin, row_count);
+
+  if (expression.type() == ExpressionType::Not) {
+    auto values = pmr_vector<int32_t>(left.size(), PolymorphicAllocator<int32_t>{&_arena});
+    std::transform(left.values.begin(), left.values.end(), values.begin(),
+                   [](const int32_t value) -> int32_t { return !value; });
+    return Block<int32_t>{std::move(values), left.null_values, left.is_literal};
+  }
+
+  const auto right = _evaluate_block_as<int32_t>(*expression.right_child(), begin, row_count);
+
+  const auto is_literal = left.is_literal && right.is_literal;
+  const auto result_row_count = is_literal ? size_t{1} : row_count;
+  auto result = Block<int32_t>{pmr_vector<int32_t>(result_row_count, PolymorphicAllocator<int32_t>{&_arena}),
+                               _allocate_null_values(result_row_count), is_literal};
+
+  // Three-valued logic: One operand that is not NULL decides the result of AND if it is false and the result of OR
+  // if it is true. Otherwise, the result is NULL if one of the operands is NULL.
+  const auto deciding_value = expression.type() == ExpressionType::Or;
+  for (auto row = size_t{0}; row < result_row_count; ++row) {
+    const auto left_is_null = left.is_null(row);
+    const auto right_is_null = right.is_null(row);
+    const auto left_value = static_cast<bool>(left.values[left.is_literal ? 0 : row]);
+    const auto right_value = static_cast<bool>(right.values[right.is_literal ? 0 : row]);
+
+    const auto decided = (!left_is_null && left_value == deciding_value) ||
+                         (!right_is_null && right_value == deciding_value);
+    result.null_values[row] = !decided && (left_is_null || right_is_null);
+    result.values[row] = decided ? deciding_value : !deciding_value;
+  }
+
+  return result;
+}
+
+template <typename Result, typename Left, typename Right, typename Functor>
+ExpressionEvaluator::Block<Result> ExpressionEvaluator::_combine(const Block<Left>& left, const Block<Right>& right,
+                                                                 const size_t row_count, const Functor& functor) {
+  const auto is_literal = left.is_literal && right.is_literal;
+  const auto result_row_count = is_literal ? size_t{1} : row_count;
+
+  auto result = Block<Result>{pmr_vector<Result>(result_row_count, PolymorphicAllocator<Result>{&_arena}), nullptr,
+                              is_literal};
+  apply_binary(left.values.data(), left.is_literal, right.values.data(), right.is_literal, result.values.data(),
+               result_row_count, functor);
+
+  // A row is NULL if one of its operands is NULL
+  if (left.null_values || right.null_values) {
+    result.null_values = _allocate_null_values(result_row_count);
+
+    // Operands without NULLs are treated like literals that are not NULL
+    const auto left_null_values_are_literal = !left.null_values || left.is_literal;
+    const auto right_null_values_are_literal = !right.null_values || right.is_literal;
+    if (left_null_values_are_literal && right_null_values_are_literal) {
+      std::fill_n(result.null_values, result_row_count, left.is_null(0) || right.is_null(0));
+    } else {
+      apply_binary(left.null_values ? left.null_values : &NOT_NULL, left_null_values_are_literal,
+                   right.null_values ? right.null_values : &NOT_NULL, right_null_values_are_literal,
+                   result.null_values, result_row_count,
+                   [](const bool left_is_null, const bool right_is_null) { return left_is_null || right_is_null; });
+    }
+  }
+
+  return result;
+}
+
+template <typename T>
+ExpressionEvaluator::Block<T> ExpressionEvaluator::_literal_block(const T& value, const bool is_null) {
+  auto block = Block<T>{pmr_vector<T>(1, value, PolymorphicAllocator<T>{&_arena}), nullptr, true};
+  if (is_null) {
+    block.null_values = _allocate_null_values(1);
+    block.null_values[0] = true;
+  }
+  return block;
+}
+
+bool* ExpressionEvaluator::_allocate_null_values(const size_t row_count) {
+  return static_cast<bool*>(_arena.allocate(row_count * sizeof(bool), alignof(bool)));
+}
+
+DataType ExpressionEvaluator::_data_type_of(const PQPExpression& expression) {
+  const auto iter = _data_types.find(&expression);
+  if (iter != _data_types.end()) return iter->second;
+
+  const auto data_type = data_type_of(expression, *_table);
+  _data_types.emplace(&expression, data_type);
+  return data_type;
+}
+
+template void ExpressionEvaluator::evaluate_block<int32_t>(const PQPExpression&, const ChunkOffset, const size_t,
+                                                           int32_t*, bool*);
+template void ExpressionEvaluator::evaluate_block<int64_t>(const PQPExpression&, const ChunkOffset, const size_t,
+                                                           int64_t*, bool*);
+template void ExpressionEvaluator::evaluate_block<float>(const PQPExpression&, const ChunkOffset, const size_t, float*,
+                                                         bool*);
+template void ExpressionEvaluator::evaluate_block<double>(const PQPExpression&, const ChunkOffset, const size_t,
+                                                          double*, bool*);
+template void ExpressionEvaluator::evaluate_block<std::string>(const PQPExpression&, const ChunkOffset, const size_t,
+                                                               std::string*, bool*);
+
+}  // namespace opossum
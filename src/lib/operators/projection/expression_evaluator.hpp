@@ -0,0 +1,110 @@
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+#include "utils/arena_memory_resource.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+class PQPExpression;
+class Table;
+
+/**
+ * Evaluates the expressions computed by the Projection on the rows of one chunk, column-wise.
+ *
+ * Instead of materializing every level of the expression tree for the whole chunk, the rows are processed in blocks
+ * of BLOCK_SIZE rows, so that the intermediate results stay in the cache. Within a block, every expression is
+ * evaluated into a plain array of values and a separate array of NULL flags by a tight loop, which the compiler
+ * specializes for the operator and the data types and can vectorize. Columns are read with decode_block. Literals
+ * are stored only once per block instead of being repeated for every row, and blocks without NULLs have no NULL
+ * flags at all.
+ *
+ * The intermediate buffers are allocated from an arena that is reset after every block, so that evaluating a chunk
+ * does not allocate memory block by block.
+ *
+ * Supported expressions:
+ *  - Literals and columns
+ *  - Arithmetic operators (+, -, *, /, %) on numbers, and + on strings, which concatenates them. If the operands have
+ *    different types, both are promoted to the wider one of them (int < long < float < double).
+ *  - Comparisons (=, !=, <, <=, >, >=), whose operands are promoted like those of arithmetic operators
+ *  - AND, OR, and NOT with the three-valued logic of SQL
+ * Comparisons and logical operators return an int column containing 0 and 1, as there is no boolean data type.
+ * Operators return NULL if one of their operands is NULL, except for AND and OR, which return a result if one
+ * operand decides it.
+ */
+class ExpressionEvaluator {
+ public:
+  static constexpr size_t BLOCK_SIZE = 4'096;
+
+  ExpressionEvaluator(const std::shared_ptr<const Table>& table, const ChunkID chunk_id);
+
+  // Returns the data type of the result of the expression on the table. DataType::Null if it is always NULL.
+  static DataType data_type_of(const PQPExpression& expression, const Table& table);
+
+  // Evaluates the expression on all rows of the chunk and returns the result as a nullable ValueColumn of the given
+  // data type, which has to be data_type_of(expression) or DataType::Int if that is DataType::Null.
+  std::shared_ptr<BaseColumn> evaluate(const PQPExpression& expression, const DataType data_type);
+
+  // Evaluates the expression on the rows [begin, begin + row_count) of the chunk, with row_count <= BLOCK_SIZE, and
+  // writes the result into values and null_values, which need room for row_count entries. Used by operators that
+  // consume the values of an expression right away, e.g., FusedAggregate.
+  template <typename T>
+  void evaluate_block(const PQPExpression& expression, const ChunkOffset begin, const size_t row_count, T* values,
+                      bool* null_values);
+
+ protected:
+  template <typename T>
+  struct Block;
+
+  // Writes the rows of the block into the output, repeating literals
+  template <typename T, typename ValuesIterator, typename NullValuesIterator>
+  static void _write_block(Block<T>& block, const size_t row_count, ValuesIterator values_out,
+                           NullValuesIterator null_values_out);
+
+  template <typename T>
+  Block<T> _evaluate_block(const PQPExpression& expression, const ChunkOffset begin, const size_t row_count);
+
+  // Evaluates the expression in its own data type and converts its result to T
+  template <typename T>
+  Block<T> _evaluate_block_as(const PQPExpression& expression, const ChunkOffset begin, const size_t row_count);
+
+  template <typename T>
+  Block<T> _read_column_block(const ColumnID column_id, const ChunkOffset begin, const size_t row_count);
+
+  template <typename T>
+  Block<T> _evaluate_arithmetic_block(const PQPExpression& expression, const ChunkOffset begin,
+                                      const size_t row_count);
+
+  Block<int32_t> _evaluate_comparison_block(const PQPExpression& expression, const ChunkOffset begin,
+                                            const size_t row_count);
+
+  Block<int32_t> _evaluate_logical_block(const PQPExpression& expression, const ChunkOffset begin,
+                                         const size_t row_count);
+
+  // Applies the functor to the values of the operands. A row of the result is NULL if one of its operands is NULL.
+  template <typename Result, typename Left, typename Right, typename Functor>
+  Block<Result> _combine(const Block<Left>& left, const Block<Right>& right, const size_t row_count,
+                         const Functor& functor);
+
+  template <typename T>
+  Block<T> _literal_block(const T& value, const bool is_null);
+
+  bool* _allocate_null_values(const size_t row_count);
+
+  // Returns data_type_of(expression), which is computed only once per expression and evaluator, not for every block
+  DataType _data_type_of(const PQPExpression& expression);
+
+  const std::shared_ptr<const Table> _table;
+  const ChunkID _chunk_id;
+
+  std::unordered_map<const PQPExpression*, DataType> _data_types;
+
+  ArenaMemoryResource _arena;
+};
+
+}  // namespace opossum
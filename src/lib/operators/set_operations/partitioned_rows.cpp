@@ -0,0 +1,178 @@
+#include "partitioned_rows.hpp"
+
+#include <boost/functional/hash.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/chunk.hpp"
+#include "storage/create_iterable_from_column.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Combined into the hashes of rows for NULLs
+constexpr size_t NULL_HASH = 0x9e3779b97f4a7c15;
+
+size_t partition_of(const size_t hash) {
+  // Multiplicative hashing spreads hashes whose high bits are all zero, e.g., those of small integers, across the
+  // partitions
+  return (hash * 0x9e3779b97f4a7c15) >> (64 - PartitionedRows::PARTITION_BITS);
+}
+
+}  // namespace
+
+class PartitionedRows::BaseMaterializedColumn {
+ public:
+  virtual ~BaseMaterializedColumn() = default;
+
+  // Materializes the column of the chunk and combines its values into the hashes of the rows of the chunk
+  virtual void materialize_chunk(const Table& table, const ChunkID chunk_id, const ColumnID column_id,
+                                 std::vector<size_t>& hashes) = 0;
+
+  virtual bool values_equal(const RowID& row_id, const BaseMaterializedColumn& other,
+                            const RowID& other_row_id) const = 0;
+};
+
+template <typename T>
+class PartitionedRows::MaterializedColumn : public PartitionedRows::BaseMaterializedColumn {
+ public:
+  explicit MaterializedColumn(const ChunkID chunk_count) : _values(chunk_count), _null_values(chunk_count) {}
+
+  void materialize_chunk(const Table& table, const ChunkID chunk_id, const ColumnID column_id,
+                         std::vector<size_t>& hashes) override {
+    const auto base_column = table.get_chunk(chunk_id)->get_column(column_id);
+    auto& values = _values[chunk_id];
+    auto& null_values = _null_values[chunk_id];
+    values.resize(base_column->size());
+    null_values.resize(base_column->size());
+
+    resolve_column_type<T>(*base_column, [&](auto& typed_column) {
+      auto iterable = create_iterable_from_column<T>(typed_column);
+      iterable.for_each([&](const auto& value) {
+        const auto chunk_offset = value.chunk_offset();
+
+        if (value.is_null()) {
+          null_values[chunk_offset] = true;
+          boost::hash_combine(hashes[chunk_offset], NULL_HASH);
+          return;
+        }
+
+        if constexpr (std::is_floating_point_v<T>) {
+          // -0.0 and 0.0 are equal, so they need the same hash
+          values[chunk_offset] = value.value() == T{0} ? T{0} : value.value();
+        } else {
+          values[chunk_offset] = value.value();
+        }
+        boost::hash_combine(hashes[chunk_offset], values[chunk_offset]);
+      });
+    });
+  }
+
+  bool values_equal(const RowID& row_id, const BaseMaterializedColumn& other,
+                    const RowID& other_row_id) const override {
+    const auto& other_column = static_cast<const MaterializedColumn<T>&>(other);
+
+    const auto is_null = _null_values[row_id.chunk_id][row_id.chunk_offset];
+    const auto other_is_null = other_column._null_values[other_row_id.chunk_id][other_row_id.chunk_offset];
+    if (is_null || other_is_null) return is_null == other_is_null;
+
+    return _values[row_id.chunk_id][row_id.chunk_offset] ==
+           other_column._values[other_row_id.chunk_id][other_row_id.chunk_offset];
+  }
+
+ protected:
+  std::vector<std::vector<T>> _values;
+  std::vector<std::vector<bool>> _null_values;
+};
+
+PartitionedRows::PartitionedRows(const std::shared_ptr<const Table>& table)
+    : _table(table), _partitions(PARTITION_COUNT) {
+  const auto chunk_count = _table->chunk_count();
+
+  for (ColumnID column_id{0}; column_id < _table->column_count(); ++column_id) {
+    resolve_data_type(_table->column_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      _columns.emplace_back(std::make_shared<MaterializedColumn<ColumnDataType>>(chunk_count));
+    });
+  }
+
+  // 1. Materialize and hash the rows, and assign them to partitions, one task per chunk
+  auto chunk_partitions = std::vector<std::vector<std::vector<Row>>>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      auto hashes = std::vector<size_t>(_table->get_chunk(chunk_id)->size());
+      for (ColumnID column_id{0}; column_id < _columns.size(); ++column_id) {
+        _columns[column_id]->materialize_chunk(*_table, chunk_id, column_id, hashes);
+      }
+
+      auto& partitions = chunk_partitions[chunk_id];
+      partitions.resize(PARTITION_COUNT);
+      for (ChunkOffset chunk_offset{0}; chunk_offset < hashes.size(); ++chunk_offset) {
+        const auto hash = hashes[chunk_offset];
+        partitions[partition_of(hash)].emplace_back(Row{hash, RowID{chunk_id, chunk_offset}});
+      }
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  // 2. Concatenate the parts of every partition in the order of the chunks, one task per partition
+  jobs.clear();
+  for (auto partition_id = size_t{0}; partition_id < PARTITION_COUNT; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      auto& partition = _partitions[partition_id];
+      for (const auto& partitions : chunk_partitions) {
+        partition.insert(partition.end(), partitions[partition_id].begin(), partitions[partition_id].end());
+      }
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+}
+
+const std::shared_ptr<const Table>& PartitionedRows::table() const { return _table; }
+
+const std::vector<PartitionedRows::Row>& PartitionedRows::partition(const size_t partition_id) const {
+  return _partitions[partition_id];
+}
+
+bool PartitionedRows::rows_equal(const RowID& row_id, const PartitionedRows& other, const RowID& other_row_id) const {
+  DebugAssert(_columns.size() == other._columns.size(), "Rows need to have the same columns to be compared");
+
+  for (auto column_id = size_t{0}; column_id < _columns.size(); ++column_id) {
+    if (!_columns[column_id]->values_equal(row_id, *other._columns[column_id], other_row_id)) return false;
+  }
+  return true;
+}
+
+PartitionedRowSet::PartitionedRowSet(const PartitionedRows& rows) : _rows(rows) {}
+
+bool PartitionedRowSet::contains(const PartitionedRows& rows, const PartitionedRows::Row& row) const {
+  const auto row_ids_it = _row_ids_by_hash.find(row.hash);
+  if (row_ids_it == _row_ids_by_hash.end()) return false;
+
+  return std::any_of(row_ids_it->second.begin(), row_ids_it->second.end(),
+                     [&](const auto& row_id) { return _rows.rows_equal(row_id, rows, row.row_id); });
+}
+
+bool PartitionedRowSet::insert(const PartitionedRows::Row& row) {
+  if (contains(_rows, row)) return false;
+
+  _row_ids_by_hash[row.hash].emplace_back(row.row_id);
+  return true;
+}
+
+}  // namespace opossum
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * The rows of a table, materialized and partitioned by their hashes. Distinct and HashSetOperation use them to find
+ * equal rows in parallel.
+ *
+ * Every chunk is processed by a task of its own. Its columns are materialized into typed vectors, and the hashes of
+ * its rows are computed column by column: Every column is resolved to its type once and its values are combined into
+ * the hashes of their rows in a tight loop. Afterwards, the rows are assigned to PARTITION_COUNT partitions by their
+ * hashes. As equal rows end up in the same partition, the partitions can be processed by independent tasks.
+ *
+ * Rows are compared value by value, with NULLs being equal to each other, as set operations and DISTINCT require.
+ */
+class PartitionedRows {
+ public:
+  static constexpr size_t PARTITION_BITS = 5;
+  static constexpr size_t PARTITION_COUNT = size_t{1} << PARTITION_BITS;
+
+  struct Row {
+    size_t hash;
+    RowID row_id;
+  };
+
+  explicit PartitionedRows(const std::shared_ptr<const Table>& table);
+
+  const std::shared_ptr<const Table>& table() const;
+
+  // The rows of a partition in the order of the table
+  const std::vector<Row>& partition(const size_t partition_id) const;
+
+  // Whether the row of this table equals the row of other, which has to have the same column types
+  bool rows_equal(const RowID& row_id, const PartitionedRows& other, const RowID& other_row_id) const;
+
+ protected:
+  class BaseMaterializedColumn;
+
+  template <typename T>
+  class MaterializedColumn;
+
+  const std::shared_ptr<const Table> _table;
+  std::vector<std::shared_ptr<BaseMaterializedColumn>> _columns;
+  std::vector<std::vector<Row>> _partitions;
+};
+
+/**
+ * Set of rows of one partition of a PartitionedRows, in which rows of the same partition of another PartitionedRows
+ * (or of the same one) can be looked up. Rows are only inserted if no equal row is contained yet.
+ */
+class PartitionedRowSet {
+ public:
+  explicit PartitionedRowSet(const PartitionedRows& rows);
+
+  bool contains(const PartitionedRows& rows, const PartitionedRows::Row& row) const;
+
+  // Returns false if an equal row is already contained
+  bool insert(const PartitionedRows::Row& row);
+
+ protected:
+  const PartitionedRows& _rows;
+
+  // Distinct rows by their hashes
+  std::unordered_map<size_t, std::vector<RowID>> _row_ids_by_hash;
+};
+
+}  // namespace opossum
@@ -1,218 +1,157 @@
 #include "sort.hpp"
 
-#include <functional>
+#include <algorithm>
+#include <limits>
 #include <memory>
+#include <numeric>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
-#include "storage/column_iterables/chunk_offset_mapping.hpp"
-#include "storage/reference_column.hpp"
-#include "storage/value_column.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "sort/normalized_sort_keys.hpp"
+#include "sort/sort_output.hpp"
+#include "utils/assert.hpp"
 
 namespace opossum {
 
-Sort::Sort(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id, const OrderByMode order_by_mode,
-           const size_t output_chunk_size)
+namespace {
+
+// Every run that is sorted by a task of its own has at least this many rows, as smaller runs do not pay off the
+// additional merging
+constexpr size_t MIN_ROWS_PER_RUN = 10'000;
+
+}  // namespace
+
+Sort::Sort(const std::shared_ptr<const AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_definitions,
+           const size_t output_chunk_size, const SortOutputMode output_mode)
     : AbstractReadOnlyOperator(in),
-      _column_id(column_id),
-      _order_by_mode(order_by_mode),
-      _output_chunk_size(output_chunk_size) {}
+      _sort_definitions(sort_definitions),
+      _output_chunk_size(output_chunk_size),
+      _output_mode(output_mode) {
+  DebugAssert(!_sort_definitions.empty(), "Sort needs at least one sort definition");
+}
+
+Sort::Sort(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id, const OrderByMode order_by_mode,
+           const size_t output_chunk_size, const SortOutputMode output_mode)
+    : Sort(in, std::vector<SortColumnDefinition>{{column_id, order_by_mode}}, output_chunk_size, output_mode) {}
 
-ColumnID Sort::column_id() const { return _column_id; }
+const std::vector<SortColumnDefinition>& Sort::sort_definitions() const { return _sort_definitions; }
 
-OrderByMode Sort::order_by_mode() const { return _order_by_mode; }
+ColumnID Sort::column_id() const { return _sort_definitions.front().column_id; }
+
+OrderByMode Sort::order_by_mode() const { return _sort_definitions.front().order_by_mode; }
+
+SortOutputMode Sort::output_mode() const { return _output_mode; }
 
 const std::string Sort::name() const { return "Sort"; }
 
-std::shared_ptr<AbstractOperator> Sort::recreate(const std::vector<AllParameterVariant>& args) const {
-  return std::make_shared<Sort>(_input_left->recreate(args), _column_id, _order_by_mode, _output_chunk_size);
+std::shared_ptr<AbstractOperator> Sort::_on_recreate(
+    const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+    const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
+  return std::make_shared<Sort>(recreated_input_left, _sort_definitions, _output_chunk_size, _output_mode);
 }
 
 std::shared_ptr<const Table> Sort::_on_execute() {
-  _impl = make_unique_by_data_type<AbstractReadOnlyOperatorImpl, SortImpl>(_input_table_left()->column_type(_column_id),
-                                                                           _input_table_left(), _column_id,
-                                                                           _order_by_mode, _output_chunk_size);
-  return _impl->_on_execute();
-}
+  const auto table_in = _input_table_left();
 
-void Sort::_on_cleanup() { _impl.reset(); }
-
-// This class fulfills only the materialization task for a sorted row_id_value_vector.
-template <typename SortColumnType>
-class Sort::SortImplMaterializeOutput {
- public:
-  // creates a new table with reference columns
-  SortImplMaterializeOutput(std::shared_ptr<const Table> in,
-                            std::shared_ptr<std::vector<std::pair<RowID, SortColumnType>>> id_value_map,
-                            const size_t output_chunk_size)
-      : _table_in(in), _output_chunk_size(output_chunk_size), _row_id_value_vector(id_value_map) {}
-
-  std::shared_ptr<const Table> execute() {
-    // First we create a new table as the output
-    auto output = Table::create_with_layout_from(_table_in, _output_chunk_size);
-
-    // We have decided against duplicating MVCC columns in https://github.com/hyrise/hyrise/issues/408
-
-    // After we created the output table and initialized the column structure, we can start adding values. Because the
-    // values are not ordered by input chunks anymore, we can't process them chunk by chunk. Instead the values are
-    // copied column by column for each output row. For each column in a row we visit the input column with a reference
-    // to the output column. This enables for the SortImplMaterializeOutput class to ignore the column types during the
-    // copying of the values.
-    const auto row_count_out = _row_id_value_vector->size();
-
-    // Ceiling of integer division
-    const auto div_ceil = [](auto x, auto y) { return (x + y - 1u) / y; };
-
-    const auto chunk_count_out = div_ceil(row_count_out, _output_chunk_size);
-
-    auto chunks_out = std::vector<std::shared_ptr<Chunk>>(chunk_count_out);
-    std::generate(chunks_out.begin(), chunks_out.end(), []() { return std::make_shared<Chunk>(); });
-
-    // Materialize column-wise
-    for (ColumnID column_id{0u}; column_id < output->column_count(); ++column_id) {
-      const auto column_data_type = output->column_type(column_id);
-
-      resolve_data_type(column_data_type, [&](auto type) {
-        using ColumnDataType = typename decltype(type)::type;
-
-        // Initialize value columns
-        auto columns_out = std::vector<std::shared_ptr<ValueColumn<ColumnDataType>>>(chunk_count_out);
-        std::generate(columns_out.begin(), columns_out.end(),
-                      []() { return std::make_shared<ValueColumn<ColumnDataType>>(true); });
-
-        auto column_it = columns_out.begin();
-        auto chunk_it = chunks_out.begin();
-        auto chunk_offset_out = 0u;
-        for (auto row_index = 0u; row_index < row_count_out; ++row_index) {
-          const auto[chunk_id, chunk_offset] = _row_id_value_vector->at(row_index).first;
-
-          const auto column = _table_in->get_chunk(chunk_id)->get_column(column_id);
-
-          // Previously the value was retrieved by calling a virtual method,
-          // which was just as slow as using the subscript operator.
-          const auto value = (*column)[chunk_offset];
-          (*column_it)->append(value);
-
-          ++chunk_offset_out;
-
-          // Check if value column is full
-          if (chunk_offset_out >= _output_chunk_size) {
-            chunk_offset_out = 0u;
-            (*chunk_it)->add_column(*column_it);
-            ++column_it;
-            ++chunk_it;
-          }
-        }
-
-        // Last column has not been added
-        if (chunk_offset_out > 0u) {
-          (*chunk_it)->add_column(*column_it);
-        }
-      });
-    }
-
-    for (auto& chunk : chunks_out) {
-      output->emplace_chunk(std::move(chunk));
-    }
+  const auto sorted_rows = _sort_rows(table_in);
 
-    return output;
+  if (_output_mode == SortOutputMode::References) {
+    if (const auto output = write_reference_output(table_in, sorted_rows, _output_chunk_size)) return output;
   }
 
-  const std::shared_ptr<const Table> _table_in;
-  const size_t _output_chunk_size;
-  const std::shared_ptr<std::vector<std::pair<RowID, SortColumnType>>> _row_id_value_vector;
-};
-
-// we need to use the impl pattern because the scan operator of the sort depends on the type of the column
-template <typename SortColumnType>
-class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
- public:
-  using RowIDValuePair = std::pair<RowID, SortColumnType>;
-
-  SortImpl(const std::shared_ptr<const Table> table_in, const ColumnID column_id,
-           const OrderByMode order_by_mode = OrderByMode::Ascending, const size_t output_chunk_size = 0)
-      : _table_in(table_in),
-        _column_id(column_id),
-        _order_by_mode(order_by_mode),
-        _output_chunk_size(output_chunk_size) {
-    // initialize a structure which can be sorted by std::sort
-    _row_id_value_vector = std::make_shared<std::vector<RowIDValuePair>>();
-    _null_value_rows = std::make_shared<std::vector<RowIDValuePair>>();
+  return write_materialized_output(table_in, sorted_rows, _output_chunk_size);
+}
+
+PosList Sort::_sort_rows(const std::shared_ptr<const Table>& table_in) const {
+  const auto row_count = static_cast<size_t>(table_in->row_count());
+  Assert(row_count <= std::numeric_limits<uint32_t>::max(), "Sort does not support more than 2^32 - 1 rows");
+
+  auto chunk_row_offsets = std::vector<size_t>(table_in->chunk_count());
+  for (ChunkID chunk_id{1}; chunk_id < table_in->chunk_count(); ++chunk_id) {
+    chunk_row_offsets[chunk_id] = chunk_row_offsets[chunk_id - 1] + table_in->get_chunk(ChunkID{chunk_id - 1})->size();
   }
 
-  std::shared_ptr<const Table> _on_execute() override {
-    // 1. Prepare Sort: Creating rowid-value-Structure
-    _materialize_sort_column();
+  // 1. Build the keys, one task per chunk. Every task writes to the rows of its chunk only.
+  auto row_ids = PosList(row_count);
+  auto keys = NormalizedSortKeys(*table_in, _sort_definitions, row_count);
 
-    // 2. After we got our ValueRowID Map we sort the map by the value of the pair
-    if (_order_by_mode == OrderByMode::Ascending || _order_by_mode == OrderByMode::AscendingNullsLast) {
-      sort_with_operator<std::less<>>();
-    } else {
-      sort_with_operator<std::greater<>>();
-    }
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(table_in->chunk_count());
+  for (ChunkID chunk_id{0}; chunk_id < table_in->chunk_count(); ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto chunk = table_in->get_chunk(chunk_id);
+      const auto row_offset = chunk_row_offsets[chunk_id];
 
-    // 2b. Insert null rows if necessary
-    if (_null_value_rows->size()) {
-      if (_order_by_mode == OrderByMode::AscendingNullsLast || _order_by_mode == OrderByMode::DescendingNullsLast) {
-        // NULLs last
-        _row_id_value_vector->insert(_row_id_value_vector->end(), _null_value_rows->begin(), _null_value_rows->end());
-      } else {
-        // NULLs first (default behavior)
-        _row_id_value_vector->insert(_row_id_value_vector->begin(), _null_value_rows->begin(), _null_value_rows->end());
+      for (ChunkOffset chunk_offset{0}; chunk_offset < chunk->size(); ++chunk_offset) {
+        row_ids[row_offset + chunk_offset] = RowID{chunk_id, chunk_offset};
       }
-    }
 
-    // 3. Materialization of the result: We take the sorted ValueRowID Vector, create chunks fill them until they are
-    // full and create the next one. Each chunk is filled row by row.
-    auto materialization = std::make_shared<SortImplMaterializeOutput<SortColumnType>>(_table_in, _row_id_value_vector,
-                                                                                       _output_chunk_size);
-    return materialization->execute();
+      keys.encode_chunk(*chunk, row_offset);
+    }));
+    jobs.back()->schedule();
   }
+  CurrentScheduler::wait_for_tasks(jobs);
 
-  // completely materializes the sort column to create a vector of RowID-Value pairs
-  void _materialize_sort_column() {
-    auto& row_id_value_vector = *_row_id_value_vector;
-    row_id_value_vector.reserve(_table_in->row_count());
-
-    auto& null_value_rows = *_null_value_rows;
+  const auto compare_rows = [&](const uint32_t lhs, const uint32_t rhs) { return keys.less(lhs, rhs); };
 
-    for (ChunkID chunk_id{0}; chunk_id < _table_in->chunk_count(); ++chunk_id) {
-      auto chunk = _table_in->get_chunk(chunk_id);
+  // 2. Sort runs of the rows in parallel
+  auto rows = std::vector<uint32_t>(row_count);
+  std::iota(rows.begin(), rows.end(), uint32_t{0});
 
-      auto base_column = chunk->get_column(_column_id);
+  const auto max_run_count = std::max(size_t{1}, static_cast<size_t>(std::thread::hardware_concurrency()));
+  const auto run_count = std::clamp(row_count / MIN_ROWS_PER_RUN, size_t{1}, max_run_count);
 
-      resolve_column_type<SortColumnType>(*base_column, [&](auto& typed_column) {
-        auto iterable = create_iterable_from_column<SortColumnType>(typed_column);
-
-        iterable.for_each([&](const auto& value) {
-          if (value.is_null()) {
-            null_value_rows.emplace_back(RowID{chunk_id, value.chunk_offset()}, SortColumnType{});
-          } else {
-            row_id_value_vector.emplace_back(RowID{chunk_id, value.chunk_offset()}, value.value());
-          }
-        });
-      });
-    }
+  auto run_bounds = std::vector<size_t>{};
+  for (auto run_id = size_t{0}; run_id <= run_count; ++run_id) {
+    run_bounds.emplace_back(run_id * row_count / run_count);
   }
 
-  template <typename Comparator>
-  void sort_with_operator() {
-    Comparator comparator;
-    std::stable_sort(_row_id_value_vector->begin(), _row_id_value_vector->end(),
-                     [comparator](RowIDValuePair a, RowIDValuePair b) { return comparator(a.second, b.second); });
+  jobs.clear();
+  for (auto run_id = size_t{0}; run_id < run_count; ++run_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, run_id]() {
+      std::sort(rows.begin() + run_bounds[run_id], rows.begin() + run_bounds[run_id + 1], compare_rows);
+    }));
+    jobs.back()->schedule();
   }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  // 3. Merge pairs of sorted runs in parallel until only one run is left
+  auto merged_rows = std::vector<uint32_t>(run_count > 1 ? row_count : 0);
+  while (run_bounds.size() > 2) {
+    auto merged_run_bounds = std::vector<size_t>{};
+
+    jobs.clear();
+    for (auto run_id = size_t{0}; run_id + 1 < run_bounds.size(); run_id += 2) {
+      merged_run_bounds.emplace_back(run_bounds[run_id]);
+
+      jobs.emplace_back(std::make_shared<JobTask>([&, run_id]() {
+        const auto begin = rows.begin() + run_bounds[run_id];
+        const auto middle = rows.begin() + run_bounds[run_id + 1];
+        // The last run is only copied if it has no partner
+        const auto end = run_id + 2 < run_bounds.size() ? rows.begin() + run_bounds[run_id + 2] : middle;
+
+        std::merge(begin, middle, middle, end, merged_rows.begin() + run_bounds[run_id], compare_rows);
+      }));
+      jobs.back()->schedule();
+    }
+    merged_run_bounds.emplace_back(row_count);
+    CurrentScheduler::wait_for_tasks(jobs);
 
-  const std::shared_ptr<const Table> _table_in;
+    std::swap(rows, merged_rows);
+    run_bounds = std::move(merged_run_bounds);
+  }
 
-  // column to sort by
-  const ColumnID _column_id;
-  const OrderByMode _order_by_mode;
-  // chunk size of the materialized output
-  const size_t _output_chunk_size;
+  auto sorted_rows = PosList(row_count);
+  for (auto row_index = size_t{0}; row_index < row_count; ++row_index) {
+    sorted_rows[row_index] = row_ids[rows[row_index]];
+  }
 
-  std::shared_ptr<std::vector<RowIDValuePair>> _row_id_value_vector;
-  std::shared_ptr<std::vector<RowIDValuePair>> _null_value_rows;
-};
+  return sorted_rows;
+}
 
 }  // namespace opossum
@@ -1,52 +1,68 @@
 #pragma once
 
-#include <algorithm>
-#include <functional>
 #include <memory>
 #include <string>
-#include <utility>
 #include <vector>
 
 #include "abstract_read_only_operator.hpp"
-#include "resolve_type.hpp"
-#include "storage/create_iterable_from_column.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
+struct SortColumnDefinition {
+  ColumnID column_id;
+  OrderByMode order_by_mode = OrderByMode::Ascending;
+};
+
+// Whether Sort returns ReferenceColumns pointing to the sorted rows or copies the rows into new ValueColumns.
+// References are cheaper to write and suffice for most consumers, as they only access the positions or few values.
+enum class SortOutputMode { References, Values };
+
 /**
- * Operator to sort a table by a single column. This implements a stable sort, i.e., rows that share the same value will
- * maintain their relative order.
- * Multi-column sort is not supported yet. For now, you will have to sort by the secondary criterion, then by the first
+ * Operator to sort a table by one or more columns. This implements a stable sort, i.e., rows that share the same values
+ * will maintain their relative order.
+ *
+ * The values of all sort columns of a row are encoded into one normalized key that can be compared with memcmp (see
+ * NormalizedSortKeys). The keys are built per input chunk and sorted in runs in parallel. The sorted runs are then
+ * merged pairwise, again in parallel.
+ *
+ * By default, the output consists of ReferenceColumns. If the columns of the input cannot be referenced by one
+ * ReferenceColumn each (e.g., if they are partly stored in the input and partly referenced by it), or if
+ * SortOutputMode::Values is requested, the sorted rows are materialized (see write_reference_output() and
+ * write_materialized_output()).
  */
 class Sort : public AbstractReadOnlyOperator {
  public:
-  // The parameter chunk_size sets the chunk size of the output table, which will always be materialized
+  // The parameter output_chunk_size sets the chunk size of the output table
+  Sort(const std::shared_ptr<const AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_definitions,
+       const size_t output_chunk_size = Chunk::MAX_SIZE,
+       const SortOutputMode output_mode = SortOutputMode::References);
   Sort(const std::shared_ptr<const AbstractOperator> in, const ColumnID column_id,
-       const OrderByMode order_by_mode = OrderByMode::Ascending, const size_t output_chunk_size = Chunk::MAX_SIZE);
+       const OrderByMode order_by_mode = OrderByMode::Ascending, const size_t output_chunk_size = Chunk::MAX_SIZE,
+       const SortOutputMode output_mode = SortOutputMode::References);
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
 
+  // Column and order of the first (i.e., primary) sort definition
   ColumnID column_id() const;
   OrderByMode order_by_mode() const;
 
+  SortOutputMode output_mode() const;
+
   const std::string name() const override;
-  std::shared_ptr<AbstractOperator> recreate(const std::vector<AllParameterVariant>& args = {}) const override;
 
  protected:
+  std::shared_ptr<AbstractOperator> _on_recreate(
+      const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+      const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
   std::shared_ptr<const Table> _on_execute() override;
-  void _on_cleanup() override;
-
-  // The operator is separated in three different classes. SortImpl is the common templated implementation of the
-  // operator. SortImpl* und SortImplMaterializeOutput are extra classes for the visitor pattern. They fulfill a certain
-  // task during the Sort process, as described later on.
-  template <typename SortColumnType>
-  class SortImpl;
-  template <typename SortColumnType>
-  class SortImplMaterializeOutput;
-
-  std::unique_ptr<AbstractReadOnlyOperatorImpl> _impl;
-  const ColumnID _column_id;
-  const OrderByMode _order_by_mode;
+
+  // Returns the positions of the input rows in sorted order
+  PosList _sort_rows(const std::shared_ptr<const Table>& table_in) const;
+
+  const std::vector<SortColumnDefinition> _sort_definitions;
   const size_t _output_chunk_size;
+  const SortOutputMode _output_mode;
 };
 
 }  // namespace opossum
@@ -0,0 +1,157 @@
+#include "normalized_sort_keys.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/create_iterable_from_column.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+bool nulls_first(const OrderByMode order_by_mode) {
+  return order_by_mode == OrderByMode::Ascending || order_by_mode == OrderByMode::Descending;
+}
+
+bool is_descending(const OrderByMode order_by_mode) {
+  return order_by_mode == OrderByMode::Descending || order_by_mode == OrderByMode::DescendingNullsLast;
+}
+
+template <typename T>
+constexpr size_t encoded_value_width() {
+  if constexpr (std::is_same_v<T, std::string>) {
+    return NormalizedSortKeys::STRING_PREFIX_LENGTH;
+  } else {
+    return sizeof(T);
+  }
+}
+
+template <typename UnsignedType>
+void write_big_endian(UnsignedType value, uint8_t* bytes) {
+  for (auto byte_index = sizeof(UnsignedType); byte_index > 0; --byte_index) {
+    bytes[byte_index - 1] = static_cast<uint8_t>(value);
+    value >>= 8;
+  }
+}
+
+template <typename T>
+void encode_value(const T& value, uint8_t* bytes) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    std::memcpy(bytes, value.data(), std::min(value.size(), NormalizedSortKeys::STRING_PREFIX_LENGTH));
+  } else if constexpr (std::is_integral_v<T>) {
+    using UnsignedType = std::make_unsigned_t<T>;
+    const auto sign_bit = UnsignedType{1} << (sizeof(T) * 8 - 1);
+    write_big_endian(static_cast<UnsignedType>(static_cast<UnsignedType>(value) ^ sign_bit), bytes);
+  } else {
+    using UnsignedType = std::conditional_t<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>;
+    const auto sign_bit = UnsignedType{1} << (sizeof(T) * 8 - 1);
+
+    // -0.0 and 0.0 are equal, so they need the same encoding
+    const auto normalized_value = value == T{0} ? T{0} : value;
+    auto bits = UnsignedType{};
+    std::memcpy(&bits, &normalized_value, sizeof(T));
+
+    write_big_endian(static_cast<UnsignedType>((bits & sign_bit) ? ~bits : bits ^ sign_bit), bytes);
+  }
+}
+
+}  // namespace
+
+NormalizedSortKeys::NormalizedSortKeys(const Table& table, const std::vector<SortColumnDefinition>& sort_definitions,
+                                       const size_t row_count)
+    : _sort_definitions(sort_definitions), _key_width(0), _strings(sort_definitions.size()) {
+  for (auto definition_id = size_t{0}; definition_id < _sort_definitions.size(); ++definition_id) {
+    const auto& definition = _sort_definitions[definition_id];
+    const auto data_type = table.column_type(definition.column_id);
+
+    _data_types.emplace_back(data_type);
+    _key_offsets.emplace_back(_key_width);
+
+    resolve_data_type(data_type, [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      _key_width += 1 + encoded_value_width<ColumnDataType>();
+
+      if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+        _strings[definition_id].resize(row_count);
+        _key_segments.emplace_back(KeySegment{_key_width, definition_id, is_descending(definition.order_by_mode)});
+      }
+    });
+  }
+
+  if (_key_segments.empty() || _key_segments.back().end != _key_width) {
+    _key_segments.emplace_back(KeySegment{_key_width, std::nullopt, false});
+  }
+
+  _keys.resize(row_count * _key_width);
+}
+
+void NormalizedSortKeys::encode_chunk(const Chunk& chunk, const size_t first_row) {
+  encode_rows(chunk, ChunkOffset{0}, static_cast<ChunkOffset>(chunk.size()), first_row);
+}
+
+void NormalizedSortKeys::encode_rows(const Chunk& chunk, const ChunkOffset begin, const ChunkOffset end,
+                                     const size_t first_row) {
+  DebugAssert(begin <= end && end <= chunk.size(), "Rows exceed the chunk");
+
+  for (auto definition_id = size_t{0}; definition_id < _sort_definitions.size(); ++definition_id) {
+    const auto& definition = _sort_definitions[definition_id];
+    const auto null_byte = nulls_first(definition.order_by_mode) ? uint8_t{0} : uint8_t{1};
+    const auto descending = is_descending(definition.order_by_mode);
+    const auto base_column = chunk.get_column(definition.column_id);
+
+    resolve_data_and_column_type(_data_types[definition_id], *base_column, [&](auto type, auto& column) {
+      using ColumnDataType = typename decltype(type)::type;
+      constexpr auto value_width = encoded_value_width<ColumnDataType>();
+
+      const auto encode = [&](const auto& value) {
+        const auto row = first_row + (value.chunk_offset() - begin);
+        auto* const key = _keys.data() + row * _key_width + _key_offsets[definition_id];
+
+        if (value.is_null()) {
+          key[0] = null_byte;
+          return;
+        }
+
+        key[0] = null_byte ^ uint8_t{1};
+        encode_value(value.value(), key + 1);
+
+        if (descending) {
+          for (auto byte_index = size_t{1}; byte_index <= value_width; ++byte_index) {
+            key[byte_index] = ~key[byte_index];
+          }
+        }
+
+        if constexpr (std::is_same_v<ColumnDataType, std::string>) {
+          _strings[definition_id][row] = value.value();
+        }
+      };
+
+      // The iterators only allow forward traversal, so the rows before begin are skipped one by one
+      auto iterable = create_iterable_from_column<ColumnDataType>(column);
+      iterable.with_iterators([&](auto it, auto) {
+        for (auto chunk_offset = ChunkOffset{0}; chunk_offset < begin; ++chunk_offset) ++it;
+        for (auto chunk_offset = begin; chunk_offset < end; ++chunk_offset, ++it) encode(*it);
+      });
+    });
+  }
+}
+
+void NormalizedSortKeys::copy_key(const NormalizedSortKeys& source, const size_t source_row, const size_t target_row) {
+  DebugAssert(source._key_width == _key_width, "Keys need to be built for the same sort definitions");
+
+  std::memcpy(_keys.data() + target_row * _key_width, source._keys.data() + source_row * _key_width, _key_width);
+
+  for (auto definition_id = size_t{0}; definition_id < _strings.size(); ++definition_id) {
+    if (_strings[definition_id].empty()) continue;
+    _strings[definition_id][target_row] = source._strings[definition_id][source_row];
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <cstring>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "operators/sort.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Chunk;
+class Table;
+
+/**
+ * Normalized sort keys of a number of rows, which are used by Sort and TopK.
+ *
+ * The values of all sort columns of a row are encoded into one fixed-width key, so that comparing two keys with
+ * memcmp orders the rows like the sort definitions do. The key consists of one part per sort definition. Each part
+ * starts with a byte that places NULLs before or after all values, followed by the encoded value:
+ *  - Integers are written in big-endian order with their sign bit flipped, so that negative values come first.
+ *  - Floating point numbers are written in big-endian order as well. Positive numbers get their sign bit flipped,
+ *    negative numbers are inverted completely, as larger magnitudes have to come first for them.
+ *  - Strings are represented by their first STRING_PREFIX_LENGTH bytes, padded with zeros. As the prefixes of
+ *    different strings can be equal, the full strings are kept as well and decide if the prefixes are equal.
+ * For descending sort definitions, the bytes of the encoded value are inverted. The bytes of NULLs are all zero.
+ */
+class NormalizedSortKeys {
+ public:
+  static constexpr size_t STRING_PREFIX_LENGTH = 8;
+
+  // Prepares the keys of row_count rows of tables with the column types of table
+  NormalizedSortKeys(const Table& table, const std::vector<SortColumnDefinition>& sort_definitions,
+                     const size_t row_count);
+
+  // Encodes the rows of the chunk into the keys starting at first_row. Different rows can be encoded in parallel.
+  void encode_chunk(const Chunk& chunk, const size_t first_row);
+
+  // Encodes the rows [begin, end) of the chunk into the keys starting at first_row
+  void encode_rows(const Chunk& chunk, const ChunkOffset begin, const ChunkOffset end, const size_t first_row);
+
+  // Copies the key of a row from other keys for the same sort definitions
+  void copy_key(const NormalizedSortKeys& source, const size_t source_row, const size_t target_row);
+
+  // Compares the keys of rows lhs and rhs like memcmp does, i.e., returns zero for equal keys
+  int compare(const size_t lhs, const size_t rhs) const {
+    const auto* const lhs_key = _keys.data() + lhs * _key_width;
+    const auto* const rhs_key = _keys.data() + rhs * _key_width;
+
+    auto segment_begin = size_t{0};
+    for (const auto& segment : _key_segments) {
+      const auto result = std::memcmp(lhs_key + segment_begin, rhs_key + segment_begin, segment.end - segment_begin);
+      if (result != 0) return result;
+
+      if (segment.definition_id) {
+        const auto string_result = _strings[*segment.definition_id][lhs].compare(_strings[*segment.definition_id][rhs]);
+        if (string_result != 0) return (string_result < 0) != segment.descending ? -1 : 1;
+      }
+
+      segment_begin = segment.end;
+    }
+
+    return 0;
+  }
+
+  // Whether row lhs comes before row rhs. Rows with equal keys are ordered by their index, which keeps sorts stable.
+  bool less(const size_t lhs, const size_t rhs) const {
+    const auto result = compare(lhs, rhs);
+    return result != 0 ? result < 0 : lhs < rhs;
+  }
+
+ protected:
+  // Part of the keys that ends either with the prefix of a string or with the end of the keys
+  struct KeySegment {
+    size_t end;
+
+    // Only set if the segment ends with a string prefix
+    std::optional<size_t> definition_id;
+    bool descending;
+  };
+
+  const std::vector<SortColumnDefinition> _sort_definitions;
+  std::vector<DataType> _data_types;
+
+  size_t _key_width;
+  std::vector<size_t> _key_offsets;
+  std::vector<KeySegment> _key_segments;
+
+  std::vector<uint8_t> _keys;
+
+  // Full strings of string sort columns, empty for all other columns
+  std::vector<std::vector<std::string>> _strings;
+};
+
+}  // namespace opossum
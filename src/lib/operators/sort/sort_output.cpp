@@ -0,0 +1,212 @@
+#include "sort_output.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/chunk.hpp"
+#include "storage/create_iterable_from_column.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+
+namespace opossum {
+
+namespace {
+
+size_t output_chunk_count(const PosList& rows, const size_t output_chunk_size) {
+  // Ceiling of integer division
+  return (rows.size() + output_chunk_size - 1) / output_chunk_size;
+}
+
+}  // namespace
+
+std::shared_ptr<Table> write_reference_output(const std::shared_ptr<const Table>& table_in, const PosList& rows,
+                                              const size_t output_chunk_size) {
+  auto output = Table::create_with_layout_from(table_in, output_chunk_size);
+  if (rows.empty()) return output;
+
+  const auto column_count = table_in->column_count();
+
+  // 1. Find the table and column every column refers to. Columns whose input chunks refer to the same position lists
+  // (e.g., all columns of a TableScan) share their position lists in the output, too.
+  auto referenced_tables = std::vector<std::shared_ptr<const Table>>(column_count);
+  auto referenced_column_ids = std::vector<ColumnID>(column_count);
+
+  // Position lists of the input chunks per group of columns, and the ids that identify them (see
+  // ReferenceColumn::positions_id()). They are empty if the columns are not references. The position lists are only
+  // accessed by index, so compact representations are not materialized.
+  auto input_pos_lists = std::vector<std::vector<std::shared_ptr<const AbstractPosList>>>{};
+  auto input_positions_ids = std::vector<std::vector<const void*>>{};
+  auto pos_list_ids = std::vector<size_t>(column_count);
+
+  for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
+    auto chunk_pos_lists = std::vector<std::shared_ptr<const AbstractPosList>>{};
+    auto chunk_positions_ids = std::vector<const void*>{};
+
+    for (ChunkID chunk_id{0}; chunk_id < table_in->chunk_count(); ++chunk_id) {
+      const auto column = table_in->get_chunk(chunk_id)->get_column(column_id);
+
+      auto referenced_table = table_in;
+      auto referenced_column_id = column_id;
+      if (const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(column)) {
+        referenced_table = reference_column->referenced_table();
+        referenced_column_id = reference_column->referenced_column_id();
+        chunk_pos_lists.emplace_back(reference_column->abstract_pos_list());
+        chunk_positions_ids.emplace_back(reference_column->positions_id());
+      }
+
+      if (chunk_id == ChunkID{0}) {
+        referenced_tables[column_id] = referenced_table;
+        referenced_column_ids[column_id] = referenced_column_id;
+      } else if (referenced_table != referenced_tables[column_id] ||
+                 referenced_column_id != referenced_column_ids[column_id]) {
+        return nullptr;
+      }
+    }
+
+    const auto positions_ids_it =
+        std::find(input_positions_ids.begin(), input_positions_ids.end(), chunk_positions_ids);
+    pos_list_ids[column_id] = std::distance(input_positions_ids.begin(), positions_ids_it);
+    if (positions_ids_it == input_positions_ids.end()) {
+      input_positions_ids.emplace_back(std::move(chunk_positions_ids));
+      input_pos_lists.emplace_back(std::move(chunk_pos_lists));
+    }
+  }
+
+  // 2. Build the output chunks in parallel
+  auto chunks_out = std::vector<std::shared_ptr<Chunk>>(output_chunk_count(rows, output_chunk_size));
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunks_out.size());
+  for (auto chunk_index = size_t{0}; chunk_index < chunks_out.size(); ++chunk_index) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_index]() {
+      const auto begin = chunk_index * output_chunk_size;
+      const auto end = std::min(begin + output_chunk_size, rows.size());
+
+      auto pos_lists_out = std::vector<std::shared_ptr<PosList>>{};
+      pos_lists_out.reserve(input_pos_lists.size());
+      for (const auto& chunk_pos_lists : input_pos_lists) {
+        auto pos_list_out = std::make_shared<PosList>();
+        pos_list_out->reserve(end - begin);
+
+        for (auto row_index = begin; row_index < end; ++row_index) {
+          const auto& row_id = rows[row_index];
+          if (chunk_pos_lists.empty()) {
+            pos_list_out->emplace_back(row_id);
+          } else {
+            pos_list_out->emplace_back((*chunk_pos_lists[row_id.chunk_id])[row_id.chunk_offset]);
+          }
+        }
+
+        pos_lists_out.emplace_back(std::move(pos_list_out));
+      }
+
+      auto chunk_out = std::make_shared<Chunk>();
+      for (ColumnID column_id{0}; column_id < column_count; ++column_id) {
+        chunk_out->add_column(std::make_shared<ReferenceColumn>(
+            referenced_tables[column_id], referenced_column_ids[column_id], pos_lists_out[pos_list_ids[column_id]]));
+      }
+      chunks_out[chunk_index] = std::move(chunk_out);
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  for (auto& chunk : chunks_out) {
+    output->emplace_chunk(std::move(chunk));
+  }
+
+  return output;
+}
+
+std::shared_ptr<Table> write_materialized_output(const std::shared_ptr<const Table>& table_in, const PosList& rows,
+                                                 const size_t output_chunk_size) {
+  // We have decided against duplicating MVCC columns in https://github.com/hyrise/hyrise/issues/408
+  auto output = Table::create_with_layout_from(table_in, output_chunk_size);
+  if (rows.empty()) return output;
+
+  const auto chunk_count_in = table_in->chunk_count();
+  const auto chunk_count_out = output_chunk_count(rows, output_chunk_size);
+
+  auto chunks_out = std::vector<std::shared_ptr<Chunk>>(chunk_count_out);
+  std::generate(chunks_out.begin(), chunks_out.end(), []() { return std::make_shared<Chunk>(); });
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+
+  // Materialize column by column, so that only the values of one input column are held at a time
+  for (ColumnID column_id{0}; column_id < output->column_count(); ++column_id) {
+    const auto nullable = table_in->column_is_nullable(column_id);
+
+    resolve_data_type(table_in->column_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      // 1. Materialize the column of every input chunk, one task per chunk
+      auto values_in = std::vector<std::vector<ColumnDataType>>(chunk_count_in);
+      auto null_values_in = std::vector<std::vector<bool>>(chunk_count_in);
+
+      jobs.clear();
+      for (ChunkID chunk_id{0}; chunk_id < chunk_count_in; ++chunk_id) {
+        jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+          const auto base_column = table_in->get_chunk(chunk_id)->get_column(column_id);
+          auto& values = values_in[chunk_id];
+          auto& null_values = null_values_in[chunk_id];
+          values.resize(base_column->size());
+          null_values.resize(base_column->size());
+
+          resolve_column_type<ColumnDataType>(*base_column, [&](auto& typed_column) {
+            auto iterable = create_iterable_from_column<ColumnDataType>(typed_column);
+            iterable.for_each([&](const auto& value) {
+              if (value.is_null()) {
+                null_values[value.chunk_offset()] = true;
+              } else {
+                values[value.chunk_offset()] = value.value();
+              }
+            });
+          });
+        }));
+        jobs.back()->schedule();
+      }
+      CurrentScheduler::wait_for_tasks(jobs);
+
+      // 2. Gather the values of the rows, one task per output chunk
+      jobs.clear();
+      for (auto chunk_index = size_t{0}; chunk_index < chunk_count_out; ++chunk_index) {
+        jobs.emplace_back(std::make_shared<JobTask>([&, chunk_index]() {
+          const auto begin = chunk_index * output_chunk_size;
+          const auto end = std::min(begin + output_chunk_size, rows.size());
+
+          auto values = pmr_concurrent_vector<ColumnDataType>(end - begin);
+          auto null_values = pmr_concurrent_vector<bool>(nullable ? end - begin : 0);
+
+          for (auto row_index = begin; row_index < end; ++row_index) {
+            const auto& row_id = rows[row_index];
+            values[row_index - begin] = values_in[row_id.chunk_id][row_id.chunk_offset];
+            if (nullable) null_values[row_index - begin] = null_values_in[row_id.chunk_id][row_id.chunk_offset];
+          }
+
+          if (nullable) {
+            chunks_out[chunk_index]->add_column(
+                std::make_shared<ValueColumn<ColumnDataType>>(std::move(values), std::move(null_values)));
+          } else {
+            chunks_out[chunk_index]->add_column(std::make_shared<ValueColumn<ColumnDataType>>(std::move(values)));
+          }
+        }));
+        jobs.back()->schedule();
+      }
+      CurrentScheduler::wait_for_tasks(jobs);
+    });
+  }
+
+  for (auto& chunk : chunks_out) {
+    output->emplace_chunk(std::move(chunk));
+  }
+
+  return output;
+}
+
+}  // namespace opossum
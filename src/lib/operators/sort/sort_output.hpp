@@ -0,0 +1,32 @@
+#pragma once
+
+#include <memory>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * Functions that write the rows of a table in a given order into a new table, which are used by Sort and TopK.
+ * Both split the output into chunks of output_chunk_size rows and build these chunks in parallel.
+ */
+
+/**
+ * Returns ReferenceColumns pointing to the rows. If the input consists of ReferenceColumns, the positions are
+ * resolved, so that the output references the same tables as the input.
+ * This is only possible if every column refers to the same table and column in all chunks of the input. Otherwise,
+ * e.g., for the output of a UnionAll of a stored table and a TableScan, nullptr is returned.
+ */
+std::shared_ptr<Table> write_reference_output(const std::shared_ptr<const Table>& table_in, const PosList& rows,
+                                              const size_t output_chunk_size);
+
+/**
+ * Copies the values of the rows into new ValueColumns, column by column. To avoid accessing every value through
+ * virtual calls, the column of every input chunk is first materialized into a typed vector.
+ */
+std::shared_ptr<Table> write_materialized_output(const std::shared_ptr<const Table>& table_in, const PosList& rows,
+                                                 const size_t output_chunk_size);
+
+}  // namespace opossum
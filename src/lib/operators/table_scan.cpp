@@ -18,6 +18,8 @@
 #include "storage/chunk.hpp"
 #include "storage/proxy_chunk.hpp"
 #include "storage/reference_column.hpp"
+#include "storage/reference_column/row_id_pos_list.hpp"
+#include "storage/reference_column/single_chunk_pos_list.hpp"
 #include "storage/table.hpp"
 #include "table_scan/column_comparison_table_scan_impl.hpp"
 #include "table_scan/is_null_table_scan_impl.hpp"
@@ -60,17 +62,17 @@ const std::string TableScan::description(DescriptionMode description_mode) const
          " " + predicate_string + ")";
 }
 
-std::shared_ptr<AbstractOperator> TableScan::recreate(const std::vector<AllParameterVariant>& args) const {
+std::shared_ptr<AbstractOperator> TableScan::_on_recreate(
+    const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+    const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
   // Replace value in the new operator, if it’s a parameter and an argument is available.
   if (is_placeholder(_right_parameter)) {
     const auto index = boost::get<ValuePlaceholder>(_right_parameter).index();
     if (index < args.size()) {
-      return std::make_shared<TableScan>(_input_left->recreate(args), _left_column_id, _predicate_condition,
-                                         args[index]);
+      return std::make_shared<TableScan>(recreated_input_left, _left_column_id, _predicate_condition, args[index]);
     }
   }
-  return std::make_shared<TableScan>(_input_left->recreate(args), _left_column_id, _predicate_condition,
-                                     _right_parameter);
+  return std::make_shared<TableScan>(recreated_input_left, _left_column_id, _predicate_condition, _right_parameter);
 }
 
 std::shared_ptr<const Table> TableScan::_on_execute() {
@@ -93,7 +95,7 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
     auto job_task = std::make_shared<JobTask>([=, &output_mutex]() {
       const auto chunk_guard = _in_table->get_chunk_with_access_counting(chunk_id);
       // The actual scan happens in the sub classes of BaseTableScanImpl
-      const auto matches_out = std::make_shared<PosList>(_impl->scan_chunk(chunk_id));
+      const auto matches_out = _impl->scan_chunk(chunk_id);
 
       // The output chunk is allocated on the same NUMA node as the input chunk. Also, the AccessCounter is
       // reused to track accesses of the output chunk. Accesses of derived chunks are counted towards the
@@ -109,11 +111,15 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
        * (a) they point to the same table and
        * (b) the reference columns of the input table point to the same positions in the same order
        *     (i.e. they share their position list).
+       *
+       * Positions within a single chunk of the referenced table are stored in a SingleChunkPosList, which picks a
+       * compact representation (a range, a bitmap, or 4-byte chunk offsets) depending on the selectivity.
        */
       if (_in_table->get_type() == TableType::References) {
         const auto chunk_in = _in_table->get_chunk(chunk_id);
 
-        auto filtered_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
+        auto filtered_pos_lists =
+            std::map<std::shared_ptr<const AbstractPosList>, std::shared_ptr<const AbstractPosList>>{};
 
         for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
           auto column_in = chunk_in->get_column(column_id);
@@ -121,20 +127,36 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
           auto ref_column_in = std::dynamic_pointer_cast<const ReferenceColumn>(column_in);
           DebugAssert(ref_column_in != nullptr, "All columns should be of type ReferenceColumn.");
 
-          const auto pos_list_in = ref_column_in->pos_list();
+          const auto abstract_pos_list_in = ref_column_in->abstract_pos_list();
 
           const auto table_out = ref_column_in->referenced_table();
           const auto column_id_out = ref_column_in->referenced_column_id();
 
-          auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
+          auto& filtered_pos_list = filtered_pos_lists[abstract_pos_list_in];
 
           if (!filtered_pos_list) {
-            filtered_pos_list = std::make_shared<PosList>();
-            filtered_pos_list->reserve(matches_out->size());
-
-            for (const auto& match : *matches_out) {
-              const auto row_id = (*pos_list_in)[match.chunk_offset];
-              filtered_pos_list->push_back(row_id);
+            if (const auto single_chunk_pos_list_in =
+                    std::dynamic_pointer_cast<const SingleChunkPosList>(abstract_pos_list_in)) {
+              const auto chunk_offsets_in = single_chunk_pos_list_in->chunk_offsets();
+
+              auto chunk_offsets = std::vector<ChunkOffset>{};
+              chunk_offsets.reserve(matches_out.size());
+              for (const auto& match : matches_out) {
+                chunk_offsets.push_back(chunk_offsets_in[match.chunk_offset]);
+              }
+
+              filtered_pos_list =
+                  SingleChunkPosList::create(single_chunk_pos_list_in->chunk_id(), std::move(chunk_offsets));
+            } else {
+              const auto pos_list_in = abstract_pos_list_in->row_ids();
+
+              auto pos_list = std::make_shared<PosList>();
+              pos_list->reserve(matches_out.size());
+              for (const auto& match : matches_out) {
+                pos_list->push_back((*pos_list_in)[match.chunk_offset]);
+              }
+
+              filtered_pos_list = std::make_shared<RowIDPosList>(pos_list);
             }
           }
 
@@ -142,8 +164,15 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
           chunk_out->add_column(ref_column_out);
         }
       } else {
+        auto chunk_offsets = std::vector<ChunkOffset>{};
+        chunk_offsets.reserve(matches_out.size());
+        for (const auto& match : matches_out) {
+          chunk_offsets.push_back(match.chunk_offset);
+        }
+        const auto pos_list_out = SingleChunkPosList::create(chunk_id, std::move(chunk_offsets));
+
         for (ColumnID column_id{0u}; column_id < _in_table->column_count(); ++column_id) {
-          auto ref_column_out = std::make_shared<ReferenceColumn>(_in_table, column_id, matches_out);
+          auto ref_column_out = std::make_shared<ReferenceColumn>(_in_table, column_id, pos_list_out);
           chunk_out->add_column(ref_column_out);
         }
       }
@@ -10,7 +10,9 @@ TableWrapper::TableWrapper(const std::shared_ptr<const Table> table) : _table(ta
 
 const std::string TableWrapper::name() const { return "TableWrapper"; }
 
-std::shared_ptr<AbstractOperator> TableWrapper::recreate(const std::vector<AllParameterVariant>& args) const {
+std::shared_ptr<AbstractOperator> TableWrapper::_on_recreate(
+    const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+    const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
   return std::make_shared<TableWrapper>(_table);
 }
 
@@ -0,0 +1,138 @@
+#include "top_k.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
+#include "sort/normalized_sort_keys.hpp"
+#include "sort/sort_output.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Chunks with more rows are split into ranges of this size, each handled by a task of its own. This bounds the
+// normalized keys a task builds at once.
+constexpr ChunkOffset MAX_ROWS_PER_TASK = 16'384;
+
+}  // namespace
+
+TopK::TopK(const std::shared_ptr<const AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_definitions,
+           const size_t k)
+    : AbstractReadOnlyOperator(in), _sort_definitions(sort_definitions), _k(k) {
+  DebugAssert(!_sort_definitions.empty(), "TopK needs at least one sort definition");
+}
+
+const std::vector<SortColumnDefinition>& TopK::sort_definitions() const { return _sort_definitions; }
+
+size_t TopK::k() const { return _k; }
+
+const std::string TopK::name() const { return "TopK"; }
+
+std::shared_ptr<AbstractOperator> TopK::_on_recreate(
+    const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+    const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
+  return std::make_shared<TopK>(recreated_input_left, _sort_definitions, _k);
+}
+
+std::shared_ptr<const Table> TopK::_on_execute() {
+  const auto table_in = _input_table_left();
+  const auto chunk_count = table_in->chunk_count();
+
+  // 1. Split the chunks into ranges of at most MAX_ROWS_PER_TASK rows
+  auto ranges = std::vector<std::pair<ChunkID, std::pair<ChunkOffset, ChunkOffset>>>{};
+  if (_k > 0) {
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk_size = table_in->get_chunk(chunk_id)->size();
+      for (auto begin = ChunkOffset{0}; begin < chunk_size; begin += std::min(MAX_ROWS_PER_TASK, chunk_size - begin)) {
+        ranges.emplace_back(chunk_id, std::make_pair(begin, std::min(begin + MAX_ROWS_PER_TASK, chunk_size)));
+      }
+    }
+  }
+
+  // 2. Select the first k rows of every range, one task per range. The candidates are kept in a heap with the last
+  // of them on top, so that a row only enters the heap if it comes before that one. Each task then merges its
+  // candidates into the first k rows of all ranges finished so far, which are kept sorted in merged_keys and
+  // merged_rows. merge_buffer receives the result of the next merge. Rows with equal keys are ordered by their RowIDs,
+  // i.e., their position in the input, so that the selection stays stable no matter in which order the tasks finish.
+  const auto max_candidate_count = std::min(_k, static_cast<size_t>(table_in->row_count()));
+  auto merged_keys = std::make_unique<NormalizedSortKeys>(*table_in, _sort_definitions, 2 * max_candidate_count);
+  auto merge_buffer = std::make_unique<NormalizedSortKeys>(*table_in, _sort_definitions, 2 * max_candidate_count);
+  auto merged_rows = PosList{};
+  merged_rows.reserve(2 * max_candidate_count);
+  std::mutex merge_mutex;
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(ranges.size());
+  for (auto range_id = size_t{0}; range_id < ranges.size(); ++range_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, range_id]() {
+      const auto chunk_id = ranges[range_id].first;
+      const auto [begin, end] = ranges[range_id].second;
+      const auto range_size = static_cast<size_t>(end - begin);
+
+      auto keys = NormalizedSortKeys(*table_in, _sort_definitions, range_size);
+      keys.encode_rows(*table_in->get_chunk(chunk_id), begin, end, 0);
+
+      const auto less = [&](const size_t lhs, const size_t rhs) { return keys.less(lhs, rhs); };
+
+      auto heap = std::vector<size_t>{};
+      heap.reserve(std::min(_k, range_size));
+      for (auto row = size_t{0}; row < range_size; ++row) {
+        if (heap.size() < _k) {
+          heap.emplace_back(row);
+          std::push_heap(heap.begin(), heap.end(), less);
+        } else if (keys.less(row, heap.front())) {
+          std::pop_heap(heap.begin(), heap.end(), less);
+          heap.back() = row;
+          std::push_heap(heap.begin(), heap.end(), less);
+        }
+      }
+      std::sort_heap(heap.begin(), heap.end(), less);
+
+      std::lock_guard<std::mutex> lock(merge_mutex);
+
+      const auto previous_count = merged_rows.size();
+      for (const auto row : heap) {
+        merged_keys->copy_key(keys, row, merged_rows.size());
+        merged_rows.emplace_back(RowID{chunk_id, static_cast<ChunkOffset>(begin + row)});
+      }
+
+      auto order = std::vector<size_t>(merged_rows.size());
+      std::iota(order.begin(), order.end(), size_t{0});
+      std::inplace_merge(order.begin(), order.begin() + previous_count, order.end(),
+                         [&](const size_t lhs, const size_t rhs) {
+                           const auto result = merged_keys->compare(lhs, rhs);
+                           return result != 0 ? result < 0 : merged_rows[lhs] < merged_rows[rhs];
+                         });
+
+      const auto kept_count = std::min(_k, order.size());
+      auto kept_rows = PosList(kept_count);
+      kept_rows.reserve(2 * max_candidate_count);
+      for (auto index = size_t{0}; index < kept_count; ++index) {
+        merge_buffer->copy_key(*merged_keys, order[index], index);
+        kept_rows[index] = merged_rows[order[index]];
+      }
+
+      std::swap(merged_keys, merge_buffer);
+      merged_rows = std::move(kept_rows);
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  // 3. Write the output, which references the input like the output of Sort
+  if (const auto output = write_reference_output(table_in, merged_rows, Chunk::MAX_SIZE)) return output;
+
+  return write_materialized_output(table_in, merged_rows, Chunk::MAX_SIZE);
+}
+
+}  // namespace opossum
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "sort.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Operator that returns the first k rows of its input in the order given by the sort definitions, i.e., a Sort
+ * followed by a Limit. Like Sort, it is stable.
+ *
+ * Instead of sorting all rows, the chunks are split into ranges of bounded size. Each range is processed by a task
+ * of its own that selects the first k rows of the range with a heap of at most k rows and then merges them into the
+ * first k rows of all ranges finished so far. Thus, a task needs O(k + range size) memory while it runs, and no more
+ * than O(k) candidates are kept overall. Like the output of Sort, the output consists of ReferenceColumns pointing to
+ * the k selected rows whenever the input allows it.
+ * The TopKRule introduces this operator for LimitNodes on top of SortNodes.
+ */
+class TopK : public AbstractReadOnlyOperator {
+ public:
+  TopK(const std::shared_ptr<const AbstractOperator> in, const std::vector<SortColumnDefinition>& sort_definitions,
+       const size_t k);
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
+  size_t k() const;
+
+  const std::string name() const override;
+
+ protected:
+  std::shared_ptr<AbstractOperator> _on_recreate(
+      const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+      const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
+  std::shared_ptr<const Table> _on_execute() override;
+
+  const std::vector<SortColumnDefinition> _sort_definitions;
+  const size_t _k;
+};
+
+}  // namespace opossum
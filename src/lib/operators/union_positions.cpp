@@ -1,13 +1,19 @@
 #include "union_positions.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <iterator>
 #include <memory>
 #include <numeric>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/chunk.hpp"
 #include "storage/reference_column.hpp"
 #include "storage/table.hpp"
@@ -51,16 +57,271 @@
  * Instead of using a ReferenceMatrix, consider using a linked list of RowIDs for each row. Since most of the sorting
  *      will depend on the leftmost column, this way most of the time no remote memory would need to be accessed
  *
- * The sorting, which is the most expensive part of this operator, could probably be parallelized.
+ * The sorting of ReferenceMatrices, which is the most expensive part of this operator for inputs with multiple column
+ *      segments, could probably be parallelized.
+ *
+ *
+ * ### Inputs referencing a single table
+ * If there is only one column segment, which is the case for any two scans of the same table, every row is identified
+ * by a single RowID. These are packed into 64-bit integers (chunk id in the upper, chunk offset in the lower half),
+ * which sort like the RowIDs. Two fast paths are used for them instead of the ReferenceMatrices:
+ *  - If both inputs reference the same chunks, a bitmap with a bit per row of these chunks is set from both inputs
+ *    in parallel and the set bits are emitted in order. No sorting is needed at all.
+ *  - Otherwise, both packed position lists are sorted with a parallel LSD radix sort and merged.
+ * Both paths emit every row exactly once, even if it occurs multiple times in one input.
  */
 namespace opossum {
 
+namespace {
+
+constexpr size_t RADIX_BITS = 8;
+constexpr size_t RADIX_BUCKET_COUNT = size_t{1} << RADIX_BITS;
+
+// Rows handled by a task of the radix sort at least, so that small inputs are not split up
+constexpr size_t MIN_ROWS_PER_RADIX_TASK = 10'000;
+
+uint64_t pack_row_id(const RowID& row_id) {
+  return static_cast<uint64_t>(row_id.chunk_id) << 32 | static_cast<uint64_t>(row_id.chunk_offset);
+}
+
+RowID unpack_row_id(const uint64_t packed_row_id) {
+  return RowID{ChunkID{static_cast<uint32_t>(packed_row_id >> 32)}, static_cast<ChunkOffset>(packed_row_id)};
+}
+
+struct PackedPositions {
+  std::vector<uint64_t> row_ids;
+
+  // Whether a chunk of the referenced table is referenced at least once
+  std::vector<bool> referenced_chunks;
+  bool contains_null_row{false};
+};
+
+/**
+ * Packs the RowIDs of the (only) column segment of the input, one task per input chunk
+ */
+PackedPositions pack_positions(const Table& input_table, const ChunkID referenced_chunk_count) {
+  const auto chunk_count = input_table.chunk_count();
+
+  auto chunk_begins = std::vector<size_t>(chunk_count + 1);
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    chunk_begins[chunk_id + 1] = chunk_begins[chunk_id] + input_table.get_chunk(chunk_id)->size();
+  }
+
+  auto packed_positions = PackedPositions{};
+  packed_positions.row_ids.resize(chunk_begins.back());
+
+  auto chunk_referenced_chunks = std::vector<std::vector<bool>>(chunk_count);
+  auto chunk_contains_null_row = std::vector<bool>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      const auto column = input_table.get_chunk(chunk_id)->get_column(ColumnID{0});
+      const auto& reference_column = static_cast<const ReferenceColumn&>(*column);
+
+      auto referenced_chunks = std::vector<bool>(referenced_chunk_count);
+      auto contains_null_row = false;
+      auto packed_row_id_it = packed_positions.row_ids.begin() + chunk_begins[chunk_id];
+      reference_column.for_each_position([&](const RowID& row_id) {
+        if (row_id.chunk_offset == INVALID_CHUNK_OFFSET) {
+          contains_null_row = true;
+        } else {
+          referenced_chunks[row_id.chunk_id] = true;
+        }
+        *packed_row_id_it++ = pack_row_id(row_id);
+      });
+
+      chunk_referenced_chunks[chunk_id] = std::move(referenced_chunks);
+      chunk_contains_null_row[chunk_id] = contains_null_row;
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  packed_positions.referenced_chunks.resize(referenced_chunk_count);
+  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
+    for (ChunkID referenced_chunk_id{0}; referenced_chunk_id < referenced_chunk_count; ++referenced_chunk_id) {
+      if (chunk_referenced_chunks[chunk_id][referenced_chunk_id]) {
+        packed_positions.referenced_chunks[referenced_chunk_id] = true;
+      }
+    }
+    packed_positions.contains_null_row |= chunk_contains_null_row[chunk_id];
+  }
+
+  return packed_positions;
+}
+
+/**
+ * Parallel LSD radix sort of packed RowIDs. Every pass splits the values into ranges, counts the digits of each range
+ * in a task of its own and then scatters each range into the buckets in another task. As the ranges are scattered in
+ * their order, every pass is stable. Only the significant bits of the largest value are sorted by, and passes in which
+ * all values have the same digit are skipped.
+ */
+void radix_sort(std::vector<uint64_t>& values) {
+  if (values.size() < 2) return;
+
+  const auto max_value = *std::max_element(values.begin(), values.end());
+  auto significant_bits = size_t{0};
+  while (significant_bits < 64 && (max_value >> significant_bits) != 0) ++significant_bits;
+
+  const auto max_range_count = std::max(size_t{1}, static_cast<size_t>(std::thread::hardware_concurrency()));
+  const auto range_count = std::clamp(values.size() / MIN_ROWS_PER_RADIX_TASK, size_t{1}, max_range_count);
+
+  auto range_bounds = std::vector<size_t>{};
+  for (auto range_id = size_t{0}; range_id <= range_count; ++range_id) {
+    range_bounds.emplace_back(range_id * values.size() / range_count);
+  }
+
+  auto buffer = std::vector<uint64_t>(values.size());
+  auto histograms = std::vector<std::vector<size_t>>(range_count);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+
+  for (auto shift = size_t{0}; shift < significant_bits; shift += RADIX_BITS) {
+    const auto digit_of = [&](const uint64_t value) { return (value >> shift) & (RADIX_BUCKET_COUNT - 1); };
+
+    // 1. Count the digits of every range
+    jobs.clear();
+    for (auto range_id = size_t{0}; range_id < range_count; ++range_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, range_id]() {
+        auto& histogram = histograms[range_id];
+        histogram.assign(RADIX_BUCKET_COUNT, 0);
+        for (auto index = range_bounds[range_id]; index < range_bounds[range_id + 1]; ++index) {
+          ++histogram[digit_of(values[index])];
+        }
+      }));
+      jobs.back()->schedule();
+    }
+    CurrentScheduler::wait_for_tasks(jobs);
+
+    // 2. Compute where every range writes the values of each digit to. Bucket by bucket, the ranges write one after
+    // another.
+    auto bucket_begin = size_t{0};
+    auto skip_pass = false;
+    for (auto digit = size_t{0}; digit < RADIX_BUCKET_COUNT; ++digit) {
+      const auto bucket_begin_before = bucket_begin;
+      for (auto& histogram : histograms) {
+        const auto value_count = histogram[digit];
+        histogram[digit] = bucket_begin;
+        bucket_begin += value_count;
+      }
+      if (bucket_begin - bucket_begin_before == values.size()) skip_pass = true;
+    }
+    if (skip_pass) continue;
+
+    // 3. Scatter the ranges into the buffer
+    jobs.clear();
+    for (auto range_id = size_t{0}; range_id < range_count; ++range_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, range_id]() {
+        auto& offsets = histograms[range_id];
+        for (auto index = range_bounds[range_id]; index < range_bounds[range_id + 1]; ++index) {
+          const auto value = values[index];
+          buffer[offsets[digit_of(value)]++] = value;
+        }
+      }));
+      jobs.back()->schedule();
+    }
+    CurrentScheduler::wait_for_tasks(jobs);
+
+    values.swap(buffer);
+  }
+}
+
+/**
+ * Sorts both inputs and merges them, dropping duplicates
+ */
+std::vector<uint64_t> union_sorted(PackedPositions& left, PackedPositions& right) {
+  radix_sort(left.row_ids);
+  radix_sort(right.row_ids);
+
+  auto row_ids = std::vector<uint64_t>{};
+  row_ids.reserve(left.row_ids.size() + right.row_ids.size());
+  std::set_union(left.row_ids.begin(), left.row_ids.end(), right.row_ids.begin(), right.row_ids.end(),
+                 std::back_inserter(row_ids));
+  row_ids.erase(std::unique(row_ids.begin(), row_ids.end()), row_ids.end());
+  return row_ids;
+}
+
+/**
+ * Marks the rows of both inputs in a bitmap spanning the referenced chunks and emits the marked rows in order. Must
+ * not be used if one of the inputs contains NULL rows, which have no bit.
+ */
+std::vector<uint64_t> union_bitmap(const PackedPositions& left, const PackedPositions& right,
+                                   const Table& referenced_table) {
+  const auto referenced_chunk_count = referenced_table.chunk_count();
+
+  // 1. Lay out the words of the referenced chunks in the bitmap
+  auto chunk_word_begins = std::vector<size_t>(referenced_chunk_count + 1);
+  for (ChunkID chunk_id{0}; chunk_id < referenced_chunk_count; ++chunk_id) {
+    const auto word_count = left.referenced_chunks[chunk_id] ? (referenced_table.get_chunk(chunk_id)->size() + 63) / 64
+                                                              : size_t{0};
+    chunk_word_begins[chunk_id + 1] = chunk_word_begins[chunk_id] + word_count;
+  }
+
+  auto bitmap = std::vector<std::atomic<uint64_t>>(chunk_word_begins.back());
+
+  // 2. Set the bits of both inputs, one task per range of MIN_ROWS_PER_RADIX_TASK rows
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  for (const auto* row_ids : {&left.row_ids, &right.row_ids}) {
+    for (auto begin = size_t{0}; begin < row_ids->size(); begin += MIN_ROWS_PER_RADIX_TASK) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, row_ids, begin]() {
+        const auto end = std::min(begin + MIN_ROWS_PER_RADIX_TASK, row_ids->size());
+        for (auto index = begin; index < end; ++index) {
+          const auto row_id = unpack_row_id((*row_ids)[index]);
+          const auto word = chunk_word_begins[row_id.chunk_id] + row_id.chunk_offset / 64;
+          bitmap[word].fetch_or(uint64_t{1} << (row_id.chunk_offset % 64), std::memory_order_relaxed);
+        }
+      }));
+      jobs.back()->schedule();
+    }
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  // 3. Count the rows of every referenced chunk, then write them to their place in the output, one task per chunk
+  auto chunk_row_begins = std::vector<size_t>(referenced_chunk_count + 1);
+  for (ChunkID chunk_id{0}; chunk_id < referenced_chunk_count; ++chunk_id) {
+    auto row_count = size_t{0};
+    for (auto word = chunk_word_begins[chunk_id]; word < chunk_word_begins[chunk_id + 1]; ++word) {
+      row_count += __builtin_popcountll(bitmap[word].load(std::memory_order_relaxed));
+    }
+    chunk_row_begins[chunk_id + 1] = chunk_row_begins[chunk_id] + row_count;
+  }
+
+  auto row_ids = std::vector<uint64_t>(chunk_row_begins.back());
+
+  jobs.clear();
+  for (ChunkID chunk_id{0}; chunk_id < referenced_chunk_count; ++chunk_id) {
+    if (chunk_row_begins[chunk_id] == chunk_row_begins[chunk_id + 1]) continue;
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_id]() {
+      auto row_id_it = row_ids.begin() + chunk_row_begins[chunk_id];
+      for (auto word = chunk_word_begins[chunk_id]; word < chunk_word_begins[chunk_id + 1]; ++word) {
+        auto bits = bitmap[word].load(std::memory_order_relaxed);
+        const auto word_offset = static_cast<ChunkOffset>((word - chunk_word_begins[chunk_id]) * 64);
+        while (bits != 0) {
+          const auto bit = static_cast<ChunkOffset>(__builtin_ctzll(bits));
+          *row_id_it++ = pack_row_id(RowID{chunk_id, word_offset + bit});
+          bits &= bits - 1;
+        }
+      }
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  return row_ids;
+}
+
+}  // namespace
+
 UnionPositions::UnionPositions(const std::shared_ptr<const AbstractOperator>& left,
                                const std::shared_ptr<const AbstractOperator>& right)
     : AbstractReadOnlyOperator(left, right) {}
 
-std::shared_ptr<AbstractOperator> UnionPositions::recreate(const std::vector<AllParameterVariant>& args) const {
-  return std::make_shared<UnionPositions>(input_left()->recreate(args), input_right()->recreate(args));
+std::shared_ptr<AbstractOperator> UnionPositions::_on_recreate(
+    const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+    const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
+  return std::make_shared<UnionPositions>(recreated_input_left, recreated_input_right);
 }
 
 const std::string UnionPositions::name() const { return "UnionPositions"; }
@@ -71,6 +332,10 @@ std::shared_ptr<const Table> UnionPositions::_on_execute() {
     return early_result;
   }
 
+  if (_column_segment_offsets.size() == 1) {
+    return _union_single_column_segment();
+  }
+
   /**
    * For each input, create a ReferenceMatrix
    */
@@ -189,6 +454,55 @@ std::shared_ptr<const Table> UnionPositions::_on_execute() {
   return out_table;
 }
 
+std::shared_ptr<const Table> UnionPositions::_union_single_column_segment() const {
+  const auto& referenced_table = *_referenced_tables.front();
+  const auto referenced_chunk_count = referenced_table.chunk_count();
+
+  auto left = pack_positions(*_input_table_left(), referenced_chunk_count);
+  auto right = pack_positions(*_input_table_right(), referenced_chunk_count);
+
+  const auto use_bitmap = left.referenced_chunks == right.referenced_chunks && !left.contains_null_row &&
+                          !right.contains_null_row;
+  const auto row_ids = use_bitmap ? union_bitmap(left, right, referenced_table) : union_sorted(left, right);
+
+  // Same chunk size as for multiple column segments
+  const auto out_chunk_size = std::max(_input_table_left()->max_chunk_size(), _input_table_right()->max_chunk_size());
+  const auto out_chunk_count = (row_ids.size() + out_chunk_size - 1) / out_chunk_size;
+
+  // Build the output chunks in parallel. All of their columns share one pos list.
+  auto chunks_out = std::vector<std::shared_ptr<Chunk>>(out_chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(out_chunk_count);
+  for (auto chunk_index = size_t{0}; chunk_index < out_chunk_count; ++chunk_index) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk_index]() {
+      const auto begin = chunk_index * out_chunk_size;
+      const auto end = std::min(begin + out_chunk_size, row_ids.size());
+
+      auto pos_list = std::make_shared<PosList>(end - begin);
+      for (auto index = begin; index < end; ++index) {
+        (*pos_list)[index - begin] = unpack_row_id(row_ids[index]);
+      }
+
+      auto chunk = std::make_shared<Chunk>();
+      for (auto column_id = ColumnID{0}; column_id < _input_table_left()->column_count(); ++column_id) {
+        chunk->add_column(
+            std::make_shared<ReferenceColumn>(_referenced_tables.front(), _referenced_column_ids[column_id], pos_list));
+      }
+      chunks_out[chunk_index] = std::move(chunk);
+    }));
+    jobs.back()->schedule();
+  }
+  CurrentScheduler::wait_for_tasks(jobs);
+
+  auto out_table = Table::create_with_layout_from(_input_table_left(), out_chunk_size);
+  for (auto& chunk : chunks_out) {
+    out_table->emplace_chunk(std::move(chunk));
+  }
+
+  return out_table;
+}
+
 std::shared_ptr<const Table> UnionPositions::_prepare_operator() {
   DebugAssert(Table::layouts_equal(_input_table_left(), _input_table_right()),
               "Input tables don't have the same layout");
@@ -221,15 +535,15 @@ std::shared_ptr<const Table> UnionPositions::_prepare_operator() {
    * below)
    */
   const auto add_column_segments = [&](const auto& table) {
-    auto current_pos_list = std::shared_ptr<const PosList>();
+    auto current_positions_id = static_cast<const void*>(nullptr);
     const auto first_chunk = table->get_chunk(ChunkID{0});
     for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
       const auto column = first_chunk->get_column(column_id);
       const auto ref_column = std::static_pointer_cast<const ReferenceColumn>(column);
-      auto pos_list = ref_column->pos_list();
+      const auto positions_id = ref_column->positions_id();
 
-      if (current_pos_list != pos_list) {
-        current_pos_list = pos_list;
+      if (current_positions_id != positions_id) {
+        current_positions_id = positions_id;
         _column_segment_offsets.emplace_back(column_id);
       }
     }
@@ -269,21 +583,21 @@ std::shared_ptr<const Table> UnionPositions::_prepare_operator() {
    */
   const auto verify_column_segments_in_all_chunks = [&](const auto& table) {
     for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
-      auto current_pos_list = std::shared_ptr<const PosList>();
+      auto current_positions_id = static_cast<const void*>(nullptr);
       size_t next_segment_id = 0;
       const auto chunk = table->get_chunk(chunk_id);
       for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
         if (column_id == _column_segment_offsets[next_segment_id]) {
           next_segment_id++;
-          current_pos_list = nullptr;
+          current_positions_id = nullptr;
         }
 
         const auto column = chunk->get_column(column_id);
         const auto ref_column = std::static_pointer_cast<const ReferenceColumn>(column);
-        auto pos_list = ref_column->pos_list();
+        const auto positions_id = ref_column->positions_id();
 
-        if (current_pos_list == nullptr) {
-          current_pos_list = pos_list;
+        if (current_positions_id == nullptr) {
+          current_positions_id = positions_id;
         }
 
         Assert(ref_column->referenced_table() == _referenced_tables[next_segment_id - 1],
@@ -296,7 +610,7 @@ std::shared_ptr<const Table> UnionPositions::_prepare_operator() {
                    ")"
                    " doesn't reference the same table as the column at the same index in the first chunk "
                    "of the left input table does");
-        Assert(current_pos_list == pos_list, "Different PosLists in column segment");
+        Assert(current_positions_id == positions_id, "Different PosLists in column segment");
       }
     }
   };
@@ -324,8 +638,7 @@ UnionPositions::ReferenceMatrix UnionPositions::_build_reference_matrix(
       const auto ref_column = std::static_pointer_cast<const ReferenceColumn>(column);
 
       auto& out_pos_list = reference_matrix[segment_id];
-      auto in_pos_list = ref_column->pos_list();
-      std::copy(in_pos_list->begin(), in_pos_list->end(), std::back_inserter(out_pos_list));
+      ref_column->for_each_position([&](const RowID& row_id) { out_pos_list.emplace_back(row_id); });
     }
   }
   return reference_matrix;
@@ -71,7 +71,6 @@ class UnionPositions : public AbstractReadOnlyOperator {
   UnionPositions(const std::shared_ptr<const AbstractOperator>& left,
                  const std::shared_ptr<const AbstractOperator>& right);
 
-  std::shared_ptr<AbstractOperator> recreate(const std::vector<AllParameterVariant>& args) const override;
   const std::string name() const override;
 
  private:
@@ -88,6 +87,9 @@ class UnionPositions : public AbstractReadOnlyOperator {
     bool operator()(size_t left, size_t right) const;
   };
 
+  std::shared_ptr<AbstractOperator> _on_recreate(
+      const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+      const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
   std::shared_ptr<const Table> _on_execute() override;
 
   /**
@@ -102,6 +104,9 @@ class UnionPositions : public AbstractReadOnlyOperator {
    */
   std::shared_ptr<const Table> _prepare_operator();
 
+  // Fast paths for inputs with a single column segment, see "Inputs referencing a single table" in the cpp
+  std::shared_ptr<const Table> _union_single_column_segment() const;
+
   UnionPositions::ReferenceMatrix _build_reference_matrix(const std::shared_ptr<const Table>& input_table) const;
   bool _compare_reference_matrix_rows(const ReferenceMatrix& left_matrix, size_t left_row_idx,
                                       const ReferenceMatrix& right_matrix, size_t right_row_idx) const;
@@ -128,8 +128,10 @@ bool Update::_execution_input_valid(const std::shared_ptr<TransactionContext>& c
   return true;
 }
 
-std::shared_ptr<AbstractOperator> Update::recreate(const std::vector<AllParameterVariant>& args) const {
-  return std::make_shared<Update>(_table_to_update_name, _input_left->recreate(args), _input_right->recreate(args));
+std::shared_ptr<AbstractOperator> Update::_on_recreate(
+    const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+    const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
+  return std::make_shared<Update>(_table_to_update_name, recreated_input_left, recreated_input_right);
 }
 
 }  // namespace opossum
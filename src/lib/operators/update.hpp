@@ -32,9 +32,11 @@ class Update : public AbstractReadWriteOperator {
   ~Update();
 
   const std::string name() const override;
-  std::shared_ptr<AbstractOperator> recreate(const std::vector<AllParameterVariant>& args) const override;
 
  protected:
+  std::shared_ptr<AbstractOperator> _on_recreate(
+      const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+      const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
   std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> context) override;
   bool _execution_input_valid(const std::shared_ptr<TransactionContext>& context) const;
 
@@ -34,8 +34,10 @@ Validate::Validate(const std::shared_ptr<AbstractOperator> in) : AbstractReadOnl
 
 const std::string Validate::name() const { return "Validate"; }
 
-std::shared_ptr<AbstractOperator> Validate::recreate(const std::vector<AllParameterVariant>& args) const {
-  return std::make_shared<Validate>(_input_left->recreate(args));
+std::shared_ptr<AbstractOperator> Validate::_on_recreate(
+    const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+    const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
+  return std::make_shared<Validate>(recreated_input_left);
 }
 
 std::shared_ptr<const Table> Validate::_on_execute() {
@@ -69,7 +71,7 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
       DebugAssert(referenced_table->get_chunk(ChunkID{0})->has_mvcc_columns(),
                   "Trying to use Validate on a table that has no MVCC columns");
 
-      for (auto row_id : *ref_col_in->pos_list()) {
+      ref_col_in->for_each_position([&](const RowID& row_id) {
         const auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
 
         auto mvcc_columns = referenced_chunk->mvcc_columns();
@@ -77,7 +79,7 @@ std::shared_ptr<const Table> Validate::_on_execute(std::shared_ptr<TransactionCo
         if (is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_columns)) {
           pos_list_out->emplace_back(row_id);
         }
-      }
+      });
 
       // Construct the actual ReferenceColumn objects and add them to the chunk.
       for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
@@ -0,0 +1,186 @@
+#include "chunk_statistics.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/create_iterable_from_column.hpp"
+#include "storage/dictionary_column.hpp"
+#include "storage/run_length_column.hpp"
+#include "storage/table.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "type_cast.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+template <typename T>
+void add_value(ChunkColumnStatistics<T>& statistics, const T& value) {
+  statistics.distinct_values.add(value);
+  statistics.min = statistics.min ? std::min(*statistics.min, value) : value;
+  statistics.max = statistics.max ? std::max(*statistics.max, value) : value;
+}
+
+template <typename T>
+void generate_samples(ChunkColumnStatistics<T>& statistics, const BaseColumn& column) {
+  const auto row_count = column.size();
+  if (row_count == 0u) return;
+
+  const auto sampled_row_count = std::min(row_count, size_t{CHUNK_STATISTICS_SAMPLE_SIZE});
+  const auto sample_weight = static_cast<float>(row_count) / static_cast<float>(sampled_row_count);
+
+  auto samples = std::vector<T>{};
+  samples.reserve(sampled_row_count);
+  for (auto sample_index = size_t{0u}; sample_index < sampled_row_count; ++sample_index) {
+    const auto value = column[static_cast<ChunkOffset>(sample_index * row_count / sampled_row_count)];
+    if (!variant_is_null(value)) samples.emplace_back(type_cast<T>(value));
+  }
+
+  // Sorted once per chunk, so that the samples of several chunks can be merged without sorting them again
+  std::sort(samples.begin(), samples.end());
+  for (const auto& sample : samples) {
+    if (statistics.weighted_samples.empty() || statistics.weighted_samples.back().first != sample) {
+      statistics.weighted_samples.emplace_back(sample, 0.f);
+    }
+    statistics.weighted_samples.back().second += sample_weight;
+  }
+
+  statistics.histogram =
+      EquiDepthHistogram<T>::from_samples(statistics.weighted_samples, statistics.distinct_values.estimate());
+}
+
+template <typename T>
+void generate_from_column(ChunkColumnStatistics<T>& statistics, const DictionaryColumn<T>& column) {
+  // The dictionary is sorted and contains every distinct value exactly once
+  const auto& dictionary = *column.dictionary();
+  if (!dictionary.empty()) {
+    statistics.min = dictionary.front();
+    statistics.max = dictionary.back();
+  }
+
+  for (const auto& value : dictionary) {
+    statistics.distinct_values.add(value);
+  }
+
+  const auto null_value_id = column.null_value_id();
+  resolve_compressed_vector_type(*column.attribute_vector(), [&](const auto& vector) {
+    for (auto it = vector.cbegin(); it != vector.cend(); ++it) {
+      if (static_cast<ValueID>(*it) == null_value_id) ++statistics.null_value_count;
+    }
+  });
+}
+
+template <typename T>
+void generate_from_column(ChunkColumnStatistics<T>& statistics, const RunLengthColumn<T>& column) {
+  // Each run is processed once, no matter how long it is
+  const auto& values = *column.values();
+  const auto& null_values = *column.null_values();
+  const auto& end_positions = *column.end_positions();
+
+  auto run_begin = ChunkOffset{0u};
+  for (auto run_index = size_t{0u}; run_index < values.size(); ++run_index) {
+    if (null_values[run_index]) {
+      statistics.null_value_count += end_positions[run_index] + 1u - run_begin;
+    } else {
+      add_value(statistics, values[run_index]);
+    }
+    run_begin = end_positions[run_index] + 1u;
+  }
+}
+
+template <typename T, typename ColumnType>
+void generate_from_column(ChunkColumnStatistics<T>& statistics, const ColumnType& column) {
+  auto iterable = create_iterable_from_column<T>(column);
+  iterable.for_each([&](const auto& value) {
+    if (value.is_null()) {
+      ++statistics.null_value_count;
+    } else {
+      add_value(statistics, value.value());
+    }
+  });
+}
+
+}  // namespace
+
+std::shared_ptr<BaseChunkColumnStatistics> generate_chunk_column_statistics(const DataType data_type,
+                                                                            const BaseColumn& column) {
+  std::shared_ptr<BaseChunkColumnStatistics> statistics;
+
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    auto typed_statistics = std::make_shared<ChunkColumnStatistics<ColumnDataType>>();
+    resolve_column_type<ColumnDataType>(
+        column, [&](const auto& typed_column) { generate_from_column(*typed_statistics, typed_column); });
+    generate_samples(*typed_statistics, column);
+    statistics = typed_statistics;
+  });
+
+  return statistics;
+}
+
+std::shared_ptr<const ChunkStatistics> generate_chunk_statistics(const Chunk& chunk,
+                                                                 const std::vector<DataType>& data_types) {
+  DebugAssert(data_types.size() == chunk.column_count(), "Number of column types must match the chunk's column count.");
+
+  auto statistics = std::make_shared<ChunkStatistics>();
+  statistics->row_count = chunk.size();
+  statistics->column_statistics.reserve(chunk.column_count());
+
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    statistics->column_statistics.emplace_back(
+        generate_chunk_column_statistics(data_types[column_id], *chunk.get_column(column_id)));
+  }
+
+  return statistics;
+}
+
+template <typename T>
+void MergedChunkColumnStatistics<T>::merge_chunks(Table& table, const ColumnID column_id, const ChunkID end_chunk_id) {
+  const auto data_type = table.column_type(column_id);
+
+  for (; chunk_count < end_chunk_id; ++chunk_count) {
+    const auto chunk = table.get_chunk(chunk_count);
+
+    // Sealed chunks carry the statistics generated when they were encoded. For chunks that may still grow, they are
+    // missing or outdated, so those of the merged column are generated for this merge only.
+    auto column_statistics_ptr = std::shared_ptr<const BaseChunkColumnStatistics>{};
+    auto chunk_row_count = size_t{0};
+    const auto chunk_statistics = chunk->statistics();
+    if (chunk_statistics && chunk_statistics->row_count == chunk->size()) {
+      column_statistics_ptr = chunk_statistics->column_statistics[column_id];
+      chunk_row_count = chunk_statistics->row_count;
+    } else {
+      const auto column = chunk->get_column(column_id);
+      chunk_row_count = column->size();
+      column_statistics_ptr = generate_chunk_column_statistics(data_type, *column);
+    }
+
+    const auto& column_statistics = static_cast<const ChunkColumnStatistics<T>&>(*column_statistics_ptr);
+
+    distinct_values.merge(column_statistics.distinct_values);
+    null_value_count += column_statistics.null_value_count;
+    row_count += chunk_row_count;
+
+    // Both the merged samples and those of the chunk are sorted, so they are merged instead of sorted
+    const auto merged_sample_count = weighted_samples.size();
+    weighted_samples.insert(weighted_samples.end(), column_statistics.weighted_samples.cbegin(),
+                            column_statistics.weighted_samples.cend());
+    std::inplace_merge(weighted_samples.begin(), weighted_samples.begin() + merged_sample_count, weighted_samples.end(),
+                       [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+    histogram = chunk_count == ChunkID{0} ? column_statistics.histogram : nullptr;
+
+    if (column_statistics.min) min = min ? std::min(*min, *column_statistics.min) : *column_statistics.min;
+    if (column_statistics.max) max = max ? std::max(*max, *column_statistics.max) : *column_statistics.max;
+  }
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(MergedChunkColumnStatistics);
+
+}  // namespace opossum
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "optimizer/equi_depth_histogram.hpp"
+#include "optimizer/hyper_log_log.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+class Chunk;
+class Table;
+
+// Number of rows per chunk that are sampled for building histograms (see EquiDepthHistogram)
+constexpr auto CHUNK_STATISTICS_SAMPLE_SIZE = ChunkOffset{256};
+
+/**
+ * Statistics of a single column within a chunk. They are generated from the column's encoded representation where
+ * possible (e.g., min, max, and distinct values are taken from the sorted dictionary of a DictionaryColumn) and are
+ * merged into the ColumnStatistics of the table, so that the optimizer never has to scan a table. They are generated
+ * and stored in the chunk by the ChunkEncoder when the chunk is sealed, so the optimizer only looks them up. Only for
+ * chunks that are not encoded yet, they are generated while merging and not stored, as such chunks may still grow.
+ */
+struct BaseChunkColumnStatistics {
+  virtual ~BaseChunkColumnStatistics() = default;
+
+  ChunkOffset null_value_count{0};
+
+  // Sketch of the distinct non-null values
+  HyperLogLog distinct_values;
+};
+
+template <typename T>
+struct ChunkColumnStatistics : public BaseChunkColumnStatistics {
+  // Not set if the column contains only NULLs
+  std::optional<T> min;
+  std::optional<T> max;
+
+  // Non-null values at evenly spaced positions of the column, sorted by value. Equal values are combined, so that
+  // each value is stored once with the number of rows it represents.
+  std::vector<std::pair<T, float>> weighted_samples;
+
+  // Histogram of the column within the chunk, built from weighted_samples (see EquiDepthHistogram::from_samples())
+  std::shared_ptr<const EquiDepthHistogram<T>> histogram;
+};
+
+/**
+ * Statistics of a column merged from the statistics of a table's leading chunks, from which ColumnStatistics are
+ * created. The TableStatistics of a stored table keep them for the chunks that can no longer grow, so that only the
+ * chunks added since have to be merged when rows are added to the table.
+ */
+struct BaseMergedChunkColumnStatistics {
+  virtual ~BaseMergedChunkColumnStatistics() = default;
+
+  // Number of leading chunks of the table that were merged
+  ChunkID chunk_count{0};
+};
+
+template <typename T>
+struct MergedChunkColumnStatistics : public BaseMergedChunkColumnStatistics {
+  // Merges the statistics of the chunks from chunk_count up to (excluding) end_chunk_id
+  void merge_chunks(Table& table, const ColumnID column_id, const ChunkID end_chunk_id);
+
+  HyperLogLog distinct_values;
+  size_t null_value_count{0};
+  size_t row_count{0};
+
+  std::optional<T> min;
+  std::optional<T> max;
+
+  // Sorted by value
+  std::vector<std::pair<T, float>> weighted_samples;
+
+  // Histogram of the merged chunk if only one chunk was merged, in which case it does not have to be built again
+  std::shared_ptr<const EquiDepthHistogram<T>> histogram;
+};
+
+struct ChunkStatistics {
+  // Number of rows in the chunk when the statistics were generated
+  ChunkOffset row_count{0};
+
+  std::vector<std::shared_ptr<const BaseChunkColumnStatistics>> column_statistics;
+};
+
+std::shared_ptr<BaseChunkColumnStatistics> generate_chunk_column_statistics(const DataType data_type,
+                                                                            const BaseColumn& column);
+
+std::shared_ptr<const ChunkStatistics> generate_chunk_statistics(const Chunk& chunk,
+                                                                 const std::vector<DataType>& data_types);
+
+}  // namespace opossum
@@ -10,8 +10,8 @@
 #include <vector>
 
 #include "all_parameter_variant.hpp"
-#include "operators/aggregate.hpp"
-#include "operators/table_wrapper.hpp"
+#include "chunk_statistics.hpp"
+#include "hyper_log_log.hpp"
 #include "storage/table.hpp"
 #include "table_statistics.hpp"
 #include "type_cast.hpp"
@@ -21,36 +21,34 @@ namespace opossum {
 
 template <typename ColumnType>
 ColumnStatistics<ColumnType>::ColumnStatistics(const ColumnID column_id, const std::weak_ptr<Table> table)
-    : _column_id(column_id), _table(table) {}
+    : _column_id(column_id) {
+  auto shared_table = table.lock();
+  DebugAssert(shared_table != nullptr, "Corresponding table of column statistics is deleted.");
+
+  // Chunks that are not sealed yet get their statistics generated while merging, see chunk_statistics.hpp
+  auto merged_statistics = MergedChunkColumnStatistics<ColumnType>{};
+  merged_statistics.merge_chunks(*shared_table, column_id, shared_table->chunk_count());
+  _initialize_from_merged_statistics(merged_statistics);
+}
+
+template <typename ColumnType>
+ColumnStatistics<ColumnType>::ColumnStatistics(const ColumnID column_id,
+                                               const MergedChunkColumnStatistics<ColumnType>& merged_statistics)
+    : _column_id(column_id) {
+  _initialize_from_merged_statistics(merged_statistics);
+}
 
 template <typename ColumnType>
 ColumnStatistics<ColumnType>::ColumnStatistics(const ColumnID column_id, float distinct_count, const ColumnType min,
                                                const ColumnType max, const float non_null_value_ratio)
     : BaseColumnStatistics(non_null_value_ratio),
       _column_id(column_id),
-      _table(std::weak_ptr<Table>()),
       _distinct_count(distinct_count),
       _min(min),
       _max(max) {}
 
 template <typename ColumnType>
-float ColumnStatistics<ColumnType>::distinct_count() const {
-  if (_distinct_count) {
-    return *_distinct_count;
-  }
-
-  // Calculation of distinct_count is delegated to aggregate operator.
-  auto table = _table.lock();
-  DebugAssert(table != nullptr, "Corresponding table of column statistics is deleted.");
-  auto table_wrapper = std::make_shared<TableWrapper>(table);
-  table_wrapper->execute();
-  auto aggregate = std::make_shared<Aggregate>(table_wrapper, std::vector<AggregateColumnDefinition>{},
-                                               std::vector<ColumnID>{_column_id});
-  aggregate->execute();
-  auto aggregate_table = aggregate->get_output();
-  _distinct_count = aggregate_table->row_count();
-  return *_distinct_count;
-}
+float ColumnStatistics<ColumnType>::distinct_count() const { return *_distinct_count; }
 
 template <typename ColumnType>
 std::shared_ptr<BaseColumnStatistics> ColumnStatistics<ColumnType>::clone() const {
@@ -58,44 +56,28 @@ std::shared_ptr<BaseColumnStatistics> ColumnStatistics<ColumnType>::clone() cons
 }
 
 template <typename ColumnType>
-ColumnType ColumnStatistics<ColumnType>::_get_or_calculate_min() const {
-  if (!_min) {
-    _initialize_min_max();
-  }
-  return *_min;
-}
+ColumnType ColumnStatistics<ColumnType>::_get_or_calculate_min() const { return *_min; }
 
 template <typename ColumnType>
-ColumnType ColumnStatistics<ColumnType>::_get_or_calculate_max() const {
-  if (!_max) {
-    _initialize_min_max();
-  }
-  return *_max;
-}
+ColumnType ColumnStatistics<ColumnType>::_get_or_calculate_max() const { return *_max; }
 
 template <typename ColumnType>
-void ColumnStatistics<ColumnType>::_initialize_min_max() const {
-  // Calculation is delegated to aggregate operator.
-  auto table = _table.lock();
-  DebugAssert(table != nullptr, "Corresponding table of column statistics is deleted.");
-
-  auto table_wrapper = std::make_shared<TableWrapper>(table);
-  table_wrapper->execute();
-
-  auto aggregate_args = std::vector<AggregateColumnDefinition>{{_column_id, AggregateFunction::Min},
-                                                               {_column_id, AggregateFunction::Max}};
-  auto aggregate = std::make_shared<Aggregate>(table_wrapper, aggregate_args, std::vector<ColumnID>{});
-  aggregate->execute();
-
-  auto aggregate_table = aggregate->get_output();
-
-  auto min_column = std::static_pointer_cast<const ValueColumn<ColumnType>>(
-      aggregate_table->get_chunk(ChunkID{0})->get_column(ColumnID{0}));
-  _min = min_column->values()[0];
-
-  auto max_column = std::static_pointer_cast<const ValueColumn<ColumnType>>(
-      aggregate_table->get_chunk(ChunkID{0})->get_column(ColumnID{1}));
-  _max = max_column->values()[0];
+void ColumnStatistics<ColumnType>::_initialize_from_merged_statistics(
+    const MergedChunkColumnStatistics<ColumnType>& merged_statistics) {
+  _distinct_count = merged_statistics.distinct_values.estimate();
+  // The histogram of a single chunk was already built when the chunk statistics were generated
+  _histogram = merged_statistics.histogram ? merged_statistics.histogram
+                                           : EquiDepthHistogram<ColumnType>::from_samples(
+                                                 merged_statistics.weighted_samples, *_distinct_count);
+
+  // Columns without any non-null values
+  _min = merged_statistics.min ? *merged_statistics.min : ColumnType{};
+  _max = merged_statistics.max ? *merged_statistics.max : ColumnType{};
+
+  if (merged_statistics.row_count > 0u) {
+    _non_null_value_ratio = 1.f - static_cast<float>(merged_statistics.null_value_count) /
+                                      static_cast<float>(merged_statistics.row_count);
+  }
 }
 
 template <typename ColumnType>
@@ -126,11 +108,36 @@ ColumnSelectivityResult ColumnStatistics<ColumnType>::_create_column_stats_for_r
   }
   auto column_statistics =
       std::make_shared<ColumnStatistics>(_column_id, selectivity * distinct_count(), common_min, common_max);
+  column_statistics->_histogram = _histogram;
   return {_non_null_value_ratio * selectivity, column_statistics};
 }
 
+template <typename ColumnType>
+std::optional<float> ColumnStatistics<ColumnType>::_estimate_range_ratio_with_histogram(
+    const ColumnType& minimum, const ColumnType& maximum) const {
+  if (!_histogram) return std::nullopt;
+
+  const auto total_fraction = _histogram->estimate_range_fraction(_get_or_calculate_min(), _get_or_calculate_max());
+  if (total_fraction <= 0.f) return std::nullopt;
+
+  return std::min(_histogram->estimate_range_fraction(minimum, maximum) / total_fraction, 1.f);
+}
+
+template <typename ColumnType>
+std::optional<float> ColumnStatistics<ColumnType>::_estimate_equals_ratio_with_histogram(
+    const ColumnType& value) const {
+  if (!_histogram) return std::nullopt;
+
+  const auto total_fraction = _histogram->estimate_range_fraction(_get_or_calculate_min(), _get_or_calculate_max());
+  if (total_fraction <= 0.f) return std::nullopt;
+
+  return std::min(_histogram->estimate_equals_fraction(value) / total_fraction, 1.f);
+}
+
 template <typename ColumnType>
 float ColumnStatistics<ColumnType>::estimate_selectivity_for_range(ColumnType minimum, ColumnType maximum) {
+  if (const auto ratio = _estimate_range_ratio_with_histogram(minimum, maximum)) return *ratio;
+
   // minimum must be smaller or equal than maximum
   // distinction between integers and decimals
   // for integers the number of possible integers is used within the inclusive ranges
@@ -149,7 +156,9 @@ float ColumnStatistics<ColumnType>::estimate_selectivity_for_range(ColumnType mi
  */
 template <>
 float ColumnStatistics<std::string>::estimate_selectivity_for_range(std::string minimum, std::string maximum) {
-  // TODO(anyone) implement selectivity for range approximation for column type string.
+  if (const auto ratio = _estimate_range_ratio_with_histogram(minimum, maximum)) return *ratio;
+
+  // TODO(anyone) implement selectivity for range approximation for column type string without histogram.
   return (maximum < minimum) ? 0.f : 1.f;
 }
 
@@ -161,6 +170,10 @@ ColumnSelectivityResult ColumnStatistics<ColumnType>::_create_column_stats_for_e
     new_distinct_count = 0.f;
   }
   auto column_statistics = std::make_shared<ColumnStatistics>(_column_id, new_distinct_count, value, value);
+
+  const auto histogram_ratio = new_distinct_count > 0.f ? _estimate_equals_ratio_with_histogram(value) : std::nullopt;
+  if (histogram_ratio) return {_non_null_value_ratio * *histogram_ratio, column_statistics};
+
   return {_non_null_value_ratio * new_distinct_count / distinct_count(), column_statistics};
 }
 
@@ -172,6 +185,12 @@ ColumnSelectivityResult ColumnStatistics<ColumnType>::_create_column_stats_for_n
   }
   auto column_statistics = std::make_shared<ColumnStatistics>(_column_id, distinct_count() - 1, _get_or_calculate_min(),
                                                               _get_or_calculate_max());
+  column_statistics->_histogram = _histogram;
+
+  if (const auto histogram_ratio = _estimate_equals_ratio_with_histogram(value)) {
+    return {_non_null_value_ratio * (1.f - *histogram_ratio), column_statistics};
+  }
+
   return {_non_null_value_ratio * (1 - 1.f / distinct_count()), column_statistics};
 }
 
@@ -247,7 +266,30 @@ ColumnSelectivityResult ColumnStatistics<std::string>::estimate_selectivity_for_
     case PredicateCondition::NotEquals: {
       return _create_column_stats_for_not_equals_predicate(casted_value);
     }
-    // TODO(anybody) implement other table-scan operators for string.
+    default:
+      break;
+  }
+
+  // Ranges of strings can only be estimated with a histogram. Like for floating point numbers, "< value" is treated as
+  // "<= value".
+  if (!_histogram) {
+    // TODO(anybody) implement other table-scan operators for string without histogram.
+    return {_non_null_value_ratio, _this_without_null_values()};
+  }
+
+  switch (predicate_condition) {
+    case PredicateCondition::LessThan:
+    case PredicateCondition::LessThanEquals: {
+      return _create_column_stats_for_range_predicate(_get_or_calculate_min(), casted_value);
+    }
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals: {
+      return _create_column_stats_for_range_predicate(casted_value, _get_or_calculate_max());
+    }
+    case PredicateCondition::Between: {
+      DebugAssert(static_cast<bool>(value2), "Operator BETWEEN should get two parameters, second is missing!");
+      return _create_column_stats_for_range_predicate(casted_value, type_cast<std::string>(*value2));
+    }
     default: { return {_non_null_value_ratio, _this_without_null_values()}; }
   }
 }
@@ -471,6 +513,8 @@ TwoColumnSelectivityResult ColumnStatistics<ColumnType>::estimate_selectivity_fo
                                                                       overlapping_range_min, overlapping_range_max);
       auto new_right_column_stats = std::make_shared<ColumnStatistics>(
           right_stats->_column_id, overlapping_distinct_count, overlapping_range_min, overlapping_range_max);
+      new_left_column_stats->_histogram = _histogram;
+      new_right_column_stats->_histogram = right_stats->_histogram;
       return {combined_non_null_ratio * equal_values_ratio, new_left_column_stats, new_right_column_stats};
     }
     case PredicateCondition::NotEquals: {
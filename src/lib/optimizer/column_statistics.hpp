@@ -7,12 +7,13 @@
 
 #include "all_type_variant.hpp"
 #include "base_column_statistics.hpp"
+#include "equi_depth_histogram.hpp"
 
 namespace opossum {
 
-class Aggregate;
 class Table;
-class TableWrapper;
+template <typename T>
+struct MergedChunkColumnStatistics;
 
 /**
  * See base_column_statistics.hpp for method comments for virtual methods
@@ -22,16 +23,21 @@ class ColumnStatistics : public BaseColumnStatistics {
  public:
   /**
    * Create a new column statistics object from a column within a table.
-   * The column statistics values distinct count, min and max are not set till used.
+   * Distinct count, min, max, and non-null value ratio are merged from the statistics of the table's chunks, so that
+   * the table does not have to be scanned.
    * This constructor is used by table statistics when a non-existent column statistics is requested.
    * @param column_id: id of corresponding column
    * @param table: table, which contains the column
    */
   ColumnStatistics(const ColumnID column_id, const std::weak_ptr<Table> table);
+  /**
+   * Create a new column statistics object from chunk statistics that were merged already. This constructor is used by
+   * the table statistics of a stored table, which merge the statistics of new chunks only.
+   */
+  ColumnStatistics(const ColumnID column_id, const MergedChunkColumnStatistics<ColumnType>& merged_statistics);
   /**
    * Create a new column statistics object from given parameters.
    * Distinct count, min and max are set during the creation. Non-null value ratio can be optionally set.
-   * Therefore, _table is not set as it is only used to calculate min, max and distinct_count.
    * This constructor is used by column statistics when returning a new column statistics from estimate selectivity
    * functions.
    */
@@ -53,7 +59,7 @@ class ColumnStatistics : public BaseColumnStatistics {
       const std::optional<AllTypeVariant>& value2 = std::nullopt) override;
 
   /**
-   * Accessors for class variable optionals. Compute values, if not available.
+   * Accessor for class variable optional.
    * See _distinct_count declaration below for explanation of float type.
    */
   float distinct_count() const override;
@@ -78,6 +84,13 @@ class ColumnStatistics : public BaseColumnStatistics {
    */
   ColumnSelectivityResult _create_column_stats_for_range_predicate(ColumnType minimum, ColumnType maximum);
 
+  /**
+   * Estimate the ratio of the values within [minimum, maximum] (or equal to value) to all values between min and max
+   * using the histogram. Returns nullopt if there is no histogram or it does not cover the range between min and max.
+   */
+  std::optional<float> _estimate_range_ratio_with_histogram(const ColumnType& minimum, const ColumnType& maximum) const;
+  std::optional<float> _estimate_equals_ratio_with_histogram(const ColumnType& value) const;
+
   /**
    * Estimate selectivity based on new and current range between min and max.
    * @param minimum, maximum: Min and max for new range. Minimum must be smaller or equal to maximum.
@@ -99,20 +112,11 @@ class ColumnStatistics : public BaseColumnStatistics {
    */
   ColumnSelectivityResult _create_column_stats_for_not_equals_predicate(ColumnType value);
 
-  /**
-   * Calculate min and max values from table.
-   */
-  void _initialize_min_max() const;
+  // Set distinct count, min, max, non-null value ratio, and histogram from the merged statistics of the table's chunks
+  void _initialize_from_merged_statistics(const MergedChunkColumnStatistics<ColumnType>& merged_statistics);
 
   const ColumnID _column_id;
 
-  // Only available for statistics of tables in the StorageManager.
-  // This is a weak_ptr, as
-  // Table --shared_ptr--> TableStatistics --shared_ptr--> ColumnStatistics
-  const std::weak_ptr<Table> _table;
-
-  // those can be lazy initialized
-
   // distinct count is not an integer as it can be a predicted value
   // it is multiplied with selectivity of a corresponding operator to predict the operator's output distinct count
   // precision is lost, if row count is rounded
@@ -120,6 +124,11 @@ class ColumnStatistics : public BaseColumnStatistics {
 
   mutable std::optional<ColumnType> _min;
   mutable std::optional<ColumnType> _max;
+
+  // Only available for statistics of tables in the StorageManager with a non-uniform value distribution and for column
+  // statistics derived from them. It describes the distribution of the table's column, of which only the range between
+  // _min and _max is considered.
+  std::shared_ptr<const EquiDepthHistogram<ColumnType>> _histogram;
 };
 
 template <typename ColumnType>
@@ -0,0 +1,185 @@
+#include "equi_depth_histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Maximum difference between the distribution of the samples and a uniform distribution (measured like the
+// Kolmogorov-Smirnov statistic) up to which numerical columns are considered to be uniformly distributed
+constexpr auto uniformity_threshold = 0.1;
+
+template <typename T>
+bool is_distributed_uniformly(const std::vector<std::pair<T, float>>& values, const double total_weight) {
+  const auto min = static_cast<double>(values.front().first);
+  const auto max = static_cast<double>(values.back().first);
+  if (min == max) return true;
+
+  auto cumulated_weight = 0.0;
+  for (const auto& [value, weight] : values) {
+    // Compare the share of values below the value plus half of the value's own share with the share a uniform
+    // distribution would have up to the value, so that discrete values are not mistaken for a skew
+    const auto share = (cumulated_weight + weight / 2.0) / total_weight;
+    auto uniform_share = 0.0;
+    if constexpr (std::is_integral_v<T>) {
+      uniform_share = (static_cast<double>(value) - min + 0.5) / (max - min + 1.0);
+    } else {
+      uniform_share = (static_cast<double>(value) - min) / (max - min);
+    }
+
+    if (std::abs(share - uniform_share) >= uniformity_threshold) return false;
+    cumulated_weight += weight;
+  }
+
+  return true;
+}
+
+}  // namespace
+
+template <typename T>
+std::shared_ptr<const EquiDepthHistogram<T>> EquiDepthHistogram<T>::from_samples(
+    std::vector<std::pair<T, float>> weighted_samples, const float distinct_count) {
+  if (weighted_samples.empty()) return nullptr;
+
+  // The samples of chunk statistics are already sorted (see chunk_statistics.hpp)
+  const auto compare_values = [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; };
+  if (!std::is_sorted(weighted_samples.cbegin(), weighted_samples.cend(), compare_values)) {
+    std::sort(weighted_samples.begin(), weighted_samples.end(), compare_values);
+  }
+
+  // Sum up the weights of equal values
+  auto values = std::vector<std::pair<T, float>>{};
+  auto total_weight = 0.0;
+  for (const auto& [value, weight] : weighted_samples) {
+    if (values.empty() || values.back().first != value) {
+      values.emplace_back(value, 0.f);
+    }
+    values.back().second += weight;
+    total_weight += weight;
+  }
+
+  if constexpr (std::is_arithmetic_v<T>) {
+    if (is_distributed_uniformly(values, total_weight)) return nullptr;
+  }
+
+  auto histogram = std::make_shared<EquiDepthHistogram<T>>();
+
+  auto remaining_values = std::vector<std::pair<T, float>>{};
+  auto remaining_weight = 0.0;
+  for (const auto& [value, weight] : values) {
+    const auto fraction = static_cast<float>(weight / total_weight);
+    if (fraction > 1.f / bucket_count) {
+      histogram->_most_common_values.emplace_back(value, fraction);
+    } else {
+      remaining_values.emplace_back(value, weight);
+      remaining_weight += weight;
+    }
+  }
+
+  if (remaining_values.empty()) return histogram;
+
+  // The samples may miss values, so the number of distinct values in a bucket is scaled up to the estimated distinct
+  // count of the column
+  histogram->_remaining_fraction = static_cast<float>(remaining_weight / total_weight);
+  histogram->_remaining_distinct_count =
+      std::max(distinct_count - static_cast<float>(histogram->_most_common_values.size()),
+               static_cast<float>(remaining_values.size()));
+  const auto distinct_count_scale = histogram->_remaining_distinct_count / remaining_values.size();
+
+  const auto bucket_weight = remaining_weight / bucket_count;
+  auto bucket_begin = remaining_values.cbegin();
+  auto current_weight = 0.0;
+  for (auto value_it = remaining_values.cbegin(); value_it != remaining_values.cend(); ++value_it) {
+    current_weight += value_it->second;
+    if (current_weight < bucket_weight && std::next(value_it) != remaining_values.cend()) continue;
+
+    const auto bucket_distinct_count = static_cast<float>(std::distance(bucket_begin, value_it) + 1);
+    histogram->_buckets.emplace_back(Bucket{bucket_begin->first, value_it->first,
+                                            static_cast<float>(current_weight / total_weight),
+                                            bucket_distinct_count * distinct_count_scale});
+
+    bucket_begin = std::next(value_it);
+    current_weight = 0.0;
+  }
+
+  return histogram;
+}
+
+template <typename T>
+float EquiDepthHistogram<T>::estimate_range_fraction(const T& minimum, const T& maximum) const {
+  if (maximum < minimum) return 0.f;
+
+  auto fraction = 0.f;
+
+  const auto compare_value = [](const auto& most_common_value, const T& other) {
+    return most_common_value.first < other;
+  };
+  auto most_common_value_it =
+      std::lower_bound(_most_common_values.cbegin(), _most_common_values.cend(), minimum, compare_value);
+  for (; most_common_value_it != _most_common_values.cend() && !(maximum < most_common_value_it->first);
+       ++most_common_value_it) {
+    fraction += most_common_value_it->second;
+  }
+
+  for (const auto& bucket : _buckets) {
+    fraction += _estimate_bucket_fraction(bucket, minimum, maximum);
+  }
+
+  return fraction;
+}
+
+template <typename T>
+float EquiDepthHistogram<T>::estimate_equals_fraction(const T& value) const {
+  const auto compare_value = [](const auto& most_common_value, const T& other) {
+    return most_common_value.first < other;
+  };
+  const auto most_common_value_it =
+      std::lower_bound(_most_common_values.cbegin(), _most_common_values.cend(), value, compare_value);
+  if (most_common_value_it != _most_common_values.cend() && most_common_value_it->first == value) {
+    return most_common_value_it->second;
+  }
+
+  for (const auto& bucket : _buckets) {
+    if (!(value < bucket.min) && !(bucket.max < value)) return bucket.fraction / bucket.distinct_count;
+  }
+
+  // The value was not sampled, assume it to be as frequent as the average value that is not among the most common
+  if (_remaining_distinct_count == 0.f) return 0.f;
+  return _remaining_fraction / _remaining_distinct_count;
+}
+
+template <typename T>
+float EquiDepthHistogram<T>::_estimate_bucket_fraction(const Bucket& bucket, const T& minimum,
+                                                       const T& maximum) const {
+  if (maximum < bucket.min || bucket.max < minimum) return 0.f;
+  if (!(bucket.min < minimum) && !(maximum < bucket.max)) return bucket.fraction;
+
+  // The range covers the bucket partially, so bucket.min < bucket.max
+  if constexpr (std::is_arithmetic_v<T>) {
+    const auto bucket_min = static_cast<double>(bucket.min);
+    const auto bucket_max = static_cast<double>(bucket.max);
+    const auto covered_min = static_cast<double>(std::max(minimum, bucket.min));
+    const auto covered_max = static_cast<double>(std::min(maximum, bucket.max));
+
+    if constexpr (std::is_integral_v<T>) {
+      return bucket.fraction * static_cast<float>((covered_max - covered_min + 1.0) / (bucket_max - bucket_min + 1.0));
+    } else {
+      return bucket.fraction * static_cast<float>((covered_max - covered_min) / (bucket_max - bucket_min));
+    }
+  } else {
+    return bucket.fraction / 2.f;
+  }
+}
+
+EXPLICITLY_INSTANTIATE_DATA_TYPES(EquiDepthHistogram);
+
+}  // namespace opossum
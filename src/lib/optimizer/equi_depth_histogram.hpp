@@ -0,0 +1,62 @@
+#pragma once
+
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace opossum {
+
+/**
+ * Compressed histogram (see Poosala et al., "Improved Histograms for Selectivity Estimation of Range Predicates") of
+ * the non-null values of a column, used by ColumnStatistics instead of assuming a uniform distribution between min and
+ * max.
+ *
+ * Values that are more frequent than a bucket's share (the most common values) are stored with their exact frequency.
+ * The remaining values are split into buckets that contain (about) the same number of values each, i.e., the
+ * histogram is equi-depth. Within a bucket, values are assumed to be distributed uniformly. For strings, a range
+ * covering a bucket only partially is assumed to cover half of it.
+ *
+ * Histograms are built from the samples that are taken per chunk when the chunk statistics are generated (see
+ * chunk_statistics.hpp), each sample weighted with the number of rows it represents. Each chunk gets a histogram of
+ * its own when it is encoded. The histogram of a column spanning several chunks is built from their merged samples.
+ */
+template <typename T>
+class EquiDepthHistogram {
+ public:
+  static constexpr auto bucket_count = size_t{32u};
+
+  /**
+   * Builds a histogram from weighted samples, with distinct_count being the estimated number of distinct values in the
+   * column. For numerical columns, nullptr is returned if the samples do not deviate noticeably from a uniform
+   * distribution between their min and max, as the histogram would not improve estimations in that case.
+   * Samples that are already sorted by value are not sorted again.
+   */
+  static std::shared_ptr<const EquiDepthHistogram<T>> from_samples(std::vector<std::pair<T, float>> weighted_samples,
+                                                                   const float distinct_count);
+
+  // Estimated share of the values v in the column with minimum <= v <= maximum
+  float estimate_range_fraction(const T& minimum, const T& maximum) const;
+
+  // Estimated share of the values v in the column with v == value
+  float estimate_equals_fraction(const T& value) const;
+
+ protected:
+  struct Bucket {
+    T min;
+    T max;
+    float fraction;
+    float distinct_count;
+  };
+
+  float _estimate_bucket_fraction(const Bucket& bucket, const T& minimum, const T& maximum) const;
+
+  // Sorted by value
+  std::vector<std::pair<T, float>> _most_common_values;
+  std::vector<Bucket> _buckets;
+
+  // Share and number of distinct values that are not among the most common values
+  float _remaining_fraction = 0.f;
+  float _remaining_distinct_count = 0.f;
+};
+
+}  // namespace opossum
@@ -0,0 +1,84 @@
+#include "hyper_log_log.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace opossum {
+
+void HyperLogLog::add_hash(const uint64_t hash) {
+  if (!_registers.empty()) {
+    _add_to_registers(hash);
+    return;
+  }
+
+  const auto iter = std::lower_bound(_explicit_hashes.begin(), _explicit_hashes.end(), hash);
+  if (iter != _explicit_hashes.end() && *iter == hash) return;
+
+  _explicit_hashes.insert(iter, hash);
+  if (_explicit_hashes.size() > max_explicit_hash_count) _convert_to_registers();
+}
+
+void HyperLogLog::merge(const HyperLogLog& other) {
+  if (other._registers.empty()) {
+    for (const auto hash : other._explicit_hashes) {
+      add_hash(hash);
+    }
+    return;
+  }
+
+  _convert_to_registers();
+  for (auto register_index = size_t{0u}; register_index < register_count; ++register_index) {
+    _registers[register_index] = std::max(_registers[register_index], other._registers[register_index]);
+  }
+}
+
+float HyperLogLog::estimate() const {
+  if (_registers.empty()) return static_cast<float>(_explicit_hashes.size());
+
+  auto inverse_sum = 0.0;
+  auto zero_register_count = size_t{0u};
+  for (const auto register_value : _registers) {
+    inverse_sum += std::ldexp(1.0, -static_cast<int>(register_value));
+    if (register_value == 0u) ++zero_register_count;
+  }
+
+  const auto m = static_cast<double>(register_count);
+  const auto alpha = 0.7213 / (1.0 + 1.079 / m);
+  const auto raw_estimate = alpha * m * m / inverse_sum;
+
+  // For small cardinalities, the raw estimate is biased and linear counting on the empty registers is more precise
+  if (raw_estimate <= 2.5 * m && zero_register_count > 0u) {
+    return static_cast<float>(m * std::log(m / static_cast<double>(zero_register_count)));
+  }
+
+  return static_cast<float>(raw_estimate);
+}
+
+void HyperLogLog::_add_to_registers(const uint64_t hash) {
+  const auto register_index = static_cast<size_t>(hash >> (64u - precision));
+
+  // The rank is the position of the first set bit in the bits that were not used for the register index
+  constexpr auto max_rank = static_cast<uint8_t>(64u - precision + 1u);
+  auto remaining_bits = hash << precision;
+  auto rank = uint8_t{1u};
+  while (rank < max_rank && !(remaining_bits & (uint64_t{1u} << 63u))) {
+    remaining_bits <<= 1u;
+    ++rank;
+  }
+
+  _registers[register_index] = std::max(_registers[register_index], rank);
+}
+
+void HyperLogLog::_convert_to_registers() {
+  if (!_registers.empty()) return;
+
+  _registers.resize(register_count, 0u);
+  for (const auto hash : _explicit_hashes) {
+    _add_to_registers(hash);
+  }
+
+  _explicit_hashes.clear();
+  _explicit_hashes.shrink_to_fit();
+}
+
+}  // namespace opossum
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "utils/murmur_hash.hpp"
+
+namespace opossum {
+
+/**
+ * HyperLogLog sketch (Flajolet et al., "HyperLogLog: the analysis of a near-optimal cardinality estimation algorithm")
+ * for estimating the number of distinct values of a column without keeping the values themselves.
+ *
+ * Each value is hashed, the first bits of the hash select one of the registers, and the register stores the maximum
+ * number of leading zeros seen in the remaining bits. Two sketches are merged by taking the maximum of each register,
+ * so sketches of chunks can be combined into a sketch of the table.
+ *
+ * Like the sparse representation of HyperLogLog++, the sketch stores the hashes explicitly as long as only few
+ * distinct hashes were added. Thus, small distinct counts are exact.
+ */
+class HyperLogLog {
+ public:
+  // 2^precision registers are used, which results in a standard error of about 1.04 / sqrt(2^precision), i.e., 3.25%
+  static constexpr auto precision = 10u;
+  static constexpr auto register_count = size_t{1u} << precision;
+
+  // Up to this many distinct hashes are stored explicitly
+  static constexpr auto max_explicit_hash_count = size_t{128u};
+
+  template <typename T>
+  static uint64_t hash(const T& value) {
+    // murmur2 only produces 32 bit hashes, two of them with different seeds are combined
+    if constexpr (std::is_same_v<T, std::string>) {
+      return (uint64_t{murmur2<std::string>(value, 0u)} << 32u) | murmur2<std::string>(value, 1u);
+    } else {
+      return (uint64_t{murmur2(value, 0u)} << 32u) | murmur2(value, 1u);
+    }
+  }
+
+  template <typename T>
+  void add(const T& value) {
+    add_hash(hash(value));
+  }
+
+  void add_hash(const uint64_t hash);
+
+  void merge(const HyperLogLog& other);
+
+  // Returns the estimated number of distinct values added to the sketch
+  float estimate() const;
+
+ protected:
+  void _add_to_registers(const uint64_t hash);
+  void _convert_to_registers();
+
+  // Sorted, only used as long as _registers is empty
+  std::vector<uint64_t> _explicit_hashes;
+
+  std::vector<uint8_t> _registers;
+};
+
+}  // namespace opossum
@@ -5,23 +5,39 @@
 #include "logical_query_plan/logical_plan_root_node.hpp"
 #include "strategy/constant_calculation_rule.hpp"
 #include "strategy/index_scan_rule.hpp"
+#include "strategy/join_algorithm_rule.hpp"
 #include "strategy/join_detection_rule.hpp"
+#include "strategy/join_ordering_rule.hpp"
+#include "strategy/materialization_rule.hpp"
+#include "strategy/pipeline_fusion_rule.hpp"
+#include "strategy/predicate_pushdown_rule.hpp"
 #include "strategy/predicate_reordering_rule.hpp"
+#include "strategy/top_k_rule.hpp"
 
 namespace opossum {
 
-std::shared_ptr<Optimizer> Optimizer::create_default_optimizer() {
+std::shared_ptr<Optimizer> Optimizer::create_default_optimizer(const UsePipelineFusion use_pipeline_fusion) {
   auto optimizer = std::make_shared<Optimizer>(10);
 
   RuleBatch main_batch(RuleBatchExecutionPolicy::Iterative);
 
+  main_batch.add_rule(std::make_shared<PredicatePushdownRule>());
   main_batch.add_rule(std::make_shared<PredicateReorderingRule>());
   main_batch.add_rule(std::make_shared<JoinDetectionRule>());
   optimizer->add_rule_batch(main_batch);
 
+  // Join ordering needs the joins found by the JoinDetectionRule and reorders each join graph as a whole
   RuleBatch final_batch(RuleBatchExecutionPolicy::Once);
+  final_batch.add_rule(std::make_shared<JoinOrderingRule>());
   final_batch.add_rule(std::make_shared<ConstantCalculationRule>());
   final_batch.add_rule(std::make_shared<IndexScanRule>());
+  // Chooses the join implementations based on the final join order and on the scan types chosen before
+  final_batch.add_rule(std::make_shared<JoinAlgorithmRule>());
+  final_batch.add_rule(std::make_shared<TopKRule>());
+  // Needs the scan types chosen by the IndexScanRule, as index scans are not fused
+  if (use_pipeline_fusion == UsePipelineFusion::Yes) final_batch.add_rule(std::make_shared<PipelineFusionRule>());
+  // Decides on the final plan whether the columns that are only referenced are materialized before returning them
+  final_batch.add_rule(std::make_shared<MaterializationRule>());
   optimizer->add_rule_batch(final_batch);
 
   return optimizer;
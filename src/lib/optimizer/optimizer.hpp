@@ -10,6 +10,10 @@ namespace opossum {
 class AbstractRule;
 class AbstractLQPNode;
 
+// Whether the default Optimizer marks Aggregates for execution as FusedAggregates, see PipelineFusionRule. Without
+// it, they are executed by the regular TableScan, Projection, and Aggregate operators, e.g., to compare the two.
+enum class UsePipelineFusion : bool { Yes = true, No = false };
+
 /**
  * Applies optimization rules to an LQP. Rules are organized in RuleBatches which can be added to the Optimizer using
  * add_rule_batch(). On each invocation of optimize(), these Batches are applied in the same order as they were added
@@ -20,7 +24,8 @@ class AbstractLQPNode;
  */
 class Optimizer final {
  public:
-  static std::shared_ptr<Optimizer> create_default_optimizer();
+  static std::shared_ptr<Optimizer> create_default_optimizer(
+      const UsePipelineFusion use_pipeline_fusion = UsePipelineFusion::Yes);
 
   explicit Optimizer(const uint32_t max_num_iterations);
 
@@ -20,4 +20,10 @@ bool AbstractRule::_apply_to_children(std::shared_ptr<AbstractLQPNode> node) {
   return children_changed;
 }
 
+bool AbstractRule::_has_statistics(const std::shared_ptr<AbstractLQPNode>& node) {
+  if (node->type() == LQPNodeType::StoredTable || node->type() == LQPNodeType::Mock) return true;
+  if (!node->left_child() || node->type() == LQPNodeType::Union) return false;
+  return _has_statistics(node->left_child()) && (!node->right_child() || _has_statistics(node->right_child()));
+}
+
 }  // namespace opossum
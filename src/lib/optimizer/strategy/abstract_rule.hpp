@@ -28,6 +28,12 @@ class AbstractRule {
    * from the tree, which might result in this node being deleted if we don't take a copy of the shared_ptr here.
    */
   bool _apply_to_children(std::shared_ptr<AbstractLQPNode> node);
+
+  /**
+   * Returns whether node->get_statistics() can be called. Statistics can only be derived for LQPs whose leaves are
+   * StoredTableNodes or MockNodes and which contain no UnionNodes, as statistics for UNION are not implemented.
+   */
+  static bool _has_statistics(const std::shared_ptr<AbstractLQPNode>& node);
 };
 
 }  // namespace opossum
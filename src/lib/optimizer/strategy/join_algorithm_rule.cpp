@@ -0,0 +1,125 @@
+#include "join_algorithm_rule.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/sort_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "optimizer/table_statistics.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+// Only if the product of the estimated row counts of both inputs does not exceed this threshold, JoinNestedLoop is
+// used. Below it, the partitioning of JoinHash and the materialization of JoinSortMerge are more expensive than
+// comparing every pair of rows.
+constexpr float NESTED_LOOP_JOIN_ROW_COUNT_PRODUCT_THRESHOLD = 1000.0f;
+
+// Only if we expect row_count_left <= row_count_right * ratio_threshold, JoinIndex is used. Otherwise, probing the
+// index once per left value is more expensive than hashing or sorting the right input. Like the threshold of the
+// IndexScanRule, this value is chosen rather arbitrarily.
+constexpr float INDEX_JOIN_ROW_COUNT_RATIO_THRESHOLD = 0.01f;
+
+std::string JoinAlgorithmRule::name() const { return "Join Algorithm Rule"; }
+
+bool JoinAlgorithmRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) {
+  if (node->type() == LQPNodeType::Join) {
+    const auto join_node = std::dynamic_pointer_cast<JoinNode>(node);
+    if (join_node->join_column_references()) {
+      const auto join_type = _choose_join_type(join_node);
+      if (join_type) join_node->set_join_type(*join_type);
+    }
+  }
+
+  return _apply_to_children(node);
+}
+
+std::optional<JoinType> JoinAlgorithmRule::_choose_join_type(const std::shared_ptr<JoinNode>& join_node) const {
+  const auto join_mode = join_node->join_mode();
+  const auto predicate_condition = *join_node->predicate_condition();
+
+  // Semi and anti joins are only supported by JoinHash, which the LQPTranslator chooses for them anyway
+  if (join_mode != JoinMode::Inner && join_mode != JoinMode::Left && join_mode != JoinMode::Right &&
+      join_mode != JoinMode::Outer) {
+    return std::nullopt;
+  }
+
+  if (predicate_condition == PredicateCondition::NotEquals && join_mode != JoinMode::Inner) {
+    return JoinType::NestedLoop;
+  }
+
+  if (_has_statistics(join_node->left_child()) && _has_statistics(join_node->right_child())) {
+    const auto row_count_left = join_node->left_child()->get_statistics()->row_count();
+    const auto row_count_right = join_node->right_child()->get_statistics()->row_count();
+    if (row_count_left * row_count_right <= NESTED_LOOP_JOIN_ROW_COUNT_PRODUCT_THRESHOLD) return JoinType::NestedLoop;
+
+    const auto index_join_supports_mode = join_mode == JoinMode::Inner || join_mode == JoinMode::Left;
+    if (index_join_supports_mode && row_count_left <= row_count_right * INDEX_JOIN_ROW_COUNT_RATIO_THRESHOLD &&
+        _has_index_on_join_column(join_node)) {
+      return JoinType::Index;
+    }
+  }
+
+  if (predicate_condition != PredicateCondition::Equals || join_mode == JoinMode::Outer) return JoinType::SortMerge;
+
+  const auto& join_column_references = *join_node->join_column_references();
+  if (_is_sorted_by(join_node->left_child(), join_column_references.first) &&
+      _is_sorted_by(join_node->right_child(), join_column_references.second)) {
+    return JoinType::SortMerge;
+  }
+
+  return JoinType::Hash;
+}
+
+bool JoinAlgorithmRule::_has_index_on_join_column(const std::shared_ptr<JoinNode>& join_node) const {
+  // Only stored tables carry indexes, so JoinIndex can only make use of them if it gets the table as its input. Under
+  // MVCC, the table is validated first. JoinIndex probes the indexes of the chunks referenced by the Validate output.
+  auto right_child = join_node->right_child();
+  if (right_child->type() == LQPNodeType::Validate) right_child = right_child->left_child();
+  if (right_child->type() != LQPNodeType::StoredTable) return false;
+
+  const auto stored_table_node = std::static_pointer_cast<StoredTableNode>(right_child);
+  const auto table = StorageManager::get().get_table(stored_table_node->table_name());
+  const auto column_id = right_child->get_output_column_id(join_node->join_column_references()->second);
+
+  const auto index_infos = table->get_indexes();
+  return std::any_of(index_infos.cbegin(), index_infos.cend(), [&](const auto& index_info) {
+    return index_info.column_ids == std::vector<ColumnID>{column_id};
+  });
+}
+
+bool JoinAlgorithmRule::_is_sorted_by(const std::shared_ptr<AbstractLQPNode>& node,
+                                      const LQPColumnReference& column_reference) const {
+  switch (node->type()) {
+    case LQPNodeType::Sort: {
+      // Only the ascending order is used by JoinSortMerge
+      const auto& order_by_definition = std::static_pointer_cast<SortNode>(node)->order_by_definitions().front();
+      return order_by_definition.column_reference == column_reference &&
+             (order_by_definition.order_by_mode == OrderByMode::Ascending ||
+              order_by_definition.order_by_mode == OrderByMode::AscendingNullsLast);
+    }
+
+    case LQPNodeType::Predicate:
+      // IndexScans emit their positions in the order of the index, TableScans keep the order of their input
+      if (std::static_pointer_cast<PredicateNode>(node)->scan_type() == ScanType::IndexScan) return false;
+      return _is_sorted_by(node->left_child(), column_reference);
+
+    case LQPNodeType::Distinct:
+    case LQPNodeType::Limit:
+    case LQPNodeType::Projection:
+    case LQPNodeType::Validate:
+      return _is_sorted_by(node->left_child(), column_reference);
+
+    default:
+      return false;
+  }
+}
+
+}  // namespace opossum
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "abstract_rule.hpp"
+#include "logical_query_plan/join_node.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * This optimizer rule chooses the physical join implementation (JoinType) of every predicated JoinNode based on the
+ * estimated row counts of its inputs and on their order:
+ *  - JoinNestedLoop if both inputs are tiny, as it needs neither partitioning nor materialization. It is also the
+ *    only implementation supporting not-equals predicates for outer joins.
+ *  - JoinIndex for inner and left joins if the right input is a stored table with an index on its join column and the
+ *    left input is much smaller, so that probing the index once per left value beats building a hash table.
+ *  - JoinSortMerge for equi joins if both inputs are sorted by their join columns, so that the sort-merge join finds
+ *    its clusters already sorted. It is also used for non-equi joins and full outer joins.
+ *  - JoinHash for all other equi joins.
+ *
+ * Note:
+ * The build side of JoinHash is still chosen when it is executed. By then, the actual row counts of its inputs are
+ * known, which are more reliable than the estimations available here.
+ */
+class JoinAlgorithmRule : public AbstractRule {
+ public:
+  std::string name() const override;
+  bool apply_to(const std::shared_ptr<AbstractLQPNode>& node) override;
+
+ protected:
+  std::optional<JoinType> _choose_join_type(const std::shared_ptr<JoinNode>& join_node) const;
+  bool _has_index_on_join_column(const std::shared_ptr<JoinNode>& join_node) const;
+  bool _is_sorted_by(const std::shared_ptr<AbstractLQPNode>& node, const LQPColumnReference& column_reference) const;
+};
+
+}  // namespace opossum
@@ -0,0 +1,593 @@
+#include "join_ordering_rule.hpp"
+
+#include <algorithm>
+#include <bitset>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "all_parameter_variant.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_column_reference.hpp"
+#include "logical_query_plan/lqp_expression.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "optimizer/table_statistics.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Bit i is set if relation i is part of the set
+using RelationSet = uint64_t;
+
+constexpr auto max_relation_count = size_t{64};
+
+/**
+ * A predicate comparing columns of two different relations of a join graph
+ */
+struct JoinGraphEdge {
+  LQPColumnReference left_column_reference;
+  PredicateCondition predicate_condition;
+  LQPColumnReference right_column_reference;
+
+  // The relation the left column belongs to and both relations connected by the edge
+  RelationSet left_relation;
+  RelationSet relations;
+};
+
+struct JoinGraph {
+  std::vector<std::shared_ptr<AbstractLQPNode>> relations;
+
+  // PredicateNodes that only reference columns of a single relation, by relation
+  std::vector<std::vector<std::shared_ptr<PredicateNode>>> local_predicates;
+
+  std::vector<JoinGraphEdge> edges;
+
+  // Relations that are connected to a relation by at least one edge, by relation
+  std::vector<RelationSet> neighbours;
+};
+
+/**
+ * A (sub)plan joining a set of relations. Leaf plans represent a single relation including its local predicates.
+ */
+struct JoinPlan {
+  RelationSet relations = 0;
+
+  std::shared_ptr<TableStatistics> statistics;
+  std::vector<LQPColumnReference> column_references;
+
+  // Sum of the estimated row counts of all joins within this plan (C_out)
+  float cost = 0.0f;
+
+  std::optional<size_t> relation_id;
+
+  std::shared_ptr<const JoinPlan> left_plan;
+  std::shared_ptr<const JoinPlan> right_plan;
+
+  // The edge used as the join predicate (if any) and the edges that are applied as PredicateNodes on top of the join
+  std::optional<size_t> join_edge_id;
+  std::vector<size_t> predicate_edge_ids;
+};
+
+using JoinPlanMap = std::unordered_map<RelationSet, std::shared_ptr<const JoinPlan>>;
+
+bool is_join_graph_node(const std::shared_ptr<AbstractLQPNode>& node) {
+  if (node->type() == LQPNodeType::Predicate) return true;
+  if (node->type() != LQPNodeType::Join) return false;
+
+  const auto join_mode = std::static_pointer_cast<JoinNode>(node)->join_mode();
+  return join_mode == JoinMode::Inner || join_mode == JoinMode::Cross;
+}
+
+bool is_join_predicate_condition(const PredicateCondition predicate_condition) {
+  switch (predicate_condition) {
+    case PredicateCondition::Equals:
+    case PredicateCondition::NotEquals:
+    case PredicateCondition::LessThan:
+    case PredicateCondition::LessThanEquals:
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// Returns the condition to use if the two sides of a predicate are swapped
+PredicateCondition flip_predicate_condition(const PredicateCondition predicate_condition) {
+  switch (predicate_condition) {
+    case PredicateCondition::LessThan:
+      return PredicateCondition::GreaterThan;
+    case PredicateCondition::LessThanEquals:
+      return PredicateCondition::GreaterThanEquals;
+    case PredicateCondition::GreaterThan:
+      return PredicateCondition::LessThan;
+    case PredicateCondition::GreaterThanEquals:
+      return PredicateCondition::LessThanEquals;
+    default:
+      return predicate_condition;
+  }
+}
+
+RelationSet single_relation(const size_t relation_id) { return RelationSet{1} << relation_id; }
+
+// Returns the set of all relations with an id smaller than or equal to relation_id
+RelationSet relations_up_to(const size_t relation_id) {
+  return relation_id + 1 >= max_relation_count ? ~RelationSet{0} : single_relation(relation_id + 1) - 1;
+}
+
+size_t lowest_relation_id(const RelationSet relations) {
+  DebugAssert(relations != 0, "Expected a non-empty set of relations");
+
+  auto relation_id = size_t{0};
+  while (!(relations & single_relation(relation_id))) ++relation_id;
+  return relation_id;
+}
+
+size_t relation_count(const RelationSet relations) { return std::bitset<max_relation_count>(relations).count(); }
+
+RelationSet neighbourhood(const JoinGraph& graph, const RelationSet relations) {
+  auto result = RelationSet{0};
+  for (auto relation_id = size_t{0}; relation_id < graph.relations.size(); ++relation_id) {
+    if (relations & single_relation(relation_id)) result |= graph.neighbours[relation_id];
+  }
+  return result & ~relations;
+}
+
+/**
+ * Returns the join predicate described by the edge so that its left column belongs to left_plan
+ */
+std::tuple<LQPColumnReference, PredicateCondition, LQPColumnReference> oriented_join_predicate(
+    const JoinGraphEdge& edge, const JoinPlan& left_plan) {
+  if (edge.left_relation & left_plan.relations) {
+    return {edge.left_column_reference, edge.predicate_condition, edge.right_column_reference};
+  }
+  return {edge.right_column_reference, flip_predicate_condition(edge.predicate_condition), edge.left_column_reference};
+}
+
+ColumnID column_id_in_plan(const JoinPlan& plan, const LQPColumnReference& column_reference) {
+  const auto iter = std::find(plan.column_references.begin(), plan.column_references.end(), column_reference);
+  DebugAssert(iter != plan.column_references.end(), "Column is not part of the plan");
+  return static_cast<ColumnID>(std::distance(plan.column_references.begin(), iter));
+}
+
+/**
+ * Collects the nodes of the join graph rooted at root (top-down) and its relations
+ */
+void collect_join_graph_nodes(const std::shared_ptr<AbstractLQPNode>& root,
+                              std::vector<std::shared_ptr<AbstractLQPNode>>& graph_nodes,
+                              std::vector<std::shared_ptr<AbstractLQPNode>>& relations) {
+  graph_nodes.emplace_back(root);
+
+  for (const auto& child : {root->left_child(), root->right_child()}) {
+    if (!child) continue;
+
+    // Once a node has multiple parents, it is used outside of this join graph and cannot be moved around
+    if (is_join_graph_node(child) && child->parents().size() == 1) {
+      collect_join_graph_nodes(child, graph_nodes, relations);
+    } else {
+      relations.emplace_back(child);
+    }
+  }
+}
+
+/**
+ * Assigns the predicates of the join graph to its relations and edges. Returns std::nullopt if the join graph cannot
+ * be reordered, either because a column cannot be assigned to one of its relations, or because no usable statistics
+ * are available.
+ */
+std::optional<JoinGraph> build_join_graph(const std::vector<std::shared_ptr<AbstractLQPNode>>& graph_nodes,
+                                          const std::vector<std::shared_ptr<AbstractLQPNode>>& relations) {
+  if (relations.size() > max_relation_count) return std::nullopt;
+
+  // A relation that is used twice within the join graph would make the assignment of columns to relations ambiguous
+  for (auto relation_iter = relations.begin(); relation_iter != relations.end(); ++relation_iter) {
+    if (std::find(std::next(relation_iter), relations.end(), *relation_iter) != relations.end()) return std::nullopt;
+  }
+
+  for (const auto& relation : relations) {
+    if (relation->get_statistics()->column_statistics().size() != relation->output_column_count()) return std::nullopt;
+  }
+
+  auto graph = JoinGraph{};
+  graph.relations = relations;
+
+  const auto find_relation_id = [&](const LQPColumnReference& column_reference) -> std::optional<size_t> {
+    for (auto relation_id = size_t{0}; relation_id < graph.relations.size(); ++relation_id) {
+      if (graph.relations[relation_id]->find_output_column_id(column_reference)) return relation_id;
+    }
+    return std::nullopt;
+  };
+
+  graph.local_predicates.resize(graph.relations.size());
+  graph.neighbours.resize(graph.relations.size(), 0);
+
+  const auto add_edge = [&](const LQPColumnReference& left_column_reference,
+                            const PredicateCondition predicate_condition,
+                            const LQPColumnReference& right_column_reference, const size_t left_relation_id,
+                            const size_t right_relation_id) {
+    graph.edges.emplace_back(JoinGraphEdge{left_column_reference, predicate_condition, right_column_reference,
+                                           single_relation(left_relation_id),
+                                           single_relation(left_relation_id) | single_relation(right_relation_id)});
+    graph.neighbours[left_relation_id] |= single_relation(right_relation_id);
+    graph.neighbours[right_relation_id] |= single_relation(left_relation_id);
+  };
+
+  for (const auto& node : graph_nodes) {
+    if (node->type() == LQPNodeType::Predicate) {
+      const auto predicate_node = std::static_pointer_cast<PredicateNode>(node);
+
+      const auto relation_id = find_relation_id(predicate_node->column_reference());
+      if (!relation_id) return std::nullopt;
+
+      if (is_lqp_column_reference(predicate_node->value())) {
+        const auto& value_column_reference = boost::get<LQPColumnReference>(predicate_node->value());
+
+        const auto value_relation_id = find_relation_id(value_column_reference);
+        if (!value_relation_id) return std::nullopt;
+
+        if (*value_relation_id != *relation_id) {
+          add_edge(predicate_node->column_reference(), predicate_node->predicate_condition(), value_column_reference,
+                   *relation_id, *value_relation_id);
+          continue;
+        }
+      }
+
+      graph.local_predicates[*relation_id].emplace_back(predicate_node);
+    } else {
+      const auto join_node = std::static_pointer_cast<JoinNode>(node);
+      if (join_node->join_mode() == JoinMode::Cross) continue;
+
+      const auto& join_column_references = *join_node->join_column_references();
+
+      const auto left_relation_id = find_relation_id(join_column_references.first);
+      const auto right_relation_id = find_relation_id(join_column_references.second);
+      if (!left_relation_id || !right_relation_id) return std::nullopt;
+
+      add_edge(join_column_references.first, *join_node->predicate_condition(), join_column_references.second,
+               *left_relation_id, *right_relation_id);
+    }
+  }
+
+  return graph;
+}
+
+std::shared_ptr<const JoinPlan> create_relation_plan(const JoinGraph& graph, const size_t relation_id) {
+  const auto& relation = graph.relations[relation_id];
+
+  auto plan = std::make_shared<JoinPlan>();
+  plan->relations = single_relation(relation_id);
+  plan->relation_id = relation_id;
+  plan->column_references = relation->output_column_references();
+
+  // Predicates do not change the column order, so the ColumnIDs of the relation can be used throughout
+  auto statistics = relation->get_statistics();
+  for (const auto& predicate_node : graph.local_predicates[relation_id]) {
+    auto value = predicate_node->value();
+    if (is_lqp_column_reference(value)) {
+      const auto value_column_id = relation->get_output_column_id(boost::get<LQPColumnReference>(value));
+      value = value_column_id;
+    }
+
+    statistics =
+        statistics->predicate_statistics(relation->get_output_column_id(predicate_node->column_reference()),
+                                         predicate_node->predicate_condition(), value, predicate_node->value2());
+  }
+  plan->statistics = statistics;
+
+  return plan;
+}
+
+std::shared_ptr<const JoinPlan> create_join_plan(const JoinGraph& graph,
+                                                 const std::shared_ptr<const JoinPlan>& left_plan,
+                                                 const std::shared_ptr<const JoinPlan>& right_plan) {
+  auto plan = std::make_shared<JoinPlan>();
+  plan->relations = left_plan->relations | right_plan->relations;
+  plan->left_plan = left_plan;
+  plan->right_plan = right_plan;
+
+  plan->column_references = left_plan->column_references;
+  plan->column_references.insert(plan->column_references.end(), right_plan->column_references.begin(),
+                                 right_plan->column_references.end());
+
+  // Collect the edges connecting both plans. An Equals predicate is preferred as the join predicate.
+  for (auto edge_id = size_t{0}; edge_id < graph.edges.size(); ++edge_id) {
+    const auto& edge = graph.edges[edge_id];
+    if (!(edge.relations & left_plan->relations) || !(edge.relations & right_plan->relations)) continue;
+
+    const auto is_better_join_edge =
+        is_join_predicate_condition(edge.predicate_condition) &&
+        (!plan->join_edge_id || (edge.predicate_condition == PredicateCondition::Equals &&
+                                 graph.edges[*plan->join_edge_id].predicate_condition != PredicateCondition::Equals));
+
+    if (is_better_join_edge) {
+      if (plan->join_edge_id) plan->predicate_edge_ids.emplace_back(*plan->join_edge_id);
+      plan->join_edge_id = edge_id;
+    } else {
+      plan->predicate_edge_ids.emplace_back(edge_id);
+    }
+  }
+
+  if (plan->join_edge_id) {
+    const auto [left_column_reference, predicate_condition, right_column_reference] =
+        oriented_join_predicate(graph.edges[*plan->join_edge_id], *left_plan);
+
+    plan->statistics = left_plan->statistics->generate_predicated_join_statistics(
+        right_plan->statistics, JoinMode::Inner,
+        ColumnIDPair{column_id_in_plan(*left_plan, left_column_reference),
+                     column_id_in_plan(*right_plan, right_column_reference)},
+        predicate_condition);
+  } else {
+    plan->statistics = left_plan->statistics->generate_cross_join_statistics(right_plan->statistics);
+  }
+
+  for (const auto edge_id : plan->predicate_edge_ids) {
+    const auto& edge = graph.edges[edge_id];
+    const auto value_column_id = column_id_in_plan(*plan, edge.right_column_reference);
+    plan->statistics = plan->statistics->predicate_statistics(column_id_in_plan(*plan, edge.left_column_reference),
+                                                              edge.predicate_condition, value_column_id);
+  }
+
+  plan->cost = left_plan->cost + right_plan->cost + plan->statistics->row_count();
+
+  return plan;
+}
+
+// Puts the input with more rows on the left, so that the output does not depend on the enumeration order
+std::shared_ptr<const JoinPlan> create_join_plan_for_pair(const JoinGraph& graph,
+                                                          const std::shared_ptr<const JoinPlan>& plan_a,
+                                                          const std::shared_ptr<const JoinPlan>& plan_b) {
+  if (plan_a->statistics->row_count() >= plan_b->statistics->row_count()) {
+    return create_join_plan(graph, plan_a, plan_b);
+  }
+  return create_join_plan(graph, plan_b, plan_a);
+}
+
+/**
+ * EnumerateCsgRec from the DPccp paper: Calls callback for all connected subgraphs that extend subgraph by relations
+ * from its neighbourhood, excluding the relations in excluded_relations.
+ */
+void enumerate_connected_subgraphs(const JoinGraph& graph, const RelationSet subgraph,
+                                   const RelationSet excluded_relations,
+                                   const std::function<void(RelationSet)>& callback) {
+  const auto extensions = neighbourhood(graph, subgraph) & ~excluded_relations;
+  if (!extensions) return;
+
+  for (auto extension = extensions; extension; extension = (extension - 1) & extensions) {
+    callback(subgraph | extension);
+  }
+
+  for (auto extension = extensions; extension; extension = (extension - 1) & extensions) {
+    enumerate_connected_subgraphs(graph, subgraph | extension, excluded_relations | extensions, callback);
+  }
+}
+
+/**
+ * EnumerateCmp from the DPccp paper: Calls callback for all connected subgraphs that are connected to, but do not
+ * overlap with, subgraph. Each pair of subgraphs is only enumerated once.
+ */
+void enumerate_complements(const JoinGraph& graph, const RelationSet subgraph,
+                           const std::function<void(RelationSet)>& callback) {
+  const auto excluded_relations = relations_up_to(lowest_relation_id(subgraph)) | subgraph;
+  const auto candidates = neighbourhood(graph, subgraph) & ~excluded_relations;
+
+  for (auto relation_id = graph.relations.size(); relation_id-- > 0;) {
+    if (!(candidates & single_relation(relation_id))) continue;
+
+    callback(single_relation(relation_id));
+    enumerate_connected_subgraphs(graph, single_relation(relation_id),
+                                  excluded_relations | (relations_up_to(relation_id) & candidates), callback);
+  }
+}
+
+/**
+ * Finds the cheapest plan for a connected set of relations using DPccp
+ */
+std::shared_ptr<const JoinPlan> order_with_dpccp(const JoinGraph& graph, const RelationSet component) {
+  auto best_plans = JoinPlanMap{};
+
+  // Enumerate all pairs of connected subgraphs first, so that they can be processed by increasing size. This
+  // guarantees that the best plans of both subgraphs are known when a pair is joined.
+  auto subgraph_pairs = std::vector<std::pair<RelationSet, RelationSet>>{};
+  const auto add_complements = [&](const RelationSet subgraph) {
+    enumerate_complements(graph, subgraph, [&](const RelationSet complement) {
+      subgraph_pairs.emplace_back(subgraph, complement);
+    });
+  };
+
+  for (auto relation_id = graph.relations.size(); relation_id-- > 0;) {
+    if (!(component & single_relation(relation_id))) continue;
+
+    best_plans.emplace(single_relation(relation_id), create_relation_plan(graph, relation_id));
+
+    add_complements(single_relation(relation_id));
+    enumerate_connected_subgraphs(graph, single_relation(relation_id), relations_up_to(relation_id), add_complements);
+  }
+
+  std::stable_sort(subgraph_pairs.begin(), subgraph_pairs.end(), [](const auto& lhs, const auto& rhs) {
+    return relation_count(lhs.first | lhs.second) < relation_count(rhs.first | rhs.second);
+  });
+
+  for (const auto& [subgraph, complement] : subgraph_pairs) {
+    const auto plan = create_join_plan_for_pair(graph, best_plans.at(subgraph), best_plans.at(complement));
+
+    auto& best_plan = best_plans[subgraph | complement];
+    if (!best_plan || plan->cost < best_plan->cost) best_plan = plan;
+  }
+
+  return best_plans.at(component);
+}
+
+/**
+ * Greedy Operator Ordering: Repeatedly joins the two plans with the smallest join result. Plans that are connected
+ * by an edge are joined before any cross join is considered.
+ */
+std::shared_ptr<const JoinPlan> order_greedily(const JoinGraph& graph,
+                                               std::vector<std::shared_ptr<const JoinPlan>> plans) {
+  DebugAssert(!plans.empty(), "Need at least one plan to join");
+
+  while (plans.size() > 1) {
+    auto best_plan = std::shared_ptr<const JoinPlan>{};
+    auto best_plan_is_connected = false;
+    auto best_plan_ids = std::pair<size_t, size_t>{};
+
+    for (auto plan_a_id = size_t{0}; plan_a_id < plans.size(); ++plan_a_id) {
+      const auto plan_a_neighbourhood = neighbourhood(graph, plans[plan_a_id]->relations);
+
+      for (auto plan_b_id = plan_a_id + 1; plan_b_id < plans.size(); ++plan_b_id) {
+        const auto is_connected = (plan_a_neighbourhood & plans[plan_b_id]->relations) != 0;
+        if (best_plan_is_connected && !is_connected) continue;
+
+        const auto plan = create_join_plan_for_pair(graph, plans[plan_a_id], plans[plan_b_id]);
+        if (!best_plan || (is_connected && !best_plan_is_connected) ||
+            plan->statistics->row_count() < best_plan->statistics->row_count()) {
+          best_plan = plan;
+          best_plan_is_connected = is_connected;
+          best_plan_ids = {plan_a_id, plan_b_id};
+        }
+      }
+    }
+
+    // plan_b_id > plan_a_id, so erasing it first keeps plan_a_id valid
+    plans.erase(plans.begin() + best_plan_ids.second);
+    plans[best_plan_ids.first] = best_plan;
+  }
+
+  return plans.front();
+}
+
+std::shared_ptr<const JoinPlan> order_join_graph(const JoinGraph& graph, const size_t max_dp_relation_count) {
+  // Split the join graph into its connected components, which are ordered independently
+  auto component_plans = std::vector<std::shared_ptr<const JoinPlan>>{};
+  auto unassigned_relations = relations_up_to(graph.relations.size() - 1);
+
+  while (unassigned_relations) {
+    auto component = single_relation(lowest_relation_id(unassigned_relations));
+    for (auto extension = neighbourhood(graph, component); extension; extension = neighbourhood(graph, component)) {
+      component |= extension;
+    }
+    unassigned_relations &= ~component;
+
+    if (relation_count(component) <= max_dp_relation_count) {
+      component_plans.emplace_back(order_with_dpccp(graph, component));
+    } else {
+      auto relation_plans = std::vector<std::shared_ptr<const JoinPlan>>{};
+      for (auto relation_id = size_t{0}; relation_id < graph.relations.size(); ++relation_id) {
+        if (component & single_relation(relation_id)) {
+          relation_plans.emplace_back(create_relation_plan(graph, relation_id));
+        }
+      }
+      component_plans.emplace_back(order_greedily(graph, relation_plans));
+    }
+  }
+
+  return order_greedily(graph, component_plans);
+}
+
+std::shared_ptr<AbstractLQPNode> create_lqp(const JoinGraph& graph, const JoinPlan& plan) {
+  auto node = std::shared_ptr<AbstractLQPNode>{};
+
+  if (plan.relation_id) {
+    node = graph.relations[*plan.relation_id];
+
+    // Retie the local predicates in their original order
+    const auto& local_predicates = graph.local_predicates[*plan.relation_id];
+    for (auto predicate_iter = local_predicates.rbegin(); predicate_iter != local_predicates.rend(); ++predicate_iter) {
+      (*predicate_iter)->set_left_child(node);
+      node = *predicate_iter;
+    }
+
+    return node;
+  }
+
+  if (plan.join_edge_id) {
+    const auto [left_column_reference, predicate_condition, right_column_reference] =
+        oriented_join_predicate(graph.edges[*plan.join_edge_id], *plan.left_plan);
+    node = JoinNode::make(JoinMode::Inner, LQPColumnReferencePair{left_column_reference, right_column_reference},
+                          predicate_condition);
+  } else {
+    node = JoinNode::make(JoinMode::Cross);
+  }
+
+  node->set_left_child(create_lqp(graph, *plan.left_plan));
+  node->set_right_child(create_lqp(graph, *plan.right_plan));
+
+  for (const auto edge_id : plan.predicate_edge_ids) {
+    const auto& edge = graph.edges[edge_id];
+    const auto predicate_node =
+        PredicateNode::make(edge.left_column_reference, edge.predicate_condition, edge.right_column_reference);
+    predicate_node->set_left_child(node);
+    node = predicate_node;
+  }
+
+  return node;
+}
+
+}  // namespace
+
+JoinOrderingRule::JoinOrderingRule(const size_t max_dp_relation_count)
+    : _max_dp_relation_count(max_dp_relation_count) {}
+
+std::string JoinOrderingRule::name() const { return "Join Ordering Rule"; }
+
+bool JoinOrderingRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) {
+  if (!is_join_graph_node(node)) return _apply_to_children(node);
+
+  auto graph_nodes = std::vector<std::shared_ptr<AbstractLQPNode>>{};
+  auto relations = std::vector<std::shared_ptr<AbstractLQPNode>>{};
+  collect_join_graph_nodes(node, graph_nodes, relations);
+
+  auto reordered = false;
+
+  // With fewer than three relations, there is nothing to reorder. Without statistics for every relation, e.g., if one
+  // of them contains a UnionNode, the join orders cannot be compared.
+  const auto relations_have_statistics = std::all_of(relations.begin(), relations.end(),
+                                                     [](const auto& relation) { return _has_statistics(relation); });
+  const auto graph =
+      relations.size() >= 3 && relations_have_statistics ? build_join_graph(graph_nodes, relations) : std::nullopt;
+  if (graph) {
+    const auto plan = order_join_graph(*graph, _max_dp_relation_count);
+
+    // Store original parents and output columns
+    const auto parents = node->parents();
+    const auto child_sides = node->get_child_sides();
+    const auto output_column_references = node->output_column_references();
+
+    // Untie the join graph from the LQP, so that its relations and local predicates can be freely retied
+    for (const auto& graph_node : graph_nodes) {
+      graph_node->set_left_child(nullptr);
+      graph_node->set_right_child(nullptr);
+    }
+
+    auto new_root = create_lqp(*graph, *plan);
+    if (new_root->output_column_references() != output_column_references) {
+      const auto projection_node = ProjectionNode::make(LQPExpression::create_columns(output_column_references));
+      projection_node->set_left_child(new_root);
+      new_root = projection_node;
+    }
+
+    for (size_t parent_idx = 0; parent_idx < parents.size(); ++parent_idx) {
+      parents[parent_idx]->set_child(child_sides[parent_idx], new_root);
+    }
+
+    reordered = true;
+  }
+
+  // Continue with the relations, which might contain further join graphs
+  for (const auto& relation : relations) {
+    reordered |= apply_to(relation);
+  }
+
+  return reordered;
+}
+
+}  // namespace opossum
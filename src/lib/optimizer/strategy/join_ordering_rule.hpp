@@ -0,0 +1,58 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * This optimizer rule reorders inner and cross joins based on the estimated cardinalities of their intermediate
+ * results.
+ *
+ * HOW THIS WORKS
+ *
+ * The rule traverses the LQP top-down. Whenever it hits an Inner or Cross JoinNode or a PredicateNode, it collects the
+ * largest connected subtree consisting only of such nodes (a "join graph"). Nodes that have multiple parents or are of
+ * any other type are the leaves (the "relations") of the join graph. PredicateNodes that compare columns of two
+ * different relations become the edges of the graph, all other PredicateNodes are attached to the relation they
+ * reference.
+ *
+ * The join order is then chosen by minimizing the sum of the estimated row counts of all joins (C_out). Cardinalities
+ * are estimated using TableStatistics::generate_predicated_join_statistics().
+ *  - Join graphs with up to max_dp_relation_count relations are ordered optimally using DPccp (Moerkotte & Neumann,
+ *    "Analysis of Two Existing and One New Dynamic Programming Algorithm for the Generation of Optimal Bushy Join Trees
+ *    without Cross Products"), which only enumerates pairs of connected subgraphs.
+ *  - Larger join graphs are ordered greedily (Greedy Operator Ordering): The pair of subplans with the smallest join
+ *    result is joined until only one plan is left.
+ * Disconnected parts of a join graph are combined using cross joins, smallest results first.
+ *
+ * Between any two subplans, an Equals predicate is preferred as the join predicate. All other predicates connecting the
+ * two subplans are placed as PredicateNodes directly on top of the join.
+ *
+ * Since the rule may change the order of the output columns, a ProjectionNode restoring the original order is
+ * added on top of the join graph if necessary.
+ *
+ * Note: Join graphs with fewer than three relations are left untouched, as there is nothing to reorder. Join graphs for
+ * which no statistics can be derived (e.g., because a relation contains a UnionNode or its statistics do not match its
+ * output columns) or that contain more than 64 relations are not reordered either.
+ */
+class JoinOrderingRule : public AbstractRule {
+ public:
+  static constexpr size_t default_max_dp_relation_count = 12;
+
+  explicit JoinOrderingRule(const size_t max_dp_relation_count = default_max_dp_relation_count);
+
+  std::string name() const override;
+
+  bool apply_to(const std::shared_ptr<AbstractLQPNode>& node) override;
+
+ private:
+  const size_t _max_dp_relation_count;
+};
+
+}  // namespace opossum
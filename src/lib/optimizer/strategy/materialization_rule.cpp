@@ -0,0 +1,69 @@
+#include "materialization_rule.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <string>
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/limit_node.hpp"
+#include "logical_query_plan/lqp_expression.hpp"
+#include "logical_query_plan/materialize_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "optimizer/table_statistics.hpp"
+
+namespace opossum {
+
+std::string MaterializationRule::name() const { return "Materialization Rule"; }
+
+bool MaterializationRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) {
+  // Only the result of the whole plan, i.e., the input of the LogicalPlanRootNode, is materialized
+  if (node->type() != LQPNodeType::Root || !node->left_child()) return false;
+
+  const auto result_node = node->left_child();
+  if (!_produces_references(result_node) || !_has_statistics(result_node)) return false;
+  if (_estimate_row_count(result_node) < MIN_ROW_COUNT_TO_MATERIALIZE) return false;
+
+  const auto materialize_node = MaterializeNode::make();
+  materialize_node->set_left_child(result_node);
+  node->set_left_child(materialize_node);
+
+  return true;
+}
+
+bool MaterializationRule::_produces_references(const std::shared_ptr<AbstractLQPNode>& node) const {
+  switch (node->type()) {
+    case LQPNodeType::Distinct:
+    case LQPNodeType::Join:
+    case LQPNodeType::Limit:
+    case LQPNodeType::Predicate:
+    case LQPNodeType::Sort:
+    case LQPNodeType::Union:
+    case LQPNodeType::Validate:
+      return true;
+
+    case LQPNodeType::Projection: {
+      // The Projection passes on the columns of its input and references the columns it computes if its input
+      // consists of references. If all columns are computed, it outputs values.
+      const auto& column_expressions = std::static_pointer_cast<ProjectionNode>(node)->column_expressions();
+      const auto passes_on_columns =
+          std::any_of(column_expressions.begin(), column_expressions.end(),
+                      [](const auto& expression) { return expression->type() == ExpressionType::Column; });
+      return passes_on_columns && _produces_references(node->left_child());
+    }
+
+    default:
+      return false;
+  }
+}
+
+float MaterializationRule::_estimate_row_count(const std::shared_ptr<AbstractLQPNode>& node) const {
+  // The statistics of a LimitNode are those of its input
+  if (node->type() == LQPNodeType::Limit) {
+    const auto num_rows = static_cast<float>(std::static_pointer_cast<LimitNode>(node)->num_rows());
+    return std::min(num_rows, _estimate_row_count(node->left_child()));
+  }
+
+  return node->get_statistics()->row_count();
+}
+
+}  // namespace opossum
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * This optimizer rule decides where the columns that the operators of a plan only reference are materialized.
+ *
+ * Operators like TableScans, Joins, Sorts, and Limits only produce positions (ReferenceColumns), and the Projection
+ * only materializes the columns it computes. The columns that none of them touch are gathered as late as possible:
+ * If the result of the plan is estimated to have at least MIN_ROW_COUNT_TO_MATERIALIZE rows, a MaterializeNode is
+ * placed directly below the LogicalPlanRootNode. The Materialize operator then gathers all referenced columns
+ * column-wise in parallel. Smaller results are returned as references, as dereferencing a few rows is cheaper than
+ * scheduling the tasks that copy them.
+ *
+ * Plans whose row count cannot be estimated (e.g., because they contain a UnionNode) are left unchanged.
+ */
+class MaterializationRule : public AbstractRule {
+ public:
+  static constexpr float MIN_ROW_COUNT_TO_MATERIALIZE = 10'000.0f;
+
+  std::string name() const override;
+  bool apply_to(const std::shared_ptr<AbstractLQPNode>& node) override;
+
+ protected:
+  // Whether the operator of the node outputs ReferenceColumns
+  bool _produces_references(const std::shared_ptr<AbstractLQPNode>& node) const;
+
+  float _estimate_row_count(const std::shared_ptr<AbstractLQPNode>& node) const;
+};
+
+}  // namespace opossum
@@ -0,0 +1,145 @@
+#include "pipeline_fusion_rule.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "all_parameter_variant.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/lqp_expression.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "resolve_type.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+namespace {
+
+// The data type of a column of a stored table, std::nullopt for columns created by other nodes
+std::optional<DataType> data_type_of(const LQPColumnReference& column_reference) {
+  const auto stored_table_node = std::dynamic_pointer_cast<const StoredTableNode>(column_reference.original_node());
+  if (!stored_table_node) return std::nullopt;
+
+  const auto table = StorageManager::get().get_table(stored_table_node->table_name());
+  return table->column_type(column_reference.original_column_id());
+}
+
+// The data type of a non-NULL value, std::nullopt for NULLs and value placeholders
+std::optional<DataType> data_type_of(const AllParameterVariant& value) {
+  if (is_lqp_column_reference(value)) return data_type_of(boost::get<LQPColumnReference>(value));
+  if (!is_variant(value) || variant_is_null(boost::get<AllTypeVariant>(value))) return std::nullopt;
+  return data_type_from_all_type_variant(boost::get<AllTypeVariant>(value));
+}
+
+// The data type of an expression the FusedAggregate can evaluate as the argument of an aggregate, std::nullopt for
+// all other expressions
+std::optional<DataType> data_type_of(const LQPExpression& expression) {
+  if (expression.type() == ExpressionType::Column) return data_type_of(expression.column_reference());
+  if (expression.type() == ExpressionType::Literal) return data_type_of(AllParameterVariant{expression.value()});
+  if (!expression.is_arithmetic_operator() || expression.type() == ExpressionType::Power) return std::nullopt;
+
+  const auto left_data_type = data_type_of(*expression.left_child());
+  const auto right_data_type = data_type_of(*expression.right_child());
+  if (!left_data_type || !right_data_type) return std::nullopt;
+  if (*left_data_type == DataType::String || *right_data_type == DataType::String) return std::nullopt;
+
+  // Numbers are promoted to the wider data type
+  return std::max(*left_data_type, *right_data_type);
+}
+
+// Strings can only be compared to strings
+bool data_types_are_compatible(const DataType lhs, const DataType rhs) {
+  return (lhs == DataType::String) == (rhs == DataType::String);
+}
+
+}  // namespace
+
+std::string PipelineFusionRule::name() const { return "Pipeline Fusion Rule"; }
+
+bool PipelineFusionRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) {
+  auto lqp_changed = false;
+
+  if (node->type() == LQPNodeType::Aggregate) {
+    const auto aggregate_node = std::static_pointer_cast<AggregateNode>(node);
+
+    if (!aggregate_node->fused_predicate_count() && _can_fuse(*aggregate_node)) {
+      // Predicates with other parents are needed by these, too, and are executed by TableScans
+      auto fused_predicate_count = size_t{0};
+      for (auto input_node = node->left_child(); input_node->type() == LQPNodeType::Predicate &&
+                                                 input_node->parents().size() == 1 &&
+                                                 _can_fuse(static_cast<const PredicateNode&>(*input_node));
+           input_node = input_node->left_child()) {
+        ++fused_predicate_count;
+      }
+
+      aggregate_node->set_fused_predicate_count(fused_predicate_count);
+      lqp_changed = true;
+    }
+  }
+
+  return _apply_to_children(node) || lqp_changed;
+}
+
+bool PipelineFusionRule::_can_fuse(const AggregateNode& aggregate_node) const {
+  for (const auto& groupby_column_reference : aggregate_node.groupby_column_references()) {
+    if (!data_type_of(groupby_column_reference)) return false;
+  }
+
+  for (const auto& aggregate_expression : aggregate_node.aggregate_expressions()) {
+    const auto function = aggregate_expression->aggregate_function();
+    const auto& arguments = aggregate_expression->aggregate_function_arguments();
+    if (function == AggregateFunction::CountDistinct || arguments.size() != 1) return false;
+
+    if (arguments[0]->type() == ExpressionType::Star) {
+      if (function != AggregateFunction::Count) return false;
+      continue;
+    }
+
+    const auto argument_data_type = data_type_of(*arguments[0]);
+    if (!argument_data_type) return false;
+    if (*argument_data_type == DataType::String &&
+        (function == AggregateFunction::Sum || function == AggregateFunction::Avg)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+bool PipelineFusionRule::_can_fuse(const PredicateNode& predicate_node) const {
+  if (predicate_node.scan_type() != ScanType::TableScan) return false;
+
+  switch (predicate_node.predicate_condition()) {
+    case PredicateCondition::Equals:
+    case PredicateCondition::NotEquals:
+    case PredicateCondition::LessThan:
+    case PredicateCondition::LessThanEquals:
+    case PredicateCondition::GreaterThan:
+    case PredicateCondition::GreaterThanEquals:
+    case PredicateCondition::Between:
+      break;
+    default:
+      return false;
+  }
+
+  const auto column_data_type = data_type_of(predicate_node.column_reference());
+  const auto value_data_type = data_type_of(predicate_node.value());
+  if (!column_data_type || !value_data_type || !data_types_are_compatible(*column_data_type, *value_data_type)) {
+    return false;
+  }
+
+  if (predicate_node.predicate_condition() == PredicateCondition::Between) {
+    if (!is_variant(predicate_node.value()) || !predicate_node.value2()) return false;
+
+    const auto value2_data_type = data_type_of(AllParameterVariant{*predicate_node.value2()});
+    if (!value2_data_type || !data_types_are_compatible(*column_data_type, *value2_data_type)) return false;
+  }
+
+  return true;
+}
+
+}  // namespace opossum
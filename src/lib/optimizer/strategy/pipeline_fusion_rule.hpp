@@ -0,0 +1,36 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+class AggregateNode;
+class PredicateNode;
+
+/**
+ * This optimizer rule marks AggregateNodes whose pipeline can be executed as a FusedAggregate, which evaluates the
+ * predicates, the arguments of the aggregate functions, and the aggregates in a single pass over the input, e.g., for
+ * TPC-H Q1 and Q6.
+ *
+ * An AggregateNode is fused if all its aggregates are MIN, MAX, SUM, AVG, or COUNT of a column or of an arithmetic
+ * expression of columns and literals, and if it groups by columns only. The PredicateNodes directly below it are
+ * fused as long as they compare a column to a value or to another column of a compatible data type and are executed
+ * as TableScans. All columns need to originate from stored tables, as their data types are needed. The predicates
+ * below the first one that cannot be fused are executed by TableScans before. Plans that cannot be fused are not
+ * changed and are executed by the regular operators.
+ */
+class PipelineFusionRule : public AbstractRule {
+ public:
+  std::string name() const override;
+  bool apply_to(const std::shared_ptr<AbstractLQPNode>& node) override;
+
+ protected:
+  bool _can_fuse(const AggregateNode& aggregate_node) const;
+  bool _can_fuse(const PredicateNode& predicate_node) const;
+};
+
+}  // namespace opossum
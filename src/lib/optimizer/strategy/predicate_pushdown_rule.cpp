@@ -0,0 +1,134 @@
+#include "predicate_pushdown_rule.hpp"
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "all_parameter_variant.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+
+namespace opossum {
+
+namespace {
+
+// Ties predicate_node in between node and its child on the given side
+void insert_below(const std::shared_ptr<AbstractLQPNode>& node, const LQPChildSide side,
+                  const std::shared_ptr<PredicateNode>& predicate_node) {
+  const auto child = node->child(side);
+  node->set_child(side, predicate_node);
+  predicate_node->set_left_child(child);
+}
+
+}  // namespace
+
+std::string PredicatePushdownRule::name() const { return "Predicate Pushdown Rule"; }
+
+bool PredicatePushdownRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) {
+  // Push down the predicates further down in the LQP first, so that the predicates above can pass them
+  auto pushed_down = _apply_to_children(node);
+
+  if (node->type() == LQPNodeType::Predicate) {
+    pushed_down |= _push_down(std::static_pointer_cast<PredicateNode>(node));
+  }
+
+  return pushed_down;
+}
+
+bool PredicatePushdownRule::_push_down(const std::shared_ptr<PredicateNode>& predicate_node) const {
+  /**
+   * Find the deepest node the predicate can be moved below. Other PredicateNodes are skipped, but only passing any
+   * other node makes it worthwhile to move the predicate.
+   */
+  auto target_node = std::shared_ptr<AbstractLQPNode>{};
+  auto target_side = LQPChildSide::Left;
+
+  auto node = predicate_node->left_child();
+  while (node && node->parents().size() == 1) {
+    if (node->type() == LQPNodeType::Predicate) {
+      node = node->left_child();
+      continue;
+    }
+
+    const auto side = _find_push_down_side(predicate_node, node);
+    if (!side) break;
+
+    target_node = node;
+    target_side = *side;
+
+    // Both inputs of a UnionNode are handled separately below
+    if (node->type() == LQPNodeType::Union) break;
+
+    node = node->child(*side);
+  }
+
+  if (!target_node) return false;
+
+  predicate_node->remove_from_tree();
+
+  if (target_node->type() == LQPNodeType::Union) {
+    const auto right_predicate_node =
+        PredicateNode::make(predicate_node->column_reference(), predicate_node->predicate_condition(),
+                            predicate_node->value(), predicate_node->value2());
+    insert_below(target_node, LQPChildSide::Right, right_predicate_node);
+    _push_down(right_predicate_node);
+  }
+
+  insert_below(target_node, target_side, predicate_node);
+  _push_down(predicate_node);
+
+  return true;
+}
+
+std::optional<LQPChildSide> PredicatePushdownRule::_find_push_down_side(
+    const std::shared_ptr<PredicateNode>& predicate_node, const std::shared_ptr<AbstractLQPNode>& node) const {
+  switch (node->type()) {
+    case LQPNodeType::Join: {
+      const auto join_mode = std::static_pointer_cast<JoinNode>(node)->join_mode();
+
+      // Outer Joins emit rows of their preserved input even if they have no join partner, so filtering the other
+      // input would change the result
+      if (_is_available_in(predicate_node, node->left_child())) {
+        if (join_mode == JoinMode::Inner || join_mode == JoinMode::Cross || join_mode == JoinMode::Left ||
+            join_mode == JoinMode::Semi || join_mode == JoinMode::Anti) {
+          return LQPChildSide::Left;
+        }
+      } else if (_is_available_in(predicate_node, node->right_child())) {
+        if (join_mode == JoinMode::Inner || join_mode == JoinMode::Cross || join_mode == JoinMode::Right) {
+          return LQPChildSide::Right;
+        }
+      }
+      return std::nullopt;
+    }
+
+    case LQPNodeType::Projection:
+    case LQPNodeType::Sort:
+      // Columns calculated by a ProjectionNode are not available in its input
+      if (_is_available_in(predicate_node, node->left_child())) return LQPChildSide::Left;
+      return std::nullopt;
+
+    case LQPNodeType::Union:
+      if (_is_available_in(predicate_node, node->left_child()) &&
+          _is_available_in(predicate_node, node->right_child())) {
+        return LQPChildSide::Left;
+      }
+      return std::nullopt;
+
+    default:
+      return std::nullopt;
+  }
+}
+
+bool PredicatePushdownRule::_is_available_in(const std::shared_ptr<PredicateNode>& predicate_node,
+                                             const std::shared_ptr<AbstractLQPNode>& node) const {
+  if (!node->find_output_column_id(predicate_node->column_reference())) return false;
+
+  if (is_lqp_column_reference(predicate_node->value())) {
+    return static_cast<bool>(node->find_output_column_id(boost::get<LQPColumnReference>(predicate_node->value())));
+  }
+
+  return true;
+}
+
+}  // namespace opossum
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+
+#include "abstract_rule.hpp"
+#include "logical_query_plan/abstract_lqp_node.hpp"
+
+namespace opossum {
+
+class PredicateNode;
+
+/**
+ * This optimizer rule moves PredicateNodes as far down the LQP as possible, so that Joins and other operators process
+ * already filtered inputs. This also applies to predicates written outside of a derived table or view, as those are
+ * part of the LQP as well.
+ *
+ * A PredicateNode is moved below
+ *  - JoinNodes, if all of its columns come from the same input and the JoinMode preserves that input's rows as they are
+ *    (i.e., the left input of Inner, Cross, Left, Semi and Anti Joins and the right input of Inner, Cross and Right
+ *    Joins). Predicates comparing columns of both inputs stay above the Join, so that the JoinDetectionRule can turn
+ *    them into join predicates.
+ *  - ProjectionNodes, if all of its columns are passed through from the input of the ProjectionNode
+ *  - SortNodes
+ *  - UnionNodes, if all of its columns are available in both inputs. The predicate is duplicated for the right input.
+ * Chains of PredicateNodes are skipped, but a predicate is only moved if it passes at least one other node. The order
+ * of predicates within a chain is left to the PredicateReorderingRule.
+ *
+ * Nodes with multiple parents are never passed, as the predicate would then also filter the input of their other
+ * parents.
+ */
+class PredicatePushdownRule : public AbstractRule {
+ public:
+  std::string name() const override;
+  bool apply_to(const std::shared_ptr<AbstractLQPNode>& node) override;
+
+ private:
+  bool _push_down(const std::shared_ptr<PredicateNode>& predicate_node) const;
+
+  // Returns the input of node that the predicate can be moved into, if any
+  std::optional<LQPChildSide> _find_push_down_side(const std::shared_ptr<PredicateNode>& predicate_node,
+                                                   const std::shared_ptr<AbstractLQPNode>& node) const;
+
+  bool _is_available_in(const std::shared_ptr<PredicateNode>& predicate_node,
+                        const std::shared_ptr<AbstractLQPNode>& node) const;
+};
+
+}  // namespace opossum
@@ -59,8 +59,13 @@ bool PredicateReorderingRule::_reorder_predicates(std::vector<std::shared_ptr<Pr
   const auto parents = predicates.front()->parents();
   const auto child_sides = predicates.front()->get_child_sides();
 
+  // Predicates with equal estimates (e.g., ranges covering the same values of a histogram) are ordered by their
+  // description, so that the order does not depend on the one in the query
   const auto sort_predicate = [&](auto& left, auto& right) {
-    return left->derive_statistics_from(child)->row_count() > right->derive_statistics_from(child)->row_count();
+    const auto left_row_count = left->derive_statistics_from(child)->row_count();
+    const auto right_row_count = right->derive_statistics_from(child)->row_count();
+    if (left_row_count != right_row_count) return left_row_count > right_row_count;
+    return left->description() > right->description();
   };
 
   if (std::is_sorted(predicates.begin(), predicates.end(), sort_predicate)) {
@@ -0,0 +1,31 @@
+#include "top_k_rule.hpp"
+
+#include <memory>
+#include <string>
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+#include "logical_query_plan/limit_node.hpp"
+#include "logical_query_plan/sort_node.hpp"
+
+namespace opossum {
+
+std::string TopKRule::name() const { return "Top K Rule"; }
+
+bool TopKRule::apply_to(const std::shared_ptr<AbstractLQPNode>& node) {
+  auto lqp_changed = false;
+
+  if (node->type() == LQPNodeType::Limit && node->left_child()->type() == LQPNodeType::Sort &&
+      node->left_child()->parents().size() == 1) {
+    const auto limit_node = std::static_pointer_cast<LimitNode>(node);
+    const auto sort_node = std::static_pointer_cast<SortNode>(node->left_child());
+
+    if (sort_node->top_k() != limit_node->num_rows()) {
+      sort_node->set_top_k(limit_node->num_rows());
+      lqp_changed = true;
+    }
+  }
+
+  return _apply_to_children(node) || lqp_changed;
+}
+
+}  // namespace opossum
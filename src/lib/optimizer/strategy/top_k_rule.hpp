@@ -0,0 +1,25 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "abstract_rule.hpp"
+
+namespace opossum {
+
+class AbstractLQPNode;
+
+/**
+ * This optimizer rule looks for LimitNodes directly on top of SortNodes and marks the SortNodes with the number of
+ * rows the LimitNode lets pass. For these SortNodes, the LQPTranslator creates a TopK operator, which only selects
+ * the first rows instead of sorting its whole input.
+ *
+ * SortNodes with more than one parent are not marked, as their other parents need all sorted rows.
+ */
+class TopKRule : public AbstractRule {
+ public:
+  std::string name() const override;
+  bool apply_to(const std::shared_ptr<AbstractLQPNode>& node) override;
+};
+
+}  // namespace opossum
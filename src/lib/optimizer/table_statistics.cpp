@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <utility>
@@ -10,6 +11,7 @@
 
 #include "all_parameter_variant.hpp"
 #include "optimizer/base_column_statistics.hpp"
+#include "optimizer/chunk_statistics.hpp"
 #include "optimizer/column_statistics.hpp"
 #include "resolve_type.hpp"
 #include "storage/table.hpp"
@@ -17,19 +19,39 @@
 namespace opossum {
 
 TableStatistics::TableStatistics(const std::shared_ptr<Table> table)
-    : _table(table), _row_count(table->row_count()), _column_statistics(table->column_count()) {}
+    : _table(table),
+      _row_count(table->row_count()),
+      _column_statistics(table->column_count()),
+      _column_statistics_row_count(table->row_count()),
+      _merged_chunk_statistics(table->column_count()) {}
+
+TableStatistics::TableStatistics(const TableStatistics& table_statistics)
+    : std::enable_shared_from_this<TableStatistics>(),
+      _table(table_statistics._table),
+      _approx_invalid_row_count(table_statistics._approx_invalid_row_count) {
+  std::lock_guard<std::mutex> lock(table_statistics._column_statistics_mutex);
+  _row_count = table_statistics._row_count;
+  _column_statistics = table_statistics._column_statistics;
+  _column_statistics_row_count = table_statistics._column_statistics_row_count;
+}
 
 TableStatistics::TableStatistics(float row_count,
                                  const std::vector<std::shared_ptr<BaseColumnStatistics>>& column_statistics)
     : _row_count(row_count), _column_statistics(column_statistics) {}
 
-float TableStatistics::row_count() const { return _row_count; }
+float TableStatistics::row_count() const {
+  std::lock_guard<std::mutex> lock(_column_statistics_mutex);
+  _refresh_column_statistics();
+  return _row_count;
+}
 
 uint64_t TableStatistics::approx_valid_row_count() const { return row_count() - _approx_invalid_row_count; }
 
-const std::vector<std::shared_ptr<BaseColumnStatistics>>& TableStatistics::column_statistics() const {
+std::vector<std::shared_ptr<BaseColumnStatistics>> TableStatistics::column_statistics() const {
   // Lazily initialize column statistics
   _create_all_column_statistics();
+
+  std::lock_guard<std::mutex> lock(_column_statistics_mutex);
   return _column_statistics;
 }
 
@@ -95,23 +117,22 @@ std::shared_ptr<TableStatistics> TableStatistics::generate_cross_join_statistics
   // create all not yet created column statistics as there is no mapping in join table statistics from table to columns
   // A join result can consist of columns of two different tables. Therefore, the reference to the table cannot be
   // stored within the table statistics but instead in the column statistics.
-  _create_all_column_statistics();
-  right_table_stats->_create_all_column_statistics();
+  const auto left_column_statistics = column_statistics();
+  const auto right_column_statistics = right_table_stats->column_statistics();
 
   // create copy of this as this should not be adapted for current join
   auto join_table_stats = std::make_shared<TableStatistics>(*this);
 
-  // make space in output for column statistics of right right table and copy them to output
-  join_table_stats->_column_statistics.resize(_column_statistics.size() + right_table_stats->_column_statistics.size());
-  auto col_stats_right_begin = join_table_stats->_column_statistics.begin() + _column_statistics.size();
-  std::copy(right_table_stats->_column_statistics.begin(), right_table_stats->_column_statistics.end(),
-            col_stats_right_begin);
+  // copy the column statistics of both tables to the output
+  join_table_stats->_column_statistics = left_column_statistics;
+  join_table_stats->_column_statistics.insert(join_table_stats->_column_statistics.end(),
+                                              right_column_statistics.cbegin(), right_column_statistics.cend());
 
   // all columns are added, table pointer is deleted for output statistics
   join_table_stats->_reset_table_ptr();
 
   // calculate output size for cross joins
-  join_table_stats->_row_count *= right_table_stats->_row_count;
+  join_table_stats->_row_count *= right_table_stats->row_count();
   return join_table_stats;
 }
 
@@ -189,8 +210,9 @@ std::shared_ptr<TableStatistics> TableStatistics::generate_predicated_join_stati
   auto join_table_stats = generate_cross_join_statistics(right_table_stats);
 
   // retrieve the two column statistics which are used by the join predicate
-  auto& left_col_stats = _column_statistics[column_ids.first];
-  auto& right_col_stats = right_table_stats->_column_statistics[column_ids.second];
+  const auto left_column_count = _column_statistics.size();
+  const auto left_col_stats = join_table_stats->_column_statistics[column_ids.first];
+  const auto right_col_stats = join_table_stats->_column_statistics[left_column_count + column_ids.second];
 
   auto stats_container =
       left_col_stats->estimate_selectivity_for_two_column_predicate(predicate_condition, right_col_stats);
@@ -198,7 +220,7 @@ std::shared_ptr<TableStatistics> TableStatistics::generate_predicated_join_stati
   // apply predicate selectivity to cross join
   join_table_stats->_row_count *= stats_container.selectivity;
 
-  ColumnID new_right_column_id{static_cast<ColumnID::base_type>(_column_statistics.size() + column_ids.second)};
+  ColumnID new_right_column_id{static_cast<ColumnID::base_type>(left_column_count + column_ids.second)};
 
   // calculate how many null values need to be added to columns from the left table for right/outer joins
   auto left_null_value_no = _calculate_added_null_values_for_outer_join(
@@ -211,14 +233,14 @@ std::shared_ptr<TableStatistics> TableStatistics::generate_predicated_join_stati
 
   // a) add null values to columns from the right table for left outer join
   auto apply_left_outer_join = [&]() {
-    _adjust_null_value_ratio_for_outer_join(join_table_stats->_column_statistics.begin() + _column_statistics.size(),
+    _adjust_null_value_ratio_for_outer_join(join_table_stats->_column_statistics.begin() + left_column_count,
                                             join_table_stats->_column_statistics.end(), right_table_stats->row_count(),
                                             right_null_value_no, join_table_stats->row_count());
   };
   // b) add null values to columns from the left table for right outer
   auto apply_right_outer_join = [&]() {
     _adjust_null_value_ratio_for_outer_join(join_table_stats->_column_statistics.begin(),
-                                            join_table_stats->_column_statistics.begin() + _column_statistics.size(),
+                                            join_table_stats->_column_statistics.begin() + left_column_count,
                                             row_count(), left_null_value_no, join_table_stats->row_count());
   };
 
@@ -258,25 +280,71 @@ void TableStatistics::increment_invalid_row_count(uint64_t count) { _approx_inva
 
 std::shared_ptr<BaseColumnStatistics> TableStatistics::_get_or_generate_column_statistics(
     const ColumnID column_id) const {
+  std::lock_guard<std::mutex> lock(_column_statistics_mutex);
+  _refresh_column_statistics();
+
   if (_column_statistics[column_id]) {
     return _column_statistics[column_id];
   }
 
   auto table = _table.lock();
   DebugAssert(table != nullptr, "Corresponding table of table statistics is deleted.");
-  auto column_type = table->column_type(column_id);
-  auto column_statistics =
-      make_shared_by_data_type<BaseColumnStatistics, ColumnStatistics>(column_type, column_id, _table);
-  _column_statistics[column_id] = column_statistics;
+
+  const auto stored_table_statistics = table->table_statistics();
+  if (stored_table_statistics.get() == this) {
+    _column_statistics[column_id] = _merge_column_statistics(*table, column_id);
+  } else if (stored_table_statistics) {
+    // Derived statistics share the column statistics of the stored table
+    _column_statistics[column_id] = stored_table_statistics->_get_or_generate_column_statistics(column_id);
+  } else {
+    auto column_type = table->column_type(column_id);
+    _column_statistics[column_id] =
+        make_shared_by_data_type<BaseColumnStatistics, ColumnStatistics>(column_type, column_id, _table);
+  }
   return _column_statistics[column_id];
 }
 
+std::shared_ptr<BaseColumnStatistics> TableStatistics::_merge_column_statistics(Table& table,
+                                                                               const ColumnID column_id) const {
+  auto column_statistics = std::shared_ptr<BaseColumnStatistics>{};
+
+  resolve_data_type(table.column_type(column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    auto& merged_statistics = _merged_chunk_statistics[column_id];
+    if (!merged_statistics) merged_statistics = std::make_shared<MergedChunkColumnStatistics<ColumnDataType>>();
+    auto& typed_merged_statistics = static_cast<MergedChunkColumnStatistics<ColumnDataType>&>(*merged_statistics);
+
+    // Only the last chunk can still grow, so it is merged into a copy of the merged statistics of the other chunks
+    const auto tail_chunk_id = table.tail_chunk_id();
+    typed_merged_statistics.merge_chunks(table, column_id, tail_chunk_id);
+
+    auto current_statistics = typed_merged_statistics;
+    current_statistics.merge_chunks(table, column_id, ChunkID{tail_chunk_id + 1u});
+    column_statistics = std::make_shared<ColumnStatistics<ColumnDataType>>(column_id, current_statistics);
+  });
+
+  return column_statistics;
+}
+
 void TableStatistics::_create_all_column_statistics() const {
   for (ColumnID column_id{0}; column_id < _column_statistics.size(); ++column_id) {
     _get_or_generate_column_statistics(column_id);
   }
 }
 
+void TableStatistics::_refresh_column_statistics() const {
+  const auto table = _table.lock();
+  if (!table || table->table_statistics().get() != this) return;
+
+  const auto row_count = table->row_count();
+  if (row_count == _column_statistics_row_count) return;
+
+  std::fill(_column_statistics.begin(), _column_statistics.end(), nullptr);
+  _column_statistics_row_count = row_count;
+  _row_count = static_cast<float>(row_count);
+}
+
 void TableStatistics::_reset_table_ptr() {
   for (ColumnID column_id{0}; column_id < _column_statistics.size(); ++column_id) {
     DebugAssert(_column_statistics[column_id], "All column statistics of table statistics have to exist.");
@@ -314,6 +382,7 @@ void TableStatistics::_adjust_null_value_ratio_for_outer_join(
 std::ostream& operator<<(std::ostream& os, TableStatistics& obj) {
   os << "Table Stats " << std::endl;
   os << " row count: " << obj._row_count;
+  std::lock_guard<std::mutex> lock(obj._column_statistics_mutex);
   for (const auto& statistics : obj._column_statistics) {
     if (statistics) os << std::endl << " " << *statistics;
   }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <ostream>
 #include <string>
@@ -13,6 +14,7 @@
 namespace opossum {
 
 class Table;
+struct BaseMergedChunkColumnStatistics;
 
 /**
  * TableStatistics is the interface to the statistics component.
@@ -31,8 +33,7 @@ class Table;
  * (e.g. placeholders in prepared statements), default selectivity values from below are used.
  * The null value support within the statistics component is currently limited. Null value information is stored for
  * every column. This information is used wherever needed (e.g. in predicates) and also updated (e.g. in outer joins).
- * However, this component cannot compute the null value numbers of a column of the corresponding tables. So currently,
- * the statistics component only knows of null values which were introduced through outer joins.
+ * For tables in the StorageManager, it is taken from the chunk statistics (see below).
  * The statistics component assumes NULL != NULL semantics.
  *
  * TableStatistics store column statistics as BaseColumnStatistics, which are instances of
@@ -40,6 +41,17 @@ class Table;
  * Public TableStatistics functions pass on the parameters to the corresponding column statistics functions.
  * These compute a new ColumnStatistics<> and the predicted selectivity of an operator.
  *
+ * The column statistics of a table in the StorageManager are merged from the statistics of its chunks (see
+ * chunk_statistics.hpp). Thus, no table scan is needed. The merged statistics of all chunks but the last one, which is
+ * the only one that can still grow, are kept. When rows are added to the table, only the chunks added since and the
+ * last chunk are merged into them. The row count follows the table as well: it is updated together with the column
+ * statistics whenever rows or chunks were added to the table. Statistics derived from those of a stored table (e.g.,
+ * by predicate_statistics()) copy the row count and take the column statistics they have not replaced from the stored
+ * table's statistics.
+ *
+ * Column statistics and the row count of a stored table are updated lazily by const methods, so they are guarded by a
+ * mutex.
+ *
  * Find more information about table statistics in our wiki:
  * https://github.com/hyrise/hyrise/wiki/potential_statistics
  */
@@ -55,7 +67,7 @@ class TableStatistics : public std::enable_shared_from_this<TableStatistics> {
    * Table statistics should not be copied by other actors.
    * Copy constructor not private as copy is used by make_shared.
    */
-  TableStatistics(const TableStatistics& table_statistics) = default;
+  TableStatistics(const TableStatistics& table_statistics);
 
   /**
    * Create the TableStatistics by explicitly specifying its underlying data. Intended for statistics tests or to
@@ -72,7 +84,8 @@ class TableStatistics : public std::enable_shared_from_this<TableStatistics> {
   // Returns the number of valid rows (using approximate count of deleted rows)
   uint64_t approx_valid_row_count() const;
 
-  const std::vector<std::shared_ptr<BaseColumnStatistics>>& column_statistics() const;
+  // Returns a copy, as the column statistics of a stored table are replaced when rows are added to it
+  std::vector<std::shared_ptr<BaseColumnStatistics>> column_statistics() const;
 
   /**
    * Generate table statistics for the operator table scan table scan.
@@ -102,6 +115,17 @@ class TableStatistics : public std::enable_shared_from_this<TableStatistics> {
 
   void _create_all_column_statistics() const;
 
+  /**
+   * Drops the column statistics of a table in the StorageManager and updates the row count if rows were added to the
+   * table since they were created, so that they get merged again from the chunk statistics. Derived statistics are not
+   * refreshed.
+   * Requires _column_statistics_mutex to be locked.
+   */
+  void _refresh_column_statistics() const;
+
+  // Creates the column statistics of a table in the StorageManager, see _merged_chunk_statistics
+  std::shared_ptr<BaseColumnStatistics> _merge_column_statistics(Table& table, const ColumnID column_id) const;
+
   /**
    * Resets the pointer variable _table after checking that the table is no longer needed. If the pointer is null, all
    * column statistics have been created. This check is useful during generation of join statistics as then all column
@@ -144,7 +168,8 @@ class TableStatistics : public std::enable_shared_from_this<TableStatistics> {
   // row count is not an integer as it is a predicted value
   // it is multiplied with selectivity factor of a corresponding operator to predict the operator's output
   // precision is lost, if row count is rounded
-  float _row_count = 0.0f;
+  // For a table in the StorageManager, it is updated in _refresh_column_statistics()
+  mutable float _row_count = 0.0f;
 
   // Stores the number of invalid (deleted) rows.
   // This is currently not an atomic due to performance considerations.
@@ -153,6 +178,16 @@ class TableStatistics : public std::enable_shared_from_this<TableStatistics> {
 
   mutable std::vector<std::shared_ptr<BaseColumnStatistics>> _column_statistics;
 
+  // Row count of the table when _column_statistics were created, see _refresh_column_statistics()
+  mutable uint64_t _column_statistics_row_count{0};
+
+  // Per column, the merged statistics of the table's chunks that can no longer grow. Only used by the statistics of a
+  // table in the StorageManager and not copied.
+  mutable std::vector<std::shared_ptr<BaseMergedChunkColumnStatistics>> _merged_chunk_statistics;
+
+  // Guards _row_count, _column_statistics, _column_statistics_row_count, and _merged_chunk_statistics
+  mutable std::mutex _column_statistics_mutex;
+
   friend std::ostream& operator<<(std::ostream& os, TableStatistics& obj);
 };
 
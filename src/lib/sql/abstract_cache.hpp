@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include <utility>
 
 namespace opossum {
@@ -24,6 +25,12 @@ class AbstractCache {
   // Causes undefined behavior if the item is not in the cache.
   virtual Value& get(const Key& key) = 0;
 
+  // Returns a copy of the value cached at the given key, or nullopt if the cache does not hold an item at the key.
+  virtual std::optional<Value> try_get(const Key& key) {
+    if (!has(key)) return std::nullopt;
+    return get(key);
+  }
+
   // Returns true if the cache holds an item at the given key.
   virtual bool has(const Key& key) const = 0;
 
@@ -39,6 +46,9 @@ class AbstractCache {
   // Return the capacity of the cache.
   size_t capacity() const { return _capacity; }
 
+  // Returns true if the cache synchronizes concurrent accesses itself.
+  virtual bool is_thread_safe() const { return false; }
+
  protected:
   // Remove an element from the cache according to the cache algorithm's strategy
   virtual void _evict() = 0;
@@ -0,0 +1,61 @@
+#include "cached_query_result.hpp"
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "operators/abstract_read_write_operator.hpp"
+#include "operators/get_table.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+namespace {
+
+bool collect_table_versions(const std::shared_ptr<const AbstractOperator>& op,
+                            std::vector<CachedQueryResult::TableVersion>& table_versions) {
+  if (std::dynamic_pointer_cast<const AbstractReadWriteOperator>(op)) return false;
+
+  if (!op->input_left()) {
+    // Leaves other than GetTable (e.g., TableWrapper or ShowTables) read data that is not versioned
+    const auto get_table = std::dynamic_pointer_cast<const GetTable>(op);
+    if (!get_table || !StorageManager::get().has_table(get_table->table_name())) return false;
+
+    const auto table = StorageManager::get().get_table(get_table->table_name());
+    table_versions.emplace_back(CachedQueryResult::TableVersion{get_table->table_name(), table,
+                                                                table->last_modified_commit_id(), table->row_count()});
+    return true;
+  }
+
+  if (!collect_table_versions(op->input_left(), table_versions)) return false;
+  return !op->input_right() || collect_table_versions(op->input_right(), table_versions);
+}
+
+}  // namespace
+
+std::optional<std::vector<CachedQueryResult::TableVersion>> CachedQueryResult::get_table_versions(
+    const std::shared_ptr<const AbstractOperator>& root) {
+  auto table_versions = std::vector<TableVersion>{};
+  if (!collect_table_versions(root, table_versions)) return std::nullopt;
+  return table_versions;
+}
+
+bool CachedQueryResult::is_valid_for(const CommitID snapshot_commit_id) const {
+  for (const auto& table_version : table_versions) {
+    if (table_version.last_modified_commit_id > snapshot_commit_id) return false;
+
+    const auto table = table_version.table.lock();
+    if (!table || !StorageManager::get().has_table(table_version.table_name) ||
+        StorageManager::get().get_table(table_version.table_name) != table) {
+      return false;
+    }
+
+    if (table->last_modified_commit_id() != table_version.last_modified_commit_id) return false;
+    if (table->row_count() != table_version.row_count) return false;
+  }
+
+  return true;
+}
+
+}  // namespace opossum
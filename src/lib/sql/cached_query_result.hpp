@@ -0,0 +1,47 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractOperator;
+class Table;
+
+/**
+ * Result of a read-only query in the result cache of SQLPipelineStatement, together with the versions of the tables
+ * it was computed from.
+ *
+ * A result may be served to a transaction as long as none of the tables was modified since the result was computed
+ * and the transaction sees all modifications that the result includes. As Insert and Delete raise the last modified
+ * commit id of their table before their commit becomes visible, this is the case if, for every table, the id is
+ * unchanged and not larger than the transaction's snapshot commit id. The tables' row counts are compared as well,
+ * so that rows appended outside of transactions (e.g., by Table::append) also invalidate the result.
+ */
+struct CachedQueryResult {
+  struct TableVersion {
+    std::string table_name;
+    std::weak_ptr<const Table> table;
+    CommitID last_modified_commit_id;
+    uint64_t row_count;
+  };
+
+  /**
+   * Captures the current versions of all tables that are read by the operator tree. This has to be done before the
+   * operators are executed. Returns nullopt if the operators do not only read stored tables.
+   */
+  static std::optional<std::vector<TableVersion>> get_table_versions(
+      const std::shared_ptr<const AbstractOperator>& root);
+
+  // Whether the result can be served to a transaction with the given snapshot commit id
+  bool is_valid_for(const CommitID snapshot_commit_id) const;
+
+  std::shared_ptr<const Table> result_table;
+  std::vector<TableVersion> table_versions;
+};
+
+}  // namespace opossum
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <atomic>
+#include <deque>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+#include "abstract_cache.hpp"
+
+namespace opossum {
+
+// Generic cache implementation using the CLOCK policy, an approximation of LRU.
+// Reading an entry only sets its reference bit. Thus, concurrent calls to try_get are safe as long as no other
+// method is called at the same time, which ShardedCache uses to serve hits under a shared lock.
+// Note: This implementation is not thread-safe otherwise.
+template <typename Key, typename Value>
+class ClockCache : public AbstractCache<Key, Value> {
+ public:
+  // Entries within the CLOCK cache.
+  struct ClockCacheEntry {
+    ClockCacheEntry(const Key& key, const Value& value) : key(key), value(value), referenced(false) {}
+
+    Key key;
+    Value value;
+
+    // Set whenever the entry is accessed and cleared when the clock hand passes it.
+    std::atomic<bool> referenced;
+  };
+
+  explicit ClockCache(size_t capacity) : AbstractCache<Key, Value>(capacity), _hand(0) {}
+
+  void set(const Key& key, const Value& value, double cost = 1.0, double size = 1.0) {
+    auto it = _map.find(key);
+    if (it != _map.end()) {
+      auto& entry = _entries[it->second];
+      entry.value = value;
+      entry.referenced.store(true, std::memory_order_relaxed);
+      return;
+    }
+
+    if (this->_capacity == 0) return;
+
+    // If the cache is full, evict the first entry the clock hand finds without its reference bit set.
+    if (_entries.size() >= this->_capacity) {
+      _evict();
+    }
+
+    _map[key] = _entries.size();
+    _entries.emplace_back(key, value);
+  }
+
+  Value& get(const Key& key) {
+    auto& entry = _entries[_map.find(key)->second];
+    entry.referenced.store(true, std::memory_order_relaxed);
+    return entry.value;
+  }
+
+  std::optional<Value> try_get(const Key& key) {
+    auto it = _map.find(key);
+    if (it == _map.end()) return std::nullopt;
+
+    auto& entry = _entries[it->second];
+    entry.referenced.store(true, std::memory_order_relaxed);
+    return entry.value;
+  }
+
+  bool has(const Key& key) const { return _map.find(key) != _map.end(); }
+
+  size_t size() const { return _map.size(); }
+
+  void clear() {
+    _entries.clear();
+    _map.clear();
+    _hand = 0;
+  }
+
+  void resize(size_t capacity) {
+    while (_entries.size() > capacity) {
+      _evict();
+    }
+    this->_capacity = capacity;
+  }
+
+ protected:
+  // A deque, as its elements (which contain an atomic) never have to be moved when appending.
+  std::deque<ClockCacheEntry> _entries;
+
+  // Map to point towards the entry's position in _entries.
+  std::unordered_map<Key, size_t> _map;
+
+  // Position of the clock hand in _entries.
+  size_t _hand;
+
+  void _evict() {
+    // Entries that were accessed since the clock hand passed them the last time get a second chance.
+    while (_entries[_hand].referenced.exchange(false, std::memory_order_relaxed)) {
+      _hand = (_hand + 1) % _entries.size();
+    }
+
+    // The last entry, which was inserted most recently, is moved into the evicted entry's position, so that _entries
+    // stays dense. The clock hand moves on, so that the moved entry is not the next one to be evicted.
+    _map.erase(_entries[_hand].key);
+    if (_hand != _entries.size() - 1) {
+      auto& last_entry = _entries.back();
+      auto& evicted_entry = _entries[_hand];
+      evicted_entry.key = std::move(last_entry.key);
+      evicted_entry.value = std::move(last_entry.value);
+      evicted_entry.referenced.store(last_entry.referenced.load(std::memory_order_relaxed), std::memory_order_relaxed);
+      _map[evicted_entry.key] = _hand;
+    }
+    _entries.pop_back();
+
+    ++_hand;
+    if (_hand >= _entries.size()) _hand = 0;
+  }
+};
+
+}  // namespace opossum
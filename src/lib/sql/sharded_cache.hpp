@@ -0,0 +1,97 @@
+#pragma once
+
+#include <array>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+
+#include "abstract_cache.hpp"
+#include "clock_cache.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+// Thread-safe cache that distributes its keys over independently locked shards, each of which is a ClockCache.
+// Lookups (has and try_get) only take a shared lock on their shard, so that concurrent cache hits do not block each
+// other. Inserting into a shard takes an exclusive lock on that shard only.
+// Every shard holds up to capacity / shard_count (rounded up) entries, eviction happens per shard.
+template <typename Key, typename Value>
+class ShardedCache : public AbstractCache<Key, Value> {
+ public:
+  static constexpr size_t shard_count = 16;
+
+  explicit ShardedCache(size_t capacity) : AbstractCache<Key, Value>(capacity) {
+    for (auto& shard : _shards) {
+      shard.cache.resize(_shard_capacity(capacity));
+    }
+  }
+
+  void set(const Key& key, const Value& value, double cost = 1.0, double size = 1.0) {
+    auto& shard = _get_shard(key);
+    std::unique_lock<std::shared_mutex> lock(shard.mutex);
+    shard.cache.set(key, value, cost, size);
+  }
+
+  // The returned reference might be invalidated by a concurrent set. Use try_get to get a copy of the value instead.
+  Value& get(const Key& key) {
+    auto& shard = _get_shard(key);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.cache.get(key);
+  }
+
+  std::optional<Value> try_get(const Key& key) {
+    auto& shard = _get_shard(key);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.cache.try_get(key);
+  }
+
+  bool has(const Key& key) const {
+    const auto& shard = _get_shard(key);
+    std::shared_lock<std::shared_mutex> lock(shard.mutex);
+    return shard.cache.has(key);
+  }
+
+  size_t size() const {
+    auto size = size_t{0};
+    for (const auto& shard : _shards) {
+      std::shared_lock<std::shared_mutex> lock(shard.mutex);
+      size += shard.cache.size();
+    }
+    return size;
+  }
+
+  void clear() {
+    for (auto& shard : _shards) {
+      std::unique_lock<std::shared_mutex> lock(shard.mutex);
+      shard.cache.clear();
+    }
+  }
+
+  void resize(size_t capacity) {
+    for (auto& shard : _shards) {
+      std::unique_lock<std::shared_mutex> lock(shard.mutex);
+      shard.cache.resize(_shard_capacity(capacity));
+    }
+    this->_capacity = capacity;
+  }
+
+  bool is_thread_safe() const { return true; }
+
+ protected:
+  struct Shard {
+    ClockCache<Key, Value> cache{0};
+    mutable std::shared_mutex mutex;
+  };
+
+  std::array<Shard, shard_count> _shards;
+
+  static size_t _shard_capacity(size_t capacity) { return (capacity + shard_count - 1) / shard_count; }
+
+  Shard& _get_shard(const Key& key) { return _shards[std::hash<Key>{}(key) % shard_count]; }
+  const Shard& _get_shard(const Key& key) const { return _shards[std::hash<Key>{}(key) % shard_count]; }
+
+  void _evict() { Fail("ShardedCache evicts entries within its shards."); }
+};
+
+}  // namespace opossum
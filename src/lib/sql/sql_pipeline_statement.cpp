@@ -2,20 +2,40 @@
 
 #include <boost/algorithm/string.hpp>
 
+#include <algorithm>
+#include <functional>
 #include <iomanip>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "SQLParser.h"
 #include "concurrency/transaction_manager.hpp"
 #include "logical_query_plan/lqp_translator.hpp"
+#include "operators/table_scan.hpp"
 #include "optimizer/optimizer.hpp"
 #include "scheduler/current_scheduler.hpp"
+#include "sql/sql_query_normalizer.hpp"
 #include "sql/sql_query_plan.hpp"
 #include "sql/sql_translator.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
+namespace {
+
+void visit_table_scans(const std::shared_ptr<const AbstractOperator>& op,
+                       const std::function<void(const TableScan&)>& visitor) {
+  if (!op) return;
+  if (const auto table_scan = std::dynamic_pointer_cast<const TableScan>(op)) visitor(*table_scan);
+  visit_table_scans(op->input_left(), visitor);
+  visit_table_scans(op->input_right(), visitor);
+}
+
+}  // namespace
+
+SQLQueryCache<std::shared_ptr<const CachedQueryResult>> SQLPipelineStatement::_result_cache(0);
+
 SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, const UseMvcc use_mvcc,
                                            const std::shared_ptr<Optimizer>& optimizer)
     : _sql_string(sql), _use_mvcc(use_mvcc), _auto_commit(_use_mvcc == UseMvcc::Yes), _optimizer(optimizer) {}
@@ -126,8 +146,36 @@ const std::shared_ptr<SQLQueryPlan>& SQLPipelineStatement::get_query_plan() {
 
   const auto started = std::chrono::high_resolution_clock::now();
 
+  // Queries that only differ in their literals share a plan, which is cached for the normalized SQL string and
+  // instantiated with the literals of this query
+  const auto normalized_query = SQLQueryNormalizer::normalize(_sql_string);
+  auto arguments = normalized_query.arguments;
+
+  auto& cache = SQLQueryCache<SQLQueryPlan>::get();
+  auto cached_plan = std::optional<SQLQueryPlan>{};
+  if (arguments.empty()) {
+    cached_plan = cache.try_get(_sql_string);
+  } else {
+    // If the literals cannot be replaced in the plan, an empty plan is cached for the normalized SQL string, so that
+    // this is only found out once. The plan is then cached for the original SQL string. Either way, the query is
+    // counted as a single hit or miss of the cache.
+    cached_plan = cache.try_get_uncounted(normalized_query.sql);
+    auto is_cache_hit = static_cast<bool>(cached_plan);
+    if (!cached_plan) {
+      cached_plan = _create_parameterized_query_plan(normalized_query.sql).value_or(SQLQueryPlan{});
+      cache.set(normalized_query.sql, *cached_plan);
+    }
+
+    if (cached_plan->tree_roots().empty()) {
+      arguments.clear();
+      cached_plan = cache.try_get_uncounted(_sql_string);
+      is_cache_hit = static_cast<bool>(cached_plan);
+    }
+    cache.count_lookup(is_cache_hit);
+  }
+
   // Handle query plan if statement has been cached
-  if (const auto cached_plan = SQLQueryCache<SQLQueryPlan>::get().try_get(_sql_string)) {
+  if (cached_plan) {
     auto& plan = *cached_plan;
 
     DebugAssert(!plan.tree_roots().empty(), "QueryPlan retrieved from cache is empty.");
@@ -137,7 +185,7 @@ const std::shared_ptr<SQLQueryPlan>& SQLPipelineStatement::get_query_plan() {
       Assert(_use_mvcc == UseMvcc::No, "Trying to use non-MVCC cached query with a transaction context.");
     }
 
-    _query_plan->append_plan(plan.recreate());
+    _query_plan->append_plan(plan.recreate(arguments));
     if (_use_mvcc == UseMvcc::Yes) _query_plan->set_transaction_context(_transaction_context);
 
     const auto done = std::chrono::high_resolution_clock::now();
@@ -164,6 +212,39 @@ const std::shared_ptr<SQLQueryPlan>& SQLPipelineStatement::get_query_plan() {
   return _query_plan;
 }
 
+std::optional<SQLQueryPlan> SQLPipelineStatement::_create_parameterized_query_plan(const std::string& normalized_sql) {
+  auto parse_result = hsql::SQLParserResult{};
+  auto plan = SQLQueryPlan{};
+  try {
+    hsql::SQLParser::parse(normalized_sql, &parse_result);
+    if (!parse_result.isValid() || !SQLQueryNormalizer::is_parameterizable(parse_result)) return std::nullopt;
+
+    const auto lqp_roots = SQLTranslator{_use_mvcc == UseMvcc::Yes}.translate_parse_result(parse_result);
+    DebugAssert(lqp_roots.size() == 1, "LQP translation returned no or more than one LQP root for a single statement.");
+    plan.add_tree_by_root(LQPTranslator{}.translate_node(_optimizer->optimize(lqp_roots.front())));
+  } catch (const std::exception&) {
+    // E.g., the optimizer chose an IndexScan, which needs the actual values. The query is planned without parameters.
+    return std::nullopt;
+  }
+
+  // Make sure that SQLQueryPlan::recreate replaces every placeholder
+  const auto parameter_count = parse_result.parameters().size();
+  auto replaced_parameters = std::vector<bool>(parameter_count, false);
+  visit_table_scans(plan.tree_roots().front(), [&](const TableScan& table_scan) {
+    if (!is_placeholder(table_scan.right_parameter())) return;
+    const auto index = boost::get<ValuePlaceholder>(table_scan.right_parameter()).index();
+    if (index < parameter_count) replaced_parameters[index] = true;
+  });
+  if (std::find(replaced_parameters.cbegin(), replaced_parameters.cend(), false) != replaced_parameters.cend()) {
+    return std::nullopt;
+  }
+
+  plan.set_num_parameters(parameter_count);
+  if (_use_mvcc == UseMvcc::Yes) plan.set_transaction_context(_transaction_context);
+
+  return plan;
+}
+
 const std::vector<std::shared_ptr<OperatorTask>>& SQLPipelineStatement::get_tasks() {
   if (!_tasks.empty()) {
     return _tasks;
@@ -188,8 +269,32 @@ const std::shared_ptr<const Table>& SQLPipelineStatement::get_result_table() {
     return _result_table;
   }
 
+  if (_uses_result_cache()) {
+    const auto started = std::chrono::high_resolution_clock::now();
+
+    if (!_transaction_context) _transaction_context = TransactionManager::get().new_transaction_context();
+
+    const auto cached_result = _result_cache.try_get(_sql_string);
+    if (cached_result && (*cached_result)->is_valid_for(_transaction_context->snapshot_commit_id())) {
+      _transaction_context->commit();
+
+      _result_table = (*cached_result)->result_table;
+
+      const auto done = std::chrono::high_resolution_clock::now();
+      _compile_time_micros = std::chrono::microseconds{0};
+      _execution_time_micros = std::chrono::duration_cast<std::chrono::microseconds>(done - started);
+
+      return _result_table;
+    }
+  }
+
   const auto& tasks = get_tasks();
 
+  // The versions of the tables a query reads have to be captured before it is executed, so that modifications that
+  // are committed while it runs invalidate its result
+  auto table_versions = std::optional<std::vector<CachedQueryResult::TableVersion>>{};
+  if (_uses_result_cache()) table_versions = CachedQueryResult::get_table_versions(tasks.back()->get_operator());
+
   const auto started = std::chrono::high_resolution_clock::now();
 
   try {
@@ -210,6 +315,13 @@ const std::shared_ptr<const Table>& SQLPipelineStatement::get_result_table() {
   _result_table = tasks.back()->get_operator()->get_output();
   if (_result_table == nullptr) _query_has_output = false;
 
+  if (_result_table && table_versions) {
+    const auto cached_result = std::make_shared<CachedQueryResult>(CachedQueryResult{_result_table, *table_versions});
+    if (cached_result->is_valid_for(_transaction_context->snapshot_commit_id())) {
+      _result_cache.set(_sql_string, cached_result);
+    }
+  }
+
   return _result_table;
 }
 
@@ -218,7 +330,9 @@ const std::shared_ptr<TransactionContext>& SQLPipelineStatement::transaction_con
 }
 
 std::chrono::microseconds SQLPipelineStatement::compile_time_microseconds() const {
-  Assert(_query_plan != nullptr, "Cannot return compile duration without having created the query plan.");
+  // No query plan is created if the result was taken from the result cache
+  Assert(_query_plan != nullptr || _result_table != nullptr,
+         "Cannot return compile duration without having created the query plan.");
   return _compile_time_micros;
 }
 
@@ -227,6 +341,15 @@ std::chrono::microseconds SQLPipelineStatement::execution_time_microseconds() co
   return _execution_time_micros;
 }
 
+SQLQueryCache<std::shared_ptr<const CachedQueryResult>>& SQLPipelineStatement::get_result_cache() {
+  return _result_cache;
+}
+
+bool SQLPipelineStatement::_uses_result_cache() const {
+  // Statements in a shared transaction might read their transaction's own, uncommitted modifications
+  return _use_mvcc == UseMvcc::Yes && _auto_commit && _result_cache.cache().capacity() > 0;
+}
+
 std::string SQLPipelineStatement::create_parse_error_message(const std::string& sql,
                                                              const hsql::SQLParserResult& result) {
   std::stringstream error_msg;
@@ -1,11 +1,13 @@
 #pragma once
 
+#include <optional>
 #include <string>
 
 #include "SQLParserResult.h"
 #include "concurrency/transaction_context.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "optimizer/optimizer.hpp"
+#include "sql/cached_query_result.hpp"
 #include "sql/sql_query_cache.hpp"
 #include "sql/sql_query_plan.hpp"
 #include "storage/table.hpp"
@@ -53,7 +55,8 @@ class SQLPipelineStatement : public Noncopyable {
   // Returns all optimized LQP roots.
   const std::shared_ptr<AbstractLQPNode>& get_optimized_logical_plan();
 
-  // For now, this always uses the optimized LQP.
+  // For now, this always uses the optimized LQP. Plans are cached for the SQL string with its literals replaced by
+  // placeholders (see SQLQueryNormalizer), so that queries that only differ in their literals share a plan.
   const std::shared_ptr<SQLQueryPlan>& get_query_plan();
 
   // Returns all task sets that need to be executed for this query.
@@ -72,7 +75,19 @@ class SQLPipelineStatement : public Noncopyable {
   // Helper function to create a pretty print error message after an invalid SQL parse
   static std::string create_parse_error_message(const std::string& sql, const hsql::SQLParserResult& result);
 
+  // Cache for the results of read-only queries, keyed by their SQL string (see CachedQueryResult). It is only used by
+  // statements that run in their own transaction with MVCC. It is disabled by default, resize it to enable it.
+  static SQLQueryCache<std::shared_ptr<const CachedQueryResult>>& get_result_cache();
+
  private:
+  // Plans the normalized query with placeholders for its literals. Returns nullopt if the placeholders could not be
+  // replaced by SQLQueryPlan::recreate.
+  std::optional<SQLQueryPlan> _create_parameterized_query_plan(const std::string& normalized_sql);
+
+  bool _uses_result_cache() const;
+
+  static SQLQueryCache<std::shared_ptr<const CachedQueryResult>> _result_cache;
+
   const std::string _sql_string;
   const UseMvcc _use_mvcc;
 
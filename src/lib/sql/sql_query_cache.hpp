@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -7,7 +8,7 @@
 #include <utility>
 #include <vector>
 
-#include "gdfs_cache.hpp"
+#include "sharded_cache.hpp"
 
 #include "SQLParserResult.h"
 
@@ -16,12 +17,14 @@ namespace opossum {
 inline constexpr size_t DefaultCacheCapacity = 1024;
 
 // Cache that stores instances of SQLParserResult.
-// Per-default, uses the GDFS cache as underlying storage.
+// Per-default, uses the ShardedCache as underlying storage, which synchronizes accesses itself, so that cache hits of
+// concurrent queries do not serialize on a single lock. Other cache implementations (e.g., GDFSCache) are guarded by a
+// mutex.
 template <typename Value, typename Key = std::string>
 class SQLQueryCache {
  public:
   explicit SQLQueryCache(size_t capacity = DefaultCacheCapacity)
-      : _cache(std::move(std::make_unique<GDFSCache<Key, Value>>(capacity))) {}
+      : _cache(std::move(std::make_unique<ShardedCache<Key, Value>>(capacity))) {}
 
   virtual ~SQLQueryCache() {}
 
@@ -34,20 +37,41 @@ class SQLQueryCache {
   void set(const Key& query, const Value& value) {
     if (_cache->capacity() == 0) return;
 
+    if (_cache->is_thread_safe()) {
+      _cache->set(query, value);
+      return;
+    }
+
     std::lock_guard<std::mutex> lock(_mutex);
     _cache->set(query, value);
   }
 
   // Tries to fetch the cache entry for the query into the result object.
   // Returns true if the entry was found, false otherwise.
+  // Every call is counted as either a hit or a miss.
   std::optional<Value> try_get(const Key& query) {
+    auto value = try_get_uncounted(query);
+    count_lookup(static_cast<bool>(value));
+    return value;
+  }
+
+  // Like try_get, but the lookup is not counted. Used if several entries are looked up for a single query, which is
+  // then counted once with count_lookup().
+  std::optional<Value> try_get_uncounted(const Key& query) {
     if (_cache->capacity() == 0) return {};
 
+    if (_cache->is_thread_safe()) return _cache->try_get(query);
+
     std::lock_guard<std::mutex> lock(_mutex);
-    if (!_cache->has(query)) {
-      return {};
+    return _cache->try_get(query);
+  }
+
+  void count_lookup(const bool hit) {
+    if (hit) {
+      ++_hits;
+    } else {
+      ++_misses;
     }
-    return _cache->get(query);
   }
 
   // Checks whether an entry for the query exists.
@@ -56,17 +80,27 @@ class SQLQueryCache {
   // Returns and refreshes the cache entry for the given query.
   // Causes undefined behavior if the query is not in the cache.
   Value get(const Key& query) {
+    if (_cache->is_thread_safe()) return *_cache->try_get(query);
+
     std::lock_guard<std::mutex> lock(_mutex);
     return _cache->get(query);
   }
 
-  // Purges all entries from the cache.
-  void clear() { _cache->clear(); }
+  // Purges all entries from the cache and resets the hit and miss counters.
+  void clear() {
+    _cache->clear();
+    _hits = 0;
+    _misses = 0;
+  }
 
   void resize(size_t capacity) { _cache->resize(capacity); }
 
   size_t size() const { return _cache->size(); }
 
+  // Number of lookups with try_get that found or did not find an entry.
+  size_t hits() const { return _hits; }
+  size_t misses() const { return _misses; }
+
   // Returns a reference to the underlying cache.
   AbstractCache<Key, Value>& cache() { return *_cache; }
 
@@ -82,6 +116,9 @@ class SQLQueryCache {
   std::unique_ptr<AbstractCache<Key, Value>> _cache;
 
   std::mutex _mutex;
+
+  std::atomic<size_t> _hits{0};
+  std::atomic<size_t> _misses{0};
 };
 
 }  // namespace opossum
@@ -0,0 +1,141 @@
+#include "sql_query_normalizer.hpp"
+
+#include <boost/algorithm/string.hpp>
+
+#include <cctype>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace opossum {
+
+namespace {
+
+bool is_identifier_character(const char character) {
+  return std::isalnum(static_cast<unsigned char>(character)) || character == '_';
+}
+
+bool is_digit(const char character) { return std::isdigit(static_cast<unsigned char>(character)); }
+
+// Counts the parameters in the WHERE clause that are compared to a column and thus become the value of a TableScan
+size_t count_scan_parameters(const hsql::Expr& expr) {
+  if (!expr.isType(hsql::kExprOperator) || !expr.expr || !expr.expr2) return 0u;
+
+  if (expr.opType == hsql::kOpAnd || expr.opType == hsql::kOpOr) {
+    return count_scan_parameters(*expr.expr) + count_scan_parameters(*expr.expr2);
+  }
+
+  switch (expr.opType) {
+    case hsql::kOpEquals:
+    case hsql::kOpNotEquals:
+    case hsql::kOpLess:
+    case hsql::kOpLessEq:
+    case hsql::kOpGreater:
+    case hsql::kOpGreaterEq:
+    case hsql::kOpLike:
+    case hsql::kOpNotLike:
+      break;
+    default:
+      return 0u;
+  }
+
+  if (expr.expr->isType(hsql::kExprColumnRef) && expr.expr2->isType(hsql::kExprParameter)) return 1u;
+  if (expr.expr->isType(hsql::kExprParameter) && expr.expr2->isType(hsql::kExprColumnRef)) return 1u;
+  return 0u;
+}
+
+}  // namespace
+
+NormalizedSQLQuery SQLQueryNormalizer::normalize(const std::string& sql) {
+  // Literals of other statements end up in operators that cannot replace placeholders (e.g., the values of an INSERT)
+  const auto first_keyword = sql.find_first_not_of(" \t\r\n(");
+  if (first_keyword == std::string::npos ||
+      !boost::algorithm::iequals(sql.substr(first_keyword, std::string{"SELECT"}.size()), "SELECT")) {
+    return {sql, {}};
+  }
+
+  auto normalized_query = NormalizedSQLQuery{};
+  normalized_query.sql.reserve(sql.size());
+
+  auto position = size_t{0u};
+  while (position < sql.size()) {
+    const auto character = sql[position];
+
+    // The parameters of the query would be mixed up with the extracted literals
+    if (character == '?') return {sql, {}};
+
+    if (character == '"' || (character == '-' && position + 1 < sql.size() && sql[position + 1] == '-')) {
+      // Quoted identifiers and comments are copied as they are
+      const auto last = character == '"' ? sql.find('"', position + 1) : sql.find('\n', position);
+      const auto end = last == std::string::npos ? sql.size() : last + 1;
+      normalized_query.sql.append(sql, position, end - position);
+      position = end;
+      continue;
+    }
+
+    if (character == '\'') {
+      const auto end = sql.find('\'', position + 1);
+      if (end == std::string::npos || (end + 1 < sql.size() && sql[end + 1] == '\'')) return {sql, {}};
+
+      normalized_query.arguments.emplace_back(AllTypeVariant{sql.substr(position + 1, end - position - 1)});
+      normalized_query.sql += '?';
+      position = end + 1;
+      continue;
+    }
+
+    const auto starts_number =
+        is_digit(character) &&
+        (position == 0u || (!is_identifier_character(sql[position - 1]) && sql[position - 1] != '.'));
+    if (starts_number) {
+      auto end = position;
+      while (end < sql.size() && is_digit(sql[end])) ++end;
+
+      auto is_float = false;
+      if (end < sql.size() && sql[end] == '.') {
+        is_float = true;
+        ++end;
+        while (end < sql.size() && is_digit(sql[end])) ++end;
+      }
+
+      const auto literal = sql.substr(position, end - position);
+      position = end;
+
+      // Numbers with exponents or followed by identifiers are left to the parser
+      if (end < sql.size() && (is_identifier_character(sql[end]) || sql[end] == '.')) {
+        normalized_query.sql += literal;
+        continue;
+      }
+
+      // The literals have the types the SQL parser gives them, see HSQLExprTranslator::to_all_parameter_variant
+      if (is_float) {
+        normalized_query.arguments.emplace_back(AllTypeVariant{std::stod(literal)});
+      } else {
+        try {
+          normalized_query.arguments.emplace_back(AllTypeVariant{static_cast<int64_t>(std::stoll(literal))});
+        } catch (const std::out_of_range&) {
+          normalized_query.sql += literal;
+          continue;
+        }
+      }
+      normalized_query.sql += '?';
+      continue;
+    }
+
+    normalized_query.sql += character;
+    ++position;
+  }
+
+  return normalized_query;
+}
+
+bool SQLQueryNormalizer::is_parameterizable(const hsql::SQLParserResult& parse_result) {
+  if (parse_result.size() != 1u || parse_result.getStatement(0)->type() != hsql::kStmtSelect) return false;
+
+  const auto& select = static_cast<const hsql::SelectStatement&>(*parse_result.getStatement(0));
+  if (!select.whereClause) return false;
+
+  return count_scan_parameters(*select.whereClause) == parse_result.parameters().size();
+}
+
+}  // namespace opossum
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "SQLParser.h"
+#include "all_parameter_variant.hpp"
+
+namespace opossum {
+
+struct NormalizedSQLQuery {
+  // The SQL string with every extracted literal replaced by a '?'
+  std::string sql;
+
+  // The extracted literals, in the order of their placeholders
+  std::vector<AllParameterVariant> arguments;
+};
+
+/**
+ * Extracts the literals from SQL strings so that queries that only differ in their literals, e.g.,
+ * `SELECT * FROM t WHERE id = 17` and `SELECT * FROM t WHERE id = 18`, share the same normalized SQL string
+ * (`SELECT * FROM t WHERE id = ?`). SQLPipelineStatement uses the normalized string as the key for cached query plans
+ * and instantiates a cached plan with SQLQueryPlan::recreate(arguments).
+ *
+ * The normalization works on the SQL string and not on the parse tree, as the key has to be known before the query
+ * is parsed. Only number and string literals of SELECT statements are extracted. Anything the normalizer does not
+ * understand (e.g., escaped quotes or parameters that are already part of the query) leaves the query unchanged.
+ */
+class SQLQueryNormalizer {
+ public:
+  static NormalizedSQLQuery normalize(const std::string& sql);
+
+  /**
+   * Checks whether a plan translated from the parsed normalized query can be instantiated with SQLQueryPlan::recreate.
+   * This is the case if every parameter is compared to a column in the WHERE clause of a SELECT statement, as these
+   * comparisons become TableScans, which are the only operators that replace ValuePlaceholders.
+   */
+  static bool is_parameterizable(const hsql::SQLParserResult& parse_result);
+};
+
+}  // namespace opossum
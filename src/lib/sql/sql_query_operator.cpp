@@ -184,7 +184,9 @@ void SQLQueryOperator::compile_parse_result(std::shared_ptr<SQLParserResult> res
   }
 }
 
-std::shared_ptr<AbstractOperator> SQLQueryOperator::recreate(const std::vector<AllParameterVariant>& args) const {
+std::shared_ptr<AbstractOperator> SQLQueryOperator::_on_recreate(
+    const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+    const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
   return std::make_shared<SQLQueryOperator>(_query, _schedule_plan, _validate);
 }
 
@@ -34,8 +34,6 @@ class SQLQueryOperator : public AbstractOperator {
 
   const std::string name() const override;
 
-  std::shared_ptr<AbstractOperator> recreate(const std::vector<AllParameterVariant>& args) const override;
-
   const std::shared_ptr<OperatorTask>& get_result_task() const;
 
   bool parse_tree_cache_hit() const;
@@ -53,6 +51,9 @@ class SQLQueryOperator : public AbstractOperator {
   static SQLQueryCache<SQLQueryPlan>& get_prepared_statement_cache();
 
  protected:
+  std::shared_ptr<AbstractOperator> _on_recreate(
+      const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+      const std::shared_ptr<AbstractOperator>& recreated_input_right) const override;
   std::shared_ptr<const Table> _on_execute(std::shared_ptr<TransactionContext> context) override;
 
   std::shared_ptr<hsql::SQLParserResult> parse_query(const std::string& query);
@@ -21,9 +21,11 @@ std::shared_ptr<const Table> SQLResultOperator::_on_execute() {
   return _input_left->get_output();
 }
 
-std::shared_ptr<AbstractOperator> SQLResultOperator::recreate(const std::vector<AllParameterVariant>& args) const {
+std::shared_ptr<AbstractOperator> SQLResultOperator::_on_recreate(
+    const std::vector<AllParameterVariant>& args, const std::shared_ptr<AbstractOperator>& recreated_input_left,
+    const std::shared_ptr<AbstractOperator>& recreated_input_right) const {
   auto op = std::make_shared<SQLResultOperator>();
-  op->set_input_operator(_input_left->recreate(args));
+  op->set_input_operator(recreated_input_left);
   return op;
 }
 
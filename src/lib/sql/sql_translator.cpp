@@ -14,6 +14,7 @@
 #include "logical_query_plan/aggregate_node.hpp"
 #include "logical_query_plan/create_view_node.hpp"
 #include "logical_query_plan/delete_node.hpp"
+#include "logical_query_plan/distinct_node.hpp"
 #include "logical_query_plan/drop_view_node.hpp"
 #include "logical_query_plan/dummy_table_node.hpp"
 #include "logical_query_plan/insert_node.hpp"
@@ -307,8 +308,6 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_select(const hsql::Se
   DebugAssert(select.selectList != nullptr, "SELECT list needs to exist");
   DebugAssert(!select.selectList->empty(), "SELECT list needs to have entries");
 
-  Assert(!select.selectDistinct, "DISTINCT is not yet supported");
-
   // If the query has a GROUP BY clause or if it has aggregates, we do not need a top-level projection
   // because all elements must either be aggregate functions or columns of the GROUP BY clause,
   // so the Aggregate operator will handle them.
@@ -329,6 +328,12 @@ std::shared_ptr<AbstractLQPNode> SQLTranslator::_translate_select(const hsql::Se
     current_result_node = _translate_projection(*select.selectList, current_result_node);
   }
 
+  if (select.selectDistinct) {
+    current_result_node = DistinctNode::make(current_result_node);
+  }
+
+  // The SQL parser does not keep which set operation (UNION, INTERSECT, or EXCEPT) was used and whether ALL was given,
+  // so they cannot be translated into a HashSetOperation yet
   Assert(select.unionSelect == nullptr, "Set operations (UNION/INTERSECT/...) are not supported yet");
 
   if (select.order != nullptr) {
@@ -21,5 +21,18 @@ class BaseValueColumn : public BaseColumn {
    */
   virtual const pmr_concurrent_vector<bool>& null_values() const = 0;
   virtual pmr_concurrent_vector<bool>& null_values() = 0;
+
+  /**
+   * @brief Copies the rows [source_begin, source_begin + count) of source into this column, starting at target_begin
+   *
+   * The rows need to exist already, i.e., the column needs to have been resized beforehand. The source can be a
+   * column of any type. As long as it holds the same data type, its values are copied (or decoded block-wise)
+   * without going through AllTypeVariant.
+   */
+  virtual void copy_values(const BaseColumn& source, const ChunkOffset source_begin, const size_t count,
+                           const ChunkOffset target_begin) = 0;
+
+  // Same as copy_values(), but appends the rows to the end of the column
+  virtual void append_values(const BaseColumn& source, const ChunkOffset source_begin, const size_t count) = 0;
 };
 }  // namespace opossum
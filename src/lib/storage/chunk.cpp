@@ -8,13 +8,23 @@
 #include <vector>
 
 #include "base_column.hpp"
+#include "base_value_column.hpp"
 #include "chunk.hpp"
 #include "index/base_index.hpp"
 #include "reference_column.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/job_task.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
+namespace {
+
+// Below this number of rows, appending to the columns one after another is cheaper than scheduling jobs for them
+constexpr auto parallel_append_row_threshold = size_t{10'000u};
+
+}  // namespace
+
 // The last commit id is reserved for uncommitted changes
 const CommitID Chunk::MAX_COMMIT_ID = std::numeric_limits<CommitID>::max() - 1;
 
@@ -63,6 +73,41 @@ void Chunk::append(const std::vector<AllTypeVariant>& values) {
   }
 }
 
+void Chunk::append_rows(const std::vector<std::shared_ptr<const BaseColumn>>& source_columns,
+                        const ChunkOffset source_begin, const size_t count, const CommitID begin_cid) {
+  DebugAssert((_columns.size() == source_columns.size()),
+              ("append_rows: number of columns (" + std::to_string(_columns.size()) +
+               ") does not match number of source columns (" + std::to_string(source_columns.size()) + ")"));
+
+  if (count == 0u) return;
+
+  // Do this first to ensure that the first thing to exist in a row are the MVCC columns.
+  if (has_mvcc_columns()) grow_mvcc_column_size_by(count, begin_cid);
+
+  const auto append_column = [&](const ColumnID column_id) {
+    const auto value_column = std::dynamic_pointer_cast<BaseValueColumn>(get_mutable_column(column_id));
+    Assert(value_column, "Rows can only be appended to ValueColumns.");
+
+    value_column->append_values(*source_columns[column_id], source_begin, count);
+  };
+
+  if (count < parallel_append_row_threshold || _columns.size() == 1u) {
+    for (ColumnID column_id{0}; column_id < _columns.size(); ++column_id) {
+      append_column(column_id);
+    }
+    return;
+  }
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(_columns.size());
+
+  for (ColumnID column_id{0}; column_id < _columns.size(); ++column_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, column_id]() { append_column(column_id); }));
+  }
+
+  CurrentScheduler::schedule_and_wait_for_tasks(jobs);
+}
+
 std::shared_ptr<BaseColumn> Chunk::get_mutable_column(ColumnID column_id) const {
   return std::atomic_load(&_columns.at(column_id));
 }
@@ -85,6 +130,32 @@ void Chunk::grow_mvcc_column_size_by(size_t delta, CommitID begin_cid) {
   mvcc_columns->tids.grow_to_at_least(size() + delta);
   mvcc_columns->begin_cids.grow_to_at_least(size() + delta, begin_cid);
   mvcc_columns->end_cids.grow_to_at_least(size() + delta, MAX_COMMIT_ID);
+
+  mvcc_columns->_reserved_row_count = static_cast<ChunkOffset>(size() + delta);
+}
+
+std::pair<ChunkOffset, ChunkOffset> Chunk::reserve_rows(const ChunkOffset row_count,
+                                                        const ChunkOffset max_chunk_size) {
+  auto mvcc_columns = this->mvcc_columns();
+
+  auto first_row = mvcc_columns->_reserved_row_count.load();
+  auto reserved_row_count = ChunkOffset{0u};
+  do {
+    if (first_row >= max_chunk_size) return {first_row, 0u};
+    reserved_row_count = std::min(row_count, static_cast<ChunkOffset>(max_chunk_size - first_row));
+  } while (!mvcc_columns->_reserved_row_count.compare_exchange_weak(first_row, first_row + reserved_row_count));
+
+  /**
+   * Grow the mvcc columns first, so that rows never exist without visibility information. The new rows are invisible
+   * until the inserting transaction commits. grow_to_at_least() is thread-safe and might already have been done by
+   * another insert that reserved rows behind ours.
+   */
+  const auto reserved_end = static_cast<size_t>(first_row) + reserved_row_count;
+  mvcc_columns->tids.grow_to_at_least(reserved_end);
+  mvcc_columns->begin_cids.grow_to_at_least(reserved_end, MAX_COMMIT_ID);
+  mvcc_columns->end_cids.grow_to_at_least(reserved_end, MAX_COMMIT_ID);
+
+  return {first_row, reserved_row_count};
 }
 
 bool Chunk::has_mvcc_columns() const { return _mvcc_columns != nullptr; }
@@ -146,13 +217,19 @@ void Chunk::remove_index(std::shared_ptr<BaseIndex> index) {
   _indices.erase(it);
 }
 
+std::shared_ptr<const ChunkStatistics> Chunk::statistics() const { return std::atomic_load(&_statistics); }
+
+void Chunk::set_statistics(const std::shared_ptr<const ChunkStatistics>& statistics) {
+  std::atomic_store(&_statistics, statistics);
+}
+
 bool Chunk::references_exactly_one_table() const {
   if (column_count() == 0) return false;
 
   auto first_column = std::dynamic_pointer_cast<const ReferenceColumn>(get_column(ColumnID{0}));
   if (first_column == nullptr) return false;
   auto first_referenced_table = first_column->referenced_table();
-  auto first_pos_list = first_column->pos_list();
+  auto first_positions_id = first_column->positions_id();
 
   for (ColumnID column_id{1}; column_id < column_count(); ++column_id) {
     const auto column = std::dynamic_pointer_cast<const ReferenceColumn>(get_column(column_id));
@@ -160,7 +237,7 @@ bool Chunk::references_exactly_one_table() const {
 
     if (first_referenced_table != column->referenced_table()) return false;
 
-    if (first_pos_list != column->pos_list()) return false;
+    if (first_positions_id != column->positions_id()) return false;
   }
 
   return true;
@@ -10,6 +10,7 @@
 #include <atomic>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "index/column_index_type.hpp"
@@ -23,6 +24,7 @@ namespace opossum {
 
 class BaseIndex;
 class BaseColumn;
+struct ChunkStatistics;
 
 enum class ChunkUseAccessCounter { Yes, No };
 
@@ -59,6 +61,13 @@ class Chunk : private Noncopyable {
      * via the mvcc_columns() getters
      */
     std::shared_mutex _mutex;
+
+    /**
+     * @brief Number of rows handed out by reserve_rows() (or added otherwise)
+     *
+     * May be ahead of the size of the chunk's columns while the reserving inserts are still filling them.
+     */
+    std::atomic<ChunkOffset> _reserved_row_count{0u};
   };
 
   /**
@@ -124,6 +133,15 @@ class Chunk : private Noncopyable {
   // note this is slow and not thread-safe and should be used for testing purposes only
   void append(const std::vector<AllTypeVariant>& values);
 
+  /**
+   * Appends the rows [source_begin, source_begin + count) of the given columns (one per column of this chunk) at once.
+   * In contrast to append(), the values are copied column-wise without going through AllTypeVariant, the MVCC columns
+   * are grown only once, and large blocks are copied in parallel, one job per column.
+   * All columns of the chunk need to be ValueColumns. Not thread-safe.
+   */
+  void append_rows(const std::vector<std::shared_ptr<const BaseColumn>>& source_columns, const ChunkOffset source_begin,
+                   const size_t count, const CommitID begin_cid = MAX_COMMIT_ID);
+
   /**
    * Atomically accesses and returns the column at a given position
    *
@@ -161,11 +179,22 @@ class Chunk : private Noncopyable {
 
   /**
    * Grows all mvcc columns by the given delta
+   * Not thread-safe, use reserve_rows() to append concurrently.
    *
    * @param begin_cid value all new begin_cids will be set to
    */
   void grow_mvcc_column_size_by(size_t delta, CommitID begin_cid);
 
+  /**
+   * Reserves up to row_count rows at the end of the chunk without letting it grow beyond max_chunk_size.
+   * The reservation is a lock-free compare-and-swap, so concurrent inserts into the same chunk do not block each other.
+   * The mvcc columns are grown to cover the reserved rows (with begin_cid set to MAX_COMMIT_ID), the data columns need
+   * to be grown by the caller.
+   *
+   * @return the offset of the first reserved row and the number of reserved rows, which is zero if the chunk is full
+   */
+  std::pair<ChunkOffset, ChunkOffset> reserve_rows(const ChunkOffset row_count, const ChunkOffset max_chunk_size);
+
   std::vector<std::shared_ptr<BaseIndex>> get_indices(
       const std::vector<std::shared_ptr<const BaseColumn>>& columns) const;
   std::vector<std::shared_ptr<BaseIndex>> get_indices(const std::vector<ColumnID> column_ids) const;
@@ -202,6 +231,13 @@ class Chunk : private Noncopyable {
 
   std::shared_ptr<AccessCounter> access_counter() const { return _access_counter; }
 
+  /**
+   * Statistics of the chunk's columns, generated by the ChunkEncoder when the chunk is sealed (see
+   * chunk_statistics.hpp). Accessed atomically, as they may be replaced while the optimizer reads them.
+   */
+  std::shared_ptr<const ChunkStatistics> statistics() const;
+  void set_statistics(const std::shared_ptr<const ChunkStatistics>& statistics);
+
   bool references_exactly_one_table() const;
 
   const PolymorphicAllocator<Chunk>& get_allocator() const;
@@ -220,6 +256,7 @@ class Chunk : private Noncopyable {
   std::shared_ptr<MvccColumns> _mvcc_columns;
   std::shared_ptr<AccessCounter> _access_counter;
   pmr_vector<std::shared_ptr<BaseIndex>> _indices;
+  std::shared_ptr<const ChunkStatistics> _statistics;
 };
 
 }  // namespace opossum
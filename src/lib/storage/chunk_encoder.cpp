@@ -8,6 +8,7 @@
 #include "table.hpp"
 #include "types.hpp"
 
+#include "optimizer/chunk_statistics.hpp"
 #include "storage/base_encoded_column.hpp"
 #include "storage/column_encoding_utils.hpp"
 #include "utils/assert.hpp"
@@ -38,6 +39,9 @@ void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::
   if (chunk->has_mvcc_columns()) {
     chunk->shrink_mvcc_columns();
   }
+
+  // Encoding seals the chunk, so its statistics are generated once here instead of on the optimizer's path
+  chunk->set_statistics(generate_chunk_statistics(*chunk, data_types));
 }
 
 void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<DataType>& data_types,
@@ -17,8 +17,14 @@ namespace opossum {
 class Chunk;
 class Table;
 
+/**
+ * @brief Specifies how a column is encoded
+ *
+ * By default, columns are dictionary-encoded. If no vector compression type is given,
+ * the encoder's default (FixedSizeByteAligned) is used.
+ */
 struct ColumnEncodingSpec {
-  constexpr ColumnEncodingSpec() : encoding_type{EncodingType::DeprecatedDictionary} {}
+  constexpr ColumnEncodingSpec() : encoding_type{EncodingType::Dictionary} {}
   constexpr ColumnEncodingSpec(EncodingType encoding_type_) : encoding_type{encoding_type_} {}
   constexpr ColumnEncodingSpec(EncodingType encoding_type_, VectorCompressionType vector_compression_type_)
       : encoding_type{encoding_type_}, vector_compression_type{vector_compression_type_} {}
@@ -41,7 +47,8 @@ class ChunkEncoder {
    * @brief Encodes a chunk
    *
    * Encodes a chunk using the passed encoding specifications.
-   * Reduces also the fragmentation of the chunk’s MVCC columns.
+   * Reduces also the fragmentation of the chunk’s MVCC columns and
+   * stores the chunk's statistics (see chunk_statistics.hpp).
    * All columns of the chunk need to be of type ValueColumn<T>,
    * i.e., recompression is not yet supported.
    *
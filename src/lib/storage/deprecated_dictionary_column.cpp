@@ -77,6 +77,20 @@ const pmr_concurrent_vector<std::optional<T>> DeprecatedDictionaryColumn<T>::mat
   return values;
 }
 
+template <typename T>
+void DeprecatedDictionaryColumn<T>::decode_block(const ChunkOffset begin, const size_t count, T* values,
+                                                 bool* null_values) const {
+  DebugAssert(begin + count <= size(), "Block exceeds the column.");
+
+  for (auto index = size_t{0u}; index < count; ++index) {
+    const auto value_id = _attribute_vector->get(begin + index);
+    const auto is_null = value_id == NULL_VALUE_ID;
+
+    null_values[index] = is_null;
+    values[index] = is_null ? T{} : (*_dictionary)[value_id];
+  }
+}
+
 template <typename T>
 const T& DeprecatedDictionaryColumn<T>::value_by_value_id(ValueID value_id) const {
   DebugAssert(value_id != NULL_VALUE_ID, "Null value id passed.");
@@ -56,6 +56,9 @@ class DeprecatedDictionaryColumn : public BaseDeprecatedDictionaryColumn {
   // return a generated vector of all values (or nulls)
   const pmr_concurrent_vector<std::optional<T>> materialize_values() const;
 
+  // Decodes the rows [begin, begin + count) into the given buffers, see ValueColumn::decode_block
+  void decode_block(const ChunkOffset begin, const size_t count, T* values, bool* null_values) const;
+
   // return the value represented by a given ValueID
   const T& value_by_value_id(ValueID value_id) const;
 
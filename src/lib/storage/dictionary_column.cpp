@@ -1,11 +1,13 @@
 #include "dictionary_column.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 
 #include "storage/column_visitable.hpp"
 #include "storage/value_column.hpp"
 #include "storage/vector_compression/base_compressed_vector.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
 #include "type_cast.hpp"
 #include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
@@ -39,6 +41,28 @@ std::shared_ptr<const pmr_vector<T>> DictionaryColumn<T>::dictionary() const {
   return _dictionary;
 }
 
+template <typename T>
+void DictionaryColumn<T>::decode_block(const ChunkOffset begin, const size_t count, T* values,
+                                       bool* null_values) const {
+  DebugAssert(begin + count <= size(), "Block exceeds the column.");
+
+  const auto& dictionary = *_dictionary;
+  const auto null_value_id = _null_value_id;
+
+  // The decoder is resolved once per block so that get() can be inlined into the loop
+  resolve_compressed_vector_type(*_attribute_vector, [&](const auto& vector) {
+    auto decoder = vector.create_decoder();
+
+    for (auto index = size_t{0u}; index < count; ++index) {
+      const auto value_id = decoder->get(begin + index);
+      const auto is_null = value_id == null_value_id;
+
+      null_values[index] = is_null;
+      values[index] = is_null ? T{} : dictionary[value_id];
+    }
+  });
+}
+
 template <typename T>
 size_t DictionaryColumn<T>::size() const {
   return _attribute_vector->size();
@@ -25,6 +25,9 @@ class DictionaryColumn : public BaseDictionaryColumn {
   // returns an underlying dictionary
   std::shared_ptr<const pmr_vector<T>> dictionary() const;
 
+  // Decodes the rows [begin, begin + count) into the given buffers, see ValueColumn::decode_block
+  void decode_block(const ChunkOffset begin, const size_t count, T* values, bool* null_values) const;
+
   /**
    * @defgroup BaseColumn interface
    * @{
@@ -0,0 +1,277 @@
+#include "encoding_advisor.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/value_column.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+/**
+ * Scan costs of the encodings relative to scanning an unencoded column.
+ * These are rough figures taken from the table scan benchmarks.
+ */
+constexpr auto dictionary_fixed_size_byte_aligned_scan_cost = 1.0f;
+constexpr auto dictionary_simd_bp128_scan_cost = 1.4f;
+constexpr auto run_length_scan_cost = 1.2f;
+
+// Number of values packed into a SIMD-BP128 meta block and the size of its meta information
+constexpr auto simd_bp128_meta_block_size = 512u;
+constexpr auto simd_bp128_meta_info_size = 16u;
+
+template <typename T>
+size_t value_size(const T& value) {
+  if constexpr (std::is_same_v<T, std::string>) {
+    // Strings that fit into the small string buffer do not allocate any additional memory
+    constexpr auto small_string_capacity = 15u;
+    return sizeof(std::string) + (value.size() > small_string_capacity ? value.size() + 1u : 0u);
+  } else {
+    return sizeof(T);
+  }
+}
+
+template <typename T>
+ColumnSampleStatistics sample_value_column(const ValueColumn<T>& column, const size_t sample_size) {
+  auto statistics = ColumnSampleStatistics{};
+
+  const auto& values = column.values();
+  const auto row_count = values.size();
+  statistics.row_count = row_count;
+
+  if (row_count == 0u) return statistics;
+
+  const auto is_nullable = column.is_nullable();
+  const auto sampled_row_count = std::min(std::max(sample_size, size_t{1u}), row_count);
+  statistics.sampled_row_count = sampled_row_count;
+
+  const auto is_null = [&](const size_t offset) { return is_nullable && column.null_values()[offset]; };
+
+  /**
+   * Rows are sampled at equal distances. Each sampled row is also compared to its successor in order to estimate
+   * the average run length, since a strided sample does not contain neighbouring rows.
+   */
+  const auto stride = static_cast<double>(row_count) / static_cast<double>(sampled_row_count);
+
+  auto frequencies = std::unordered_map<T, size_t>{};
+  auto null_count = size_t{0u};
+  auto neighbour_count = size_t{0u};
+  auto run_starts = size_t{0u};
+  auto total_value_size = size_t{0u};
+  auto min_value = std::optional<T>{};
+  auto max_value = std::optional<T>{};
+  auto previous_value = std::optional<T>{};
+
+  for (auto sample_index = size_t{0u}; sample_index < sampled_row_count; ++sample_index) {
+    const auto offset = static_cast<size_t>(static_cast<double>(sample_index) * stride);
+    const auto current_is_null = is_null(offset);
+
+    if (offset + 1u < row_count) {
+      const auto next_is_null = is_null(offset + 1u);
+      ++neighbour_count;
+
+      if (current_is_null != next_is_null || (!current_is_null && values[offset] != values[offset + 1u])) {
+        ++run_starts;
+      }
+
+      if (!current_is_null && !next_is_null && values[offset + 1u] < values[offset]) {
+        statistics.is_sorted = false;
+      }
+    }
+
+    if (current_is_null) {
+      ++null_count;
+      continue;
+    }
+
+    const auto& value = values[offset];
+    ++frequencies[value];
+    total_value_size += value_size(value);
+
+    if (previous_value && value < *previous_value) statistics.is_sorted = false;
+    previous_value = value;
+
+    if (!min_value || value < *min_value) min_value = value;
+    if (!max_value || *max_value < value) max_value = value;
+  }
+
+  const auto sampled_non_null_count = sampled_row_count - null_count;
+  const auto scale = static_cast<double>(row_count) / static_cast<double>(sampled_row_count);
+
+  statistics.estimated_null_count = static_cast<size_t>(std::round(null_count * scale));
+
+  /**
+   * The distinct count is extrapolated using the Guaranteed-Error Estimator (GEE) by Charikar et al.:
+   * values seen exactly once in the sample are scaled by sqrt(n/r), all others are assumed to be complete.
+   * If the whole column was sampled, the result is exact.
+   */
+  if (sampled_non_null_count > 0u) {
+    auto singleton_count = size_t{0u};
+    for (const auto& frequency : frequencies) {
+      if (frequency.second == 1u) ++singleton_count;
+    }
+
+    const auto non_null_row_count = std::max(row_count - statistics.estimated_null_count, sampled_non_null_count);
+    const auto singleton_scale =
+        std::sqrt(static_cast<double>(non_null_row_count) / static_cast<double>(sampled_non_null_count));
+    auto estimate = singleton_scale * singleton_count + (frequencies.size() - singleton_count);
+
+    // An integral column cannot have more distinct values than there are integers between its smallest and largest
+    // value. Strided samples of such columns tend to contain many singletons, which GEE would scale up beyond that.
+    if constexpr (std::is_integral_v<T>) {
+      const auto value_range = static_cast<double>(*max_value) - static_cast<double>(*min_value) + 1.0;
+      estimate = std::min(estimate, value_range);
+    }
+
+    statistics.estimated_distinct_count =
+        std::clamp(static_cast<size_t>(std::round(estimate)), frequencies.size(), non_null_row_count);
+
+    statistics.average_value_size =
+        static_cast<float>(total_value_size) / static_cast<float>(sampled_non_null_count);
+    statistics.min_value = *min_value;
+    statistics.max_value = *max_value;
+  } else {
+    statistics.average_value_size = static_cast<float>(sizeof(T));
+  }
+
+  if (statistics.is_sorted && null_count == 0u) {
+    // In a sorted column, all rows with the same value form a single run. The distinct count is a better basis for
+    // the run length than the few neighbouring rows that happen to be sampled.
+    statistics.estimated_average_run_length =
+        static_cast<float>(row_count) / static_cast<float>(statistics.estimated_distinct_count);
+  } else if (run_starts == 0u) {
+    statistics.estimated_average_run_length = static_cast<float>(row_count);
+  } else {
+    statistics.estimated_average_run_length = static_cast<float>(neighbour_count) / static_cast<float>(run_starts);
+  }
+
+  return statistics;
+}
+
+size_t estimate_unencoded_memory_usage(const ColumnSampleStatistics& statistics, const bool is_nullable) {
+  const auto null_values_size = is_nullable ? statistics.row_count * sizeof(bool) : 0u;
+  return static_cast<size_t>(statistics.row_count * statistics.average_value_size) + null_values_size;
+}
+
+size_t estimate_dictionary_memory_usage(const ColumnSampleStatistics& statistics,
+                                        const VectorCompressionType vector_compression_type) {
+  const auto dictionary_size =
+      static_cast<size_t>(statistics.estimated_distinct_count * statistics.average_value_size);
+
+  // The attribute vector needs to store the distinct count plus one value id for NULL
+  const auto max_value_id = statistics.estimated_distinct_count + 1u;
+
+  auto attribute_vector_size = size_t{0u};
+  if (vector_compression_type == VectorCompressionType::FixedSizeByteAligned) {
+    if (max_value_id <= std::numeric_limits<uint8_t>::max()) {
+      attribute_vector_size = statistics.row_count * sizeof(uint8_t);
+    } else if (max_value_id <= std::numeric_limits<uint16_t>::max()) {
+      attribute_vector_size = statistics.row_count * sizeof(uint16_t);
+    } else {
+      attribute_vector_size = statistics.row_count * sizeof(uint32_t);
+    }
+  } else {
+    const auto bits_needed = static_cast<size_t>(std::ceil(std::log2(max_value_id + 1u)));
+    const auto packed_size = (statistics.row_count * bits_needed + 7u) / 8u;
+    const auto meta_block_count = (statistics.row_count + simd_bp128_meta_block_size - 1u) / simd_bp128_meta_block_size;
+    attribute_vector_size = packed_size + meta_block_count * simd_bp128_meta_info_size;
+  }
+
+  return dictionary_size + attribute_vector_size;
+}
+
+size_t estimate_run_length_memory_usage(const ColumnSampleStatistics& statistics) {
+  const auto run_count = static_cast<size_t>(std::ceil(statistics.row_count / statistics.estimated_average_run_length));
+
+  // Each run stores its value, its end position and a (bit-packed) null flag
+  const auto values_size = static_cast<size_t>(run_count * statistics.average_value_size);
+  return values_size + run_count * sizeof(ChunkOffset) + (run_count + 7u) / 8u;
+}
+
+}  // namespace
+
+EncodingAdvisor::EncodingAdvisor(const EncodingAdvisorConfig& config) : _config{config} {}
+
+const EncodingAdvisorConfig& EncodingAdvisor::config() const { return _config; }
+
+ColumnEncodingDecision EncodingAdvisor::advise_column(const std::shared_ptr<const BaseColumn>& column,
+                                                      DataType data_type) const {
+  auto decision = ColumnEncodingDecision{};
+
+  auto is_nullable = false;
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    const auto value_column = std::dynamic_pointer_cast<const ValueColumn<ColumnDataType>>(column);
+    if (!value_column) return;
+
+    is_nullable = value_column->is_nullable();
+    decision.statistics = sample_value_column(*value_column, _config.sample_size);
+  });
+
+  // Columns that are already encoded (or reference other tables) are left as they are
+  if (!decision.statistics) return decision;
+
+  const auto& statistics = *decision.statistics;
+
+  decision.estimated_memory_usage = estimate_unencoded_memory_usage(statistics, is_nullable);
+
+  const auto consider = [&](const ColumnEncodingSpec& spec, const size_t memory_usage, const float scan_cost) {
+    if (scan_cost > _config.max_relative_scan_cost) return;
+
+    // On ties, the encoding that is cheaper to scan wins
+    if (memory_usage < decision.estimated_memory_usage ||
+        (memory_usage == decision.estimated_memory_usage && scan_cost < decision.estimated_relative_scan_cost)) {
+      decision.encoding_spec = spec;
+      decision.estimated_memory_usage = memory_usage;
+      decision.estimated_relative_scan_cost = scan_cost;
+    }
+  };
+
+  consider({EncodingType::Dictionary, VectorCompressionType::FixedSizeByteAligned},
+           estimate_dictionary_memory_usage(statistics, VectorCompressionType::FixedSizeByteAligned),
+           dictionary_fixed_size_byte_aligned_scan_cost);
+  consider({EncodingType::Dictionary, VectorCompressionType::SimdBp128},
+           estimate_dictionary_memory_usage(statistics, VectorCompressionType::SimdBp128),
+           dictionary_simd_bp128_scan_cost);
+  consider({EncodingType::RunLength}, estimate_run_length_memory_usage(statistics), run_length_scan_cost);
+
+  return decision;
+}
+
+ChunkEncodingDecision EncodingAdvisor::advise_chunk(const std::shared_ptr<const Chunk>& chunk,
+                                                    const std::vector<DataType>& data_types) const {
+  Assert((data_types.size() == chunk->column_count()), "Number of column types must match the chunk’s column count.");
+
+  auto chunk_decision = ChunkEncodingDecision{};
+  chunk_decision.reserve(chunk->column_count());
+
+  for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
+    chunk_decision.push_back(advise_column(chunk->get_column(column_id), data_types[column_id]));
+  }
+
+  return chunk_decision;
+}
+
+ChunkEncodingSpec EncodingAdvisor::encoding_spec(const ChunkEncodingDecision& chunk_decision) {
+  auto chunk_encoding_spec = ChunkEncodingSpec{};
+  chunk_encoding_spec.reserve(chunk_decision.size());
+
+  for (const auto& column_decision : chunk_decision) {
+    chunk_encoding_spec.push_back(column_decision.encoding_spec);
+  }
+
+  return chunk_encoding_spec;
+}
+
+}  // namespace opossum
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+#include "storage/chunk_encoder.hpp"
+
+namespace opossum {
+
+class BaseColumn;
+class Chunk;
+
+/**
+ * @brief Parameters of the EncodingAdvisor
+ */
+struct EncodingAdvisorConfig {
+  // The estimated scan cost of the chosen encoding relative to the scan cost of an
+  // unencoded column must not exceed this factor. Among all encodings within this budget,
+  // the one with the smallest estimated memory footprint is chosen.
+  float max_relative_scan_cost = 1.5f;
+
+  // Number of rows per column that are inspected. If the column has at most this many rows,
+  // the statistics are exact.
+  size_t sample_size = 4'096u;
+};
+
+/**
+ * @brief Properties of a column as estimated from a sample
+ */
+struct ColumnSampleStatistics {
+  size_t row_count = 0u;
+  size_t sampled_row_count = 0u;
+
+  size_t estimated_distinct_count = 0u;
+  size_t estimated_null_count = 0u;
+
+  // Average number of consecutive rows that share the same value (or are all NULL)
+  float estimated_average_run_length = 1.0f;
+
+  // Estimated memory usage of a single value, including heap-allocated string data
+  float average_value_size = 0.0f;
+
+  // Smallest and largest non-NULL value within the sample (NullValue if the sample contains only NULLs)
+  AllTypeVariant min_value = NULL_VALUE;
+  AllTypeVariant max_value = NULL_VALUE;
+
+  // True if no descending pair of neighbouring rows was found within the sample
+  bool is_sorted = true;
+};
+
+/**
+ * @brief The encoding chosen for a single column and the figures the decision was based on
+ *
+ * If statistics is std::nullopt, the column was not a value column and is left untouched.
+ */
+struct ColumnEncodingDecision {
+  ColumnEncodingSpec encoding_spec{EncodingType::Unencoded};
+  std::optional<ColumnSampleStatistics> statistics;
+
+  size_t estimated_memory_usage = 0u;
+  float estimated_relative_scan_cost = 1.0f;
+};
+
+using ChunkEncodingDecision = std::vector<ColumnEncodingDecision>;
+
+/**
+ * @brief Chooses column encodings based on the data in a chunk
+ *
+ * For each value column, the advisor samples the column, estimates its distinct count,
+ * average run length, null count, value range and sortedness and derives the expected
+ * memory usage of every available encoding (unencoded, Dictionary with FixedSizeByteAligned
+ * or SimdBp128 vector compression, and RunLength) from these numbers. The value range caps
+ * the distinct count of integral columns. In sorted columns, every distinct value forms a
+ * single run, so that the run length follows from the distinct count.
+ * It picks the encoding with the smallest memory footprint whose estimated scan cost stays
+ * within EncodingAdvisorConfig::max_relative_scan_cost.
+ *
+ * The cost model is deliberately simple: it only relies on the sample and some constant factors
+ * per encoding. It is meant to keep up with changing data, not to find the optimal encoding.
+ */
+class EncodingAdvisor {
+ public:
+  explicit EncodingAdvisor(const EncodingAdvisorConfig& config = {});
+
+  const EncodingAdvisorConfig& config() const;
+
+  ColumnEncodingDecision advise_column(const std::shared_ptr<const BaseColumn>& column, DataType data_type) const;
+
+  ChunkEncodingDecision advise_chunk(const std::shared_ptr<const Chunk>& chunk,
+                                     const std::vector<DataType>& data_types) const;
+
+  /**
+   * @brief Collects the encoding specs of the given decisions so that they can be passed to the ChunkEncoder
+   */
+  static ChunkEncodingSpec encoding_spec(const ChunkEncodingDecision& chunk_decision);
+
+ protected:
+  const EncodingAdvisorConfig _config;
+};
+
+}  // namespace opossum
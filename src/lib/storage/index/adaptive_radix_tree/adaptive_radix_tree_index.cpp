@@ -9,9 +9,10 @@
 
 #include "adaptive_radix_tree_nodes.hpp"
 #include "storage/base_column.hpp"
-#include "storage/base_deprecated_dictionary_column.hpp"
-#include "storage/deprecated_dictionary_column/base_attribute_vector.hpp"
+#include "storage/base_dictionary_column.hpp"
 #include "storage/index/base_index.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "storage/vector_compression/base_vector_decompressor.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
@@ -19,26 +20,34 @@ namespace opossum {
 
 AdaptiveRadixTreeIndex::AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr<const BaseColumn>>& index_columns)
     : BaseIndex{get_index_type_of<AdaptiveRadixTreeIndex>()},
-      _index_column(std::dynamic_pointer_cast<const BaseDeprecatedDictionaryColumn>(index_columns.front())) {
+      _index_column(std::dynamic_pointer_cast<const BaseDictionaryColumn>(index_columns.front())) {
   DebugAssert(static_cast<bool>(_index_column), "AdaptiveRadixTree only works with DictionaryColumns for now");
   DebugAssert((index_columns.size() == 1), "AdaptiveRadixTree only works with a single column");
 
+  auto decoder = _index_column->attribute_vector()->create_base_decoder();
+
   // for each valueID in the attribute vector, create a pair consisting of a BinaryComparable of this valueID and its
-  // ChunkOffset (needed for bulk-inserting)
+  // ChunkOffset (needed for bulk-inserting). As the null value id is larger than all other value ids, NULLs end up
+  // behind all values.
   std::vector<std::pair<BinaryComparable, ChunkOffset>> pairs_to_insert;
-  pairs_to_insert.reserve(_index_column->attribute_vector()->size());
-  for (ChunkOffset chunk_offset = 0u; chunk_offset < _index_column->attribute_vector()->size(); ++chunk_offset) {
-    pairs_to_insert.emplace_back(
-        std::make_pair(BinaryComparable(_index_column->attribute_vector()->get(chunk_offset)), chunk_offset));
+  pairs_to_insert.reserve(decoder->size());
+  const auto null_value_id = _index_column->null_value_id();
+  auto null_count = size_t{0};
+  for (ChunkOffset chunk_offset = 0u; chunk_offset < decoder->size(); ++chunk_offset) {
+    const auto value_id = ValueID{decoder->get(chunk_offset)};
+    if (value_id == null_value_id) ++null_count;
+    pairs_to_insert.emplace_back(std::make_pair(BinaryComparable(value_id), chunk_offset));
   }
   _root = _bulk_insert(pairs_to_insert);
+  _null_positions_begin = _chunk_offsets.cend() - null_count;
 }
 
 BaseIndex::Iterator AdaptiveRadixTreeIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
   assert(values.size() == 1);
   ValueID valueID = _index_column->lower_bound(values[0]);
   if (valueID == INVALID_VALUE_ID) {
-    return _chunk_offsets.end();
+    // The value is larger than all values, so the bound lies in front of the NULLs, which are kept behind them
+    return _null_positions_begin;
   }
   return _root->lower_bound(BinaryComparable(valueID), 0);
 }
@@ -47,10 +56,10 @@ BaseIndex::Iterator AdaptiveRadixTreeIndex::_upper_bound(const std::vector<AllTy
   assert(values.size() == 1);
   ValueID valueID = _index_column->upper_bound(values[0]);
   if (valueID == INVALID_VALUE_ID) {
-    return _chunk_offsets.end();
-  } else {
-    return _root->lower_bound(BinaryComparable(valueID), 0);
+    // See _lower_bound()
+    return _null_positions_begin;
   }
+  return _root->lower_bound(BinaryComparable(valueID), 0);
 }
 
 BaseIndex::Iterator AdaptiveRadixTreeIndex::_cbegin() const { return _chunk_offsets.cbegin(); }
@@ -4,19 +4,48 @@
 #include <climits>
 #include <cstdint>
 #include <iterator>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <string>
 #include <utility>
 #include <vector>
 
-#include "storage/base_deprecated_dictionary_column.hpp"
-#include "storage/deprecated_dictionary_column/base_attribute_vector.hpp"
+#include "storage/base_dictionary_column.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "storage/vector_compression/base_vector_decompressor.hpp"
 #include "utils/assert.hpp"
 #include "variable_length_key_proxy.hpp"
 
 namespace opossum {
 
+namespace {
+
+/**
+ * Returns the number of bytes a column's partial key occupies within the composite key. The attribute vector of
+ * a DictionaryColumn may be compressed with any number of bits, so this is derived from the largest value id, which
+ * is the null value id. One more code is reserved above it (see bound_partial_key()).
+ */
+uint8_t partial_key_width(const BaseDictionaryColumn& column) {
+  const auto null_value_id = column.null_value_id();
+  if (null_value_id < std::numeric_limits<uint8_t>::max()) return sizeof(uint8_t);
+  if (null_value_id < std::numeric_limits<uint16_t>::max()) return sizeof(uint16_t);
+  return sizeof(uint32_t);
+}
+
+/**
+ * Returns the partial key for a value id returned by lower_bound() or upper_bound(). INVALID_VALUE_ID means that the
+ * bound lies behind all values. NULLs are sorted behind all values, so the bound of the last searched column is
+ * encoded as the null value id, which excludes the NULLs from the searched range. For a preceding column, that would
+ * match the rows that are NULL in this column, so the reserved code behind the null value id is used instead.
+ */
+ValueID bound_partial_key(const BaseDictionaryColumn& column, const ValueID value_id, const bool is_last_value) {
+  if (value_id != INVALID_VALUE_ID) return value_id;
+  return is_last_value ? column.null_value_id() : ValueID{column.null_value_id() + 1u};
+}
+
+}  // namespace
+
 CompositeGroupKeyIndex::CompositeGroupKeyIndex(const std::vector<std::shared_ptr<const BaseColumn>>& indexed_columns)
     : BaseIndex{get_index_type_of<CompositeGroupKeyIndex>()} {
   DebugAssert(!indexed_columns.empty(), "CompositeGroupKeyIndex requires at least one column to be indexed.");
@@ -34,7 +63,7 @@ CompositeGroupKeyIndex::CompositeGroupKeyIndex(const std::vector<std::shared_ptr
   // cast and check columns
   _indexed_columns.reserve(indexed_columns.size());
   for (const auto& column : indexed_columns) {
-    auto dict_column = std::dynamic_pointer_cast<const BaseDeprecatedDictionaryColumn>(column);
+    auto dict_column = std::dynamic_pointer_cast<const BaseDictionaryColumn>(column);
     DebugAssert(static_cast<bool>(dict_column), "CompositeGroupKeyIndex only works with DictionaryColumns");
     _indexed_columns.emplace_back(dict_column);
   }
@@ -42,7 +71,7 @@ CompositeGroupKeyIndex::CompositeGroupKeyIndex(const std::vector<std::shared_ptr
   // retrieve amount of memory consumed by each concatenated key
   CompositeKeyLength bytes_per_key = std::accumulate(
       _indexed_columns.begin(), _indexed_columns.end(), 0u,
-      [](auto key_length, const auto& column) { return key_length + column->attribute_vector()->width(); });
+      [](auto key_length, const auto& column) { return key_length + partial_key_width(*column); });
 
   // create concatenated keys and save their positions
   // at this point duplicated keys may be created, they will be handled later
@@ -50,11 +79,19 @@ CompositeGroupKeyIndex::CompositeGroupKeyIndex(const std::vector<std::shared_ptr
   auto keys = std::vector<VariableLengthKey>(column_size);
   _position_list.resize(column_size);
 
+  auto decoders = std::vector<std::unique_ptr<BaseVectorDecompressor>>();
+  auto partial_key_bits = std::vector<uint8_t>();
+  decoders.reserve(_indexed_columns.size());
+  partial_key_bits.reserve(_indexed_columns.size());
+  for (const auto& column : _indexed_columns) {
+    decoders.emplace_back(column->attribute_vector()->create_base_decoder());
+    partial_key_bits.emplace_back(partial_key_width(*column) * CHAR_BIT);
+  }
+
   for (ChunkOffset chunk_offset = 0; chunk_offset < column_size; ++chunk_offset) {
     auto concatenated_key = VariableLengthKey(bytes_per_key);
-    for (const auto& column : _indexed_columns) {
-      const auto& attribute_vector = column->attribute_vector();
-      concatenated_key.shift_and_set(attribute_vector->get(chunk_offset), attribute_vector->width() * CHAR_BIT);
+    for (auto column_index = size_t{0u}; column_index < _indexed_columns.size(); ++column_index) {
+      concatenated_key.shift_and_set(decoders[column_index]->get(chunk_offset), partial_key_bits[column_index]);
     }
     keys[chunk_offset] = std::move(concatenated_key);
     _position_list[chunk_offset] = chunk_offset;
@@ -103,23 +140,26 @@ VariableLengthKey CompositeGroupKeyIndex::_create_composite_key(const std::vecto
 
   // retrieve the partial keys for every value except for the last one and append them into one partial-key
   for (size_t column = 0; column < values.size() - 1; ++column) {
-    auto partial_key = _indexed_columns[column]->lower_bound(values[column]);
-    auto bits_of_partial_key = _indexed_columns[column]->attribute_vector()->width() * CHAR_BIT;
+    auto partial_key =
+        bound_partial_key(*_indexed_columns[column], _indexed_columns[column]->lower_bound(values[column]), false);
+    auto bits_of_partial_key = partial_key_width(*_indexed_columns[column]) * CHAR_BIT;
     result.shift_and_set(partial_key, bits_of_partial_key);
   }
 
   // retrieve the partial key for the last value (depending on whether we have a lower- or upper-bound-query)
   // and append it to the previously created partial key to obtain the key containing all provided values
   const auto& column_for_last_value = _indexed_columns[values.size() - 1];
-  auto&& partial_key = is_upper_bound ? column_for_last_value->upper_bound(values.back())
-                                      : column_for_last_value->lower_bound(values.back());
-  auto bits_of_partial_key = column_for_last_value->attribute_vector()->width() * CHAR_BIT;
+  auto partial_key = bound_partial_key(*column_for_last_value,
+                                       is_upper_bound ? column_for_last_value->upper_bound(values.back())
+                                                      : column_for_last_value->lower_bound(values.back()),
+                                       true);
+  auto bits_of_partial_key = partial_key_width(*column_for_last_value) * CHAR_BIT;
   result.shift_and_set(partial_key, bits_of_partial_key);
 
   // fill empty space of key with zeros if less values than columns were provided
   auto empty_bits =
       std::accumulate(_indexed_columns.cbegin() + values.size(), _indexed_columns.cend(), static_cast<uint8_t>(0u),
-                      [](auto value, auto column) { return value + column->attribute_vector()->width() * CHAR_BIT; });
+                      [](auto value, auto column) { return value + partial_key_width(*column) * CHAR_BIT; });
   result <<= empty_bits;
 
   return result;
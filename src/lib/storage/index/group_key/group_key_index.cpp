@@ -3,26 +3,31 @@
 #include <memory>
 #include <vector>
 
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "storage/vector_compression/base_vector_decompressor.hpp"
+
 namespace opossum {
 
 GroupKeyIndex::GroupKeyIndex(const std::vector<std::shared_ptr<const BaseColumn>> index_columns)
     : BaseIndex{get_index_type_of<GroupKeyIndex>()},
-      _index_column(std::dynamic_pointer_cast<const BaseDeprecatedDictionaryColumn>(index_columns[0])) {
+      _index_column(std::dynamic_pointer_cast<const BaseDictionaryColumn>(index_columns[0])) {
   DebugAssert(static_cast<bool>(_index_column), "GroupKeyIndex only works with DictionaryColumns");
   DebugAssert((index_columns.size() == 1), "GroupKeyIndex only works with a single column");
 
+  const auto null_value_id = _index_column->null_value_id();
+  auto decoder = _index_column->attribute_vector()->create_base_decoder();
+
   // 1) Initialize the index structures
   // 1a) Set the index_offset to size of the dictionary + 1 (plus one to mark the ending position) and set all offsets
   // to 0
   _index_offsets = std::vector<size_t>(_index_column->unique_values_count() + 1, 0);
-  // 1b) Set the _index_postings to the size of the attribute vector
-  _index_postings = std::vector<ChunkOffset>(_index_column->size());
 
   // 2) Count the occurrences of value-ids: Iterate once over the attribute vector (ie value ids) and count the
   // occurrences of each value id at their respective position in the dictionary, ie the position in the
-  // _index_offsets
+  // _index_offsets. NULL values are not indexed.
   for (ChunkOffset offset = 0; offset < _index_column->size(); ++offset) {
-    auto value_id = _index_column->attribute_vector()->get(offset);
+    auto value_id = decoder->get(offset);
+    if (value_id == null_value_id) continue;
     _index_offsets[value_id + 1]++;
   }
 
@@ -30,12 +35,14 @@ GroupKeyIndex::GroupKeyIndex(const std::vector<std::shared_ptr<const BaseColumn>
   std::partial_sum(_index_offsets.begin(), _index_offsets.end(), _index_offsets.begin());
 
   // 4) Create the postings
-  // 4a) Copy _index_offsets to use it as a write counter
+  // 4a) Set the _index_postings to the number of non-NULL values and copy _index_offsets to use it as a write counter
+  _index_postings = std::vector<ChunkOffset>(_index_offsets.back());
   auto index_offset_copy = std::vector<size_t>(_index_offsets);
 
   // 4b) Iterate once again over the attribute vector to obtain the write-offsets
   for (ChunkOffset pos = 0; pos < _index_column->size(); ++pos) {
-    auto value_id = _index_column->attribute_vector()->get(pos);
+    auto value_id = decoder->get(pos);
+    if (value_id == null_value_id) continue;
     _index_postings[index_offset_copy[value_id]] = pos;
 
     // increase the write-offset in the copy by one to assure that further writes are directed to the next position in
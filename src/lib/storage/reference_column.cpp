@@ -5,6 +5,7 @@
 #include <utility>
 
 #include "column_visitable.hpp"
+#include "reference_column/row_id_pos_list.hpp"
 #include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
 
@@ -12,6 +13,10 @@ namespace opossum {
 
 ReferenceColumn::ReferenceColumn(const std::shared_ptr<const Table> referenced_table,
                                  const ColumnID referenced_column_id, const std::shared_ptr<const PosList> pos)
+    : ReferenceColumn(referenced_table, referenced_column_id, std::make_shared<RowIDPosList>(pos)) {}
+
+ReferenceColumn::ReferenceColumn(const std::shared_ptr<const Table> referenced_table,
+                                 const ColumnID referenced_column_id, const std::shared_ptr<const AbstractPosList> pos)
     : _referenced_table(referenced_table), _referenced_column_id(referenced_column_id), _pos_list(pos) {
 #if IS_DEBUG
   auto referenced_column = _referenced_table->get_chunk(ChunkID{0})->get_column(referenced_column_id);
@@ -24,7 +29,8 @@ ReferenceColumn::ReferenceColumn(const std::shared_ptr<const Table> referenced_t
 const AllTypeVariant ReferenceColumn::operator[](const ChunkOffset chunk_offset) const {
   PerformanceWarning("operator[] used");
 
-  auto chunk_info = _pos_list->at(chunk_offset);
+  DebugAssert(chunk_offset < size(), "ChunkOffset exceeds the column.");
+  auto chunk_info = (*_pos_list)[chunk_offset];
 
   if (chunk_info == NULL_ROW_ID) return NULL_VALUE;
 
@@ -35,7 +41,17 @@ const AllTypeVariant ReferenceColumn::operator[](const ChunkOffset chunk_offset)
 
 void ReferenceColumn::append(const AllTypeVariant&) { Fail("ReferenceColumn is immutable"); }
 
-const std::shared_ptr<const PosList> ReferenceColumn::pos_list() const { return _pos_list; }
+const std::shared_ptr<const PosList> ReferenceColumn::pos_list() const { return _pos_list->row_ids(); }
+const std::shared_ptr<const AbstractPosList> ReferenceColumn::abstract_pos_list() const { return _pos_list; }
+
+const void* ReferenceColumn::positions_id() const {
+  // Each column created from a PosList wraps it in a RowIDPosList of its own
+  if (const auto row_id_pos_list = std::dynamic_pointer_cast<const RowIDPosList>(_pos_list)) {
+    return row_id_pos_list->row_ids().get();
+  }
+  return _pos_list.get();
+}
+
 const std::shared_ptr<const Table> ReferenceColumn::referenced_table() const { return _referenced_table; }
 ColumnID ReferenceColumn::referenced_column_id() const { return _referenced_column_id; }
 
@@ -51,8 +67,6 @@ std::shared_ptr<BaseColumn> ReferenceColumn::copy_using_allocator(const Polymorp
   Fail("Cannot migrate a ReferenceColumn");
 }
 
-size_t ReferenceColumn::estimate_memory_usage() const {
-  return sizeof(*this) + _pos_list->size() * sizeof(decltype(_pos_list)::element_type::value_type);
-}
+size_t ReferenceColumn::estimate_memory_usage() const { return sizeof(*this) + _pos_list->estimate_memory_usage(); }
 
 }  // namespace opossum
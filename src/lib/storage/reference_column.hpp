@@ -2,6 +2,7 @@
 
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -9,10 +10,17 @@
 
 #include "base_column.hpp"
 #include "deprecated_dictionary_column.hpp"
+#include "deprecated_dictionary_column/base_attribute_vector.hpp"
+#include "dictionary_column.hpp"
+#include "reference_column/abstract_pos_list.hpp"
+#include "reference_column/single_chunk_pos_list.hpp"
 #include "table.hpp"
+#include "type_cast.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 #include "value_column.hpp"
+#include "vector_compression/base_compressed_vector.hpp"
+#include "vector_compression/base_vector_decompressor.hpp"
 
 namespace opossum {
 
@@ -24,6 +32,10 @@ class ReferenceColumn : public BaseColumn {
   ReferenceColumn(const std::shared_ptr<const Table> referenced_table, const ColumnID referenced_column_id,
                   const std::shared_ptr<const PosList> pos);
 
+  // creates a reference column whose positions are stored in a (possibly compact) representation other than PosList
+  ReferenceColumn(const std::shared_ptr<const Table> referenced_table, const ColumnID referenced_column_id,
+                  const std::shared_ptr<const AbstractPosList> pos);
+
   const AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
 
   void append(const AllTypeVariant&) override;
@@ -31,47 +43,145 @@ class ReferenceColumn : public BaseColumn {
   // return generated vector of all values (or nulls)
   template <typename T>
   const pmr_concurrent_vector<std::optional<T>> materialize_values() const {
-    pmr_concurrent_vector<std::optional<T>> values;
-    values.reserve(_pos_list->size());
+    const auto row_count = size();
 
-    for (const RowID& row : *_pos_list) {
-      auto chunk = _referenced_table->get_chunk(row.chunk_id);
-      std::shared_ptr<const BaseColumn> column = chunk->get_column(_referenced_column_id);
+    // Gather the values with decode_block, which looks up and resolves the referenced column once per run of rows
+    // in the same chunk instead of once per row and does not materialize the RowIDs of a SingleChunkPosList
+    auto decoded_values = std::vector<T>(row_count);
+    auto decoded_null_values = std::make_unique<bool[]>(row_count);
+    decode_block(ChunkOffset{0}, row_count, decoded_values.data(), decoded_null_values.get());
 
-      if (row.chunk_offset == INVALID_CHUNK_OFFSET) {
+    pmr_concurrent_vector<std::optional<T>> values;
+    values.reserve(row_count);
+    for (auto index = size_t{0}; index < row_count; ++index) {
+      if (decoded_null_values[index]) {
         values.push_back(std::nullopt);
-        continue;
+      } else {
+        values.push_back(std::move(decoded_values[index]));
       }
+    }
 
-      // Can't avoid Code Duplication here because get() is part of a templated class
+    return values;
+  }
 
-      if (auto value_column = std::dynamic_pointer_cast<const ValueColumn<T>>(column)) {
-        if (value_column->is_null(row.chunk_offset)) {
-          values.push_back(std::nullopt);
-        } else {
-          values.push_back(value_column->get(row.chunk_offset));
-        }
-        continue;
+  // Gathers the referenced values of the rows [begin, begin + count) into the given buffers,
+  // see ValueColumn::decode_block
+  template <typename T>
+  void decode_block(const ChunkOffset begin, const size_t count, T* values, bool* null_values) const {
+    DebugAssert(begin + count <= size(), "Block exceeds the column.");
+
+    if (count == 0) return;
+
+    /**
+     * The referenced column is only looked up again when the chunk changes, so that position lists
+     * that mostly point into the same chunk do not pay for a dynamic_cast per row. Value and (deprecated)
+     * dictionary columns are gathered from directly, all other columns are accessed via the (slow) virtual
+     * operator[].
+     */
+    auto column = std::shared_ptr<const BaseColumn>{};
+    auto value_column = static_cast<const ValueColumn<T>*>(nullptr);
+    auto dictionary_column = static_cast<const DictionaryColumn<T>*>(nullptr);
+    auto dictionary = static_cast<const pmr_vector<T>*>(nullptr);
+    auto attribute_vector_decoder = std::unique_ptr<BaseVectorDecompressor>{};
+    auto deprecated_dictionary_column = static_cast<const DeprecatedDictionaryColumn<T>*>(nullptr);
+    auto deprecated_attribute_vector = static_cast<const BaseAttributeVector*>(nullptr);
+
+    const auto resolve_column = [&](const ChunkID chunk_id) {
+      column = _referenced_table->get_chunk(chunk_id)->get_column(_referenced_column_id);
+      value_column = dynamic_cast<const ValueColumn<T>*>(column.get());
+      dictionary_column = dynamic_cast<const DictionaryColumn<T>*>(column.get());
+      deprecated_dictionary_column = dynamic_cast<const DeprecatedDictionaryColumn<T>*>(column.get());
+
+      if (dictionary_column) {
+        dictionary = dictionary_column->dictionary().get();
+        attribute_vector_decoder = dictionary_column->attribute_vector()->create_base_decoder();
+      } else if (deprecated_dictionary_column) {
+        dictionary = deprecated_dictionary_column->dictionary().get();
+        deprecated_attribute_vector = deprecated_dictionary_column->attribute_vector().get();
       }
+    };
+
+    const auto gather_value = [&](const size_t index, const ChunkOffset chunk_offset) {
+      if (value_column) {
+        values[index] = value_column->values()[chunk_offset];
+        null_values[index] = value_column->is_null(chunk_offset);
+      } else if (dictionary_column) {
+        const auto value_id = attribute_vector_decoder->get(chunk_offset);
+        const auto is_null = value_id == dictionary_column->null_value_id();
+
+        values[index] = is_null ? T{} : (*dictionary)[value_id];
+        null_values[index] = is_null;
+      } else if (deprecated_dictionary_column) {
+        const auto value_id = deprecated_attribute_vector->get(chunk_offset);
+        const auto is_null = value_id == NULL_VALUE_ID;
+
+        values[index] = is_null ? T{} : (*dictionary)[value_id];
+        null_values[index] = is_null;
+      } else {
+        const auto value = (*column)[chunk_offset];
+        const auto is_null = variant_is_null(value);
+
+        values[index] = is_null ? T{} : type_cast<T>(value);
+        null_values[index] = is_null;
+      }
+    };
+
+    // All positions of a SingleChunkPosList lie in the same chunk. Walk its chunk offsets instead of materializing
+    // the RowIDs.
+    if (const auto single_chunk_pos_list = std::dynamic_pointer_cast<const SingleChunkPosList>(_pos_list)) {
+      resolve_column(single_chunk_pos_list->chunk_id());
+
+      auto index = size_t{0};
+      single_chunk_pos_list->for_each_chunk_offset(
+          begin, begin + count, [&](const ChunkOffset chunk_offset) { gather_value(index++, chunk_offset); });
+      return;
+    }
+
+    const auto pos_list = this->pos_list();
+    auto current_chunk_id = std::optional<ChunkID>{};
 
-      if (auto dict_column = std::dynamic_pointer_cast<const DeprecatedDictionaryColumn<T>>(column)) {
-        if (dict_column->is_null(row.chunk_offset)) {
-          values.push_back(std::nullopt);
-        } else {
-          values.push_back(dict_column->get(row.chunk_offset));
-        }
+    for (auto index = size_t{0u}; index < count; ++index) {
+      const auto& row = (*pos_list)[begin + index];
+
+      if (row.chunk_offset == INVALID_CHUNK_OFFSET) {
+        values[index] = T{};
+        null_values[index] = true;
         continue;
       }
 
-      Fail("column is no dictionary or value column");
-    }
+      if (row.chunk_id != current_chunk_id) {
+        current_chunk_id = row.chunk_id;
+        resolve_column(row.chunk_id);
+      }
 
-    return values;
+      gather_value(index, row.chunk_offset);
+    }
   }
 
   size_t size() const final;
 
+  // Calls functor(row_id) for every position in order. Unlike pos_list(), this does not materialize compact
+  // representations.
+  template <typename Functor>
+  void for_each_position(const Functor& functor) const {
+    if (const auto single_chunk_pos_list = std::dynamic_pointer_cast<const SingleChunkPosList>(_pos_list)) {
+      const auto chunk_id = single_chunk_pos_list->chunk_id();
+      single_chunk_pos_list->for_each_chunk_offset(
+          [&](const ChunkOffset chunk_offset) { functor(RowID{chunk_id, chunk_offset}); });
+      return;
+    }
+
+    for (const auto& row_id : *pos_list()) functor(row_id);
+  }
+
+  // The positions as RowIDs. For compact representations, these are materialized on first use and kept, so prefer
+  // for_each_position() or abstract_pos_list() where possible.
   const std::shared_ptr<const PosList> pos_list() const;
+  const std::shared_ptr<const AbstractPosList> abstract_pos_list() const;
+
+  // Identifies the positions: columns created from the same PosList or AbstractPosList return the same id. Unlike
+  // comparing pos_list(), this does not materialize compact representations.
+  const void* positions_id() const;
   const std::shared_ptr<const Table> referenced_table() const;
 
   ColumnID referenced_column_id() const;
@@ -91,13 +201,13 @@ class ReferenceColumn : public BaseColumn {
     std::unordered_map<ChunkID, std::shared_ptr<std::vector<ChunkOffset>>, std::hash<decltype(ChunkID().t)>>
         all_chunk_offsets;
 
-    for (auto row_id : *(_pos_list)) {
+    for_each_position([&](const RowID& row_id) {
       auto iter = all_chunk_offsets.find(row_id.chunk_id);
       if (iter == all_chunk_offsets.end())
         iter = all_chunk_offsets.emplace(row_id.chunk_id, std::make_shared<std::vector<ChunkOffset>>()).first;
 
       iter->second->emplace_back(row_id.chunk_offset);
-    }
+    });
 
     for (auto& pair : all_chunk_offsets) {
       auto& chunk_id = pair.first;
@@ -123,7 +233,7 @@ class ReferenceColumn : public BaseColumn {
   const ColumnID _referenced_column_id;
 
   // The position list can be shared amongst multiple columns
-  const std::shared_ptr<const PosList> _pos_list;
+  const std::shared_ptr<const AbstractPosList> _pos_list;
 };
 
 }  // namespace opossum
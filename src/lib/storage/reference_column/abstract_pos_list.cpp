@@ -0,0 +1,18 @@
+#include "abstract_pos_list.hpp"
+
+#include <memory>
+
+namespace opossum {
+
+std::shared_ptr<const PosList> AbstractPosList::row_ids() const {
+  // _row_ids_memory_usage() can read _row_ids while it is materialized, so it is accessed atomically
+  std::call_once(_materialize_flag, [&]() { std::atomic_store(&_row_ids, _materialize()); });
+  return _row_ids;
+}
+
+size_t AbstractPosList::_row_ids_memory_usage() const {
+  const auto row_ids = std::atomic_load(&_row_ids);
+  return row_ids ? sizeof(PosList) + row_ids->capacity() * sizeof(RowID) : size_t{0};
+}
+
+}  // namespace opossum
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * The positions a ReferenceColumn points to. Besides plain lists of RowIDs (RowIDPosList), positions can be stored in
+ * more compact representations, see SingleChunkPosList.
+ *
+ * Every representation can be turned into a PosList, which is what most operators work on. This PosList is created
+ * on first use and then kept, so that columns sharing an AbstractPosList also share the PosList returned by
+ * ReferenceColumn::pos_list(). For compact representations, it takes additional memory, so operators that only
+ * iterate over or look up positions should use operator[] or ReferenceColumn::for_each_position() instead.
+ */
+class AbstractPosList {
+ public:
+  virtual ~AbstractPosList() = default;
+
+  virtual size_t size() const = 0;
+
+  // The index-th position
+  virtual RowID operator[](const size_t index) const = 0;
+
+  // The positions as RowIDs, materialized on first use
+  std::shared_ptr<const PosList> row_ids() const;
+
+  virtual size_t estimate_memory_usage() const = 0;
+
+ protected:
+  virtual std::shared_ptr<const PosList> _materialize() const = 0;
+
+  // The memory used by the PosList returned by row_ids(), zero if it has not been materialized yet
+  size_t _row_ids_memory_usage() const;
+
+ private:
+  mutable std::once_flag _materialize_flag;
+  mutable std::shared_ptr<const PosList> _row_ids;
+};
+
+}  // namespace opossum
@@ -1,15 +1,33 @@
 #pragma once
 
-#include <map>
 #include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
 #include "storage/column_iterables.hpp"
+#include "storage/deprecated_dictionary_column.hpp"
+#include "storage/deprecated_dictionary_column/base_attribute_vector.hpp"
+#include "storage/dictionary_column.hpp"
 #include "storage/reference_column.hpp"
+#include "storage/reference_column/row_id_pos_list.hpp"
+#include "storage/reference_column/single_chunk_pos_list.hpp"
+#include "storage/value_column.hpp"
+#include "storage/vector_compression/base_compressed_vector.hpp"
+#include "storage/vector_compression/base_vector_decompressor.hpp"
 
 namespace opossum {
 
+/**
+ * Iterates over the values a ReferenceColumn points to.
+ *
+ * Looking up the referenced column (an atomic shared_ptr copy and a virtual call) and resolving its type for every
+ * value is expensive. Instead, the referenced column of every chunk is looked up once, when the first position in
+ * that chunk is dereferenced, so that the values are gathered directly from the typed columns even if the positions
+ * alternate between chunks (e.g., in the output of a join). If all positions lie in a single chunk (e.g., for
+ * SingleChunkPosLists or the sorted outputs of scans on stored tables), the column is looked up once and the iterator
+ * only walks the chunk offsets.
+ */
 template <typename T>
 class ReferenceColumnIterable : public ColumnIterable<ReferenceColumnIterable<T>> {
  public:
@@ -19,12 +37,37 @@ class ReferenceColumnIterable : public ColumnIterable<ReferenceColumnIterable<T>
   void _on_with_iterators(const Functor& functor) const {
     const auto table = _column.referenced_table();
     const auto column_id = _column.referenced_column_id();
+    const auto abstract_pos_list = _column.abstract_pos_list();
 
-    const auto begin_it = _column.pos_list()->begin();
-    const auto end_it = _column.pos_list()->end();
+    if (const auto single_chunk_pos_list = std::dynamic_pointer_cast<const SingleChunkPosList>(abstract_pos_list)) {
+      const auto column = table->get_chunk(single_chunk_pos_list->chunk_id())->get_column(column_id);
 
-    auto begin = Iterator{table, column_id, begin_it, begin_it};
-    auto end = Iterator{table, column_id, begin_it, end_it};
+      auto begin = SingleChunkIterator{column, single_chunk_pos_list, 0u};
+      auto end = SingleChunkIterator{column, single_chunk_pos_list, single_chunk_pos_list->size()};
+      functor(begin, end);
+      return;
+    }
+
+    const auto pos_list = abstract_pos_list->row_ids();
+
+    const auto row_id_pos_list = std::dynamic_pointer_cast<const RowIDPosList>(abstract_pos_list);
+    if (row_id_pos_list && row_id_pos_list->single_chunk_id()) {
+      const auto column = table->get_chunk(*row_id_pos_list->single_chunk_id())->get_column(column_id);
+
+      auto begin = SingleChunkIterator{column, pos_list, 0u};
+      auto end = SingleChunkIterator{column, pos_list, pos_list->size()};
+      functor(begin, end);
+      return;
+    }
+
+    const auto begin_it = pos_list->begin();
+    const auto end_it = pos_list->end();
+
+    // Shared by the copies of the iterators
+    const auto resolved_columns = std::make_shared<ResolvedColumns>(table->chunk_count());
+
+    auto begin = Iterator{table, column_id, resolved_columns, begin_it, begin_it};
+    auto end = Iterator{table, column_id, resolved_columns, begin_it, end_it};
     functor(begin, end);
   }
 
@@ -32,14 +75,84 @@ class ReferenceColumnIterable : public ColumnIterable<ReferenceColumnIterable<T>
   const ReferenceColumn& _column;
 
  private:
+  // A referenced column, resolved to its type once so that its values can be gathered directly
+  class ResolvedColumn {
+   public:
+    ResolvedColumn() = default;
+
+    explicit ResolvedColumn(const std::shared_ptr<const BaseColumn>& column)
+        : _column{column},
+          _value_column{dynamic_cast<const ValueColumn<T>*>(column.get())},
+          _dictionary_column{dynamic_cast<const DictionaryColumn<T>*>(column.get())},
+          _deprecated_dictionary_column{dynamic_cast<const DeprecatedDictionaryColumn<T>*>(column.get())} {
+      if (_dictionary_column) {
+        _dictionary = _dictionary_column->dictionary().get();
+        _attribute_vector_decoder = _dictionary_column->attribute_vector()->create_base_decoder();
+      } else if (_deprecated_dictionary_column) {
+        _dictionary = _deprecated_dictionary_column->dictionary().get();
+        _deprecated_attribute_vector = _deprecated_dictionary_column->attribute_vector().get();
+      }
+    }
+
+    ColumnIteratorValue<T> get(const ChunkOffset chunk_offset, const ChunkOffset chunk_offset_into_ref_column) const {
+      if (_value_column) {
+        if (_value_column->is_nullable() && _value_column->null_values()[chunk_offset]) {
+          return ColumnIteratorValue<T>{T{}, true, chunk_offset_into_ref_column};
+        }
+        return ColumnIteratorValue<T>{_value_column->values()[chunk_offset], false, chunk_offset_into_ref_column};
+      }
+
+      if (_dictionary_column) {
+        const auto value_id = ValueID{_attribute_vector_decoder->get(chunk_offset)};
+        if (value_id == _dictionary_column->null_value_id()) {
+          return ColumnIteratorValue<T>{T{}, true, chunk_offset_into_ref_column};
+        }
+        return ColumnIteratorValue<T>{(*_dictionary)[value_id], false, chunk_offset_into_ref_column};
+      }
+
+      if (_deprecated_dictionary_column) {
+        const auto value_id = _deprecated_attribute_vector->get(chunk_offset);
+        if (value_id == NULL_VALUE_ID) return ColumnIteratorValue<T>{T{}, true, chunk_offset_into_ref_column};
+        return ColumnIteratorValue<T>{(*_dictionary)[value_id], false, chunk_offset_into_ref_column};
+      }
+
+      /**
+       * Other encodings are accessed via the (slow) virtual operator[]
+       */
+      const auto variant_value = (*_column)[chunk_offset];
+      if (variant_is_null(variant_value)) return ColumnIteratorValue<T>{T{}, true, chunk_offset_into_ref_column};
+      return ColumnIteratorValue<T>{type_cast<T>(variant_value), false, chunk_offset_into_ref_column};
+    }
+
+   private:
+    std::shared_ptr<const BaseColumn> _column;
+    const ValueColumn<T>* _value_column{nullptr};
+    const DictionaryColumn<T>* _dictionary_column{nullptr};
+    const DeprecatedDictionaryColumn<T>* _deprecated_dictionary_column{nullptr};
+
+    // Of the (deprecated) dictionary column
+    const pmr_vector<T>* _dictionary{nullptr};
+    std::shared_ptr<BaseVectorDecompressor> _attribute_vector_decoder;
+    const BaseAttributeVector* _deprecated_attribute_vector{nullptr};
+  };
+
+  // The referenced column of every chunk of the referenced table, resolved when it is first accessed
+  using ResolvedColumns = std::vector<std::optional<ResolvedColumn>>;
+
+  // Iterates over RowIDs that may point into any chunk
   class Iterator : public BaseColumnIterator<Iterator, ColumnIteratorValue<T>> {
    public:
     using PosListIterator = PosList::const_iterator;
 
    public:
     explicit Iterator(const std::shared_ptr<const Table> table, const ColumnID column_id,
+                      const std::shared_ptr<ResolvedColumns>& resolved_columns,
                       const PosListIterator& begin_pos_list_it, const PosListIterator& pos_list_it)
-        : _table{table}, _column_id{column_id}, _begin_pos_list_it{begin_pos_list_it}, _pos_list_it{pos_list_it} {}
+        : _table{table},
+          _column_id{column_id},
+          _resolved_columns{resolved_columns},
+          _begin_pos_list_it{begin_pos_list_it},
+          _pos_list_it{pos_list_it} {}
 
    private:
     friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
@@ -48,97 +161,76 @@ class ReferenceColumnIterable : public ColumnIterable<ReferenceColumnIterable<T>
 
     bool equal(const Iterator& other) const { return _pos_list_it == other._pos_list_it; }
 
-    // TODO(anyone): benchmark if using two maps instead doing the dynamic cast every time really is faster.
     ColumnIteratorValue<T> dereference() const {
-      if (*_pos_list_it == NULL_ROW_ID) return ColumnIteratorValue<T>{T{}, true, 0u};
-
-      const auto chunk_id = _pos_list_it->chunk_id;
-      const auto& chunk_offset = _pos_list_it->chunk_offset;
-
-      auto value_column_it = _value_columns.find(chunk_id);
-      if (value_column_it != _value_columns.end()) {
-        return _value_from_value_column(*(value_column_it->second), chunk_offset);
-      }
-
-      auto dict_column_it = _dictionary_columns.find(chunk_id);
-      if (dict_column_it != _dictionary_columns.end()) {
-        return _value_from_dictionary_column(*(dict_column_it->second), chunk_offset);
-      }
-
-      const auto chunk = _table->get_chunk(chunk_id);
-      const auto column = chunk->get_column(_column_id);
+      const auto chunk_offset_into_ref_column =
+          static_cast<ChunkOffset>(std::distance(_begin_pos_list_it, _pos_list_it));
 
-      if (auto value_column = std::dynamic_pointer_cast<const ValueColumn<T>>(column)) {
-        _value_columns[chunk_id] = value_column;
-        return _value_from_value_column(*value_column, chunk_offset);
-      }
+      const auto& row_id = *_pos_list_it;
+      if (row_id == NULL_ROW_ID) return ColumnIteratorValue<T>{T{}, true, chunk_offset_into_ref_column};
 
-      if (auto dict_column = std::dynamic_pointer_cast<const DeprecatedDictionaryColumn<T>>(column)) {
-        _dictionary_columns[chunk_id] = dict_column;
-        return _value_from_dictionary_column(*dict_column, chunk_offset);
-      }
+      auto& resolved_column = (*_resolved_columns)[row_id.chunk_id];
+      if (!resolved_column) resolved_column.emplace(_table->get_chunk(row_id.chunk_id)->get_column(_column_id));
 
-      /**
-       * This is just a temporary solution to supporting encoded column type.
-       * It’s very slow and is going to be replaced very soon!
-       */
-      return _value_from_any_column(*column, chunk_offset);
+      return resolved_column->get(row_id.chunk_offset, chunk_offset_into_ref_column);
     }
 
    private:
-    auto _value_from_value_column(const ValueColumn<T>& column, const ChunkOffset& chunk_offset) const {
-      const auto chunk_offset_into_ref_column =
-          static_cast<ChunkOffset>(std::distance(_begin_pos_list_it, _pos_list_it));
+    const std::shared_ptr<const Table> _table;
+    const ColumnID _column_id;
+    const std::shared_ptr<ResolvedColumns> _resolved_columns;
 
-      if (column.is_nullable()) {
-        auto is_null = column.null_values()[chunk_offset];
-        const auto& value = is_null ? T{} : column.values()[chunk_offset];
-        return ColumnIteratorValue<T>{value, is_null, chunk_offset_into_ref_column};
-      }
+    const PosListIterator _begin_pos_list_it;
+    PosListIterator _pos_list_it;
+  };
 
-      const auto& value = column.values()[chunk_offset];
-      return ColumnIteratorValue<T>{value, false, chunk_offset_into_ref_column};
-    }
+  // Iterates over positions that all lie in the same chunk, either of a SingleChunkPosList or of RowIDs
+  class SingleChunkIterator : public BaseColumnIterator<SingleChunkIterator, ColumnIteratorValue<T>> {
+   public:
+    explicit SingleChunkIterator(const std::shared_ptr<const BaseColumn>& column,
+                                 const std::shared_ptr<const SingleChunkPosList>& pos_list, const size_t index)
+        : _column{column},
+          _single_chunk_pos_list{pos_list},
+          _size{pos_list->size()},
+          _index{index},
+          _chunk_offset{index < _size ? pos_list->first_chunk_offset() : INVALID_CHUNK_OFFSET} {}
+
+    explicit SingleChunkIterator(const std::shared_ptr<const BaseColumn>& column,
+                                 const std::shared_ptr<const PosList>& pos_list, const size_t index)
+        : _column{column},
+          _row_ids{pos_list},
+          _size{pos_list->size()},
+          _index{index},
+          _chunk_offset{index < _size ? (*pos_list)[index].chunk_offset : INVALID_CHUNK_OFFSET} {}
 
-    auto _value_from_dictionary_column(const DeprecatedDictionaryColumn<T>& column,
-                                       const ChunkOffset& chunk_offset) const {
-      const auto chunk_offset_into_ref_column =
-          static_cast<ChunkOffset>(std::distance(_begin_pos_list_it, _pos_list_it));
-      auto attribute_vector = column.attribute_vector();
-      auto value_id = attribute_vector->get(chunk_offset);
+   private:
+    friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
 
-      if (value_id == NULL_VALUE_ID) {
-        return ColumnIteratorValue<T>{T{}, true, chunk_offset_into_ref_column};
+    void increment() {
+      if (_row_ids) {
+        ++_index;
+        _chunk_offset = _index < _size ? (*_row_ids)[_index].chunk_offset : INVALID_CHUNK_OFFSET;
+      } else {
+        _chunk_offset = _single_chunk_pos_list->next_chunk_offset(_index, _chunk_offset);
+        ++_index;
       }
-
-      auto dictionary = column.dictionary();
-      const auto& value = (*dictionary)[value_id];
-
-      return ColumnIteratorValue<T>{value, false, chunk_offset_into_ref_column};
     }
 
-    auto _value_from_any_column(const BaseColumn& column, const ChunkOffset& chunk_offset) const {
-      const auto variant_value = column[chunk_offset];
-
-      const auto chunk_offset_into_ref_column =
-          static_cast<ChunkOffset>(std::distance(_begin_pos_list_it, _pos_list_it));
-
-      if (variant_is_null(variant_value)) {
-        return ColumnIteratorValue<T>{T{}, true, chunk_offset_into_ref_column};
-      }
+    bool equal(const SingleChunkIterator& other) const { return _index == other._index; }
 
-      return ColumnIteratorValue<T>{type_cast<T>(variant_value), false, chunk_offset_into_ref_column};
+    ColumnIteratorValue<T> dereference() const {
+      return _column.get(_chunk_offset, static_cast<ChunkOffset>(_index));
     }
 
    private:
-    const std::shared_ptr<const Table> _table;
-    const ColumnID _column_id;
+    ResolvedColumn _column;
 
-    const PosListIterator _begin_pos_list_it;
-    PosListIterator _pos_list_it;
+    // Either of the two is set
+    std::shared_ptr<const SingleChunkPosList> _single_chunk_pos_list;
+    std::shared_ptr<const PosList> _row_ids;
 
-    mutable std::map<ChunkID, std::shared_ptr<const ValueColumn<T>>> _value_columns;
-    mutable std::map<ChunkID, std::shared_ptr<const DeprecatedDictionaryColumn<T>>> _dictionary_columns;
+    size_t _size;
+    size_t _index;
+    ChunkOffset _chunk_offset;
   };
 };
 
@@ -0,0 +1,33 @@
+#include "row_id_pos_list.hpp"
+
+#include <algorithm>
+#include <memory>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+RowIDPosList::RowIDPosList(const std::shared_ptr<const PosList>& pos_list) : _pos_list(pos_list) {
+  DebugAssert(_pos_list, "RowIDPosList needs a PosList");
+}
+
+size_t RowIDPosList::size() const { return _pos_list->size(); }
+
+std::optional<ChunkID> RowIDPosList::single_chunk_id() const {
+  std::call_once(_single_chunk_id_flag, [&]() {
+    if (_pos_list->empty()) return;
+
+    const auto chunk_id = _pos_list->front().chunk_id;
+    const auto in_chunk = [&](const RowID& row_id) {
+      return row_id.chunk_id == chunk_id && row_id.chunk_offset != INVALID_CHUNK_OFFSET;
+    };
+    if (std::all_of(_pos_list->begin(), _pos_list->end(), in_chunk)) _single_chunk_id = chunk_id;
+  });
+  return _single_chunk_id;
+}
+
+size_t RowIDPosList::estimate_memory_usage() const { return sizeof(*this) + _pos_list->size() * sizeof(RowID); }
+
+std::shared_ptr<const PosList> RowIDPosList::_materialize() const { return _pos_list; }
+
+}  // namespace opossum
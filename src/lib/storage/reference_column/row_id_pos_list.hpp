@@ -0,0 +1,35 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <optional>
+
+#include "abstract_pos_list.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+// Positions stored as RowIDs, which may point into any chunk and may contain NULL_ROW_IDs
+class RowIDPosList : public AbstractPosList {
+ public:
+  explicit RowIDPosList(const std::shared_ptr<const PosList>& pos_list);
+
+  size_t size() const override;
+
+  RowID operator[](const size_t index) const override { return (*_pos_list)[index]; }
+
+  // The chunk all positions lie in, if they do and none of them is a NULL_ROW_ID. Determined on first use.
+  std::optional<ChunkID> single_chunk_id() const;
+
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  std::shared_ptr<const PosList> _materialize() const override;
+
+  const std::shared_ptr<const PosList> _pos_list;
+
+  mutable std::once_flag _single_chunk_id_flag;
+  mutable std::optional<ChunkID> _single_chunk_id;
+};
+
+}  // namespace opossum
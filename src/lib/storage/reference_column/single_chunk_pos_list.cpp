@@ -0,0 +1,109 @@
+#include "single_chunk_pos_list.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+std::vector<uint32_t> block_ranks(const std::vector<uint64_t>& bitmap, const size_t block_words) {
+  auto ranks = std::vector<uint32_t>{};
+  ranks.reserve((bitmap.size() + block_words - 1) / block_words);
+
+  auto rank = uint32_t{0};
+  for (auto word_idx = size_t{0}; word_idx < bitmap.size(); ++word_idx) {
+    if (word_idx % block_words == 0) ranks.emplace_back(rank);
+    rank += static_cast<uint32_t>(__builtin_popcountll(bitmap[word_idx]));
+  }
+  return ranks;
+}
+
+}  // namespace
+
+std::shared_ptr<SingleChunkPosList> SingleChunkPosList::create(const ChunkID chunk_id,
+                                                               std::vector<ChunkOffset> chunk_offsets) {
+  if (chunk_offsets.empty()) return std::make_shared<SingleChunkPosList>(chunk_id, ChunkOffset{0}, ChunkOffset{0});
+
+  const auto is_ascending =
+      std::adjacent_find(chunk_offsets.begin(), chunk_offsets.end(), std::greater_equal<ChunkOffset>{}) ==
+      chunk_offsets.end();
+
+  if (is_ascending) {
+    const auto begin = chunk_offsets.front();
+    const auto end = chunk_offsets.back() + 1;
+    if (end - begin == chunk_offsets.size()) return std::make_shared<SingleChunkPosList>(chunk_id, begin, end);
+
+    // A bitmap needs a bit per row up to the last position, a list of chunk offsets 32 bits per position
+    if (end <= chunk_offsets.size() * 32) {
+      auto bitmap = std::vector<uint64_t>((end + 63) / 64);
+      for (const auto chunk_offset : chunk_offsets) {
+        bitmap[chunk_offset / 64] |= uint64_t{1} << (chunk_offset % 64);
+      }
+      return std::make_shared<SingleChunkPosList>(chunk_id, std::move(bitmap), chunk_offsets.size());
+    }
+  }
+
+  return std::make_shared<SingleChunkPosList>(chunk_id, std::move(chunk_offsets));
+}
+
+SingleChunkPosList::SingleChunkPosList(const ChunkID chunk_id, std::vector<ChunkOffset> chunk_offsets)
+    : _chunk_id(chunk_id),
+      _type(SingleChunkPosListType::ChunkOffsets),
+      _size(chunk_offsets.size()),
+      _chunk_offsets(std::move(chunk_offsets)) {
+  DebugAssert(std::find(_chunk_offsets.begin(), _chunk_offsets.end(), INVALID_CHUNK_OFFSET) == _chunk_offsets.end(),
+              "SingleChunkPosList cannot contain NULL rows");
+}
+
+SingleChunkPosList::SingleChunkPosList(const ChunkID chunk_id, const ChunkOffset begin, const ChunkOffset end)
+    : _chunk_id(chunk_id), _type(SingleChunkPosListType::Range), _size(end - begin), _range_begin(begin) {
+  DebugAssert(begin <= end, "Invalid range");
+}
+
+SingleChunkPosList::SingleChunkPosList(const ChunkID chunk_id, std::vector<uint64_t> bitmap, const size_t size)
+    : _chunk_id(chunk_id),
+      _type(SingleChunkPosListType::Bitmap),
+      _size(size),
+      _bitmap(std::move(bitmap)),
+      _bitmap_block_ranks(block_ranks(_bitmap, BITMAP_BLOCK_WORDS)) {
+  DebugAssert(std::accumulate(_bitmap.begin(), _bitmap.end(), size_t{0},
+                              [](const auto sum, const auto word) { return sum + __builtin_popcountll(word); }) == size,
+              "Size does not match the number of set bits");
+}
+
+ChunkID SingleChunkPosList::chunk_id() const { return _chunk_id; }
+
+SingleChunkPosListType SingleChunkPosList::type() const { return _type; }
+
+size_t SingleChunkPosList::size() const { return _size; }
+
+std::vector<ChunkOffset> SingleChunkPosList::chunk_offsets() const {
+  if (_type == SingleChunkPosListType::ChunkOffsets) return _chunk_offsets;
+
+  auto chunk_offsets = std::vector<ChunkOffset>{};
+  chunk_offsets.reserve(_size);
+  for_each_chunk_offset([&](const ChunkOffset chunk_offset) { chunk_offsets.emplace_back(chunk_offset); });
+  return chunk_offsets;
+}
+
+size_t SingleChunkPosList::estimate_memory_usage() const {
+  return sizeof(*this) + _chunk_offsets.size() * sizeof(ChunkOffset) + _bitmap.size() * sizeof(uint64_t) +
+         _bitmap_block_ranks.size() * sizeof(uint32_t) + _row_ids_memory_usage();
+}
+
+std::shared_ptr<const PosList> SingleChunkPosList::_materialize() const {
+  auto pos_list = std::make_shared<PosList>();
+  pos_list->reserve(_size);
+  for_each_chunk_offset(
+      [&](const ChunkOffset chunk_offset) { pos_list->emplace_back(RowID{_chunk_id, chunk_offset}); });
+  return pos_list;
+}
+
+}  // namespace opossum
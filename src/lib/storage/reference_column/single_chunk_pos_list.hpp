@@ -0,0 +1,173 @@
+#pragma once
+
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "abstract_pos_list.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+enum class SingleChunkPosListType { ChunkOffsets, Range, Bitmap };
+
+/**
+ * Positions that all lie in one chunk of the referenced table, as produced by a TableScan on a stored table. Instead
+ * of 8-byte RowIDs, they are stored as either
+ *  - ChunkOffsets: a list of 4-byte chunk offsets in any order,
+ *  - Range: the contiguous chunk offsets [begin, end), or
+ *  - Bitmap: a bit per row of the chunk up to the last position, for ascending chunk offsets that make up a large
+ *    share of these rows.
+ * create() picks the most compact of these representations.
+ *
+ * NULL_ROW_IDs cannot be represented, positions that may contain them need to be stored in a RowIDPosList.
+ */
+class SingleChunkPosList : public AbstractPosList {
+ public:
+  static std::shared_ptr<SingleChunkPosList> create(const ChunkID chunk_id, std::vector<ChunkOffset> chunk_offsets);
+
+  // ChunkOffsets
+  SingleChunkPosList(const ChunkID chunk_id, std::vector<ChunkOffset> chunk_offsets);
+
+  // Range
+  SingleChunkPosList(const ChunkID chunk_id, const ChunkOffset begin, const ChunkOffset end);
+
+  // Bitmap, with bit i of word i / 64 being set if chunk offset i is contained
+  SingleChunkPosList(const ChunkID chunk_id, std::vector<uint64_t> bitmap, const size_t size);
+
+  ChunkID chunk_id() const;
+  SingleChunkPosListType type() const;
+
+  size_t size() const override;
+
+  RowID operator[](const size_t index) const override {
+    DebugAssert(index < _size, "Index exceeds the list.");
+
+    switch (_type) {
+      case SingleChunkPosListType::ChunkOffsets:
+        return RowID{_chunk_id, _chunk_offsets[index]};
+      case SingleChunkPosListType::Range:
+        return RowID{_chunk_id, static_cast<ChunkOffset>(_range_begin + index)};
+      case SingleChunkPosListType::Bitmap:
+        return RowID{_chunk_id, _select_set_bit(index)};
+    }
+    return NULL_ROW_ID;
+  }
+
+  // The chunk offset of the first position, the list must not be empty
+  ChunkOffset first_chunk_offset() const {
+    switch (_type) {
+      case SingleChunkPosListType::ChunkOffsets:
+        return _chunk_offsets.front();
+      case SingleChunkPosListType::Range:
+        return _range_begin;
+      case SingleChunkPosListType::Bitmap:
+        return _next_set_bit(0);
+    }
+    return INVALID_CHUNK_OFFSET;
+  }
+
+  // The chunk offset of the position following the index-th position, which is at chunk_offset. Cheaper than random
+  // access for bitmaps, so that iterators advance using this.
+  ChunkOffset next_chunk_offset(const size_t index, const ChunkOffset chunk_offset) const {
+    if (index + 1 >= _size) return INVALID_CHUNK_OFFSET;
+
+    switch (_type) {
+      case SingleChunkPosListType::ChunkOffsets:
+        return _chunk_offsets[index + 1];
+      case SingleChunkPosListType::Range:
+        return chunk_offset + 1;
+      case SingleChunkPosListType::Bitmap:
+        return _next_set_bit(chunk_offset + 1);
+    }
+    return INVALID_CHUNK_OFFSET;
+  }
+
+  // Calls functor(chunk_offset) for every position in order
+  template <typename Functor>
+  void for_each_chunk_offset(const Functor& functor) const {
+    for_each_chunk_offset(0, _size, functor);
+  }
+
+  // Calls functor(chunk_offset) for the positions [begin_index, end_index) in order
+  template <typename Functor>
+  void for_each_chunk_offset(const size_t begin_index, const size_t end_index, const Functor& functor) const {
+    DebugAssert(begin_index <= end_index && end_index <= _size, "Positions exceed the list.");
+
+    switch (_type) {
+      case SingleChunkPosListType::ChunkOffsets:
+        for (auto index = begin_index; index < end_index; ++index) functor(_chunk_offsets[index]);
+        break;
+
+      case SingleChunkPosListType::Range:
+        for (auto index = begin_index; index < end_index; ++index) {
+          functor(static_cast<ChunkOffset>(_range_begin + index));
+        }
+        break;
+
+      case SingleChunkPosListType::Bitmap: {
+        // Skip the words before the begin_index-th position by counting their set bits
+        auto index = size_t{0};
+        auto word_idx = size_t{0};
+        for (; word_idx < _bitmap.size(); ++word_idx) {
+          const auto bit_count = static_cast<size_t>(__builtin_popcountll(_bitmap[word_idx]));
+          if (index + bit_count > begin_index) break;
+          index += bit_count;
+        }
+
+        for (; word_idx < _bitmap.size() && index < end_index; ++word_idx) {
+          for (auto word = _bitmap[word_idx]; word != 0 && index < end_index; word &= word - 1, ++index) {
+            if (index >= begin_index) functor(static_cast<ChunkOffset>(word_idx * 64 + __builtin_ctzll(word)));
+          }
+        }
+        break;
+      }
+    }
+  }
+
+  std::vector<ChunkOffset> chunk_offsets() const;
+
+  size_t estimate_memory_usage() const override;
+
+ protected:
+  std::shared_ptr<const PosList> _materialize() const override;
+
+  // The chunk offset of the index-th set bit. The block ranks narrow it down to one block of BITMAP_BLOCK_WORDS words.
+  ChunkOffset _select_set_bit(const size_t index) const {
+    const auto block_it = std::upper_bound(_bitmap_block_ranks.begin(), _bitmap_block_ranks.end(), index) - 1;
+    auto rank = size_t{*block_it};
+    auto word_idx = static_cast<size_t>(block_it - _bitmap_block_ranks.begin()) * BITMAP_BLOCK_WORDS;
+
+    for (auto bit_count = static_cast<size_t>(__builtin_popcountll(_bitmap[word_idx])); rank + bit_count <= index;
+         bit_count = static_cast<size_t>(__builtin_popcountll(_bitmap[++word_idx]))) {
+      rank += bit_count;
+    }
+
+    auto word = _bitmap[word_idx];
+    for (; rank < index; ++rank) word &= word - 1;
+    return static_cast<ChunkOffset>(word_idx * 64 + __builtin_ctzll(word));
+  }
+
+  // The first chunk offset >= chunk_offset whose bit is set, which has to exist
+  ChunkOffset _next_set_bit(const ChunkOffset chunk_offset) const {
+    auto word_idx = size_t{chunk_offset / 64};
+    auto word = _bitmap[word_idx] & (~uint64_t{0} << (chunk_offset % 64));
+    while (word == 0) word = _bitmap[++word_idx];
+    return static_cast<ChunkOffset>(word_idx * 64 + __builtin_ctzll(word));
+  }
+
+  const ChunkID _chunk_id;
+  const SingleChunkPosListType _type;
+  const size_t _size;
+
+  const std::vector<ChunkOffset> _chunk_offsets;
+  const ChunkOffset _range_begin{0};
+  const std::vector<uint64_t> _bitmap;
+
+  // For bitmaps, the number of set bits in front of every block of BITMAP_BLOCK_WORDS words, used by operator[]
+  static constexpr size_t BITMAP_BLOCK_WORDS = 8;
+  const std::vector<uint32_t> _bitmap_block_ranks;
+};
+
+}  // namespace opossum
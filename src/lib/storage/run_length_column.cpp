@@ -30,6 +30,30 @@ std::shared_ptr<const pmr_vector<ChunkOffset>> RunLengthColumn<T>::end_positions
   return _end_positions;
 }
 
+template <typename T>
+void RunLengthColumn<T>::decode_block(const ChunkOffset begin, const size_t count, T* values,
+                                      bool* null_values) const {
+  DebugAssert(begin + count <= size(), "Block exceeds the column.");
+
+  if (count == 0u) return;
+
+  // Only the first run needs to be searched for, all following runs are expanded one after another
+  const auto first_run_it = std::lower_bound(_end_positions->cbegin(), _end_positions->cend(), begin);
+  auto run_index = static_cast<size_t>(std::distance(_end_positions->cbegin(), first_run_it));
+
+  auto index = size_t{0u};
+  while (index < count) {
+    const auto run_end = static_cast<size_t>((*_end_positions)[run_index]) + 1u;
+    const auto run_length = std::min(run_end - begin - index, count - index);
+
+    std::fill_n(values + index, run_length, (*_values)[run_index]);
+    std::fill_n(null_values + index, run_length, static_cast<bool>((*_null_values)[run_index]));
+
+    index += run_length;
+    ++run_index;
+  }
+}
+
 template <typename T>
 const AllTypeVariant RunLengthColumn<T>::operator[](const ChunkOffset chunk_offset) const {
   PerformanceWarning("operator[] used");
@@ -37,6 +37,9 @@ class RunLengthColumn : public BaseEncodedColumn {
   std::shared_ptr<const pmr_vector<bool>> null_values() const;
   std::shared_ptr<const pmr_vector<ChunkOffset>> end_positions() const;
 
+  // Expands the runs covering the rows [begin, begin + count) into the given buffers, see ValueColumn::decode_block
+  void decode_block(const ChunkOffset begin, const size_t count, T* values, bool* null_values) const;
+
   /**
    * @defgroup BaseColumn interface
    * @{
@@ -5,9 +5,11 @@
 #include <memory>
 #include <numeric>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
+#include "base_encoded_column.hpp"
 #include "resolve_type.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -47,8 +49,7 @@ bool Table::layouts_equal(const std::shared_ptr<const Table>& left, const std::s
   return true;
 }
 
-Table::Table(const uint32_t max_chunk_size)
-    : _max_chunk_size(max_chunk_size), _append_mutex(std::make_unique<std::mutex>()) {
+Table::Table(const uint32_t max_chunk_size) : _max_chunk_size(max_chunk_size) {
   Assert(max_chunk_size > 0, "Table must have a chunk size greater than 0.");
   _chunks.push_back(std::make_shared<Chunk>(UseMvcc::Yes));
 }
@@ -64,16 +65,41 @@ void Table::add_column_definition(const std::string& name, DataType data_type, b
 void Table::add_column(const std::string& name, DataType data_type, bool nullable) {
   add_column_definition(name, data_type, nullable);
 
-  for (auto& chunk : _chunks) {
-    chunk->add_column(make_shared_by_data_type<BaseColumn, ValueColumn>(data_type, nullable));
+  const auto chunk_count = this->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    get_chunk(chunk_id)->add_column(make_shared_by_data_type<BaseColumn, ValueColumn>(data_type, nullable));
   }
 }
 
 void Table::append(std::vector<AllTypeVariant> values) {
   // TODO(Anyone): Chunks should be preallocated for chunk size
-  if (_chunks.back()->size() == _max_chunk_size) create_new_chunk();
+  auto tail_chunk_id = this->tail_chunk_id();
+  if (get_chunk(tail_chunk_id)->size() == _max_chunk_size) tail_chunk_id = append_tail_chunk(tail_chunk_id);
 
-  _chunks.back()->append(values);
+  get_chunk(tail_chunk_id)->append(values);
+}
+
+void Table::append_rows(const std::vector<std::shared_ptr<const BaseColumn>>& columns, const CommitID begin_cid) {
+  Assert(columns.size() == column_count(), "Number of columns does not match the table's column count.");
+
+  const auto row_count = columns.empty() ? size_t{0u} : columns.front()->size();
+
+  for (auto offset = size_t{0u}; offset < row_count;) {
+    const auto tail_chunk_id = this->tail_chunk_id();
+    const auto chunk = get_chunk(tail_chunk_id);
+
+    // Like Insert, append a new chunk if the last one is full or encoded and thus immutable
+    if (chunk->size() == _max_chunk_size ||
+        std::dynamic_pointer_cast<const BaseEncodedColumn>(chunk->get_column(ColumnID{0})) != nullptr) {
+      append_tail_chunk(tail_chunk_id);
+      continue;
+    }
+
+    const auto chunk_row_count = std::min(static_cast<size_t>(_max_chunk_size - chunk->size()), row_count - offset);
+
+    chunk->append_rows(columns, static_cast<ChunkOffset>(offset), chunk_row_count, begin_cid);
+    offset += chunk_row_count;
+  }
 }
 
 void Table::create_new_chunk() {
@@ -86,20 +112,59 @@ void Table::create_new_chunk() {
 
     new_chunk->add_column(make_shared_by_data_type<BaseColumn, ValueColumn>(type, nullable));
   }
-  _chunks.push_back(std::move(new_chunk));
+  const auto new_chunk_it = _chunks.push_back(std::move(new_chunk));
+  const auto new_chunk_id = static_cast<ChunkID::base_type>(new_chunk_it - _chunks.begin());
+
+  // Readers only access chunks up to _tail_chunk_id, so the chunk becomes visible to them only now, once it is
+  // completely constructed
+  _claimed_tail_chunk_id.store(new_chunk_id);
+  _tail_chunk_id.store(new_chunk_id, std::memory_order_release);
+}
+
+ChunkID Table::tail_chunk_id() const { return ChunkID{_tail_chunk_id.load(std::memory_order_acquire)}; }
+
+ChunkID Table::append_tail_chunk(const ChunkID expected_tail_chunk_id) {
+  auto expected = static_cast<ChunkID::base_type>(expected_tail_chunk_id);
+
+  if (_claimed_tail_chunk_id.compare_exchange_strong(expected, expected + 1u)) {
+    // Only one thread can claim the next chunk, and it can only be claimed once its predecessor has been published.
+    // Thus, the new chunk is guaranteed to end up at index expected + 1. create_new_chunk() publishes it.
+    create_new_chunk();
+    return ChunkID{expected + 1u};
+  }
+
+  // Another thread is creating (or has created) the chunk, wait until it is published
+  while (_tail_chunk_id.load(std::memory_order_acquire) == static_cast<ChunkID::base_type>(expected_tail_chunk_id)) {
+    std::this_thread::yield();
+  }
+
+  return tail_chunk_id();
+}
+
+CommitID Table::last_modified_commit_id() const { return _last_modified_commit_id.load(std::memory_order_acquire); }
+
+void Table::update_last_modified_commit_id(const CommitID commit_id) {
+  // Transactions commit their records concurrently, so the commit id is only ever raised
+  auto last_modified_commit_id = _last_modified_commit_id.load();
+  while (last_modified_commit_id < commit_id &&
+         !_last_modified_commit_id.compare_exchange_weak(last_modified_commit_id, commit_id)) {
+  }
 }
 
 uint16_t Table::column_count() const { return _column_types.size(); }
 
 uint64_t Table::row_count() const {
   uint64_t ret = 0;
-  for (const auto& chunk : _chunks) {
-    ret += chunk->size();
+  const auto chunk_count = this->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    ret += get_chunk(chunk_id)->size();
   }
   return ret;
 }
 
-ChunkID Table::chunk_count() const { return static_cast<ChunkID>(_chunks.size()); }
+// _chunks.size() can already include a chunk that append_tail_chunk() is still constructing, so the number of chunks
+// is derived from the last published one
+ChunkID Table::chunk_count() const { return ChunkID{_tail_chunk_id.load(std::memory_order_acquire) + 1u}; }
 
 ColumnID Table::column_id_by_name(const std::string& column_name) const {
   for (ColumnID column_id{0}; column_id < column_count(); ++column_id) {
@@ -135,45 +200,50 @@ const std::vector<DataType>& Table::column_types() const { return _column_types;
 const std::vector<bool>& Table::column_nullables() const { return _column_nullable; }
 
 std::shared_ptr<Chunk> Table::get_chunk(ChunkID chunk_id) {
-  DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
-  return _chunks[chunk_id];
+  DebugAssert(chunk_id < chunk_count(), "ChunkID " + std::to_string(chunk_id) + " out of range");
+  return std::atomic_load(&_chunks[chunk_id]);
 }
 
 std::shared_ptr<const Chunk> Table::get_chunk(ChunkID chunk_id) const {
-  DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
-  return _chunks[chunk_id];
+  DebugAssert(chunk_id < chunk_count(), "ChunkID " + std::to_string(chunk_id) + " out of range");
+  return std::atomic_load(&_chunks[chunk_id]);
 }
 
 ProxyChunk Table::get_chunk_with_access_counting(ChunkID chunk_id) {
-  DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
-  return ProxyChunk(_chunks[chunk_id]);
+  DebugAssert(chunk_id < chunk_count(), "ChunkID " + std::to_string(chunk_id) + " out of range");
+  return ProxyChunk(get_chunk(chunk_id));
 }
 
 const ProxyChunk Table::get_chunk_with_access_counting(ChunkID chunk_id) const {
-  DebugAssert(chunk_id < _chunks.size(), "ChunkID " + std::to_string(chunk_id) + " out of range");
-  return ProxyChunk(_chunks[chunk_id]);
+  DebugAssert(chunk_id < chunk_count(), "ChunkID " + std::to_string(chunk_id) + " out of range");
+  return ProxyChunk(std::atomic_load(&_chunks[chunk_id]));
 }
 
 void Table::emplace_chunk(const std::shared_ptr<Chunk>& chunk) {
-  if (_chunks.size() == 1 && (_chunks.back()->column_count() == 0 || _chunks.back()->size() == 0)) {
-    // the initial chunk was not used yet
-    _chunks.clear();
-  }
   DebugAssert(chunk->column_count() > 0, "Trying to add chunk without columns.");
   DebugAssert(chunk->column_count() == column_count(),
               std::string("adding chunk with ") + std::to_string(chunk->column_count()) + " columns to table with " +
                   std::to_string(column_count()) + " columns");
-  _chunks.emplace_back(chunk);
-}
 
-std::unique_lock<std::mutex> Table::acquire_append_mutex() { return std::unique_lock<std::mutex>(*_append_mutex); }
+  const auto first_chunk = get_chunk(ChunkID{0});
+  if (chunk_count() == 1 && (first_chunk->column_count() == 0 || first_chunk->size() == 0)) {
+    // The initial chunk was not used yet and is replaced. Other threads might read the slot concurrently, so it is
+    // written atomically, and readers that already hold the old chunk keep it alive.
+    std::atomic_store(&_chunks[0], chunk);
+    return;
+  }
+
+  const auto new_chunk_id = static_cast<ChunkID::base_type>(_chunks.push_back(chunk) - _chunks.begin());
+  _claimed_tail_chunk_id.store(new_chunk_id);
+  _tail_chunk_id.store(new_chunk_id, std::memory_order_release);
+}
 
 TableType Table::get_type() const {
   // Cannot answer this if the table has no content
-  Assert(!_chunks.empty() && column_count() > 0, "Table has no content, can't specify type");
+  Assert(column_count() > 0, "Table has no content, can't specify type");
 
   // We assume if one column is a reference column, all are.
-  const auto column = _chunks[0]->get_column(ColumnID{0});
+  const auto column = get_chunk(ChunkID{0})->get_column(ColumnID{0});
   const auto ref_column = std::dynamic_pointer_cast<const ReferenceColumn>(column);
 
   if (ref_column != nullptr) {
@@ -181,7 +251,7 @@ TableType Table::get_type() const {
 #if IS_DEBUG
     for (auto chunk_idx = ChunkID{0}; chunk_idx < chunk_count(); ++chunk_idx) {
       for (auto column_idx = ColumnID{0}; column_idx < column_count(); ++column_idx) {
-        const auto column2 = _chunks[chunk_idx]->get_column(ColumnID{column_idx});
+        const auto column2 = get_chunk(chunk_idx)->get_column(ColumnID{column_idx});
         const auto ref_column2 = std::dynamic_pointer_cast<const ReferenceColumn>(column);
         DebugAssert(ref_column2 != nullptr, "Invalid table: Contains Reference and Non-Reference Columns");
       }
@@ -193,7 +263,7 @@ TableType Table::get_type() const {
 #if IS_DEBUG
     for (auto chunk_idx = ChunkID{0}; chunk_idx < chunk_count(); ++chunk_idx) {
       for (auto column_idx = ColumnID{0}; column_idx < column_count(); ++column_idx) {
-        const auto column2 = _chunks[chunk_idx]->get_column(ColumnID{column_idx});
+        const auto column2 = get_chunk(chunk_idx)->get_column(ColumnID{column_idx});
         const auto ref_column2 = std::dynamic_pointer_cast<const ReferenceColumn>(column);
         DebugAssert(ref_column2 == nullptr, "Invalid table: Contains Reference and Non-Reference Columns");
       }
@@ -208,8 +278,9 @@ std::vector<IndexInfo> Table::get_indexes() const { return _indexes; }
 size_t Table::estimate_memory_usage() const {
   auto bytes = size_t{sizeof(*this)};
 
-  for (const auto& chunk : _chunks) {
-    bytes += chunk->estimate_memory_usage();
+  const auto chunk_count = this->chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    bytes += get_chunk(chunk_id)->estimate_memory_usage();
   }
 
   for (const auto& column_name : _column_names) {
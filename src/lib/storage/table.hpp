@@ -1,7 +1,6 @@
 #pragma once
 
 #include <memory>
-#include <mutex>
 #include <string>
 #include <utility>
 #include <vector>
@@ -13,6 +12,7 @@
 #include "type_cast.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
+#include "utils/copyable_atomic.hpp"
 #include "utils/performance_warning.hpp"
 
 namespace opossum {
@@ -97,6 +97,11 @@ class Table : private Noncopyable {
   // note this is slow and not thread-safe and should be used for testing purposes only
   void append(std::vector<AllTypeVariant> values);
 
+  // Appends all rows of the given columns (one per column of the table), creating new chunks as needed, e.g., if the
+  // last chunk is encoded. See Chunk::append_rows(). Not thread-safe.
+  void append_rows(const std::vector<std::shared_ptr<const BaseColumn>>& columns,
+                   const CommitID begin_cid = Chunk::MAX_COMMIT_ID);
+
   // returns one materialized value
   // multiversion concurrency control values of chunks are ignored
   // - table needs to be validated before by Validate operator
@@ -108,7 +113,9 @@ class Table : private Noncopyable {
     Assert(column_id < column_count(), "column_id invalid");
 
     size_t row_counter = 0u;
-    for (auto& chunk : _chunks) {
+    const auto chunk_count = this->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = get_chunk(chunk_id);
       size_t current_size = chunk->size();
       row_counter += current_size;
       if (row_counter > row_number) {
@@ -121,7 +128,24 @@ class Table : private Noncopyable {
   // creates a new chunk and appends it
   void create_new_chunk();
 
-  std::unique_lock<std::mutex> acquire_append_mutex();
+  // returns the ID of the last chunk, can be called concurrently with append_tail_chunk()
+  ChunkID tail_chunk_id() const;
+
+  /**
+   * Appends a new (empty, mutable) chunk, but only if the chunk with expected_tail_chunk_id is still the last one.
+   * This is used by concurrent inserts when the last chunk is full or immutable: exactly one of them wins the
+   * compare-and-swap and creates the chunk, the others wait until it is published and then use it as well.
+   *
+   * @return the ID of the new last chunk
+   */
+  ChunkID append_tail_chunk(const ChunkID expected_tail_chunk_id);
+
+  /**
+   * Commit id of the last transaction that inserted or deleted rows of this table. Insert and Delete raise it while
+   * committing, i.e., before the commit becomes visible to other transactions. Used to invalidate cached query results.
+   */
+  CommitID last_modified_commit_id() const;
+  void update_last_modified_commit_id(const CommitID commit_id);
 
   void set_table_statistics(std::shared_ptr<TableStatistics> table_statistics) { _table_statistics = table_statistics; }
 
@@ -141,8 +165,9 @@ class Table : private Noncopyable {
   void create_index(const std::vector<ColumnID>& column_ids, const std::string& name = "") {
     ColumnIndexType index_type = get_index_type_of<Index>();
 
-    for (auto& chunk : _chunks) {
-      chunk->create_index<Index>(column_ids);
+    const auto chunk_count = this->chunk_count();
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      get_chunk(chunk_id)->create_index<Index>(column_ids);
     }
     IndexInfo i = {column_ids, name, index_type};
     _indexes.emplace_back(i);
@@ -155,7 +180,18 @@ class Table : private Noncopyable {
 
  protected:
   const uint32_t _max_chunk_size;
-  std::vector<std::shared_ptr<Chunk>> _chunks;
+
+  // A concurrent vector, so that inserts can append chunks while other operators access the existing ones. Its size
+  // can include a chunk that is still being constructed, so all accesses are bounded by chunk_count(). As
+  // emplace_chunk() can replace the initial chunk, the slots are read via get_chunk(), which loads them atomically.
+  pmr_concurrent_vector<std::shared_ptr<Chunk>> _chunks;
+
+  // _claimed_tail_chunk_id is advanced by the winner of the compare-and-swap in append_tail_chunk(),
+  // _tail_chunk_id once the new chunk has been added to _chunks
+  copyable_atomic<ChunkID::base_type> _tail_chunk_id{0u};
+  copyable_atomic<ChunkID::base_type> _claimed_tail_chunk_id{0u};
+
+  copyable_atomic<CommitID> _last_modified_commit_id{0u};
 
   // these should be const strings, but having a vector of const values is a C++17 feature
   // that is not yet completely implemented in all compilers
@@ -165,8 +201,6 @@ class Table : private Noncopyable {
 
   std::shared_ptr<TableStatistics> _table_statistics;
 
-  std::unique_ptr<std::mutex> _append_mutex;
-
   std::vector<IndexInfo> _indexes;
 };
 }  // namespace opossum
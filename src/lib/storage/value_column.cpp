@@ -1,5 +1,7 @@
 #include "value_column.hpp"
 
+#include <algorithm>
+#include <functional>
 #include <limits>
 #include <memory>
 #include <sstream>
@@ -8,6 +10,10 @@
 #include <vector>
 
 #include "column_visitable.hpp"
+#include "deprecated_dictionary_column.hpp"
+#include "dictionary_column.hpp"
+#include "reference_column.hpp"
+#include "run_length_column.hpp"
 #include "type_cast.hpp"
 #include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
@@ -93,6 +99,95 @@ void ValueColumn<std::string>::append(const AllTypeVariant& val) {
   _values.push_back(typed_val);
 }
 
+template <typename T>
+void ValueColumn<T>::copy_values(const BaseColumn& source, const ChunkOffset source_begin, const size_t count,
+                                 const ChunkOffset target_begin) {
+  DebugAssert(source_begin + count <= source.size(), "Source range exceeds the source column.");
+  DebugAssert(target_begin + count <= _values.size(), "Target range exceeds the column.");
+
+  const auto assert_not_null = [](const auto null_values_begin, const size_t null_values_count) {
+    const auto is_null = [](const bool null_value) { return null_value; };
+    Assert(std::none_of(null_values_begin, null_values_begin + null_values_count, is_null),
+           "Cannot insert NULL into a column that is not nullable.");
+  };
+
+  if (const auto value_column = dynamic_cast<const ValueColumn<T>*>(&source)) {
+    std::copy_n(value_column->values().cbegin() + source_begin, count, _values.begin() + target_begin);
+
+    if (value_column->is_nullable()) {
+      const auto source_null_values_begin = value_column->null_values().cbegin() + source_begin;
+
+      if (is_nullable()) {
+        std::copy_n(source_null_values_begin, count, _null_values->begin() + target_begin);
+      } else {
+        assert_not_null(source_null_values_begin, count);
+      }
+    } else if (is_nullable()) {
+      std::fill_n(_null_values->begin() + target_begin, count, false);
+    }
+
+    return;
+  }
+
+  // All other columns are decoded block by block, so that the values never have to be wrapped in AllTypeVariants
+  auto decode_block = std::function<void(const ChunkOffset, const size_t, T*, bool*)>{};
+
+  if (const auto dictionary_column = dynamic_cast<const DictionaryColumn<T>*>(&source)) {
+    decode_block = [&](const ChunkOffset begin, const size_t block_count, T* values, bool* null_values) {
+      dictionary_column->decode_block(begin, block_count, values, null_values);
+    };
+  } else if (const auto deprecated_dictionary_column = dynamic_cast<const DeprecatedDictionaryColumn<T>*>(&source)) {
+    decode_block = [&](const ChunkOffset begin, const size_t block_count, T* values, bool* null_values) {
+      deprecated_dictionary_column->decode_block(begin, block_count, values, null_values);
+    };
+  } else if (const auto run_length_column = dynamic_cast<const RunLengthColumn<T>*>(&source)) {
+    decode_block = [&](const ChunkOffset begin, const size_t block_count, T* values, bool* null_values) {
+      run_length_column->decode_block(begin, block_count, values, null_values);
+    };
+  } else if (const auto reference_column = dynamic_cast<const ReferenceColumn*>(&source)) {
+    decode_block = [&](const ChunkOffset begin, const size_t block_count, T* values, bool* null_values) {
+      reference_column->decode_block<T>(begin, block_count, values, null_values);
+    };
+  } else {
+    // Columns of a different data type (e.g., the NULL-only dummy column used by Insert) are accessed via operator[]
+    decode_block = [&](const ChunkOffset begin, const size_t block_count, T* values, bool* null_values) {
+      for (auto index = size_t{0u}; index < block_count; ++index) {
+        const auto value = source[begin + index];
+        null_values[index] = variant_is_null(value);
+        values[index] = null_values[index] ? T{} : type_cast<T>(value);
+      }
+    };
+  }
+
+  constexpr auto block_size = size_t{4'096u};
+
+  auto values = std::vector<T>(std::min(count, block_size));
+  auto null_values = std::unique_ptr<bool[]>(new bool[values.size()]);
+
+  for (auto offset = size_t{0u}; offset < count; offset += block_size) {
+    const auto block_count = std::min(block_size, count - offset);
+    decode_block(source_begin + offset, block_count, values.data(), null_values.get());
+
+    std::move(values.begin(), values.begin() + block_count, _values.begin() + target_begin + offset);
+
+    if (is_nullable()) {
+      std::copy_n(null_values.get(), block_count, _null_values->begin() + target_begin + offset);
+    } else {
+      assert_not_null(null_values.get(), block_count);
+    }
+  }
+}
+
+template <typename T>
+void ValueColumn<T>::append_values(const BaseColumn& source, const ChunkOffset source_begin, const size_t count) {
+  const auto target_begin = static_cast<ChunkOffset>(_values.size());
+
+  _values.grow_by(count);
+  if (is_nullable()) _null_values->grow_by(count);
+
+  copy_values(source, source_begin, count, target_begin);
+}
+
 template <typename T>
 const pmr_concurrent_vector<T>& ValueColumn<T>::values() const {
   return _values;
@@ -115,6 +210,19 @@ const pmr_concurrent_vector<std::optional<T>> ValueColumn<T>::materialize_values
   return values;
 }
 
+template <typename T>
+void ValueColumn<T>::decode_block(const ChunkOffset begin, const size_t count, T* values, bool* null_values) const {
+  DebugAssert(begin + count <= _values.size(), "Block exceeds the column.");
+
+  std::copy_n(_values.cbegin() + begin, count, values);
+
+  if (is_nullable()) {
+    std::copy_n(_null_values->cbegin() + begin, count, null_values);
+  } else {
+    std::fill_n(null_values, count, false);
+  }
+}
+
 template <typename T>
 bool ValueColumn<T>::is_nullable() const {
   return static_cast<bool>(_null_values);
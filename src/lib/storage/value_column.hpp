@@ -35,6 +35,11 @@ class ValueColumn : public BaseValueColumn {
   // Add a value to the end of the column.
   void append(const AllTypeVariant& val) final;
 
+  // Copy or append a range of rows of another column, see BaseValueColumn
+  void copy_values(const BaseColumn& source, const ChunkOffset source_begin, const size_t count,
+                   const ChunkOffset target_begin) final;
+  void append_values(const BaseColumn& source, const ChunkOffset source_begin, const size_t count) final;
+
   // Return all values. This is the preferred method to check a value at a certain index. Usually you need to
   // access more than a single value anyway.
   // e.g. auto& values = col.values(); and then: values.at(i); in your loop.
@@ -44,6 +49,11 @@ class ValueColumn : public BaseValueColumn {
   // return a generated vector of all values (or nulls)
   const pmr_concurrent_vector<std::optional<T>> materialize_values() const;
 
+  // Copies the values of the rows [begin, begin + count) into the given buffers, which must be large enough to hold
+  // count elements each. NULLs are written as T{} and flagged in null_values.
+  // Use this instead of iterables if you want to process values in tight, vectorizable loops.
+  void decode_block(const ChunkOffset begin, const size_t count, T* values, bool* null_values) const;
+
   // Return whether column supports null values.
   bool is_nullable() const final;
 
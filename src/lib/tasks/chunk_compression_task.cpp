@@ -1,5 +1,6 @@
 #include "chunk_compression_task.hpp"
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -19,6 +20,14 @@ ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const
 ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids)
     : _table_name{table_name}, _chunk_ids{chunk_ids} {}
 
+ChunkCompressionTask::ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                                           const EncodingAdvisorConfig& advisor_config)
+    : _table_name{table_name}, _chunk_ids{chunk_ids}, _encoding_advisor{EncodingAdvisor{advisor_config}} {}
+
+const std::map<ChunkID, ChunkEncodingDecision>& ChunkCompressionTask::encoding_decisions() const {
+  return _encoding_decisions;
+}
+
 void ChunkCompressionTask::_on_execute() {
   auto table = StorageManager::get().get_table(_table_name);
 
@@ -32,7 +41,13 @@ void ChunkCompressionTask::_on_execute() {
     DebugAssert(chunk_is_completed(chunk, table->max_chunk_size()),
                 "Chunk is not completed and thus can’t be compressed.");
 
-    ChunkEncoder::encode_chunk(chunk, table->column_types());
+    if (_encoding_advisor) {
+      const auto chunk_decision = _encoding_advisor->advise_chunk(chunk, table->column_types());
+      ChunkEncoder::encode_chunk(chunk, table->column_types(), EncodingAdvisor::encoding_spec(chunk_decision));
+      _encoding_decisions[chunk_id] = chunk_decision;
+    } else {
+      ChunkEncoder::encode_chunk(chunk, table->column_types());
+    }
   }
 }
 
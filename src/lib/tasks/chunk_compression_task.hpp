@@ -1,9 +1,12 @@
 #pragma once
 
+#include <map>
+#include <optional>
 #include <string>
 #include <vector>
 
 #include "scheduler/abstract_task.hpp"
+#include "storage/encoding_advisor.hpp"
 
 namespace opossum {
 
@@ -31,6 +34,10 @@ class Chunk;
  * in order to reduce fragmentation of the MVCC columns. The MVCC columns are locked
  * exclusively during this step.
  *
+ * If the task is given an EncodingAdvisorConfig, the encoding of each column is chosen
+ * by an EncodingAdvisor based on a sample of the chunk’s data instead of using the default
+ * encoding. The decisions are kept and can be inspected via encoding_decisions().
+ *
  * Note: Reference columns are not invalidated by this task because the order in which
  *       records are stored does not change.
  */
@@ -38,6 +45,15 @@ class ChunkCompressionTask : public AbstractTask {
  public:
   explicit ChunkCompressionTask(const std::string& table_name, const ChunkID chunk_id);
   explicit ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids);
+  explicit ChunkCompressionTask(const std::string& table_name, const std::vector<ChunkID>& chunk_ids,
+                                const EncodingAdvisorConfig& advisor_config);
+
+  /**
+   * @brief Returns the encodings chosen by the EncodingAdvisor for each compressed chunk
+   *
+   * Empty if the task was created without an EncodingAdvisorConfig or has not been executed yet.
+   */
+  const std::map<ChunkID, ChunkEncodingDecision>& encoding_decisions() const;
 
  protected:
   void _on_execute() override;
@@ -53,5 +69,7 @@ class ChunkCompressionTask : public AbstractTask {
  private:
   const std::string _table_name;
   const std::vector<ChunkID> _chunk_ids;
+  const std::optional<EncodingAdvisor> _encoding_advisor;
+  std::map<ChunkID, ChunkEncodingDecision> _encoding_decisions;
 };
 }  // namespace opossum
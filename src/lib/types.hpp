@@ -231,6 +231,8 @@ enum class JoinMode { Inner, Left, Right, Outer, Cross, Natural, Self, Semi, Ant
 
 enum class UnionMode { Positions };
 
+enum class SetOperationMode { Union, Intersect, Except };
+
 enum class AggregateFunction { Min, Max, Sum, Avg, Count, CountDistinct };
 
 enum class OrderByMode { Ascending, Descending, AscendingNullsLast, DescendingNullsLast };
@@ -0,0 +1,46 @@
+#include "arena_memory_resource.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+ArenaMemoryResource::ArenaMemoryResource(const size_t buffer_size) : _buffer(buffer_size) {}
+
+ArenaMemoryResource::~ArenaMemoryResource() { release(); }
+
+void ArenaMemoryResource::release() {
+  for (const auto pointer : _overflow_allocations) {
+    std::free(pointer);
+  }
+  _overflow_allocations.clear();
+  _offset = 0;
+}
+
+void* ArenaMemoryResource::do_allocate(std::size_t bytes, std::size_t alignment) {
+  const auto buffer_begin = reinterpret_cast<uintptr_t>(_buffer.data());
+  const auto aligned_offset = ((buffer_begin + _offset + alignment - 1) & ~(alignment - 1)) - buffer_begin;
+
+  if (aligned_offset + bytes <= _buffer.size()) {
+    _offset = aligned_offset + bytes;
+    return _buffer.data() + aligned_offset;
+  }
+
+  // malloc aligns its memory for all fundamental types
+  DebugAssert(alignment <= alignof(std::max_align_t), "Over-aligned types are not supported");
+  const auto pointer = std::malloc(bytes);
+  if (!pointer) throw std::bad_alloc();
+  _overflow_allocations.emplace_back(pointer);
+  return pointer;
+}
+
+void ArenaMemoryResource::do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) {}
+
+bool ArenaMemoryResource::do_is_equal(const boost::container::pmr::memory_resource& other) const noexcept {
+  return &other == this;
+}
+
+}  // namespace opossum
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <boost/container/pmr/memory_resource.hpp>
+
+#include <cstddef>
+#include <vector>
+
+namespace opossum {
+
+/**
+ * Memory resource for short-lived intermediate results. It hands out memory from a buffer by bumping an offset and
+ * frees everything at once in release(), so that a sequence of allocations that is repeated, e.g., once per block of
+ * rows, reuses the same memory without calling malloc. Deallocating single allocations has no effect.
+ *
+ * Allocations that do not fit into the remaining buffer are served by malloc and freed on release(), too.
+ * Not thread-safe.
+ */
+class ArenaMemoryResource : public boost::container::pmr::memory_resource {
+ public:
+  explicit ArenaMemoryResource(const size_t buffer_size);
+  ~ArenaMemoryResource() override;
+
+  ArenaMemoryResource(const ArenaMemoryResource&) = delete;
+  ArenaMemoryResource& operator=(const ArenaMemoryResource&) = delete;
+
+  // Invalidates all memory handed out so far
+  void release();
+
+ protected:
+  void* do_allocate(std::size_t bytes, std::size_t alignment) override;
+  void do_deallocate(void* pointer, std::size_t bytes, std::size_t alignment) override;
+  bool do_is_equal(const boost::container::pmr::memory_resource& other) const noexcept override;
+
+  std::vector<char> _buffer;
+  size_t _offset = 0;
+  std::vector<void*> _overflow_allocations;
+};
+
+}  // namespace opossum
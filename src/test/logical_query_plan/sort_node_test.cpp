@@ -74,6 +74,13 @@ TEST_F(SortNodeTest, ShallowEquals) {
   EXPECT_TRUE(other_sort_node_a->shallow_equals(*_sort_node));
   EXPECT_FALSE(other_sort_node_b->shallow_equals(*_sort_node));
   EXPECT_FALSE(other_sort_node_c->shallow_equals(*_sort_node));
+
+  other_sort_node_a->set_top_k(10);
+  EXPECT_FALSE(other_sort_node_a->shallow_equals(*_sort_node));
+  _sort_node->set_top_k(10);
+  EXPECT_TRUE(other_sort_node_a->shallow_equals(*_sort_node));
+  _sort_node->set_top_k(20);
+  EXPECT_FALSE(other_sort_node_a->shallow_equals(*_sort_node));
 }
 
 }  // namespace opossum
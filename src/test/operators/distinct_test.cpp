@@ -0,0 +1,103 @@
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/distinct.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/union_all.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsDistinctTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(3);
+    _table->add_column("a", DataType::Int, true);
+    _table->add_column("b", DataType::String);
+    _table->add_column("c", DataType::Float);
+    _table->append({1, "hyrise", 0.5f});
+    _table->append({NullValue{}, "hyrise", 0.5f});
+    _table->append({1, "hyrise", 0.5f});
+    _table->append({2, "hyrise", 0.0f});
+    _table->append({NullValue{}, "hyrise", 0.5f});
+    _table->append({2, "hyrise", -0.0f});
+    _table->append({1, "opossum", 0.5f});
+    ChunkEncoder::encode_chunks(_table, {ChunkID{1}});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsDistinctTest, RemovesDuplicatesAndKeepsOrder) {
+  auto distinct = std::make_shared<Distinct>(_table_wrapper);
+  distinct->execute();
+
+  // NULLs are equal to each other, and so are 0.0 and -0.0
+  auto expected_result = std::make_shared<Table>();
+  expected_result->add_column("a", DataType::Int, true);
+  expected_result->add_column("b", DataType::String);
+  expected_result->add_column("c", DataType::Float);
+  expected_result->append({1, "hyrise", 0.5f});
+  expected_result->append({NullValue{}, "hyrise", 0.5f});
+  expected_result->append({2, "hyrise", 0.0f});
+  expected_result->append({1, "opossum", 0.5f});
+
+  EXPECT_TABLE_EQ_ORDERED(distinct->get_output(), expected_result);
+
+  const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(
+      distinct->get_output()->get_chunk(ChunkID{0})->get_column(ColumnID{1}));
+  ASSERT_TRUE(reference_column);
+  EXPECT_EQ(reference_column->referenced_table(), _table);
+}
+
+TEST_F(OperatorsDistinctTest, MixedInput) {
+  // The output of UnionAll consists of stored and referenced chunks, so that Distinct materializes its output
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, PredicateCondition::Equals, 2);
+  scan->execute();
+  auto union_all = std::make_shared<UnionAll>(_table_wrapper, scan);
+  union_all->execute();
+
+  auto distinct = std::make_shared<Distinct>(union_all);
+  distinct->execute();
+
+  EXPECT_EQ(distinct->get_output()->row_count(), 4u);
+}
+
+TEST_F(OperatorsDistinctTest, ParallelDistinct) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 4)));
+
+  auto table = std::make_shared<Table>(1'000);
+  table->add_column("a", DataType::Int);
+  table->add_column("b", DataType::Long);
+  for (auto row = 0; row < 20'000; ++row) {
+    table->append({row % 97, int64_t{row % 13}});
+  }
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto distinct = std::make_shared<Distinct>(table_wrapper);
+  distinct->execute();
+
+  // 97 and 13 are coprime, so every combination of both values occurs
+  EXPECT_EQ(distinct->get_output()->row_count(), 97u * 13u);
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+}
+
+}  // namespace opossum
@@ -0,0 +1,222 @@
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/aggregate.hpp"
+#include "operators/fused_aggregate.hpp"
+#include "operators/pqp_expression.hpp"
+#include "operators/projection.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsFusedAggregateTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table_wrapper_2_2 = _make_table_wrapper("src/test/tables/aggregateoperator/groupby_int_2gb_2agg/input.tbl");
+    _table_wrapper_string_null =
+        _make_table_wrapper("src/test/tables/aggregateoperator/groupby_string_1gb_1agg/input_null.tbl");
+    _table_wrapper_int_null = _make_table_wrapper("src/test/tables/int_int_int_null.tbl");
+  }
+
+  static std::shared_ptr<TableWrapper> _make_table_wrapper(const std::string& path, const bool encode = false) {
+    auto table = load_table(path, 2);
+    if (encode) ChunkEncoder::encode_all_chunks(table);
+
+    auto table_wrapper = std::make_shared<TableWrapper>(std::move(table));
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  static std::shared_ptr<PQPExpression> _column(const ColumnID column_id) {
+    return PQPExpression::create_column(column_id);
+  }
+
+  // Returns a FusedAggregate on the columns a, b, c, and d of groupby_int_2gb_2agg, and the equivalent pipeline of a
+  // TableScan, a Projection, and an Aggregate
+  static std::pair<std::shared_ptr<AbstractOperator>, std::shared_ptr<AbstractOperator>> _make_q1_like_operators(
+      const std::shared_ptr<TableWrapper>& input) {
+    const auto predicate =
+        PQPExpression::create_binary_operator(ExpressionType::GreaterThan, _column(ColumnID{1}),
+                                              PQPExpression::create_literal(400.0));
+    const auto revenue = [] {
+      return PQPExpression::create_binary_operator(ExpressionType::Multiplication, _column(ColumnID{2}),
+                                                   _column(ColumnID{3}), std::string{"revenue"});
+    };
+
+    const auto fused_aggregate = std::make_shared<FusedAggregate>(
+        input, predicate,
+        std::vector<FusedAggregateColumnDefinition>{{revenue(), AggregateFunction::Sum, std::string{"revenue"}},
+                                                    {_column(ColumnID{2}), AggregateFunction::Avg},
+                                                    {std::nullopt, AggregateFunction::Count},
+                                                    {_column(ColumnID{3}), AggregateFunction::Min},
+                                                    {_column(ColumnID{2}), AggregateFunction::Max}},
+        std::vector<ColumnID>{ColumnID{0}});
+
+    const auto table_scan = std::make_shared<TableScan>(input, ColumnID{1}, PredicateCondition::GreaterThan, 400.0);
+    const auto projection = std::make_shared<Projection>(
+        table_scan, Projection::ColumnExpressions{_column(ColumnID{0}), revenue(), _column(ColumnID{2}),
+                                                  _column(ColumnID{3})});
+    const auto aggregate = std::make_shared<Aggregate>(
+        projection,
+        std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Sum, std::string{"revenue"}},
+                                               {ColumnID{2}, AggregateFunction::Avg},
+                                               {std::nullopt, AggregateFunction::Count},
+                                               {ColumnID{3}, AggregateFunction::Min},
+                                               {ColumnID{2}, AggregateFunction::Max}},
+        std::vector<ColumnID>{ColumnID{0}});
+
+    return {fused_aggregate, aggregate};
+  }
+
+  static void _execute_all(const std::shared_ptr<AbstractOperator>& op) {
+    if (op->input_left()) _execute_all(std::const_pointer_cast<AbstractOperator>(op->input_left()));
+    op->execute();
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper_2_2, _table_wrapper_string_null, _table_wrapper_int_null;
+};
+
+TEST_F(OperatorsFusedAggregateTest, ScanArithmeticAndAggregates) {
+  const auto [fused_aggregate, aggregate] = _make_q1_like_operators(_table_wrapper_2_2);
+  fused_aggregate->execute();
+  _execute_all(aggregate);
+
+  EXPECT_EQ(fused_aggregate->get_output()->row_count(), 2u);
+  EXPECT_TABLE_EQ_ORDERED(fused_aggregate->get_output(), aggregate->get_output());
+}
+
+TEST_F(OperatorsFusedAggregateTest, DictionaryEncodedInput) {
+  const auto table_wrapper =
+      _make_table_wrapper("src/test/tables/aggregateoperator/groupby_int_2gb_2agg/input.tbl", true);
+  const auto [fused_aggregate, aggregate] = _make_q1_like_operators(table_wrapper);
+  fused_aggregate->execute();
+  _execute_all(aggregate);
+
+  EXPECT_TABLE_EQ_ORDERED(fused_aggregate->get_output(), aggregate->get_output());
+}
+
+TEST_F(OperatorsFusedAggregateTest, NullGroupsAndArguments) {
+  const auto fused_aggregate = std::make_shared<FusedAggregate>(
+      _table_wrapper_string_null, nullptr,
+      std::vector<FusedAggregateColumnDefinition>{{_column(ColumnID{1}), AggregateFunction::Min},
+                                                  {_column(ColumnID{1}), AggregateFunction::Max},
+                                                  {_column(ColumnID{1}), AggregateFunction::Sum},
+                                                  {_column(ColumnID{1}), AggregateFunction::Count}},
+      std::vector<ColumnID>{ColumnID{0}});
+  fused_aggregate->execute();
+
+  const auto aggregate = std::make_shared<Aggregate>(
+      _table_wrapper_string_null,
+      std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Min},
+                                             {ColumnID{1}, AggregateFunction::Max},
+                                             {ColumnID{1}, AggregateFunction::Sum},
+                                             {ColumnID{1}, AggregateFunction::Count}},
+      std::vector<ColumnID>{ColumnID{0}});
+  aggregate->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(fused_aggregate->get_output(), aggregate->get_output());
+}
+
+TEST_F(OperatorsFusedAggregateTest, StringsWithoutGroupBy) {
+  const auto fused_aggregate = std::make_shared<FusedAggregate>(
+      _table_wrapper_string_null, nullptr,
+      std::vector<FusedAggregateColumnDefinition>{{_column(ColumnID{0}), AggregateFunction::Min},
+                                                  {_column(ColumnID{0}), AggregateFunction::Max},
+                                                  {std::nullopt, AggregateFunction::Count}},
+      std::vector<ColumnID>{});
+  fused_aggregate->execute();
+
+  const auto aggregate = std::make_shared<Aggregate>(
+      _table_wrapper_string_null,
+      std::vector<AggregateColumnDefinition>{{ColumnID{0}, AggregateFunction::Min},
+                                             {ColumnID{0}, AggregateFunction::Max},
+                                             {std::nullopt, AggregateFunction::Count}},
+      std::vector<ColumnID>{});
+  aggregate->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(fused_aggregate->get_output(), aggregate->get_output());
+}
+
+TEST_F(OperatorsFusedAggregateTest, ConjunctionWithNulls) {
+  // a >= 9 AND b <= 10, which is NULL for the rows with NULLs in a or b
+  const auto predicate = PQPExpression::create_binary_operator(
+      ExpressionType::And,
+      PQPExpression::create_binary_operator(ExpressionType::GreaterThanEquals, _column(ColumnID{0}),
+                                            PQPExpression::create_literal(9)),
+      PQPExpression::create_binary_operator(ExpressionType::LessThanEquals, _column(ColumnID{1}),
+                                            PQPExpression::create_literal(10)));
+  const auto sum = [] {
+    return PQPExpression::create_binary_operator(ExpressionType::Addition, _column(ColumnID{0}), _column(ColumnID{1}),
+                                                 std::string{"a_plus_b"});
+  };
+
+  const auto fused_aggregate = std::make_shared<FusedAggregate>(
+      _table_wrapper_int_null, predicate,
+      std::vector<FusedAggregateColumnDefinition>{{sum(), AggregateFunction::Sum, std::string{"sum"}}},
+      std::vector<ColumnID>{ColumnID{2}});
+  fused_aggregate->execute();
+
+  const auto table_scan_a =
+      std::make_shared<TableScan>(_table_wrapper_int_null, ColumnID{0}, PredicateCondition::GreaterThanEquals, 9);
+  const auto table_scan_b =
+      std::make_shared<TableScan>(table_scan_a, ColumnID{1}, PredicateCondition::LessThanEquals, 10);
+  const auto projection =
+      std::make_shared<Projection>(table_scan_b, Projection::ColumnExpressions{_column(ColumnID{2}), sum()});
+  const auto aggregate = std::make_shared<Aggregate>(
+      projection, std::vector<AggregateColumnDefinition>{{ColumnID{1}, AggregateFunction::Sum, std::string{"sum"}}},
+      std::vector<ColumnID>{ColumnID{0}});
+  _execute_all(aggregate);
+
+  ASSERT_EQ(fused_aggregate->get_output()->row_count(), 1u);
+  EXPECT_EQ(fused_aggregate->get_output()->get_value<int64_t>(ColumnID{1}, 0u), 19);
+  EXPECT_TABLE_EQ_ORDERED(fused_aggregate->get_output(), aggregate->get_output());
+}
+
+TEST_F(OperatorsFusedAggregateTest, NoQualifyingRows) {
+  const auto predicate = PQPExpression::create_binary_operator(ExpressionType::LessThan, _column(ColumnID{0}),
+                                                               PQPExpression::create_literal(0));
+  const auto fused_aggregate = std::make_shared<FusedAggregate>(
+      _table_wrapper_2_2, predicate,
+      std::vector<FusedAggregateColumnDefinition>{{std::nullopt, AggregateFunction::Count}}, std::vector<ColumnID>{});
+  fused_aggregate->execute();
+
+  EXPECT_EQ(fused_aggregate->get_output()->row_count(), 0u);
+  EXPECT_EQ(fused_aggregate->get_output()->column_type(ColumnID{0}), DataType::Long);
+}
+
+TEST_F(OperatorsFusedAggregateTest, DivisionByZeroWithScheduler) {
+  // The exception is thrown by a task on a worker thread and has to reach the caller
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 4)));
+
+  const auto quotient = PQPExpression::create_binary_operator(ExpressionType::Division, _column(ColumnID{2}),
+                                                              PQPExpression::create_literal(0));
+  const auto fused_aggregate = std::make_shared<FusedAggregate>(
+      _table_wrapper_2_2, nullptr,
+      std::vector<FusedAggregateColumnDefinition>{{quotient, AggregateFunction::Sum, std::string{"quotient"}}},
+      std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_THROW(fused_aggregate->execute(), std::runtime_error);
+}
+
+TEST_F(OperatorsFusedAggregateTest, Recreate) {
+  const auto [fused_aggregate, aggregate] = _make_q1_like_operators(_table_wrapper_2_2);
+  fused_aggregate->execute();
+
+  const auto recreated = fused_aggregate->recreate();
+  _execute_all(recreated);
+
+  EXPECT_TABLE_EQ_ORDERED(recreated->get_output(), fused_aggregate->get_output());
+}
+
+}  // namespace opossum
@@ -0,0 +1,102 @@
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/hash_set_operation.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsHashSetOperationTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto table_left = std::make_shared<Table>(2);
+    table_left->add_column("a", DataType::Int, true);
+    table_left->add_column("b", DataType::String);
+    table_left->append({1, "a"});
+    table_left->append({2, "b"});
+    table_left->append({NullValue{}, "c"});
+    table_left->append({1, "a"});
+    table_left->append({3, "d"});
+    ChunkEncoder::encode_chunks(table_left, {ChunkID{1}});
+
+    auto table_right = std::make_shared<Table>(3);
+    table_right->add_column("x", DataType::Int, true);
+    table_right->add_column("y", DataType::String);
+    table_right->append({3, "d"});
+    table_right->append({4, "e"});
+    table_right->append({NullValue{}, "c"});
+    table_right->append({4, "e"});
+    table_right->append({2, "z"});
+
+    _table_wrapper_left = std::make_shared<TableWrapper>(table_left);
+    _table_wrapper_left->execute();
+    _table_wrapper_right = std::make_shared<TableWrapper>(table_right);
+    _table_wrapper_right->execute();
+  }
+
+  std::shared_ptr<Table> _expected_table(const std::vector<std::vector<AllTypeVariant>>& rows) {
+    auto table = std::make_shared<Table>();
+    table->add_column("a", DataType::Int, true);
+    table->add_column("b", DataType::String);
+    for (const auto& row : rows) {
+      table->append(row);
+    }
+    return table;
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper_left, _table_wrapper_right;
+};
+
+TEST_F(OperatorsHashSetOperationTest, Union) {
+  auto set_operation =
+      std::make_shared<HashSetOperation>(_table_wrapper_left, _table_wrapper_right, SetOperationMode::Union);
+  set_operation->execute();
+
+  const auto expected_result =
+      _expected_table({{1, "a"}, {2, "b"}, {NullValue{}, "c"}, {3, "d"}, {4, "e"}, {2, "z"}});
+  EXPECT_TABLE_EQ_ORDERED(set_operation->get_output(), expected_result);
+}
+
+TEST_F(OperatorsHashSetOperationTest, Intersect) {
+  auto set_operation =
+      std::make_shared<HashSetOperation>(_table_wrapper_left, _table_wrapper_right, SetOperationMode::Intersect);
+  set_operation->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(set_operation->get_output(), _expected_table({{NullValue{}, "c"}, {3, "d"}}));
+}
+
+TEST_F(OperatorsHashSetOperationTest, Except) {
+  auto set_operation =
+      std::make_shared<HashSetOperation>(_table_wrapper_left, _table_wrapper_right, SetOperationMode::Except);
+  set_operation->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(set_operation->get_output(), _expected_table({{1, "a"}, {2, "b"}}));
+}
+
+TEST_F(OperatorsHashSetOperationTest, ReferenceInputs) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper_left, ColumnID{0}, PredicateCondition::GreaterThan, 1);
+  scan->execute();
+
+  auto set_operation = std::make_shared<HashSetOperation>(scan, _table_wrapper_right, SetOperationMode::Except);
+  set_operation->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(set_operation->get_output(), _expected_table({{2, "b"}}));
+}
+
+TEST_F(OperatorsHashSetOperationTest, EmptyResult) {
+  auto set_operation =
+      std::make_shared<HashSetOperation>(_table_wrapper_left, _table_wrapper_left, SetOperationMode::Except);
+  set_operation->execute();
+
+  EXPECT_EQ(set_operation->get_output()->row_count(), 0u);
+  EXPECT_EQ(set_operation->get_output()->column_count(), 2u);
+}
+
+}  // namespace opossum
@@ -1,5 +1,6 @@
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "../base_test.hpp"
@@ -237,4 +238,63 @@ TEST_F(OperatorsInsertTest, InsertSingleNullFromDummyProjection) {
   EXPECT_TRUE(variant_is_null(null_val));
 }
 
+TEST_F(OperatorsInsertTest, ConcurrentInserts) {
+  auto t_name = "test1";
+  auto t_name2 = "test2";
+
+  auto t = std::make_shared<Table>(5u);
+  t->add_column("a", DataType::Int);
+  StorageManager::get().add_table(t_name, t);
+
+  // 3 Rows
+  auto t2 = load_table("src/test/tables/int.tbl", Chunk::MAX_SIZE);
+  StorageManager::get().add_table(t_name2, t2);
+
+  constexpr auto thread_count = 8u;
+  constexpr auto inserts_per_thread = 20u;
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0u; thread_id < thread_count; ++thread_id) {
+    threads.emplace_back([&]() {
+      for (auto insert_id = 0u; insert_id < inserts_per_thread; ++insert_id) {
+        auto gt = std::make_shared<GetTable>(t_name2);
+        gt->execute();
+
+        auto ins = std::make_shared<Insert>(t_name, gt);
+        auto context = TransactionManager::get().new_transaction_context();
+        ins->set_transaction_context(context);
+        ins->execute();
+        context->commit();
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  const auto expected_row_count = thread_count * inserts_per_thread * 3u;
+  EXPECT_EQ(t->row_count(), expected_row_count);
+
+  // New chunks are only created once the previous one has been filled completely
+  EXPECT_EQ(t->chunk_count(), expected_row_count / 5u);
+
+  auto sum = int64_t{0};
+  for (ChunkID chunk_id{0}; chunk_id < t->chunk_count(); ++chunk_id) {
+    const auto chunk = t->get_chunk(chunk_id);
+    EXPECT_EQ(chunk->size(), 5u);
+
+    const auto& values = std::static_pointer_cast<const ValueColumn<int32_t>>(chunk->get_column(ColumnID{0}))->values();
+    for (const auto value : values) {
+      sum += value;
+    }
+
+    const auto mvcc_columns = chunk->mvcc_columns();
+    for (const auto begin_cid : mvcc_columns->begin_cids) {
+      EXPECT_NE(begin_cid, Chunk::MAX_COMMIT_ID);
+    }
+  }
+  EXPECT_EQ(sum, int64_t{thread_count * inserts_per_thread} * (123 + 1234 + 12345));
+}
+
 }  // namespace opossum
@@ -0,0 +1,176 @@
+#include <algorithm>
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "concurrency/transaction_context.hpp"
+#include "operators/join_index.hpp"
+#include "operators/join_nested_loop.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/validate.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "storage/index/group_key/composite_group_key_index.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/reference_column/single_chunk_pos_list.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+template <typename DerivedIndex>
+class OperatorsJoinIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    auto left_table = std::make_shared<Table>(3);
+    left_table->add_column("a", DataType::Int, true);
+    left_table->add_column("b", DataType::Int);
+    for (const auto value : {3, 12, 3, 30, 8}) left_table->append({value, 100 + value});
+    left_table->append({NullValue{}, 99});
+
+    _left_table_wrapper = std::make_shared<TableWrapper>(left_table);
+    _left_table_wrapper->execute();
+
+    // The values repeat, so that probes find several positions per chunk
+    auto right_table = std::make_shared<Table>(5);
+    right_table->add_column("c", DataType::Int, true);
+    right_table->add_column("d", DataType::Int);
+    right_table->append({NullValue{}, 2000});
+    for (auto value = 0; value < 23; ++value) right_table->append({value % 13, 1000 + value});
+    ChunkEncoder::encode_all_chunks(right_table);
+
+    // The last chunk is left without an index, so that JoinIndex has to scan it
+    for (auto chunk_id = ChunkID{0}; chunk_id < right_table->chunk_count() - 1; ++chunk_id) {
+      right_table->get_chunk(chunk_id)->template create_index<DerivedIndex>(std::vector<ColumnID>{ColumnID{0}});
+    }
+
+    _right_table_wrapper = std::make_shared<TableWrapper>(right_table);
+    _right_table_wrapper->execute();
+  }
+
+  // Compares the result of JoinIndex with the one of JoinNestedLoop, by default on the indexed right table
+  void _test_join(const std::shared_ptr<const AbstractOperator>& left, const JoinMode mode,
+                  const PredicateCondition predicate_condition,
+                  std::shared_ptr<const AbstractOperator> right = nullptr) {
+    const auto column_ids = ColumnIDPair{ColumnID{0}, ColumnID{0}};
+    if (!right) right = _right_table_wrapper;
+
+    auto join_index = std::make_shared<JoinIndex>(left, right, mode, column_ids, predicate_condition);
+    join_index->execute();
+
+    auto join_nested_loop = std::make_shared<JoinNestedLoop>(left, right, mode, column_ids, predicate_condition);
+    join_nested_loop->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(join_index->get_output(), join_nested_loop->get_output());
+  }
+
+  std::shared_ptr<TableWrapper> _left_table_wrapper, _right_table_wrapper;
+};
+
+// The right join column is nullable, so all conditions whose ranges reach up to the end of the index check that NULLs
+// are not returned as matches
+using DerivedIndices = ::testing::Types<GroupKeyIndex, CompositeGroupKeyIndex, AdaptiveRadixTreeIndex>;
+TYPED_TEST_CASE(OperatorsJoinIndexTest, DerivedIndices);
+
+TYPED_TEST(OperatorsJoinIndexTest, InnerJoin) {
+  for (const auto predicate_condition :
+       {PredicateCondition::Equals, PredicateCondition::NotEquals, PredicateCondition::LessThan,
+        PredicateCondition::LessThanEquals, PredicateCondition::GreaterThan, PredicateCondition::GreaterThanEquals}) {
+    this->_test_join(this->_left_table_wrapper, JoinMode::Inner, predicate_condition);
+  }
+}
+
+TYPED_TEST(OperatorsJoinIndexTest, LeftJoin) {
+  for (const auto predicate_condition :
+       {PredicateCondition::Equals, PredicateCondition::NotEquals, PredicateCondition::LessThan,
+        PredicateCondition::LessThanEquals, PredicateCondition::GreaterThan, PredicateCondition::GreaterThanEquals}) {
+    this->_test_join(this->_left_table_wrapper, JoinMode::Left, predicate_condition);
+  }
+}
+
+TYPED_TEST(OperatorsJoinIndexTest, ReferenceColumnsAsLeftInput) {
+  auto table_scan = std::make_shared<TableScan>(this->_left_table_wrapper, ColumnID{1}, PredicateCondition::GreaterThan,
+                                                105);
+  table_scan->execute();
+
+  this->_test_join(table_scan, JoinMode::Inner, PredicateCondition::Equals);
+  this->_test_join(table_scan, JoinMode::Left, PredicateCondition::Equals);
+}
+
+TYPED_TEST(OperatorsJoinIndexTest, ValidatedRightInput) {
+  // The ReferenceColumns of a Validate are joined using the indexes of the chunks they reference. The row with the
+  // value 3 in the first chunk is invisible and must not be joined.
+  const auto right_table = std::const_pointer_cast<Table>(this->_right_table_wrapper->get_output());
+  for (auto chunk_id = ChunkID{0}; chunk_id < right_table->chunk_count(); ++chunk_id) {
+    auto mvcc_columns = right_table->get_chunk(chunk_id)->mvcc_columns();
+    std::fill(mvcc_columns->begin_cids.begin(), mvcc_columns->begin_cids.end(), 0u);
+    std::fill(mvcc_columns->end_cids.begin(), mvcc_columns->end_cids.end(), Chunk::MAX_COMMIT_ID);
+  }
+  right_table->get_chunk(ChunkID{0})->mvcc_columns()->end_cids[4] = 2u;
+
+  const auto transaction_context = std::make_shared<TransactionContext>(1u, 3u);
+  auto validate = std::make_shared<Validate>(this->_right_table_wrapper);
+  validate->set_transaction_context(transaction_context);
+  validate->execute();
+
+  for (const auto predicate_condition :
+       {PredicateCondition::Equals, PredicateCondition::NotEquals, PredicateCondition::LessThan,
+        PredicateCondition::LessThanEquals, PredicateCondition::GreaterThan, PredicateCondition::GreaterThanEquals}) {
+    this->_test_join(this->_left_table_wrapper, JoinMode::Inner, predicate_condition, validate);
+    this->_test_join(this->_left_table_wrapper, JoinMode::Left, predicate_condition, validate);
+  }
+}
+
+TYPED_TEST(OperatorsJoinIndexTest, ScannedRightInput) {
+  // The positions of a TableScan on the right table are stored as SingleChunkPosLists
+  auto table_scan = std::make_shared<TableScan>(this->_right_table_wrapper, ColumnID{1}, PredicateCondition::NotEquals,
+                                                1008);
+  table_scan->execute();
+
+  this->_test_join(this->_left_table_wrapper, JoinMode::Inner, PredicateCondition::Equals, table_scan);
+  this->_test_join(this->_left_table_wrapper, JoinMode::Left, PredicateCondition::GreaterThan, table_scan);
+}
+
+TYPED_TEST(OperatorsJoinIndexTest, RightInputWithDuplicatePositions) {
+  // The outputs of joins or UnionAlls can reference a row more than once. Each of these positions has to be joined.
+  const auto right_table = this->_right_table_wrapper->get_output();
+  const auto chunk_offsets = std::vector<ChunkOffset>{4, 2, 4, 1, 4};
+
+  const auto test_join_with_positions = [&](const auto& positions) {
+    auto reference_table = Table::create_with_layout_from(right_table);
+    auto chunk = std::make_shared<Chunk>();
+    for (auto column_id = ColumnID{0}; column_id < right_table->column_count(); ++column_id) {
+      chunk->add_column(std::make_shared<ReferenceColumn>(right_table, column_id, positions));
+    }
+    reference_table->emplace_chunk(chunk);
+
+    auto table_wrapper = std::make_shared<TableWrapper>(reference_table);
+    table_wrapper->execute();
+
+    this->_test_join(this->_left_table_wrapper, JoinMode::Inner, PredicateCondition::Equals, table_wrapper);
+    this->_test_join(this->_left_table_wrapper, JoinMode::Left, PredicateCondition::LessThan, table_wrapper);
+  };
+
+  auto pos_list = std::make_shared<PosList>();
+  for (const auto chunk_offset : chunk_offsets) pos_list->emplace_back(RowID{ChunkID{0}, chunk_offset});
+  test_join_with_positions(std::shared_ptr<const PosList>{pos_list});
+
+  test_join_with_positions(
+      std::shared_ptr<const AbstractPosList>{std::make_shared<SingleChunkPosList>(ChunkID{0}, chunk_offsets)});
+}
+
+TYPED_TEST(OperatorsJoinIndexTest, OutputReferencesRightTable) {
+  auto join = std::make_shared<JoinIndex>(this->_left_table_wrapper, this->_right_table_wrapper, JoinMode::Inner,
+                                          ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals);
+  join->execute();
+
+  // 3 appears twice on both sides, 8 twice on the right, 12 once on each side, and 30 only on the left
+  EXPECT_EQ(join->get_output()->row_count(), 7u);
+  EXPECT_EQ(join->get_output()->column_count(), 4u);
+}
+
+}  // namespace opossum
@@ -0,0 +1,113 @@
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/materialize.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsMaterializeTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(3);
+    _table->add_column("a", DataType::Int, true);
+    _table->add_column("b", DataType::String);
+    _table->add_column("c", DataType::Float);
+    _table->append({1, "hyrise", 0.5f});
+    _table->append({NullValue{}, "opossum", 1.5f});
+    _table->append({3, "hyrise", 2.5f});
+    _table->append({4, "hyrise", 3.5f});
+    _table->append({NullValue{}, "hyrise", 4.5f});
+    _table->append({6, "opossum", 5.5f});
+    _table->append({7, "hyrise", 6.5f});
+    ChunkEncoder::encode_chunks(_table, {ChunkID{1}});
+
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  static void _expect_no_references(const std::shared_ptr<const Table>& table) {
+    for (ChunkID chunk_id{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
+        EXPECT_FALSE(std::dynamic_pointer_cast<const ReferenceColumn>(
+            table->get_chunk(chunk_id)->get_column(column_id)));
+      }
+    }
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsMaterializeTest, PassesOnDataTables) {
+  auto materialize = std::make_shared<Materialize>(_table_wrapper);
+  materialize->execute();
+
+  EXPECT_EQ(materialize->get_output(), _table);
+}
+
+TEST_F(OperatorsMaterializeTest, MaterializesReferenceColumns) {
+  auto table_scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{1}, PredicateCondition::Equals, "hyrise");
+  table_scan->execute();
+
+  auto materialize = std::make_shared<Materialize>(table_scan);
+  materialize->execute();
+
+  const auto output = materialize->get_output();
+  _expect_no_references(output);
+  EXPECT_TRUE(output->column_is_nullable(ColumnID{0}));
+  EXPECT_EQ(output->chunk_count(), table_scan->get_output()->chunk_count());
+
+  auto expected_result = std::make_shared<Table>();
+  expected_result->add_column("a", DataType::Int, true);
+  expected_result->add_column("b", DataType::String);
+  expected_result->add_column("c", DataType::Float);
+  expected_result->append({1, "hyrise", 0.5f});
+  expected_result->append({3, "hyrise", 2.5f});
+  expected_result->append({4, "hyrise", 3.5f});
+  expected_result->append({NullValue{}, "hyrise", 4.5f});
+  expected_result->append({7, "hyrise", 6.5f});
+
+  EXPECT_TABLE_EQ_ORDERED(output, expected_result);
+}
+
+TEST_F(OperatorsMaterializeTest, ParallelMaterialize) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 4)));
+
+  auto table = std::make_shared<Table>(1'000);
+  table->add_column("a", DataType::Int);
+  table->add_column("b", DataType::Long);
+  for (auto row = 0; row < 20'000; ++row) {
+    table->append({row, int64_t{row % 13}});
+  }
+  ChunkEncoder::encode_all_chunks(table);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto table_scan = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, PredicateCondition::Equals, int64_t{0});
+  table_scan->execute();
+
+  auto materialize = std::make_shared<Materialize>(table_scan);
+  materialize->execute();
+
+  const auto output = materialize->get_output();
+  _expect_no_references(output);
+  EXPECT_TABLE_EQ_ORDERED(output, table_scan->get_output());
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+}
+
+}  // namespace opossum
@@ -10,8 +10,12 @@
 #include "operators/pqp_expression.hpp"
 #include "operators/print.hpp"
 #include "operators/projection.hpp"
+#include "operators/projection/expression_evaluator.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
@@ -215,6 +219,14 @@ TEST_F(OperatorsProjectionTest, DivisionByZero) {
   EXPECT_THROW(projection_literal->execute(), std::runtime_error);
 }
 
+TEST_F(OperatorsProjectionTest, DivisionByZeroWithScheduler) {
+  // The exception is thrown by a task on a worker thread and has to reach the caller
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 4)));
+
+  auto projection = std::make_shared<Projection>(_table_wrapper_int_zero, _div_a_b_expr);
+  EXPECT_THROW(projection->execute(), std::runtime_error);
+}
+
 TEST_F(OperatorsProjectionTest, AddNull) {
   std::shared_ptr<Table> expected_result = load_table("src/test/tables/string_concatenated_null.tbl", 2);
 
@@ -321,6 +333,122 @@ TEST_F(OperatorsProjectionTest, ReferenceColumnCount) {
   EXPECT_EQ(projection_3->get_output()->row_count(), (u_int)1);
 }
 
+TEST_F(OperatorsProjectionTest, ColumnsArePassedOnWithoutCopying) {
+  auto projection = std::make_shared<Projection>(
+      _table_wrapper_int, Projection::ColumnExpressions{PQPExpression::create_column(ColumnID{2}),
+                                                        _sum_a_b_expr.front()});
+  projection->execute();
+
+  const auto table_in = _table_wrapper_int->get_output();
+  const auto table_out = projection->get_output();
+  ASSERT_EQ(table_out->chunk_count(), table_in->chunk_count());
+  for (ChunkID chunk_id{0}; chunk_id < table_in->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(table_out->get_chunk(chunk_id)->get_column(ColumnID{0}),
+              table_in->get_chunk(chunk_id)->get_column(ColumnID{2}));
+  }
+}
+
+TEST_F(OperatorsProjectionTest, ComputedColumnsOfReferenceInputAreReferenced) {
+  auto expected_result = std::make_shared<Table>();
+  expected_result->add_column("a", DataType::Int);
+  expected_result->add_column("sum", DataType::Int);
+  expected_result->append({10, 20});
+  expected_result->append({11, 21});
+
+  auto table_scan =
+      std::make_shared<TableScan>(_table_wrapper_int_dict, ColumnID{0}, PredicateCondition::GreaterThan, 9);
+  table_scan->execute();
+
+  auto projection = std::make_shared<Projection>(
+      table_scan, Projection::ColumnExpressions{PQPExpression::create_column(ColumnID{0}), _sum_a_b_expr.front()});
+  projection->execute();
+
+  // The columns of the input are passed on as they are, the computed column is referenced
+  const auto table_out = projection->get_output();
+  EXPECT_EQ(table_out->get_type(), TableType::References);
+  for (ChunkID chunk_id{0}; chunk_id < table_out->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(table_out->get_chunk(chunk_id)->get_column(ColumnID{0}),
+              table_scan->get_output()->get_chunk(chunk_id)->get_column(ColumnID{0}));
+  }
+
+  EXPECT_TABLE_EQ_UNORDERED(table_out, expected_result);
+}
+
+TEST_F(OperatorsProjectionTest, MixedTypesArePromoted) {
+  auto expected_result = std::make_shared<Table>();
+  expected_result->add_column("sum", DataType::Float);
+  expected_result->append({12345 + 458.7f});
+  expected_result->append({123 + 456.7f});
+  expected_result->append({1234 + 457.7f});
+
+  auto projection = std::make_shared<Projection>(_table_wrapper, _sum_a_b_expr);
+  projection->execute();
+
+  EXPECT_EQ(projection->get_output()->column_type(ColumnID{0}), DataType::Float);
+  EXPECT_TABLE_EQ_UNORDERED(projection->get_output(), expected_result);
+}
+
+TEST_F(OperatorsProjectionTest, ComparisonsAndLogicalOperatorsWithNull) {
+  auto expected_result = std::make_shared<Table>();
+  expected_result->add_column("and", DataType::Int, true);
+  expected_result->add_column("or", DataType::Int, true);
+  expected_result->add_column("not", DataType::Int, true);
+  expected_result->append({0, 1, 1});
+  expected_result->append({NullValue{}, 1, NullValue{}});
+  expected_result->append({NullValue{}, 1, 0});
+  expected_result->append({0, NullValue{}, 1});
+
+  // a > 9 and b = 10
+  const auto a_greater_than_9 = PQPExpression::create_binary_operator(
+      ExpressionType::GreaterThan, PQPExpression::create_column(ColumnID{0}), PQPExpression::create_literal(9));
+  const auto b_equals_10 = PQPExpression::create_binary_operator(
+      ExpressionType::Equals, PQPExpression::create_column(ColumnID{1}), PQPExpression::create_literal(10));
+
+  auto projection = std::make_shared<Projection>(
+      _table_wrapper_int_null,
+      Projection::ColumnExpressions{
+          PQPExpression::create_binary_operator(ExpressionType::And, a_greater_than_9, b_equals_10, {"and"}),
+          PQPExpression::create_binary_operator(ExpressionType::Or, a_greater_than_9, b_equals_10, {"or"}),
+          PQPExpression::create_unary_operator(ExpressionType::Not, a_greater_than_9, {"not"})});
+  projection->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(projection->get_output(), expected_result);
+}
+
+TEST_F(OperatorsProjectionTest, ChunksLargerThanABlock) {
+  const auto row_count = 3 * ExpressionEvaluator::BLOCK_SIZE + 5;
+
+  auto table = std::make_shared<Table>();
+  table->add_column("a", DataType::Int, true);
+  auto expected_result = std::make_shared<Table>();
+  expected_result->add_column("a * 2 + 1", DataType::Int, true);
+
+  for (auto row = size_t{0}; row < row_count; ++row) {
+    if (row % 7 == 0) {
+      table->append({NullValue{}});
+      expected_result->append({NullValue{}});
+    } else {
+      table->append({static_cast<int32_t>(row)});
+      expected_result->append({static_cast<int32_t>(row * 2 + 1)});
+    }
+  }
+  ChunkEncoder::encode_all_chunks(table);
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto projection = std::make_shared<Projection>(
+      table_wrapper, Projection::ColumnExpressions{PQPExpression::create_binary_operator(
+                         ExpressionType::Addition,
+                         PQPExpression::create_binary_operator(ExpressionType::Multiplication,
+                                                               PQPExpression::create_column(ColumnID{0}),
+                                                               PQPExpression::create_literal(2)),
+                         PQPExpression::create_literal(1), {"a * 2 + 1"})});
+  projection->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(projection->get_output(), expected_result);
+}
+
 TEST_F(OperatorsProjectionTest, Literals) {
   std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_string_filtered.tbl", 1);
 
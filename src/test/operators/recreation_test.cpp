@@ -13,6 +13,7 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/union_positions.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -162,4 +163,29 @@ TEST_F(RecreationTest, RecreationTableScan) {
   EXPECT_TABLE_EQ_UNORDERED(recreated_scan->get_output(), expected_result);
 }
 
+TEST_F(RecreationTest, RecreationSharedInput) {
+  // build and execute two table scans on the same input and the union of their results
+  auto scan_a = std::make_shared<TableScan>(this->_table_wrapper_a, ColumnID{0}, PredicateCondition::LessThan, 200);
+  auto scan_b =
+      std::make_shared<TableScan>(this->_table_wrapper_a, ColumnID{0}, PredicateCondition::GreaterThanEquals, 12345);
+  auto union_positions = std::make_shared<UnionPositions>(scan_a, scan_b);
+
+  // recreate the union, the input of both scans is only recreated once
+  auto recreated_union = union_positions->recreate();
+  EXPECT_NE(recreated_union, nullptr) << "Could not recreate UnionPositions";
+
+  const auto recreated_scan_a = recreated_union->mutable_input_left();
+  const auto recreated_scan_b = recreated_union->mutable_input_right();
+  EXPECT_NE(recreated_scan_a, recreated_scan_b);
+  EXPECT_NE(recreated_scan_a->input_left(), this->_table_wrapper_a);
+  EXPECT_EQ(recreated_scan_a->input_left(), recreated_scan_b->input_left());
+
+  // table wrapper needs to be executed manually
+  recreated_scan_a->mutable_input_left()->execute();
+  recreated_scan_a->execute();
+  recreated_scan_b->execute();
+  recreated_union->execute();
+  EXPECT_EQ(recreated_union->get_output()->row_count(), 2u);
+}
+
 }  // namespace opossum
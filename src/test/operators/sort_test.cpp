@@ -1,6 +1,7 @@
 #include <iostream>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
@@ -10,9 +11,14 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/union_all.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/chunk_encoder.hpp"
+#include "storage/reference_column.hpp"
 #include "storage/storage_manager.hpp"
 #include "storage/table.hpp"
+#include "storage/value_column.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -142,6 +148,96 @@ TEST_P(OperatorsSortTest, MultipleColumnSortIsStableMixedOrder) {
   EXPECT_TABLE_EQ_ORDERED(sort_after_a->get_output(), expected_result);
 }
 
+TEST_P(OperatorsSortTest, MultipleColumnSort) {
+  auto table_wrapper = std::make_shared<TableWrapper>(load_table("src/test/tables/int_float4.tbl", 2));
+  table_wrapper->execute();
+
+  auto sort = std::make_shared<Sort>(
+      table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{0}, OrderByMode::Ascending}, {ColumnID{1}}}, 2u);
+  sort->execute();
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), load_table("src/test/tables/int_float2_sorted.tbl", 2));
+
+  auto sort_mixed = std::make_shared<Sort>(
+      table_wrapper,
+      std::vector<SortColumnDefinition>{{ColumnID{0}, OrderByMode::Ascending}, {ColumnID{1}, OrderByMode::Descending}},
+      2u);
+  sort_mixed->execute();
+  EXPECT_TABLE_EQ_ORDERED(sort_mixed->get_output(), load_table("src/test/tables/int_float2_sorted_mixed.tbl", 2));
+}
+
+TEST_P(OperatorsSortTest, MultipleColumnSortWithLongStrings) {
+  // The strings share prefixes that are longer than the part of them that is encoded into the sort keys
+  auto table = std::make_shared<Table>(2);
+  table->add_column("a", DataType::String, true);
+  table->add_column("b", DataType::Int);
+  table->append({"hyrise_database_b", 1});
+  table->append({"hyrise_database_a", 2});
+  table->append({"hyrise_database", 3});
+  table->append({NullValue{}, 4});
+  table->append({"hyrise_database_a", 5});
+  table->append({"hyrise", 6});
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}}, {_encoding_type});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto sort = std::make_shared<Sort>(
+      table_wrapper,
+      std::vector<SortColumnDefinition>{{ColumnID{0}, OrderByMode::DescendingNullsLast},
+                                        {ColumnID{1}, OrderByMode::Descending}},
+      2u);
+  sort->execute();
+
+  auto expected_result = std::make_shared<Table>(2);
+  expected_result->add_column("a", DataType::String, true);
+  expected_result->add_column("b", DataType::Int);
+  expected_result->append({"hyrise_database_b", 1});
+  expected_result->append({"hyrise_database_a", 5});
+  expected_result->append({"hyrise_database_a", 2});
+  expected_result->append({"hyrise_database", 3});
+  expected_result->append({"hyrise", 6});
+  expected_result->append({NullValue{}, 4});
+
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
+}
+
+TEST_P(OperatorsSortTest, ParallelMultipleColumnSort) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 4)));
+
+  // Enough rows for the sort to be split into several runs that are merged afterwards
+  const auto row_count = 50'000;
+  auto table = std::make_shared<Table>(1'000);
+  table->add_column("a", DataType::Int);
+  table->add_column("b", DataType::Double);
+  for (auto row = 0; row < row_count; ++row) {
+    table->append({(row * 7'919) % 1'000 - 500, static_cast<double>(int64_t{row} * 104'729 % row_count)});
+  }
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}, ChunkID{1}}, {_encoding_type});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  auto sort = std::make_shared<Sort>(
+      table_wrapper,
+      std::vector<SortColumnDefinition>{{ColumnID{0}, OrderByMode::Ascending}, {ColumnID{1}, OrderByMode::Descending}});
+  sort->execute();
+
+  const auto output = sort->get_output();
+  ASSERT_EQ(output->row_count(), static_cast<uint64_t>(row_count));
+
+  for (auto row = size_t{1}; row < static_cast<size_t>(row_count); ++row) {
+    const auto previous_a = output->get_value<int32_t>(ColumnID{0}, row - 1);
+    const auto a = output->get_value<int32_t>(ColumnID{0}, row);
+    ASSERT_LE(previous_a, a);
+    if (previous_a == a) {
+      ASSERT_GT(output->get_value<double>(ColumnID{1}, row - 1), output->get_value<double>(ColumnID{1}, row));
+    }
+  }
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+}
+
 TEST_P(OperatorsSortTest, AscendingSortOfOneColumnWithNull) {
   std::shared_ptr<Table> expected_result = load_table("src/test/tables/int_float_null_sorted_asc.tbl", 2);
 
@@ -237,4 +333,47 @@ TEST_P(OperatorsSortTest, SortTableWithRefandValueColumns) {
       load_table("src/test/tables/int_float__int_float2_filtered__union__sorted.tbl", Chunk::MAX_SIZE));
 }
 
+TEST_P(OperatorsSortTest, OutputReferencesInput) {
+  auto sort = std::make_shared<Sort>(_table_wrapper_null_dict, ColumnID{0}, OrderByMode::Ascending, 2u);
+  sort->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), load_table("src/test/tables/int_float_null_sorted_asc.tbl", 2));
+  ASSERT_EQ(sort->get_output()->chunk_count(), 2u);
+
+  // Both columns share one position list per chunk
+  const auto chunk = sort->get_output()->get_chunk(ChunkID{1});
+  const auto reference_column_a = std::dynamic_pointer_cast<const ReferenceColumn>(chunk->get_column(ColumnID{0}));
+  const auto reference_column_b = std::dynamic_pointer_cast<const ReferenceColumn>(chunk->get_column(ColumnID{1}));
+  ASSERT_TRUE(reference_column_a && reference_column_b);
+  EXPECT_EQ(reference_column_a->referenced_table(), _table_wrapper_null_dict->get_output());
+  EXPECT_EQ(reference_column_b->referenced_column_id(), ColumnID{1});
+  EXPECT_EQ(reference_column_a->pos_list(), reference_column_b->pos_list());
+}
+
+TEST_P(OperatorsSortTest, OutputOfReferenceInputReferencesStoredTable) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper_dict, ColumnID{0}, PredicateCondition::NotEquals, 123);
+  scan->execute();
+
+  auto sort = std::make_shared<Sort>(scan, ColumnID{0});
+  sort->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), load_table("src/test/tables/int_float_filtered_sorted.tbl", 2));
+
+  const auto output_chunk = sort->get_output()->get_chunk(ChunkID{0});
+  const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(output_chunk->get_column(ColumnID{0}));
+  ASSERT_TRUE(reference_column);
+  EXPECT_EQ(reference_column->referenced_table(), _table_wrapper_dict->get_output());
+}
+
+TEST_P(OperatorsSortTest, MaterializedOutput) {
+  auto sort = std::make_shared<Sort>(_table_wrapper_null_dict, ColumnID{0}, OrderByMode::Descending, 3u,
+                                     SortOutputMode::Values);
+  sort->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), load_table("src/test/tables/int_float_null_sorted_desc.tbl", 2));
+  ASSERT_EQ(sort->get_output()->chunk_count(), 2u);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const ValueColumn<int32_t>>(
+      sort->get_output()->get_chunk(ChunkID{1})->get_column(ColumnID{0})));
+}
+
 }  // namespace opossum
@@ -0,0 +1,164 @@
+#include <memory>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/limit.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/table.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class OperatorsTopKTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = load_table("src/test/tables/int_float_with_null.tbl", 2);
+    _table_wrapper = std::make_shared<TableWrapper>(_table);
+    _table_wrapper->execute();
+  }
+
+  // TopK has to return the same rows as a Sort followed by a Limit
+  void _expect_top_k(const std::shared_ptr<AbstractOperator>& input,
+                     const std::vector<SortColumnDefinition>& sort_definitions, const size_t k) {
+    auto top_k = std::make_shared<TopK>(input, sort_definitions, k);
+    top_k->execute();
+
+    auto sort = std::make_shared<Sort>(input, sort_definitions);
+    sort->execute();
+    auto limit = std::make_shared<Limit>(sort, k);
+    limit->execute();
+
+    EXPECT_TABLE_EQ_ORDERED(top_k->get_output(), limit->get_output());
+  }
+
+  std::shared_ptr<Table> _table;
+  std::shared_ptr<TableWrapper> _table_wrapper;
+};
+
+TEST_F(OperatorsTopKTest, OneColumnWithNull) {
+  for (const auto order_by_mode : {OrderByMode::Ascending, OrderByMode::Descending, OrderByMode::AscendingNullsLast,
+                                   OrderByMode::DescendingNullsLast}) {
+    for (const auto k : {size_t{1}, size_t{2}, size_t{3}}) {
+      _expect_top_k(_table_wrapper, {{ColumnID{0}, order_by_mode}}, k);
+      _expect_top_k(_table_wrapper, {{ColumnID{1}, order_by_mode}}, k);
+    }
+  }
+}
+
+TEST_F(OperatorsTopKTest, KLargerThanInput) {
+  auto top_k = std::make_shared<TopK>(_table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{0}}}, 100);
+  top_k->execute();
+
+  EXPECT_EQ(top_k->get_output()->row_count(), 4u);
+  _expect_top_k(_table_wrapper, {{ColumnID{0}}}, 100);
+}
+
+TEST_F(OperatorsTopKTest, KIsZero) {
+  auto top_k = std::make_shared<TopK>(_table_wrapper, std::vector<SortColumnDefinition>{{ColumnID{0}}}, 0);
+  top_k->execute();
+
+  EXPECT_EQ(top_k->get_output()->row_count(), 0u);
+  EXPECT_EQ(top_k->get_output()->column_count(), 2u);
+}
+
+TEST_F(OperatorsTopKTest, MultipleColumnsWithLongStrings) {
+  // Equal values across chunks check that TopK is stable, like Sort
+  auto table = std::make_shared<Table>(2);
+  table->add_column("a", DataType::String, true);
+  table->add_column("b", DataType::Int);
+  table->append({"hyrise_database_b", 1});
+  table->append({"hyrise_database_a", 2});
+  table->append({"hyrise_database", 3});
+  table->append({NullValue{}, 4});
+  table->append({"hyrise_database_a", 2});
+  table->append({"hyrise", 6});
+  table->append({"hyrise_database_a", 7});
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}, ChunkID{2}});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  for (const auto k : {size_t{1}, size_t{3}, size_t{5}}) {
+    _expect_top_k(table_wrapper, {{ColumnID{0}, OrderByMode::DescendingNullsLast}, {ColumnID{1}}}, k);
+    _expect_top_k(table_wrapper, {{ColumnID{1}, OrderByMode::Descending}}, k);
+  }
+}
+
+TEST_F(OperatorsTopKTest, ReferenceInput) {
+  auto scan = std::make_shared<TableScan>(_table_wrapper, ColumnID{0}, PredicateCondition::NotEquals, 123);
+  scan->execute();
+
+  _expect_top_k(scan, {{ColumnID{1}, OrderByMode::Descending}}, 2);
+
+  // The output references the stored table instead of the output of the scan
+  auto top_k = std::make_shared<TopK>(scan, std::vector<SortColumnDefinition>{{ColumnID{1}}}, 2);
+  top_k->execute();
+
+  const auto reference_column = std::dynamic_pointer_cast<const ReferenceColumn>(
+      top_k->get_output()->get_chunk(ChunkID{0})->get_column(ColumnID{1}));
+  ASSERT_NE(reference_column, nullptr);
+  EXPECT_EQ(reference_column->referenced_table(), _table);
+}
+
+TEST_F(OperatorsTopKTest, ParallelTopK) {
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 4)));
+
+  const auto row_count = 20'000;
+  auto table = std::make_shared<Table>(1'000);
+  table->add_column("a", DataType::Int);
+  table->add_column("b", DataType::Double);
+  for (auto row = 0; row < row_count; ++row) {
+    table->append({(row * 7'919) % 1'000 - 500, static_cast<double>(int64_t{row} * 104'729 % row_count)});
+  }
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}, ChunkID{1}});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  _expect_top_k(table_wrapper, {{ColumnID{0}}, {ColumnID{1}, OrderByMode::Descending}}, 1'500);
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+}
+
+TEST_F(OperatorsTopKTest, ChunksLargerThanARange) {
+  // The chunks are split into several ranges with equal values in all of them, which checks that TopK stays stable
+  const auto row_count = 50'000;
+  auto table = std::make_shared<Table>(40'000);
+  table->add_column("a", DataType::Int, true);
+  table->add_column("b", DataType::Int);
+  for (auto row = 0; row < row_count; ++row) {
+    table->append({row % 13 == 0 ? NULL_VALUE : AllTypeVariant{(row * 7'919) % 100}, row});
+  }
+  ChunkEncoder::encode_chunks(table, {ChunkID{0}});
+
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  for (const auto k : {size_t{10}, size_t{20'000}}) {
+    _expect_top_k(table_wrapper, {{ColumnID{0}, OrderByMode::AscendingNullsLast}}, k);
+    _expect_top_k(table_wrapper, {{ColumnID{0}, OrderByMode::Descending}}, k);
+  }
+
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, PredicateCondition::GreaterThan, 100);
+  scan->execute();
+  _expect_top_k(scan, {{ColumnID{0}, OrderByMode::AscendingNullsLast}}, 50);
+
+  // With a scheduler, the ranges are merged in the order in which their tasks finish
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 4)));
+  _expect_top_k(table_wrapper, {{ColumnID{0}, OrderByMode::AscendingNullsLast}}, 20'000);
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+}
+
+}  // namespace opossum
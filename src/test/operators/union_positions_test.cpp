@@ -1,5 +1,7 @@
+#include <algorithm>
 #include <memory>
 #include <utility>
+#include <vector>
 
 #include "base_test.hpp"
 
@@ -9,6 +11,9 @@
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
 #include "operators/union_positions.hpp"
+#include "scheduler/current_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "scheduler/topology.hpp"
 #include "storage/reference_column.hpp"
 #include "storage/storage_manager.hpp"
 
@@ -25,6 +30,60 @@ class UnionPositionsTest : public BaseTest {
     StorageManager::get().add_table("int_int", load_table("src/test/tables/int_int.tbl", 2));
   }
 
+  // Table with the two int columns a and b, whose rows are spread over chunks of chunk_size rows
+  std::shared_ptr<Table> _create_int_int_table(const size_t row_count, const uint32_t chunk_size) {
+    auto table = std::make_shared<Table>(chunk_size);
+    table->add_column("a", DataType::Int);
+    table->add_column("b", DataType::Int);
+    for (auto row_idx = size_t{0}; row_idx < row_count; ++row_idx) {
+      table->append({static_cast<int32_t>(row_idx), static_cast<int32_t>(row_idx * 2)});
+    }
+    return table;
+  }
+
+  // Table referencing the rows of referenced_table in chunks of chunk_size rows. All columns share a pos list.
+  std::shared_ptr<Table> _create_reference_table(const std::shared_ptr<Table>& referenced_table,
+                                                 const PosList& pos_list, const size_t chunk_size) {
+    auto table = Table::create_with_layout_from(referenced_table, chunk_size);
+    for (auto begin = size_t{0}; begin < pos_list.size(); begin += chunk_size) {
+      const auto end = std::min(begin + chunk_size, pos_list.size());
+      const auto chunk_pos_list = std::make_shared<PosList>(pos_list.begin() + begin, pos_list.begin() + end);
+
+      auto chunk = std::make_shared<Chunk>();
+      for (auto column_id = ColumnID{0}; column_id < referenced_table->column_count(); ++column_id) {
+        chunk->add_column(std::make_shared<ReferenceColumn>(referenced_table, column_id, chunk_pos_list));
+      }
+      table->emplace_chunk(std::move(chunk));
+    }
+    return table;
+  }
+
+  // Concatenated pos lists of the output, checking that all columns of a chunk share their pos list
+  PosList _output_pos_list(const std::shared_ptr<const Table>& table) {
+    auto pos_list = PosList{};
+    for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+      const auto chunk = table->get_chunk(chunk_id);
+      const auto chunk_pos_list =
+          std::static_pointer_cast<const ReferenceColumn>(chunk->get_column(ColumnID{0}))->pos_list();
+      for (auto column_id = ColumnID{1}; column_id < table->column_count(); ++column_id) {
+        EXPECT_EQ(std::static_pointer_cast<const ReferenceColumn>(chunk->get_column(column_id))->pos_list(),
+                  chunk_pos_list);
+      }
+      pos_list.insert(pos_list.end(), chunk_pos_list->begin(), chunk_pos_list->end());
+    }
+    return pos_list;
+  }
+
+  // Sorted union of both pos lists, without duplicates
+  PosList _expected_pos_list(PosList left, PosList right) {
+    auto expected = PosList{};
+    std::sort(left.begin(), left.end());
+    std::sort(right.begin(), right.end());
+    std::set_union(left.begin(), left.end(), right.begin(), right.end(), std::back_inserter(expected));
+    expected.erase(std::unique(expected.begin(), expected.end()), expected.end());
+    return expected;
+  }
+
   std::shared_ptr<Table> _table_10_ints;
   std::shared_ptr<Table> _table_int_float4;
 };
@@ -323,4 +382,84 @@ TEST_F(UnionPositionsTest, MultipleShuffledPosList) {
       load_table("src/test/tables/union_positions_multiple_shuffled_pos_list.tbl", Chunk::MAX_SIZE));
 }
 
+TEST_F(UnionPositionsTest, SingleReferencedTableSameChunks) {
+  /**
+   * Both inputs reference all chunks of the same table, so the rows are united in a bitmap. Duplicates within one input
+   * are emitted only once, too.
+   */
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 4)));
+
+  const auto table = _create_int_int_table(30'000, 1'000);
+
+  auto pos_list_left = PosList{};
+  auto pos_list_right = PosList{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 1'000; ++chunk_offset) {
+      if (chunk_offset % 3 == 0) pos_list_left.emplace_back(RowID{chunk_id, chunk_offset});
+      if (chunk_offset % 5 == 0) pos_list_right.emplace_back(RowID{chunk_id, chunk_offset});
+      if (chunk_offset % 7 == 0) pos_list_left.emplace_back(RowID{chunk_id, chunk_offset});
+    }
+  }
+  std::reverse(pos_list_right.begin(), pos_list_right.end());
+
+  auto table_wrapper_left_op = std::make_shared<TableWrapper>(_create_reference_table(table, pos_list_left, 2'000));
+  auto table_wrapper_right_op = std::make_shared<TableWrapper>(_create_reference_table(table, pos_list_right, 500));
+  auto union_positions_op = std::make_shared<UnionPositions>(table_wrapper_left_op, table_wrapper_right_op);
+  _execute_all({table_wrapper_left_op, table_wrapper_right_op, union_positions_op});
+
+  EXPECT_EQ(_output_pos_list(union_positions_op->get_output()), _expected_pos_list(pos_list_left, pos_list_right));
+  EXPECT_EQ(union_positions_op->get_output()->max_chunk_size(), 2'000u);
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+}
+
+TEST_F(UnionPositionsTest, SingleReferencedTableDifferentChunks) {
+  /**
+   * The inputs reference different chunks of the same table, so the rows are radix sorted and merged
+   */
+  CurrentScheduler::set(std::make_shared<NodeQueueScheduler>(Topology::create_fake_numa_topology(8, 4)));
+
+  const auto table = _create_int_int_table(30'000, 1'000);
+
+  auto pos_list_left = PosList{};
+  auto pos_list_right = PosList{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 1'000; ++chunk_offset) {
+      if (chunk_id < ChunkID{20} && chunk_offset % 2 == 0) pos_list_left.emplace_back(RowID{chunk_id, chunk_offset});
+      if (chunk_id >= ChunkID{10} && chunk_offset % 3 == 0) pos_list_right.emplace_back(RowID{chunk_id, chunk_offset});
+    }
+  }
+  std::reverse(pos_list_left.begin(), pos_list_left.end());
+  pos_list_right.emplace_back(RowID{ChunkID{12}, 0});
+
+  auto table_wrapper_left_op = std::make_shared<TableWrapper>(_create_reference_table(table, pos_list_left, 1'000));
+  auto table_wrapper_right_op = std::make_shared<TableWrapper>(_create_reference_table(table, pos_list_right, 1'000));
+  auto union_positions_op = std::make_shared<UnionPositions>(table_wrapper_left_op, table_wrapper_right_op);
+  _execute_all({table_wrapper_left_op, table_wrapper_right_op, union_positions_op});
+
+  EXPECT_EQ(_output_pos_list(union_positions_op->get_output()), _expected_pos_list(pos_list_left, pos_list_right));
+
+  CurrentScheduler::get()->finish();
+  CurrentScheduler::set(nullptr);
+}
+
+TEST_F(UnionPositionsTest, SingleReferencedTableNullRows) {
+  /**
+   * NULL rows, as produced by outer joins, are not covered by the bitmap and need to be sorted like any other row
+   */
+  const auto table = _create_int_int_table(4, 2);
+
+  const auto pos_list_left = PosList{RowID{ChunkID{1}, 0}, NULL_ROW_ID, RowID{ChunkID{0}, 1}};
+  const auto pos_list_right = PosList{NULL_ROW_ID, RowID{ChunkID{0}, 0}, RowID{ChunkID{1}, 0}};
+
+  auto table_wrapper_left_op = std::make_shared<TableWrapper>(_create_reference_table(table, pos_list_left, 2));
+  auto table_wrapper_right_op = std::make_shared<TableWrapper>(_create_reference_table(table, pos_list_right, 2));
+  auto union_positions_op = std::make_shared<UnionPositions>(table_wrapper_left_op, table_wrapper_right_op);
+  _execute_all({table_wrapper_left_op, table_wrapper_right_op, union_positions_op});
+
+  const auto expected = PosList{RowID{ChunkID{0}, 0}, RowID{ChunkID{0}, 1}, NULL_ROW_ID, RowID{ChunkID{1}, 0}};
+  EXPECT_EQ(_output_pos_list(union_positions_op->get_output()), expected);
+}
+
 }  // namespace opossum
@@ -79,10 +79,9 @@ void OperatorsUpdateTest::helper(std::shared_ptr<GetTable> table_to_update, std:
   auto updated_table = std::make_shared<GetTable>("updateTestTable");
   updated_table->execute();
   ASSERT_NE(updated_table->get_output()->table_statistics(), nullptr);
-  EXPECT_EQ(updated_table->get_output()->table_statistics()->row_count(), original_row_count);
-  // TODO(anybody) atm the statistics will just be informed about the new invalid rows, not about the inserted rows.
-  // fix this
-  EXPECT_EQ(updated_table->get_output()->table_statistics()->approx_valid_row_count(), 0u);
+  // The statistics are informed about the new invalid rows and follow the table's row count for the inserted rows.
+  EXPECT_EQ(updated_table->get_output()->table_statistics()->row_count(), original_row_count * 2);
+  EXPECT_EQ(updated_table->get_output()->table_statistics()->approx_valid_row_count(), original_row_count);
   EXPECT_EQ(updated_table->get_output()->row_count(), original_row_count * 2);
 
   // The total row count (valid + invalid) should have increased by the number of rows that were updated.
@@ -0,0 +1,247 @@
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "optimizer/chunk_statistics.hpp"
+#include "optimizer/column_statistics.hpp"
+#include "optimizer/hyper_log_log.hpp"
+#include "optimizer/table_statistics.hpp"
+#include "resolve_type.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/table.hpp"
+#include "storage/value_column.hpp"
+
+namespace opossum {
+
+class ChunkStatisticsTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(4);
+    _table->add_column("a", DataType::Int, true);
+    _table->add_column("b", DataType::String);
+
+    _table->append({3, "x"});
+    _table->append({NULL_VALUE, "y"});
+    _table->append({3, "x"});
+    _table->append({7, "z"});
+    _table->append({1, "x"});
+  }
+
+  template <typename T>
+  const ChunkColumnStatistics<T>& _column_statistics(const std::shared_ptr<const ChunkStatistics>& chunk_statistics,
+                                                     const ColumnID column_id) {
+    return static_cast<const ChunkColumnStatistics<T>&>(*chunk_statistics->column_statistics[column_id]);
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(ChunkStatisticsTest, HyperLogLogIsExactForFewValues) {
+  auto hyper_log_log = HyperLogLog{};
+  for (auto value = 0; value < 100; ++value) {
+    hyper_log_log.add(value);
+    hyper_log_log.add(value);
+  }
+
+  EXPECT_FLOAT_EQ(hyper_log_log.estimate(), 100.f);
+}
+
+TEST_F(ChunkStatisticsTest, HyperLogLogEstimate) {
+  auto hyper_log_log = HyperLogLog{};
+  for (auto value = 0; value < 100'000; ++value) {
+    hyper_log_log.add(value % 50'000);
+  }
+
+  // Four times the standard error of 3.25%
+  EXPECT_NEAR(hyper_log_log.estimate(), 50'000.f, 50'000.f * 0.13f);
+}
+
+TEST_F(ChunkStatisticsTest, HyperLogLogMerge) {
+  auto hyper_log_log_a = HyperLogLog{};
+  auto hyper_log_log_b = HyperLogLog{};
+  for (auto value = 0; value < 20'000; ++value) {
+    hyper_log_log_a.add(std::to_string(value));
+    hyper_log_log_b.add(std::to_string(value + 10'000));
+  }
+
+  hyper_log_log_a.merge(hyper_log_log_b);
+  EXPECT_NEAR(hyper_log_log_a.estimate(), 30'000.f, 30'000.f * 0.13f);
+
+  // Merging sketches with explicitly stored hashes stays exact
+  auto hyper_log_log_c = HyperLogLog{};
+  auto hyper_log_log_d = HyperLogLog{};
+  hyper_log_log_c.add(std::string{"a"});
+  hyper_log_log_d.add(std::string{"a"});
+  hyper_log_log_d.add(std::string{"b"});
+  hyper_log_log_c.merge(hyper_log_log_d);
+  EXPECT_FLOAT_EQ(hyper_log_log_c.estimate(), 2.f);
+}
+
+TEST_F(ChunkStatisticsTest, ValueColumns) {
+  const auto chunk_statistics = generate_chunk_statistics(*_table->get_chunk(ChunkID{0}), _table->column_types());
+
+  EXPECT_EQ(chunk_statistics->row_count, 4u);
+
+  const auto& statistics_a = _column_statistics<int32_t>(chunk_statistics, ColumnID{0});
+  EXPECT_EQ(statistics_a.null_value_count, 1u);
+  EXPECT_FLOAT_EQ(statistics_a.distinct_values.estimate(), 2.f);
+  EXPECT_EQ(statistics_a.min, 3);
+  EXPECT_EQ(statistics_a.max, 7);
+
+  const auto& statistics_b = _column_statistics<std::string>(chunk_statistics, ColumnID{1});
+  EXPECT_EQ(statistics_b.null_value_count, 0u);
+  EXPECT_FLOAT_EQ(statistics_b.distinct_values.estimate(), 3.f);
+  EXPECT_EQ(statistics_b.min, "x");
+  EXPECT_EQ(statistics_b.max, "z");
+}
+
+TEST_F(ChunkStatisticsTest, EncodedColumns) {
+  for (const auto encoding_type : {EncodingType::Dictionary, EncodingType::RunLength}) {
+    SetUp();
+    const auto chunk = _table->get_chunk(ChunkID{0});
+    EXPECT_EQ(chunk->statistics(), nullptr);
+
+    // Encoding seals the chunk and stores its statistics
+    ChunkEncoder::encode_chunks(_table, {ChunkID{0}}, {encoding_type});
+    const auto chunk_statistics = chunk->statistics();
+    ASSERT_NE(chunk_statistics, nullptr);
+    EXPECT_EQ(chunk_statistics->row_count, 4u);
+
+    const auto& statistics_a = _column_statistics<int32_t>(chunk_statistics, ColumnID{0});
+    EXPECT_EQ(statistics_a.null_value_count, 1u);
+    EXPECT_FLOAT_EQ(statistics_a.distinct_values.estimate(), 2.f);
+    EXPECT_EQ(statistics_a.min, 3);
+    EXPECT_EQ(statistics_a.max, 7);
+
+    const auto& statistics_b = _column_statistics<std::string>(chunk_statistics, ColumnID{1});
+    EXPECT_FLOAT_EQ(statistics_b.distinct_values.estimate(), 3.f);
+    EXPECT_EQ(statistics_b.min, "x");
+    EXPECT_EQ(statistics_b.max, "z");
+  }
+}
+
+TEST_F(ChunkStatisticsTest, SamplesAndHistogramsAreBuiltWhenEncoding) {
+  // A skewed chunk gets a histogram, a uniformly distributed one does not
+  auto table = std::make_shared<Table>(100);
+  table->add_column("a", DataType::Int);
+  for (auto row = 0; row < 100; ++row) table->append({row < 50 ? 1 : row});
+  for (auto row = 0; row < 100; ++row) table->append({row});
+
+  ChunkEncoder::encode_all_chunks(table);
+  const auto& skewed_statistics = _column_statistics<int32_t>(table->get_chunk(ChunkID{0})->statistics(), ColumnID{0});
+  const auto& uniform_statistics = _column_statistics<int32_t>(table->get_chunk(ChunkID{1})->statistics(), ColumnID{0});
+  EXPECT_NE(skewed_statistics.histogram, nullptr);
+  EXPECT_EQ(uniform_statistics.histogram, nullptr);
+
+  // The samples are sorted, with equal values combined
+  ASSERT_EQ(skewed_statistics.weighted_samples.size(), 51u);
+  EXPECT_EQ(skewed_statistics.weighted_samples.front(), std::make_pair(1, 50.f));
+  EXPECT_EQ(skewed_statistics.weighted_samples.back(), std::make_pair(99, 1.f));
+
+  // The histogram of a single chunk is reused, those of several chunks are built from their merged samples
+  auto merged_statistics = MergedChunkColumnStatistics<int32_t>{};
+  merged_statistics.merge_chunks(*table, ColumnID{0}, ChunkID{1});
+  EXPECT_EQ(merged_statistics.histogram, skewed_statistics.histogram);
+
+  merged_statistics.merge_chunks(*table, ColumnID{0}, ChunkID{2});
+  EXPECT_EQ(merged_statistics.histogram, nullptr);
+  EXPECT_EQ(merged_statistics.weighted_samples.size(), 151u);
+  EXPECT_TRUE(std::is_sorted(merged_statistics.weighted_samples.cbegin(), merged_statistics.weighted_samples.cend(),
+                             [](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; }));
+}
+
+TEST_F(ChunkStatisticsTest, MergingDoesNotStoreStatisticsOfGrowingChunks) {
+  auto merged_statistics = MergedChunkColumnStatistics<int32_t>{};
+  merged_statistics.merge_chunks(*_table, ColumnID{0}, _table->chunk_count());
+
+  EXPECT_EQ(merged_statistics.row_count, 5u);
+  EXPECT_EQ(merged_statistics.max, 7);
+  EXPECT_EQ(_table->get_chunk(ChunkID{0})->statistics(), nullptr);
+  EXPECT_EQ(_table->get_chunk(ChunkID{1})->statistics(), nullptr);
+}
+
+TEST_F(ChunkStatisticsTest, TableStatisticsMergeChunkStatistics) {
+  ChunkEncoder::encode_chunks(_table, {ChunkID{0}});
+
+  auto table_statistics = std::make_shared<TableStatistics>(_table);
+  _table->set_table_statistics(table_statistics);
+
+  const auto column_statistics_a =
+      std::dynamic_pointer_cast<ColumnStatistics<int32_t>>(table_statistics->column_statistics()[0]);
+  ASSERT_NE(column_statistics_a, nullptr);
+  EXPECT_FLOAT_EQ(column_statistics_a->distinct_count(), 3.f);
+  EXPECT_FLOAT_EQ(column_statistics_a->null_value_ratio(), 0.2f);
+
+  // Rows appended to the table are reflected in the column statistics
+  _table->append({5, "x"});
+  _table->append({NULL_VALUE, "x"});
+
+  const auto new_column_statistics_a =
+      std::dynamic_pointer_cast<ColumnStatistics<int32_t>>(table_statistics->column_statistics()[0]);
+  ASSERT_NE(new_column_statistics_a, nullptr);
+  EXPECT_NE(new_column_statistics_a, column_statistics_a);
+  EXPECT_FLOAT_EQ(new_column_statistics_a->distinct_count(), 4.f);
+  EXPECT_FLOAT_EQ(new_column_statistics_a->null_value_ratio(), 2.f / 7.f);
+}
+
+TEST_F(ChunkStatisticsTest, TableStatisticsMergeFullChunksOnce) {
+  auto table_statistics = std::make_shared<TableStatistics>(_table);
+  _table->set_table_statistics(table_statistics);
+  table_statistics->column_statistics();
+
+  // The first chunk is full, so its statistics are not looked at again when rows are added. Statistics of other
+  // values stored in it afterwards thus do not show up in the merged statistics.
+  auto other_table = std::make_shared<Table>(4);
+  other_table->add_column("a", DataType::Int, true);
+  other_table->add_column("b", DataType::String);
+  for (auto value = 100; value < 104; ++value) other_table->append({value, "x"});
+  const auto full_chunk = _table->get_chunk(ChunkID{0});
+  full_chunk->set_statistics(generate_chunk_statistics(*other_table->get_chunk(ChunkID{0}), _table->column_types()));
+
+  _table->append({5, "x"});
+  _table->append({NULL_VALUE, "x"});
+  _table->append({9, "x"});
+  _table->append({2, "x"});
+  ASSERT_EQ(_table->chunk_count(), 3u);
+
+  const auto column_statistics_a =
+      std::dynamic_pointer_cast<ColumnStatistics<int32_t>>(table_statistics->column_statistics()[0]);
+  ASSERT_NE(column_statistics_a, nullptr);
+  EXPECT_FLOAT_EQ(column_statistics_a->distinct_count(), 6.f);
+  EXPECT_FLOAT_EQ(column_statistics_a->null_value_ratio(), 2.f / 9.f);
+
+  // Derived statistics use the column statistics of the stored table
+  const auto predicate_statistics =
+      table_statistics->predicate_statistics(ColumnID{0}, PredicateCondition::GreaterThan, AllTypeVariant{3});
+  EXPECT_EQ(predicate_statistics->column_statistics()[1], table_statistics->column_statistics()[1]);
+}
+
+TEST_F(ChunkStatisticsTest, TableStatisticsFollowRowCount) {
+  auto table_statistics = std::make_shared<TableStatistics>(_table);
+  _table->set_table_statistics(table_statistics);
+  EXPECT_FLOAT_EQ(table_statistics->row_count(), 5.f);
+
+  _table->append({5, "x"});
+  EXPECT_FLOAT_EQ(table_statistics->row_count(), 6.f);
+
+  auto chunk = std::make_shared<Chunk>();
+  chunk->add_column(make_shared_by_data_type<BaseColumn, ValueColumn>(DataType::Int, true));
+  chunk->add_column(make_shared_by_data_type<BaseColumn, ValueColumn>(DataType::String));
+  chunk->append({8, "y"});
+  chunk->append({9, "y"});
+  _table->emplace_chunk(chunk);
+  EXPECT_FLOAT_EQ(table_statistics->row_count(), 8.f);
+
+  // Statistics derived after rows were added are based on the new row count
+  const auto predicate_statistics =
+      table_statistics->predicate_statistics(ColumnID{0}, PredicateCondition::Equals, AllTypeVariant{8});
+  EXPECT_GT(predicate_statistics->row_count(), 0.f);
+  EXPECT_LE(predicate_statistics->row_count(), 8.f);
+}
+
+}  // namespace opossum
@@ -401,4 +401,37 @@ TEST_F(ColumnStatisticsTest, NonNullRatioTwoColumnTest) {
   EXPECT_FLOAT_EQ(result.selectivity, 0.8f * 0.85f * (1.f / 3.f + 1.f / 3.f * 1.f / 2.f));
 }
 
+TEST_F(ColumnStatisticsTest, SkewedDistributionTest) {
+  // 90 % of the values are 1, the other values are 2 to 11
+  auto table = std::make_shared<Table>();
+  table->add_column("a", DataType::Int);
+  for (auto row = 0; row < 90; ++row) {
+    table->append({1});
+  }
+  for (auto value = 2; value <= 11; ++value) {
+    table->append({value});
+  }
+
+  auto column_statistics = std::make_shared<ColumnStatistics<int32_t>>(ColumnID{0}, table);
+  EXPECT_FLOAT_EQ(column_statistics->distinct_count(), 11.f);
+
+  auto result = column_statistics->estimate_selectivity_for_predicate(PredicateCondition::Equals, AllTypeVariant(1));
+  EXPECT_NEAR(result.selectivity, 0.9f, 0.0001f);
+  result = column_statistics->estimate_selectivity_for_predicate(PredicateCondition::Equals, AllTypeVariant(5));
+  EXPECT_NEAR(result.selectivity, 0.01f, 0.0001f);
+  result = column_statistics->estimate_selectivity_for_predicate(PredicateCondition::NotEquals, AllTypeVariant(1));
+  EXPECT_NEAR(result.selectivity, 0.1f, 0.0001f);
+  result = column_statistics->estimate_selectivity_for_predicate(PredicateCondition::LessThan, AllTypeVariant(2));
+  EXPECT_NEAR(result.selectivity, 0.9f, 0.0001f);
+  result = column_statistics->estimate_selectivity_for_predicate(PredicateCondition::GreaterThan, AllTypeVariant(6));
+  EXPECT_NEAR(result.selectivity, 0.05f, 0.0001f);
+
+  // Statistics derived from a range predicate keep using the histogram
+  result = column_statistics->estimate_selectivity_for_predicate(PredicateCondition::GreaterThan, AllTypeVariant(1));
+  EXPECT_NEAR(result.selectivity, 0.1f, 0.0001f);
+  result = result.column_statistics->estimate_selectivity_for_predicate(PredicateCondition::LessThanEquals,
+                                                                        AllTypeVariant(6));
+  EXPECT_NEAR(result.selectivity, 0.5f, 0.0001f);
+}
+
 }  // namespace opossum
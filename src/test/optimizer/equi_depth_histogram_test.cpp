@@ -0,0 +1,66 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "optimizer/equi_depth_histogram.hpp"
+
+namespace opossum {
+
+class EquiDepthHistogramTest : public BaseTest {};
+
+TEST_F(EquiDepthHistogramTest, NoHistogramForUniformDistribution) {
+  auto int_samples = std::vector<std::pair<int32_t, float>>{};
+  auto float_samples = std::vector<std::pair<float, float>>{};
+  for (auto value = 1; value <= 100; ++value) {
+    int_samples.emplace_back(value, 3.f);
+    float_samples.emplace_back(static_cast<float>(value), 3.f);
+  }
+
+  EXPECT_EQ(EquiDepthHistogram<int32_t>::from_samples(int_samples, 100.f), nullptr);
+  EXPECT_EQ(EquiDepthHistogram<float>::from_samples(float_samples, 100.f), nullptr);
+  EXPECT_EQ(EquiDepthHistogram<int32_t>::from_samples({}, 0.f), nullptr);
+}
+
+TEST_F(EquiDepthHistogramTest, SkewedNumbers) {
+  // Half of the values are 1, the other half is distributed uniformly over 2 to 101
+  auto samples = std::vector<std::pair<int32_t, float>>{{1, 500.f}};
+  for (auto value = 2; value <= 101; ++value) {
+    samples.emplace_back(value, 5.f);
+  }
+
+  const auto histogram = EquiDepthHistogram<int32_t>::from_samples(samples, 101.f);
+  ASSERT_NE(histogram, nullptr);
+
+  EXPECT_FLOAT_EQ(histogram->estimate_equals_fraction(1), 0.5f);
+  EXPECT_FLOAT_EQ(histogram->estimate_equals_fraction(50), 0.005f);
+
+  EXPECT_NEAR(histogram->estimate_range_fraction(1, 101), 1.f, 0.0001f);
+  EXPECT_NEAR(histogram->estimate_range_fraction(2, 101), 0.5f, 0.0001f);
+  EXPECT_NEAR(histogram->estimate_range_fraction(1, 11), 0.55f, 0.0001f);
+  EXPECT_FLOAT_EQ(histogram->estimate_range_fraction(102, 200), 0.f);
+  EXPECT_FLOAT_EQ(histogram->estimate_range_fraction(11, 1), 0.f);
+}
+
+TEST_F(EquiDepthHistogramTest, SkewedStrings) {
+  auto samples = std::vector<std::pair<std::string, float>>{{"x", 100.f}};
+  for (auto value = 0; value < 100; ++value) {
+    samples.emplace_back("s" + std::string(value < 10 ? "0" : "") + std::to_string(value), 1.f);
+  }
+
+  const auto histogram = EquiDepthHistogram<std::string>::from_samples(samples, 101.f);
+  ASSERT_NE(histogram, nullptr);
+
+  EXPECT_FLOAT_EQ(histogram->estimate_equals_fraction("x"), 0.5f);
+  EXPECT_FLOAT_EQ(histogram->estimate_equals_fraction("s50"), 0.005f);
+
+  EXPECT_NEAR(histogram->estimate_range_fraction("s00", "s99"), 0.5f, 0.0001f);
+
+  // Buckets covered partially count half
+  EXPECT_FLOAT_EQ(histogram->estimate_range_fraction("s00", "s01"), 0.01f);
+}
+
+}  // namespace opossum
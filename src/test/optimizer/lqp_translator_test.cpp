@@ -30,6 +30,7 @@
 #include "operators/projection.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
+#include "operators/top_k.hpp"
 #include "operators/union_positions.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/index/group_key/group_key_index.hpp"
@@ -259,6 +260,28 @@ TEST_F(LQPTranslatorTest, SortNode) {
   EXPECT_EQ(sort_op->order_by_mode(), OrderByMode::Ascending);
 }
 
+TEST_F(LQPTranslatorTest, SortNodeMultipleColumns) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  const auto stored_table_node = StoredTableNode::make("table_int_float");
+  auto sort_node = SortNode::make(
+      std::vector<OrderByDefinition>{{LQPColumnReference(stored_table_node, ColumnID{1}), OrderByMode::Descending},
+                                     {LQPColumnReference(stored_table_node, ColumnID{0}), OrderByMode::Ascending}});
+  sort_node->set_left_child(stored_table_node);
+  const auto op = LQPTranslator{}.translate_node(sort_node);
+
+  // All columns are sorted by a single operator
+  const auto sort_op = std::dynamic_pointer_cast<Sort>(op);
+  ASSERT_TRUE(sort_op);
+  ASSERT_EQ(sort_op->sort_definitions().size(), 2u);
+  EXPECT_EQ(sort_op->sort_definitions()[0].column_id, ColumnID{1});
+  EXPECT_EQ(sort_op->sort_definitions()[0].order_by_mode, OrderByMode::Descending);
+  EXPECT_EQ(sort_op->sort_definitions()[1].column_id, ColumnID{0});
+  EXPECT_EQ(sort_op->sort_definitions()[1].order_by_mode, OrderByMode::Ascending);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const GetTable>(sort_op->input_left()));
+}
+
 TEST_F(LQPTranslatorTest, JoinNode) {
   /**
    * Build LQP and translate to PQP
@@ -469,6 +492,31 @@ TEST_F(LQPTranslatorTest, LimitNode) {
   EXPECT_EQ(limit_op->num_rows(), num_rows);
 }
 
+TEST_F(LQPTranslatorTest, LimitNodeOverTopKSortNode) {
+  /**
+   * Build LQP and translate to PQP
+   */
+  const auto stored_table_node = StoredTableNode::make("table_int_float");
+  auto sort_node = SortNode::make(
+      std::vector<OrderByDefinition>{{LQPColumnReference(stored_table_node, ColumnID{1}), OrderByMode::Descending}});
+  sort_node->set_left_child(stored_table_node);
+  sort_node->set_top_k(3);
+
+  auto limit_node = LimitNode::make(3);
+  limit_node->set_left_child(sort_node);
+
+  /**
+   * Check PQP - the Limit is not needed on top of the TopK
+   */
+  const auto op = LQPTranslator{}.translate_node(limit_node);
+  const auto top_k_op = std::dynamic_pointer_cast<TopK>(op);
+  ASSERT_TRUE(top_k_op);
+  EXPECT_EQ(top_k_op->k(), 3u);
+  ASSERT_EQ(top_k_op->sort_definitions().size(), 1u);
+  EXPECT_EQ(top_k_op->sort_definitions()[0].column_id, ColumnID{1});
+  EXPECT_EQ(top_k_op->sort_definitions()[0].order_by_mode, OrderByMode::Descending);
+}
+
 TEST_F(LQPTranslatorTest, DiamondShapeSimple) {
   /**
    * Test that
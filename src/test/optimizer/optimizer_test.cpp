@@ -1,12 +1,21 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../base_test.hpp"
 #include "gtest/gtest.h"
 
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/lqp_expression.hpp"
 #include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
 #include "optimizer/optimizer.hpp"
 #include "optimizer/strategy/abstract_rule.hpp"
+#include "storage/storage_manager.hpp"
 
 namespace opossum {
 
-class OptimizerTest : public ::testing::Test {};
+class OptimizerTest : public BaseTest {};
 
 struct MockRule : public AbstractRule {
   explicit MockRule(size_t num_iterations) : num_iterations(num_iterations) {}
@@ -50,4 +59,30 @@ TEST_F(OptimizerTest, RuleBatches) {
   EXPECT_EQ(iterative_rule_d->num_iterations, 6u);
 }
 
+TEST_F(OptimizerTest, PipelineFusionCanBeDisabled) {
+  StorageManager::get().add_table("a", load_table("src/test/tables/int_float.tbl", Chunk::MAX_SIZE));
+
+  // SUM(a) ... GROUP BY b
+  const auto make_aggregate_node = [] {
+    const auto stored_table_node = StoredTableNode::make("a");
+    const auto a = LQPColumnReference{stored_table_node, ColumnID{0}};
+    const auto b = LQPColumnReference{stored_table_node, ColumnID{1}};
+
+    const auto aggregate_node = AggregateNode::make(
+        std::vector<std::shared_ptr<LQPExpression>>{LQPExpression::create_aggregate_function(
+            AggregateFunction::Sum, {LQPExpression::create_column(a)})},
+        std::vector<LQPColumnReference>{b});
+    aggregate_node->set_left_child(stored_table_node);
+    return aggregate_node;
+  };
+
+  const auto fused_aggregate_node = make_aggregate_node();
+  Optimizer::create_default_optimizer()->optimize(fused_aggregate_node);
+  EXPECT_TRUE(fused_aggregate_node->fused_predicate_count());
+
+  const auto unfused_aggregate_node = make_aggregate_node();
+  Optimizer::create_default_optimizer(UsePipelineFusion::No)->optimize(unfused_aggregate_node);
+  EXPECT_FALSE(unfused_aggregate_node->fused_predicate_count());
+}
+
 }  // namespace opossum
@@ -0,0 +1,176 @@
+#include <memory>
+#include <vector>
+
+#include "../../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/sort_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "logical_query_plan/union_node.hpp"
+#include "logical_query_plan/validate_node.hpp"
+#include "optimizer/strategy/join_algorithm_rule.hpp"
+#include "optimizer/strategy/strategy_base_test.hpp"
+#include "optimizer/table_statistics.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/group_key/group_key_index.hpp"
+#include "storage/storage_manager.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class JoinAlgorithmRuleTest : public StrategyBaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("a", load_table("src/test/tables/int_float.tbl", Chunk::MAX_SIZE));
+    StorageManager::get().add_table("b", load_table("src/test/tables/int_float2.tbl", Chunk::MAX_SIZE));
+
+    _stored_table_node_a = StoredTableNode::make("a");
+    _stored_table_node_b = StoredTableNode::make("b");
+
+    _a_a = LQPColumnReference{_stored_table_node_a, ColumnID{0}};
+    _b_a = LQPColumnReference{_stored_table_node_b, ColumnID{0}};
+
+    _rule = std::make_shared<JoinAlgorithmRule>();
+  }
+
+  // Pretends that the stored tables are large
+  void _set_large_statistics() {
+    const auto no_column_statistics = std::vector<std::shared_ptr<BaseColumnStatistics>>{};
+    _stored_table_node_a->set_statistics(std::make_shared<TableStatistics>(10'000.0f, no_column_statistics));
+    _stored_table_node_b->set_statistics(std::make_shared<TableStatistics>(20'000.0f, no_column_statistics));
+  }
+
+  std::shared_ptr<JoinNode> _make_join(const JoinMode join_mode, const PredicateCondition predicate_condition,
+                                       const std::shared_ptr<AbstractLQPNode>& left,
+                                       const std::shared_ptr<AbstractLQPNode>& right) {
+    auto join_node = JoinNode::make(join_mode, LQPColumnReferencePair{_a_a, _b_a}, predicate_condition);
+    join_node->set_left_child(left);
+    join_node->set_right_child(right);
+    return join_node;
+  }
+
+  std::shared_ptr<StoredTableNode> _stored_table_node_a, _stored_table_node_b;
+  LQPColumnReference _a_a, _b_a;
+  std::shared_ptr<JoinAlgorithmRule> _rule;
+};
+
+TEST_F(JoinAlgorithmRuleTest, SmallInputsUseNestedLoopJoin) {
+  auto join_node = _make_join(JoinMode::Inner, PredicateCondition::Equals, _stored_table_node_a, _stored_table_node_b);
+
+  EXPECT_FALSE(join_node->join_type());
+  StrategyBaseTest::apply_rule(_rule, join_node);
+  EXPECT_EQ(join_node->join_type(), JoinType::NestedLoop);
+}
+
+TEST_F(JoinAlgorithmRuleTest, EquiJoinUsesHashJoin) {
+  _set_large_statistics();
+  auto join_node = _make_join(JoinMode::Left, PredicateCondition::Equals, _stored_table_node_a, _stored_table_node_b);
+
+  StrategyBaseTest::apply_rule(_rule, join_node);
+  EXPECT_EQ(join_node->join_type(), JoinType::Hash);
+}
+
+TEST_F(JoinAlgorithmRuleTest, NonEquiJoinUsesSortMergeJoin) {
+  _set_large_statistics();
+  auto join_node_less =
+      _make_join(JoinMode::Inner, PredicateCondition::LessThan, _stored_table_node_a, _stored_table_node_b);
+  StrategyBaseTest::apply_rule(_rule, join_node_less);
+  EXPECT_EQ(join_node_less->join_type(), JoinType::SortMerge);
+
+  auto join_node_outer =
+      _make_join(JoinMode::Outer, PredicateCondition::Equals, _stored_table_node_a, _stored_table_node_b);
+  StrategyBaseTest::apply_rule(_rule, join_node_outer);
+  EXPECT_EQ(join_node_outer->join_type(), JoinType::SortMerge);
+
+  // JoinSortMerge does not support not-equals predicates for outer joins
+  auto join_node_not_equals =
+      _make_join(JoinMode::Left, PredicateCondition::NotEquals, _stored_table_node_a, _stored_table_node_b);
+  StrategyBaseTest::apply_rule(_rule, join_node_not_equals);
+  EXPECT_EQ(join_node_not_equals->join_type(), JoinType::NestedLoop);
+}
+
+TEST_F(JoinAlgorithmRuleTest, SortedInputsUseSortMergeJoin) {
+  _set_large_statistics();
+  auto sort_node_a = SortNode::make(OrderByDefinitions{{_a_a, OrderByMode::Ascending}});
+  sort_node_a->set_left_child(_stored_table_node_a);
+  auto sort_node_b = SortNode::make(OrderByDefinitions{{_b_a, OrderByMode::Ascending}});
+  sort_node_b->set_left_child(_stored_table_node_b);
+
+  auto join_node = _make_join(JoinMode::Inner, PredicateCondition::Equals, sort_node_a, sort_node_b);
+  StrategyBaseTest::apply_rule(_rule, join_node);
+  EXPECT_EQ(join_node->join_type(), JoinType::SortMerge);
+
+  // Descending order does not help JoinSortMerge
+  auto sort_node_b_descending = SortNode::make(OrderByDefinitions{{_b_a, OrderByMode::Descending}});
+  sort_node_b_descending->set_left_child(_stored_table_node_b);
+
+  auto join_node_descending =
+      _make_join(JoinMode::Inner, PredicateCondition::Equals, sort_node_a, sort_node_b_descending);
+  StrategyBaseTest::apply_rule(_rule, join_node_descending);
+  EXPECT_EQ(join_node_descending->join_type(), JoinType::Hash);
+}
+
+TEST_F(JoinAlgorithmRuleTest, SmallInputOnIndexedTableUsesIndexJoin) {
+  const auto no_column_statistics = std::vector<std::shared_ptr<BaseColumnStatistics>>{};
+  _stored_table_node_a->set_statistics(std::make_shared<TableStatistics>(100.0f, no_column_statistics));
+  _stored_table_node_b->set_statistics(std::make_shared<TableStatistics>(100'000.0f, no_column_statistics));
+
+  // Without an index on the join column of the right input, JoinHash is used
+  auto join_node = _make_join(JoinMode::Inner, PredicateCondition::Equals, _stored_table_node_a, _stored_table_node_b);
+  StrategyBaseTest::apply_rule(_rule, join_node);
+  EXPECT_EQ(join_node->join_type(), JoinType::Hash);
+
+  const auto table_b = StorageManager::get().get_table("b");
+  ChunkEncoder::encode_all_chunks(table_b);
+  table_b->create_index<GroupKeyIndex>({ColumnID{0}});
+
+  auto join_node_indexed =
+      _make_join(JoinMode::Left, PredicateCondition::Equals, _stored_table_node_a, _stored_table_node_b);
+  StrategyBaseTest::apply_rule(_rule, join_node_indexed);
+  EXPECT_EQ(join_node_indexed->join_type(), JoinType::Index);
+
+  // Probing the index once per left row does not pay off if the left input is not much smaller
+  _stored_table_node_a->set_statistics(std::make_shared<TableStatistics>(10'000.0f, no_column_statistics));
+  auto join_node_large_left =
+      _make_join(JoinMode::Inner, PredicateCondition::Equals, _stored_table_node_a, _stored_table_node_b);
+  StrategyBaseTest::apply_rule(_rule, join_node_large_left);
+  EXPECT_EQ(join_node_large_left->join_type(), JoinType::Hash);
+}
+
+TEST_F(JoinAlgorithmRuleTest, ValidatedIndexedTableUsesIndexJoin) {
+  const auto no_column_statistics = std::vector<std::shared_ptr<BaseColumnStatistics>>{};
+  _stored_table_node_a->set_statistics(std::make_shared<TableStatistics>(100.0f, no_column_statistics));
+  _stored_table_node_b->set_statistics(std::make_shared<TableStatistics>(100'000.0f, no_column_statistics));
+
+  const auto table_b = StorageManager::get().get_table("b");
+  ChunkEncoder::encode_all_chunks(table_b);
+  table_b->create_index<GroupKeyIndex>({ColumnID{0}});
+
+  auto join_node = _make_join(JoinMode::Inner, PredicateCondition::Equals, _stored_table_node_a,
+                              ValidateNode::make(_stored_table_node_b));
+  StrategyBaseTest::apply_rule(_rule, join_node);
+  EXPECT_EQ(join_node->join_type(), JoinType::Index);
+}
+
+TEST_F(JoinAlgorithmRuleTest, JoinAboveUnion) {
+  // (SELECT * FROM a WHERE a = 1 OR a = 2) JOIN b. No statistics can be derived for the UnionNode, so the join type
+  // is chosen without row counts.
+  auto predicate_node_1 = PredicateNode::make(_a_a, PredicateCondition::Equals, 1, _stored_table_node_a);
+  auto predicate_node_2 = PredicateNode::make(_a_a, PredicateCondition::Equals, 2, _stored_table_node_a);
+  auto union_node = UnionNode::make(UnionMode::Positions, predicate_node_1, predicate_node_2);
+  auto join_node = _make_join(JoinMode::Inner, PredicateCondition::Equals, union_node, _stored_table_node_b);
+
+  StrategyBaseTest::apply_rule(_rule, join_node);
+  EXPECT_EQ(join_node->join_type(), JoinType::Hash);
+}
+
+TEST_F(JoinAlgorithmRuleTest, SemiJoinKeepsDefault) {
+  auto join_node = _make_join(JoinMode::Semi, PredicateCondition::Equals, _stored_table_node_a, _stored_table_node_b);
+
+  StrategyBaseTest::apply_rule(_rule, join_node);
+  EXPECT_FALSE(join_node->join_type());
+}
+
+}  // namespace opossum
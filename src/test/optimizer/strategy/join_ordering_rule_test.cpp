@@ -0,0 +1,210 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_column_reference.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/union_node.hpp"
+#include "optimizer/column_statistics.hpp"
+#include "optimizer/strategy/join_ordering_rule.hpp"
+#include "optimizer/strategy/strategy_base_test.hpp"
+#include "optimizer/table_statistics.hpp"
+
+namespace opossum {
+
+class JoinOrderingRuleTest : public StrategyBaseTest {
+ protected:
+  void SetUp() override {
+    /**
+     * a and b are large and joining them on a.a = b.a yields 10 million rows. c is tiny and b.b = c.a is selective,
+     * so joining b and c first keeps all intermediate results small.
+     */
+    const auto statistics_a = std::make_shared<TableStatistics>(
+        10'000, std::vector<std::shared_ptr<BaseColumnStatistics>>{
+                    std::make_shared<ColumnStatistics<int32_t>>(ColumnID{0}, 10, 0, 9)});
+    const auto statistics_b = std::make_shared<TableStatistics>(
+        10'000, std::vector<std::shared_ptr<BaseColumnStatistics>>{
+                    std::make_shared<ColumnStatistics<int32_t>>(ColumnID{0}, 10, 0, 9),
+                    std::make_shared<ColumnStatistics<int32_t>>(ColumnID{1}, 10'000, 0, 9'999)});
+    const auto statistics_c = std::make_shared<TableStatistics>(
+        10, std::vector<std::shared_ptr<BaseColumnStatistics>>{
+                std::make_shared<ColumnStatistics<int32_t>>(ColumnID{0}, 10, 0, 9'999)});
+
+    _node_a = MockNode::make(statistics_a);
+    _node_b = MockNode::make(statistics_b);
+    _node_c = MockNode::make(statistics_c);
+
+    _a_a = LQPColumnReference{_node_a, ColumnID{0}};
+    _b_a = LQPColumnReference{_node_b, ColumnID{0}};
+    _b_b = LQPColumnReference{_node_b, ColumnID{1}};
+    _c_a = LQPColumnReference{_node_c, ColumnID{0}};
+
+    _rule = std::make_shared<JoinOrderingRule>();
+  }
+
+  // Checks that the LQP joins b and c first and a afterwards, see SetUp()
+  void _check_join_order(const std::shared_ptr<AbstractLQPNode>& join_node) {
+    ASSERT_INNER_JOIN_NODE(join_node, PredicateCondition::Equals, _a_a, _b_a);
+    EXPECT_EQ(join_node->left_child(), _node_a);
+
+    const auto right_join_node = join_node->right_child();
+    ASSERT_INNER_JOIN_NODE(right_join_node, PredicateCondition::Equals, _b_b, _c_a);
+    EXPECT_EQ(right_join_node->left_child(), _node_b);
+    EXPECT_EQ(right_join_node->right_child(), _node_c);
+  }
+
+  std::shared_ptr<MockNode> _node_a, _node_b, _node_c;
+  LQPColumnReference _a_a, _b_a, _b_b, _c_a;
+  std::shared_ptr<JoinOrderingRule> _rule;
+};
+
+TEST_F(JoinOrderingRuleTest, SmallIntermediateResultsFirst) {
+  /**
+   * Test that
+   *
+   *          Join
+   *    (b.b == c.a)
+   *       /      \
+   *     Join      c
+   * (a.a == b.a)
+   *   /     \
+   *  a       b
+   *
+   * gets converted to
+   *
+   *      Join
+   *  (a.a == b.a)
+   *    /     \
+   *   a     Join
+   *     (b.b == c.a)
+   *       /     \
+   *      b       c
+   */
+  auto join_node_ab = JoinNode::make(JoinMode::Inner, LQPColumnReferencePair{_a_a, _b_a}, PredicateCondition::Equals);
+  join_node_ab->set_left_child(_node_a);
+  join_node_ab->set_right_child(_node_b);
+
+  auto join_node_bc = JoinNode::make(JoinMode::Inner, LQPColumnReferencePair{_b_b, _c_a}, PredicateCondition::Equals);
+  join_node_bc->set_left_child(join_node_ab);
+  join_node_bc->set_right_child(_node_c);
+
+  const auto output_column_references = join_node_bc->output_column_references();
+
+  const auto output = StrategyBaseTest::apply_rule(_rule, join_node_bc);
+
+  _check_join_order(output);
+  EXPECT_EQ(output->output_column_references(), output_column_references);
+}
+
+TEST_F(JoinOrderingRuleTest, CrossJoinsWithPredicates) {
+  /**
+   * Test that
+   *
+   *     Predicate
+   *   (c.a == b.b)
+   *        |
+   *     Predicate
+   *   (b.a == a.a)
+   *        |
+   *      Cross
+   *     /     \
+   *  Cross     a
+   *  /   \
+   * c     b
+   *
+   * gets converted to the same joins as in SmallIntermediateResultsFirst. As the join order changes the order of the
+   * output columns, a Projection restores the original column order.
+   */
+  auto cross_join_node_cb = JoinNode::make(JoinMode::Cross);
+  cross_join_node_cb->set_left_child(_node_c);
+  cross_join_node_cb->set_right_child(_node_b);
+
+  auto cross_join_node_cba = JoinNode::make(JoinMode::Cross);
+  cross_join_node_cba->set_left_child(cross_join_node_cb);
+  cross_join_node_cba->set_right_child(_node_a);
+
+  auto predicate_node_ba = PredicateNode::make(_b_a, PredicateCondition::Equals, _a_a);
+  predicate_node_ba->set_left_child(cross_join_node_cba);
+
+  auto predicate_node_cb = PredicateNode::make(_c_a, PredicateCondition::Equals, _b_b);
+  predicate_node_cb->set_left_child(predicate_node_ba);
+
+  const auto output_column_references = predicate_node_cb->output_column_references();
+
+  const auto output = StrategyBaseTest::apply_rule(_rule, predicate_node_cb);
+
+  ASSERT_EQ(output->type(), LQPNodeType::Projection);
+  EXPECT_EQ(output->output_column_references(), output_column_references);
+  _check_join_order(output->left_child());
+}
+
+TEST_F(JoinOrderingRuleTest, GreedyFallback) {
+  auto join_node_ab = JoinNode::make(JoinMode::Inner, LQPColumnReferencePair{_a_a, _b_a}, PredicateCondition::Equals);
+  join_node_ab->set_left_child(_node_a);
+  join_node_ab->set_right_child(_node_b);
+
+  auto join_node_bc = JoinNode::make(JoinMode::Inner, LQPColumnReferencePair{_b_b, _c_a}, PredicateCondition::Equals);
+  join_node_bc->set_left_child(join_node_ab);
+  join_node_bc->set_right_child(_node_c);
+
+  // Do not use dynamic programming for join graphs with more than two relations
+  const auto output = StrategyBaseTest::apply_rule(std::make_shared<JoinOrderingRule>(2), join_node_bc);
+
+  _check_join_order(output);
+}
+
+TEST_F(JoinOrderingRuleTest, LocalPredicatesStayWithTheirRelation) {
+  /**
+   * The predicate on a.a is placed directly on top of a, the predicate comparing a.a and b.a becomes a join predicate
+   */
+  auto cross_join_node_ab = JoinNode::make(JoinMode::Cross);
+  cross_join_node_ab->set_left_child(_node_a);
+  cross_join_node_ab->set_right_child(_node_b);
+
+  auto join_node_bc = JoinNode::make(JoinMode::Inner, LQPColumnReferencePair{_b_b, _c_a}, PredicateCondition::Equals);
+  join_node_bc->set_left_child(cross_join_node_ab);
+  join_node_bc->set_right_child(_node_c);
+
+  auto predicate_node_ab = PredicateNode::make(_a_a, PredicateCondition::Equals, _b_a);
+  predicate_node_ab->set_left_child(join_node_bc);
+
+  auto predicate_node_a = PredicateNode::make(_a_a, PredicateCondition::GreaterThan, 5);
+  predicate_node_a->set_left_child(predicate_node_ab);
+
+  const auto output = StrategyBaseTest::apply_rule(_rule, predicate_node_a);
+
+  ASSERT_EQ(output->type(), LQPNodeType::Join);
+  EXPECT_EQ(output->left_child(), predicate_node_a);
+  EXPECT_EQ(predicate_node_a->left_child(), _node_a);
+  EXPECT_EQ(output->right_child()->type(), LQPNodeType::Join);
+}
+
+TEST_F(JoinOrderingRuleTest, RelationWithoutStatistics) {
+  /**
+   * Statistics cannot be derived for a, which is the union of two predicates (e.g., a.a = 1 OR a.a = 2), so the join
+   * graph is left as it is
+   */
+  auto union_node_a =
+      UnionNode::make(UnionMode::Positions, PredicateNode::make(_a_a, PredicateCondition::Equals, 1, _node_a),
+                      PredicateNode::make(_a_a, PredicateCondition::Equals, 2, _node_a));
+
+  auto join_node_ab = JoinNode::make(JoinMode::Inner, LQPColumnReferencePair{_a_a, _b_a}, PredicateCondition::Equals);
+  join_node_ab->set_left_child(union_node_a);
+  join_node_ab->set_right_child(_node_b);
+
+  auto join_node_bc = JoinNode::make(JoinMode::Inner, LQPColumnReferencePair{_b_b, _c_a}, PredicateCondition::Equals);
+  join_node_bc->set_left_child(join_node_ab);
+  join_node_bc->set_right_child(_node_c);
+
+  const auto output = StrategyBaseTest::apply_rule(_rule, join_node_bc);
+
+  EXPECT_EQ(output, join_node_bc);
+  EXPECT_EQ(join_node_bc->left_child(), join_node_ab);
+  EXPECT_EQ(join_node_ab->left_child(), union_node_a);
+}
+
+}  // namespace opossum
@@ -0,0 +1,73 @@
+#include <memory>
+#include <vector>
+
+#include "../../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "logical_query_plan/limit_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/sort_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "optimizer/strategy/materialization_rule.hpp"
+#include "optimizer/strategy/strategy_base_test.hpp"
+#include "optimizer/table_statistics.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class MaterializationRuleTest : public StrategyBaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("a", load_table("src/test/tables/int_float.tbl", Chunk::MAX_SIZE));
+
+    _stored_table_node = StoredTableNode::make("a");
+    _sort_node = SortNode::make(
+        OrderByDefinitions{{LQPColumnReference{_stored_table_node, ColumnID{0}}, OrderByMode::Ascending}},
+        _stored_table_node);
+
+    _rule = std::make_shared<MaterializationRule>();
+  }
+
+  // Pretends that the stored table is large
+  void _set_large_statistics() {
+    const auto no_column_statistics = std::vector<std::shared_ptr<BaseColumnStatistics>>{};
+    _stored_table_node->set_statistics(std::make_shared<TableStatistics>(100'000.0f, no_column_statistics));
+  }
+
+  std::shared_ptr<StoredTableNode> _stored_table_node;
+  std::shared_ptr<SortNode> _sort_node;
+  std::shared_ptr<MaterializationRule> _rule;
+};
+
+TEST_F(MaterializationRuleTest, LargeResultIsMaterialized) {
+  _set_large_statistics();
+  auto projection_node = ProjectionNode::make_pass_through(_sort_node);
+
+  const auto result_node = StrategyBaseTest::apply_rule(_rule, projection_node);
+  EXPECT_EQ(result_node->type(), LQPNodeType::Materialize);
+  EXPECT_EQ(result_node->left_child(), projection_node);
+}
+
+TEST_F(MaterializationRuleTest, SmallResultIsNotMaterialized) {
+  const auto result_node = StrategyBaseTest::apply_rule(_rule, _sort_node);
+  EXPECT_EQ(result_node, _sort_node);
+}
+
+TEST_F(MaterializationRuleTest, LimitedResultIsNotMaterialized) {
+  _set_large_statistics();
+  auto limit_node = LimitNode::make(10, _sort_node);
+
+  const auto result_node = StrategyBaseTest::apply_rule(_rule, limit_node);
+  EXPECT_EQ(result_node, limit_node);
+}
+
+TEST_F(MaterializationRuleTest, ValuesAreNotMaterialized) {
+  // GetTable outputs the stored table itself
+  _set_large_statistics();
+  auto projection_node = ProjectionNode::make_pass_through(_stored_table_node);
+
+  const auto result_node = StrategyBaseTest::apply_rule(_rule, projection_node);
+  EXPECT_EQ(result_node, projection_node);
+}
+
+}  // namespace opossum
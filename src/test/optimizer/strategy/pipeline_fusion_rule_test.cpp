@@ -0,0 +1,106 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "logical_query_plan/aggregate_node.hpp"
+#include "logical_query_plan/lqp_expression.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "optimizer/strategy/pipeline_fusion_rule.hpp"
+#include "optimizer/strategy/strategy_base_test.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class PipelineFusionRuleTest : public StrategyBaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("a", load_table("src/test/tables/int_float.tbl", Chunk::MAX_SIZE));
+
+    _stored_table_node = StoredTableNode::make("a");
+    _a = LQPColumnReference{_stored_table_node, ColumnID{0}};
+    _b = LQPColumnReference{_stored_table_node, ColumnID{1}};
+
+    _rule = std::make_shared<PipelineFusionRule>();
+  }
+
+  // SUM(a * b) ... GROUP BY b
+  std::shared_ptr<AggregateNode> _make_aggregate_node(const std::shared_ptr<AbstractLQPNode>& input,
+                                                      const AggregateFunction function = AggregateFunction::Sum) {
+    const auto argument = LQPExpression::create_binary_operator(
+        ExpressionType::Multiplication, LQPExpression::create_column(_a), LQPExpression::create_column(_b));
+    const auto aggregate_node = AggregateNode::make(
+        std::vector<std::shared_ptr<LQPExpression>>{LQPExpression::create_aggregate_function(function, {argument})},
+        std::vector<LQPColumnReference>{_b});
+    aggregate_node->set_left_child(input);
+    return aggregate_node;
+  }
+
+  std::shared_ptr<StoredTableNode> _stored_table_node;
+  LQPColumnReference _a, _b;
+  std::shared_ptr<PipelineFusionRule> _rule;
+};
+
+TEST_F(PipelineFusionRuleTest, FusesConsecutivePredicates) {
+  const auto predicate_node_b = PredicateNode::make(_b, PredicateCondition::Between, 400.0, 460.0);
+  predicate_node_b->set_left_child(_stored_table_node);
+  const auto predicate_node_a = PredicateNode::make(_a, PredicateCondition::GreaterThan, 100);
+  predicate_node_a->set_left_child(predicate_node_b);
+  const auto aggregate_node = _make_aggregate_node(predicate_node_a);
+
+  EXPECT_FALSE(aggregate_node->fused_predicate_count());
+  StrategyBaseTest::apply_rule(_rule, aggregate_node);
+  EXPECT_EQ(aggregate_node->fused_predicate_count(), 2u);
+}
+
+TEST_F(PipelineFusionRuleTest, AggregateWithoutPredicates) {
+  const auto aggregate_node = _make_aggregate_node(_stored_table_node);
+
+  StrategyBaseTest::apply_rule(_rule, aggregate_node);
+  EXPECT_EQ(aggregate_node->fused_predicate_count(), 0u);
+}
+
+TEST_F(PipelineFusionRuleTest, StopsAtUnsupportedPredicate) {
+  // IS NULL cannot be fused, so only the predicate above it is
+  const auto predicate_node_b = PredicateNode::make(_b, PredicateCondition::IsNull, NULL_VALUE);
+  predicate_node_b->set_left_child(_stored_table_node);
+  const auto predicate_node_a = PredicateNode::make(_a, PredicateCondition::GreaterThan, 100);
+  predicate_node_a->set_left_child(predicate_node_b);
+  const auto aggregate_node = _make_aggregate_node(predicate_node_a);
+
+  StrategyBaseTest::apply_rule(_rule, aggregate_node);
+  EXPECT_EQ(aggregate_node->fused_predicate_count(), 1u);
+}
+
+TEST_F(PipelineFusionRuleTest, PredicateWithSeveralParents) {
+  // The other parent needs the result of the predicate, so it is executed by a TableScan
+  const auto predicate_node = PredicateNode::make(_a, PredicateCondition::GreaterThan, 100);
+  predicate_node->set_left_child(_stored_table_node);
+  const auto aggregate_node = _make_aggregate_node(predicate_node);
+  const auto projection_node = ProjectionNode::make_pass_through(predicate_node);
+
+  StrategyBaseTest::apply_rule(_rule, aggregate_node);
+  EXPECT_EQ(aggregate_node->fused_predicate_count(), 0u);
+}
+
+TEST_F(PipelineFusionRuleTest, StringComparedToNumber) {
+  const auto predicate_node = PredicateNode::make(_a, PredicateCondition::Equals, std::string{"100"});
+  predicate_node->set_left_child(_stored_table_node);
+  const auto aggregate_node = _make_aggregate_node(predicate_node);
+
+  StrategyBaseTest::apply_rule(_rule, aggregate_node);
+  EXPECT_EQ(aggregate_node->fused_predicate_count(), 0u);
+}
+
+TEST_F(PipelineFusionRuleTest, CountDistinctIsNotFused) {
+  const auto aggregate_node = _make_aggregate_node(_stored_table_node, AggregateFunction::CountDistinct);
+
+  StrategyBaseTest::apply_rule(_rule, aggregate_node);
+  EXPECT_FALSE(aggregate_node->fused_predicate_count());
+}
+
+}  // namespace opossum
@@ -0,0 +1,161 @@
+#include <memory>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_column_reference.hpp"
+#include "logical_query_plan/mock_node.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/sort_node.hpp"
+#include "logical_query_plan/union_node.hpp"
+#include "optimizer/strategy/predicate_pushdown_rule.hpp"
+#include "optimizer/strategy/strategy_base_test.hpp"
+
+namespace opossum {
+
+class PredicatePushdownRuleTest : public StrategyBaseTest {
+ protected:
+  void SetUp() override {
+    _node_a = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}, {DataType::Int, "b"}});
+    _node_b = MockNode::make(MockNode::ColumnDefinitions{{DataType::Int, "a"}, {DataType::Int, "b"}});
+
+    _a_a = LQPColumnReference{_node_a, ColumnID{0}};
+    _a_b = LQPColumnReference{_node_a, ColumnID{1}};
+    _b_a = LQPColumnReference{_node_b, ColumnID{0}};
+    _b_b = LQPColumnReference{_node_b, ColumnID{1}};
+
+    _rule = std::make_shared<PredicatePushdownRule>();
+  }
+
+  std::shared_ptr<MockNode> _node_a, _node_b;
+  LQPColumnReference _a_a, _a_b, _b_a, _b_b;
+  std::shared_ptr<PredicatePushdownRule> _rule;
+};
+
+TEST_F(PredicatePushdownRuleTest, PushDownBelowInnerJoin) {
+  /**
+   * Test that
+   *
+   *   Predicate (a.b > 5)
+   *         |
+   *   Predicate (b.b < 3)
+   *         |
+   *       Join
+   *   (a.a == b.a)
+   *     /     \
+   *    a       b
+   *
+   * gets converted to
+   *
+   *             Join
+   *         (a.a == b.a)
+   *          /       \
+   *   Predicate     Predicate
+   *   (a.b > 5)     (b.b < 3)
+   *       |             |
+   *       a             b
+   */
+  auto join_node = JoinNode::make(JoinMode::Inner, LQPColumnReferencePair{_a_a, _b_a}, PredicateCondition::Equals);
+  join_node->set_left_child(_node_a);
+  join_node->set_right_child(_node_b);
+
+  auto predicate_node_b = PredicateNode::make(_b_b, PredicateCondition::LessThan, 3);
+  predicate_node_b->set_left_child(join_node);
+
+  auto predicate_node_a = PredicateNode::make(_a_b, PredicateCondition::GreaterThan, 5);
+  predicate_node_a->set_left_child(predicate_node_b);
+
+  const auto output = StrategyBaseTest::apply_rule(_rule, predicate_node_a);
+
+  EXPECT_EQ(output, join_node);
+  EXPECT_EQ(join_node->left_child(), predicate_node_a);
+  EXPECT_EQ(predicate_node_a->left_child(), _node_a);
+  EXPECT_EQ(join_node->right_child(), predicate_node_b);
+  EXPECT_EQ(predicate_node_b->left_child(), _node_b);
+}
+
+TEST_F(PredicatePushdownRuleTest, RespectOuterJoinSemantics) {
+  // The predicate on the right input of a Left Join must not be pushed, the one on the left input must
+  auto join_node = JoinNode::make(JoinMode::Left, LQPColumnReferencePair{_a_a, _b_a}, PredicateCondition::Equals);
+  join_node->set_left_child(_node_a);
+  join_node->set_right_child(_node_b);
+
+  auto predicate_node_b = PredicateNode::make(_b_b, PredicateCondition::IsNull, NULL_VALUE);
+  predicate_node_b->set_left_child(join_node);
+
+  auto predicate_node_a = PredicateNode::make(_a_b, PredicateCondition::GreaterThan, 5);
+  predicate_node_a->set_left_child(predicate_node_b);
+
+  const auto output = StrategyBaseTest::apply_rule(_rule, predicate_node_a);
+
+  EXPECT_EQ(output, predicate_node_b);
+  EXPECT_EQ(predicate_node_b->left_child(), join_node);
+  EXPECT_EQ(join_node->left_child(), predicate_node_a);
+  EXPECT_EQ(predicate_node_a->left_child(), _node_a);
+  EXPECT_EQ(join_node->right_child(), _node_b);
+}
+
+TEST_F(PredicatePushdownRuleTest, KeepJoinPredicatesAboveJoin) {
+  auto cross_join_node = JoinNode::make(JoinMode::Cross);
+  cross_join_node->set_left_child(_node_a);
+  cross_join_node->set_right_child(_node_b);
+
+  auto predicate_node = PredicateNode::make(_a_a, PredicateCondition::Equals, _b_a);
+  predicate_node->set_left_child(cross_join_node);
+
+  const auto output = StrategyBaseTest::apply_rule(_rule, predicate_node);
+
+  EXPECT_EQ(output, predicate_node);
+  EXPECT_EQ(predicate_node->left_child(), cross_join_node);
+}
+
+TEST_F(PredicatePushdownRuleTest, PushDownThroughProjectionAndSort) {
+  auto sort_node = SortNode::make(OrderByDefinitions{{_a_a, OrderByMode::Ascending}});
+  sort_node->set_left_child(_node_a);
+
+  auto projection_node = ProjectionNode::make_pass_through(sort_node);
+
+  auto predicate_node = PredicateNode::make(_a_b, PredicateCondition::Equals, 4);
+  predicate_node->set_left_child(projection_node);
+
+  const auto output = StrategyBaseTest::apply_rule(_rule, predicate_node);
+
+  EXPECT_EQ(output, projection_node);
+  EXPECT_EQ(projection_node->left_child(), sort_node);
+  EXPECT_EQ(sort_node->left_child(), predicate_node);
+  EXPECT_EQ(predicate_node->left_child(), _node_a);
+}
+
+TEST_F(PredicatePushdownRuleTest, PushDownIntoBothInputsOfUnion) {
+  auto predicate_node_left = PredicateNode::make(_a_a, PredicateCondition::Equals, 1);
+  predicate_node_left->set_left_child(_node_a);
+
+  auto predicate_node_right = PredicateNode::make(_a_a, PredicateCondition::Equals, 2);
+  predicate_node_right->set_left_child(_node_a);
+
+  auto union_node = UnionNode::make(UnionMode::Positions);
+  union_node->set_left_child(predicate_node_left);
+  union_node->set_right_child(predicate_node_right);
+
+  auto predicate_node = PredicateNode::make(_a_b, PredicateCondition::LessThan, 10);
+  predicate_node->set_left_child(union_node);
+
+  const auto output = StrategyBaseTest::apply_rule(_rule, predicate_node);
+
+  EXPECT_EQ(output, union_node);
+
+  // Both inputs of the union share the node a, so the predicates cannot be pushed below their predicate chains
+  EXPECT_EQ(union_node->left_child(), predicate_node);
+  EXPECT_EQ(predicate_node->left_child(), predicate_node_left);
+
+  const auto right_predicate_node = std::dynamic_pointer_cast<PredicateNode>(union_node->right_child());
+  ASSERT_TRUE(right_predicate_node);
+  EXPECT_EQ(right_predicate_node->column_reference(), _a_b);
+  EXPECT_EQ(right_predicate_node->predicate_condition(), PredicateCondition::LessThan);
+  EXPECT_EQ(right_predicate_node->value(), AllParameterVariant{10});
+  EXPECT_EQ(right_predicate_node->left_child(), predicate_node_right);
+}
+
+}  // namespace opossum
@@ -0,0 +1,59 @@
+#include <memory>
+#include <vector>
+
+#include "../../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "logical_query_plan/limit_node.hpp"
+#include "logical_query_plan/projection_node.hpp"
+#include "logical_query_plan/sort_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
+#include "optimizer/strategy/strategy_base_test.hpp"
+#include "optimizer/strategy/top_k_rule.hpp"
+#include "storage/storage_manager.hpp"
+
+namespace opossum {
+
+class TopKRuleTest : public StrategyBaseTest {
+ protected:
+  void SetUp() override {
+    StorageManager::get().add_table("a", load_table("src/test/tables/int_float.tbl", Chunk::MAX_SIZE));
+
+    _stored_table_node = StoredTableNode::make("a");
+    _sort_node = SortNode::make(
+        OrderByDefinitions{{LQPColumnReference{_stored_table_node, ColumnID{0}}, OrderByMode::Ascending}},
+        _stored_table_node);
+
+    _rule = std::make_shared<TopKRule>();
+  }
+
+  std::shared_ptr<StoredTableNode> _stored_table_node;
+  std::shared_ptr<SortNode> _sort_node;
+  std::shared_ptr<TopKRule> _rule;
+};
+
+TEST_F(TopKRuleTest, LimitOverSort) {
+  auto limit_node = LimitNode::make(5, _sort_node);
+
+  EXPECT_FALSE(_sort_node->top_k());
+  StrategyBaseTest::apply_rule(_rule, limit_node);
+  EXPECT_EQ(_sort_node->top_k(), 5u);
+}
+
+TEST_F(TopKRuleTest, LimitNotDirectlyOverSort) {
+  auto limit_node = LimitNode::make(5, ProjectionNode::make_pass_through(_sort_node));
+
+  StrategyBaseTest::apply_rule(_rule, limit_node);
+  EXPECT_FALSE(_sort_node->top_k());
+}
+
+TEST_F(TopKRuleTest, SortWithSeveralParents) {
+  // The other parent needs all sorted rows
+  auto limit_node = LimitNode::make(5, _sort_node);
+  auto projection_node = ProjectionNode::make_pass_through(_sort_node);
+
+  StrategyBaseTest::apply_rule(_rule, limit_node);
+  EXPECT_FALSE(_sort_node->top_k());
+}
+
+}  // namespace opossum
@@ -1,12 +1,17 @@
 
+#include <thread>
+#include <vector>
+
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
 
+#include "sql/clock_cache.hpp"
 #include "sql/gdfs_cache.hpp"
 #include "sql/gds_cache.hpp"
 #include "sql/lru_cache.hpp"
 #include "sql/lru_k_cache.hpp"
 #include "sql/random_cache.hpp"
+#include "sql/sharded_cache.hpp"
 
 namespace opossum {
 
@@ -86,6 +91,99 @@ TEST_F(SQLBasicCacheTest, LRU2CacheTest) {
   ASSERT_EQ(6, cache.get(3));  // Hit.
 }
 
+// CLOCK Strategy
+TEST_F(SQLBasicCacheTest, ClockCacheTest) {
+  ClockCache<int, int> cache(2);
+
+  ASSERT_FALSE(cache.has(1));
+  ASSERT_FALSE(cache.has(2));
+  ASSERT_FALSE(cache.has(3));
+
+  cache.set(1, 2);  // Miss, insert.
+  cache.set(2, 4);  // Miss, insert.
+
+  ASSERT_EQ(2, cache.get(1));  // Hit, reference 1.
+
+  cache.set(3, 6);  // Miss, 1 gets a second chance, evict 2.
+
+  ASSERT_TRUE(cache.has(1));
+  ASSERT_FALSE(cache.has(2));
+  ASSERT_TRUE(cache.has(3));
+
+  cache.set(4, 8);  // Miss, evict 1, as it was not referenced again.
+
+  ASSERT_FALSE(cache.has(1));
+  ASSERT_TRUE(cache.has(3));
+  ASSERT_TRUE(cache.has(4));
+
+  ASSERT_EQ(6, *cache.try_get(3));  // Hit, reference 3.
+  ASSERT_FALSE(cache.try_get(1));   // Miss.
+
+  cache.set(5, 10);  // Miss, 3 gets a second chance, evict 4.
+
+  ASSERT_TRUE(cache.has(3));
+  ASSERT_FALSE(cache.has(4));
+  ASSERT_TRUE(cache.has(5));
+}
+
+// Sharded CLOCK Strategy
+TEST_F(SQLBasicCacheTest, ShardedCacheTest) {
+  ShardedCache<int, int> cache(64);
+
+  ASSERT_TRUE(cache.is_thread_safe());
+  ASSERT_FALSE(cache.try_get(1));
+
+  for (auto key = 0; key < 16; ++key) {
+    cache.set(key, 2 * key);
+  }
+
+  ASSERT_EQ(16u, cache.size());
+  for (auto key = 0; key < 16; ++key) {
+    ASSERT_TRUE(cache.has(key));
+    ASSERT_EQ(2 * key, *cache.try_get(key));
+  }
+
+  // Every shard holds at most 64 / 16 entries
+  for (auto key = 16; key < 1000; ++key) {
+    cache.set(key, 2 * key);
+  }
+
+  ASSERT_EQ(64u, cache.size());
+
+  cache.resize(32);
+
+  ASSERT_EQ(32u, cache.capacity());
+  ASSERT_EQ(32u, cache.size());
+
+  cache.clear();
+
+  ASSERT_EQ(0u, cache.size());
+}
+
+TEST_F(SQLBasicCacheTest, ShardedCacheConcurrentAccess) {
+  ShardedCache<int, int> cache(128);
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < 8; ++thread_id) {
+    threads.emplace_back([&cache, thread_id]() {
+      for (auto iteration = 0; iteration < 1000; ++iteration) {
+        const auto key = (iteration * 7 + thread_id) % 256;
+        if (const auto value = cache.try_get(key)) {
+          ASSERT_EQ(*value, 2 * key);
+        } else {
+          cache.set(key, 2 * key);
+        }
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  ASSERT_EQ(128u, cache.size());
+}
+
 // GDS Strategy
 TEST_F(SQLBasicCacheTest, GDSCacheTest) {
   GDSCache<int, int> cache(2);
@@ -237,7 +335,7 @@ class CacheTest : public BaseTest {};
 
 // here we define all Join types
 using CacheTypes = ::testing::Types<LRUCache<int, int>, LRUKCache<2, int, int>, GDSCache<int, int>, GDFSCache<int, int>,
-                                    RandomCache<int, int>>;
+                                    RandomCache<int, int>, ClockCache<int, int>>;
 TYPED_TEST_CASE(CacheTest, CacheTypes);
 
 TYPED_TEST(CacheTest, Size) {
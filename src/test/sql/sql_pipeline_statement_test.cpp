@@ -61,6 +61,12 @@ class SQLPipelineStatementTest : public BaseTest {
     SQLQueryCache<SQLQueryPlan>::get().clear();
   }
 
+  void TearDown() override {
+    auto& result_cache = SQLPipelineStatement::get_result_cache();
+    result_cache.clear();
+    result_cache.resize(0);
+  }
+
   std::shared_ptr<Table> _table_a;
   std::shared_ptr<Table> _table_b;
   std::shared_ptr<Table> _join_result;
@@ -459,4 +465,108 @@ TEST_F(SQLPipelineStatementTest, CacheQueryPlan) {
   EXPECT_TRUE(cache.has(_select_query_a));
 }
 
+TEST_F(SQLPipelineStatementTest, CacheParameterizedQueryPlan) {
+  const auto& cache = SQLQueryCache<SQLQueryPlan>::get();
+
+  SQLPipelineStatement sql_pipeline1{"SELECT * FROM table_a WHERE a = 123"};
+  const auto& result1 = sql_pipeline1.get_result_table();
+
+  EXPECT_EQ(cache.size(), 1u);
+  EXPECT_TRUE(cache.has("SELECT * FROM table_a WHERE a = ?"));
+  EXPECT_EQ(cache.hits(), 0u);
+  EXPECT_EQ(cache.misses(), 1u);
+
+  // Only the literal differs, so the cached plan is reused
+  SQLPipelineStatement sql_pipeline2{"SELECT * FROM table_a WHERE a = 12345"};
+  const auto& result2 = sql_pipeline2.get_result_table();
+
+  EXPECT_EQ(cache.size(), 1u);
+  EXPECT_EQ(cache.hits(), 1u);
+  EXPECT_EQ(cache.misses(), 1u);
+
+  ASSERT_EQ(result1->row_count(), 1u);
+  EXPECT_EQ(result1->get_value<int>(ColumnID{0}, 0u), 123);
+  ASSERT_EQ(result2->row_count(), 1u);
+  EXPECT_EQ(result2->get_value<int>(ColumnID{0}, 0u), 12345);
+}
+
+TEST_F(SQLPipelineStatementTest, CacheNonParameterizableQueryPlan) {
+  // The second value of BETWEEN cannot be a placeholder, so the plan is cached for the original SQL string. An empty
+  // plan is cached for the normalized SQL string to remember that.
+  const auto query = std::string{"SELECT * FROM table_a WHERE a BETWEEN 1000 AND 2000"};
+  SQLPipelineStatement sql_pipeline1{query};
+  sql_pipeline1.get_result_table();
+
+  const auto& cache = SQLQueryCache<SQLQueryPlan>::get();
+  EXPECT_EQ(cache.size(), 2u);
+  EXPECT_TRUE(cache.has(query));
+  EXPECT_TRUE(cache.has("SELECT * FROM table_a WHERE a BETWEEN ? AND ?"));
+  EXPECT_EQ(cache.hits(), 0u);
+  EXPECT_EQ(cache.misses(), 1u);
+
+  SQLPipelineStatement sql_pipeline2{query};
+  const auto& result = sql_pipeline2.get_result_table();
+
+  EXPECT_EQ(cache.size(), 2u);
+  EXPECT_EQ(cache.hits(), 1u);
+  EXPECT_EQ(cache.misses(), 1u);
+  ASSERT_EQ(result->row_count(), 1u);
+  EXPECT_EQ(result->get_value<int>(ColumnID{0}, 0u), 1234);
+
+  // Other literals are planned for their original SQL string right away
+  SQLPipelineStatement sql_pipeline3{"SELECT * FROM table_a WHERE a BETWEEN 100 AND 200"};
+  const auto& result3 = sql_pipeline3.get_result_table();
+
+  EXPECT_EQ(cache.size(), 3u);
+  EXPECT_EQ(cache.hits(), 1u);
+  EXPECT_EQ(cache.misses(), 2u);
+  EXPECT_EQ(result3->row_count(), 1u);
+}
+
+TEST_F(SQLPipelineStatementTest, CacheQueryResult) {
+  auto& result_cache = SQLPipelineStatement::get_result_cache();
+  result_cache.resize(16);
+
+  SQLPipelineStatement sql_pipeline1{_select_query_a};
+  const auto& result1 = sql_pipeline1.get_result_table();
+
+  EXPECT_EQ(result_cache.size(), 1u);
+  EXPECT_EQ(result_cache.misses(), 1u);
+
+  SQLPipelineStatement sql_pipeline2{_select_query_a};
+  const auto& result2 = sql_pipeline2.get_result_table();
+
+  EXPECT_EQ(result_cache.hits(), 1u);
+  EXPECT_EQ(result1, result2);
+  EXPECT_EQ(sql_pipeline2.compile_time_microseconds(), std::chrono::microseconds{0});
+  EXPECT_TRUE(sql_pipeline2.transaction_context()->phase() == TransactionPhase::Committed);
+}
+
+TEST_F(SQLPipelineStatementTest, InvalidateCachedQueryResult) {
+  auto& result_cache = SQLPipelineStatement::get_result_cache();
+  result_cache.resize(16);
+
+  SQLPipelineStatement sql_pipeline1{_select_query_a};
+  EXPECT_EQ(sql_pipeline1.get_result_table()->row_count(), 3u);
+
+  SQLPipelineStatement insert_pipeline{"INSERT INTO table_a VALUES (11, 11.11)"};
+  insert_pipeline.get_result_table();
+  EXPECT_EQ(_table_a->last_modified_commit_id(), insert_pipeline.transaction_context()->commit_id());
+
+  // The cached result does not contain the inserted row and must not be used anymore
+  SQLPipelineStatement sql_pipeline2{_select_query_a};
+  EXPECT_EQ(sql_pipeline2.get_result_table()->row_count(), 4u);
+  EXPECT_EQ(result_cache.hits(), 0u);
+}
+
+TEST_F(SQLPipelineStatementTest, DoNotCacheQueryResultWithoutMVCC) {
+  auto& result_cache = SQLPipelineStatement::get_result_cache();
+  result_cache.resize(16);
+
+  SQLPipelineStatement sql_pipeline{_select_query_a, UseMvcc::No};
+  sql_pipeline.get_result_table();
+
+  EXPECT_EQ(result_cache.size(), 0u);
+}
+
 }  // namespace opossum
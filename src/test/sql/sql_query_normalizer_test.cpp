@@ -0,0 +1,53 @@
+#include <string>
+
+#include "../base_test.hpp"
+
+#include "SQLParser.h"
+#include "SQLParserResult.h"
+#include "gtest/gtest.h"
+
+#include "sql/sql_query_normalizer.hpp"
+
+namespace opossum {
+
+class SQLQueryNormalizerTest : public BaseTest {
+ protected:
+  static bool _is_parameterizable(const std::string& sql) {
+    hsql::SQLParserResult parse_result;
+    hsql::SQLParser::parse(sql, &parse_result);
+    EXPECT_TRUE(parse_result.isValid());
+    return SQLQueryNormalizer::is_parameterizable(parse_result);
+  }
+};
+
+TEST_F(SQLQueryNormalizerTest, ExtractLiterals) {
+  const auto normalized_query =
+      SQLQueryNormalizer::normalize("SELECT a1, \"b2\" FROM t WHERE a1 = 17 AND b2 > 1.5 OR c LIKE '%x%'");
+
+  EXPECT_EQ(normalized_query.sql, "SELECT a1, \"b2\" FROM t WHERE a1 = ? AND b2 > ? OR c LIKE ?");
+  ASSERT_EQ(normalized_query.arguments.size(), 3u);
+  EXPECT_EQ(normalized_query.arguments[0], AllParameterVariant{AllTypeVariant{int64_t{17}}});
+  EXPECT_EQ(normalized_query.arguments[1], AllParameterVariant{AllTypeVariant{1.5}});
+  EXPECT_EQ(normalized_query.arguments[2], AllParameterVariant{AllTypeVariant{std::string{"%x%"}}});
+}
+
+TEST_F(SQLQueryNormalizerTest, KeepUnsupportedQueries) {
+  const auto queries = {"INSERT INTO t VALUES (1, 2)", "SELECT * FROM t WHERE a = ? AND b = 1",
+                        "SELECT * FROM t WHERE a = 'it''s'"};
+
+  for (const auto& query : queries) {
+    const auto normalized_query = SQLQueryNormalizer::normalize(query);
+    EXPECT_EQ(normalized_query.sql, query);
+    EXPECT_TRUE(normalized_query.arguments.empty());
+  }
+}
+
+TEST_F(SQLQueryNormalizerTest, IsParameterizable) {
+  EXPECT_TRUE(_is_parameterizable("SELECT * FROM t WHERE a = ? AND (? < b OR c LIKE ?)"));
+
+  EXPECT_FALSE(_is_parameterizable("SELECT * FROM t WHERE a = ? + ?"));
+  EXPECT_FALSE(_is_parameterizable("SELECT * FROM t WHERE a BETWEEN ? AND ?"));
+  EXPECT_FALSE(_is_parameterizable("SELECT a + ? FROM t WHERE a = ?"));
+}
+
+}  // namespace opossum
@@ -12,6 +12,7 @@
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/aggregate_node.hpp"
 #include "logical_query_plan/create_view_node.hpp"
+#include "logical_query_plan/distinct_node.hpp"
 #include "logical_query_plan/drop_view_node.hpp"
 #include "logical_query_plan/dummy_table_node.hpp"
 #include "logical_query_plan/insert_node.hpp"
@@ -371,6 +372,15 @@ TEST_F(SQLTranslatorTest, SelectLimit) {
   EXPECT_LQP_EQ(lqp, result_node);
 }
 
+TEST_F(SQLTranslatorTest, SelectDistinct) {
+  const auto query = "SELECT DISTINCT * FROM table_a;";
+  auto result_node = compile_query(query);
+
+  const auto lqp = DistinctNode::make(ProjectionNode::make_pass_through(_stored_table_node_a));
+
+  EXPECT_LQP_EQ(lqp, result_node);
+}
+
 TEST_F(SQLTranslatorTest, InsertValues) {
   const auto query = "INSERT INTO table_a VALUES (10, 12.5);";
   auto result_node = compile_query(query);
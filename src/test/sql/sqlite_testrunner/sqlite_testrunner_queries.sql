@@ -35,6 +35,11 @@ SELECT * FROM mixed ORDER BY b, a DESC, c;
 SELECT sub.a, sub.b FROM (SELECT a, b FROM mixed WHERE a = 'a' ORDER BY b) AS sub WHERE sub.b > 10 ORDER BY b;
 -- (#577) SELECT * FROM mixed_null ORDER BY b;
 
+-- DISTINCT
+SELECT DISTINCT a FROM mixed;
+SELECT DISTINCT a, b FROM mixed_null;
+SELECT DISTINCT a, b FROM mixed WHERE b > 30 ORDER BY b, a;
+
 -- LIMIT
 SELECT * FROM mixed LIMIT 77;
 SELECT b FROM mixed LIMIT 10;
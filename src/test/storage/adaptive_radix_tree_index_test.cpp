@@ -9,9 +9,11 @@
 
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
+#include "type_cast.hpp"
 #include "types.hpp"
 
-#include "storage/deprecated_dictionary_column.hpp"
+#include "storage/column_encoding_utils.hpp"
+#include "storage/dictionary_column.hpp"
 #include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
 #include "storage/index/adaptive_radix_tree/adaptive_radix_tree_nodes.hpp"
 
@@ -130,18 +132,34 @@ TEST_F(AdaptiveRadixTreeIndexTest, VectorOfRandomInts) {
   auto index = std::make_shared<AdaptiveRadixTreeIndex>(std::vector<std::shared_ptr<const BaseColumn>>({column}));
 
   for (auto i : {0, 2, 4, 8, 12, 14, 60, 64, 128, 130, 1024, 1026, 2048, 2050, 4096, 8190, 8192, 8194, 16382, 16384}) {
-    EXPECT_EQ(column->get(*index->lower_bound({i})), i);
-    EXPECT_EQ(column->get(*index->lower_bound({i + 1})), i + 2);
-    EXPECT_EQ(column->get(*index->upper_bound({i})), i + 2);
-    EXPECT_EQ(column->get(*index->upper_bound({i + 1})), i + 2);
+    EXPECT_EQ(type_cast<int>((*column)[*index->lower_bound({i})]), i);
+    EXPECT_EQ(type_cast<int>((*column)[*index->lower_bound({i + 1})]), i + 2);
+    EXPECT_EQ(type_cast<int>((*column)[*index->upper_bound({i})]), i + 2);
+    EXPECT_EQ(type_cast<int>((*column)[*index->upper_bound({i + 1})]), i + 2);
 
     auto expected_lower = i;
     for (auto it = index->lower_bound({i}); it < index->lower_bound({i + 20}); ++it) {
-      EXPECT_EQ(column->get(*it), expected_lower);
+      EXPECT_EQ(type_cast<int>((*column)[*it]), expected_lower);
       expected_lower += 2;
     }
   }
   EXPECT_EQ(index->upper_bound({99999}), index->cend());
 }
 
+TEST_F(AdaptiveRadixTreeIndexTest, NullsAreNotInRange) {
+  // The NULLs are kept behind all values, so bounds beyond the largest value must lie in front of them
+  const auto value_column = std::make_shared<ValueColumn<int32_t>>(true);
+  for (const auto& value : std::vector<AllTypeVariant>{3, NULL_VALUE, 1, 3, NULL_VALUE, 2}) {
+    value_column->append(value);
+  }
+  const auto column = encode_column(EncodingType::Dictionary, DataType::Int, value_column);
+  const auto index = std::make_shared<AdaptiveRadixTreeIndex>(std::vector<std::shared_ptr<const BaseColumn>>({column}));
+
+  const auto positions = [](auto begin, auto end) { return std::set<ChunkOffset>(begin, end); };
+  EXPECT_EQ(positions(index->lower_bound({3}), index->upper_bound({3})), (std::set<ChunkOffset>{0, 3}));
+  EXPECT_EQ(positions(index->cbegin(), index->upper_bound({3})), (std::set<ChunkOffset>{0, 2, 3, 5}));
+  EXPECT_EQ(positions(index->lower_bound({4}), index->cend()), (std::set<ChunkOffset>{1, 4}));
+  EXPECT_EQ(index->lower_bound({4}), index->upper_bound({4}));
+}
+
 }  // namespace opossum
@@ -26,8 +26,8 @@ class StorageChunkTest : public BaseTest {
     vc_str->append("world");
     vc_str->append("!");
 
-    dc_int = encode_column(EncodingType::DeprecatedDictionary, DataType::Int, vc_int);
-    dc_str = encode_column(EncodingType::DeprecatedDictionary, DataType::String, vc_str);
+    dc_int = encode_column(EncodingType::Dictionary, DataType::Int, vc_int);
+    dc_str = encode_column(EncodingType::Dictionary, DataType::String, vc_str);
 
     c = std::make_shared<Chunk>();
   }
@@ -59,6 +59,41 @@ TEST_F(StorageChunkTest, AddValuesToChunk) {
   }
 }
 
+TEST_F(StorageChunkTest, AppendRowsToChunk) {
+  c = std::make_shared<Chunk>(UseMvcc::Yes);
+  c->add_column(make_shared_by_data_type<BaseColumn, ValueColumn>(DataType::Int));
+  c->add_column(make_shared_by_data_type<BaseColumn, ValueColumn>(DataType::String));
+
+  // Rows can be taken from value columns as well as from encoded columns
+  c->append_rows({vc_int, dc_str}, ChunkOffset{1u}, 2u);
+
+  EXPECT_EQ(c->size(), 2u);
+  EXPECT_EQ((*c->get_column(ColumnID{0}))[0], AllTypeVariant{6});
+  EXPECT_EQ((*c->get_column(ColumnID{0}))[1], AllTypeVariant{3});
+  EXPECT_EQ((*c->get_column(ColumnID{1}))[0], AllTypeVariant{"world"});
+  EXPECT_EQ((*c->get_column(ColumnID{1}))[1], AllTypeVariant{"!"});
+
+  const auto mvcc_columns = c->mvcc_columns();
+  EXPECT_EQ(mvcc_columns->begin_cids.size(), 2u);
+  EXPECT_EQ(mvcc_columns->begin_cids[1], Chunk::MAX_COMMIT_ID);
+}
+
+TEST_F(StorageChunkTest, ReserveRows) {
+  c = std::make_shared<Chunk>(UseMvcc::Yes);
+  c->add_column(vc_int);
+
+  const auto [first_begin, first_count] = c->reserve_rows(ChunkOffset{4u}, ChunkOffset{5u});
+  EXPECT_EQ(first_begin, 3u);
+  EXPECT_EQ(first_count, 2u);
+  EXPECT_EQ(c->mvcc_columns()->begin_cids.size(), 5u);
+  EXPECT_EQ(c->mvcc_columns()->begin_cids[4], Chunk::MAX_COMMIT_ID);
+
+  // The chunk is full
+  const auto [second_begin, second_count] = c->reserve_rows(ChunkOffset{1u}, ChunkOffset{5u});
+  EXPECT_EQ(second_begin, 5u);
+  EXPECT_EQ(second_count, 0u);
+}
+
 TEST_F(StorageChunkTest, RetrieveColumn) {
   c->add_column(vc_int);
   c->add_column(vc_str);
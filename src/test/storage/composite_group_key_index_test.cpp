@@ -9,7 +9,7 @@
 #include "gtest/gtest.h"
 #include "storage/base_column.hpp"
 #include "storage/chunk.hpp"
-#include "storage/deprecated_dictionary_column.hpp"
+#include "storage/dictionary_column.hpp"
 #include "storage/index/group_key/composite_group_key_index.hpp"
 #include "storage/index/group_key/variable_length_key_proxy.hpp"
 
@@ -125,4 +125,24 @@ TEST_F(CompositeGroupKeyIndexTest, PositionList) {
   EXPECT_POSITION_LIST_EQ(expected_str_int, *_position_list_str_int);
 }
 
+TEST_F(CompositeGroupKeyIndexTest, NullsAreNotInRange) {
+  // The NULLs are sorted behind all values, so ranges reaching past the largest value must end before them
+  const auto value_column = std::make_shared<ValueColumn<int32_t>>(true);
+  for (const auto& value : std::vector<AllTypeVariant>{1, NULL_VALUE, 3, 1, NULL_VALUE, 2}) {
+    value_column->append(value);
+  }
+  const auto column_int_null = encode_column(EncodingType::Dictionary, DataType::Int, value_column);
+  const auto column_int = create_dict_column_by_type<int32_t>(DataType::Int, {0, 1, 2, 3, 0, 1});
+
+  const auto index = std::make_shared<CompositeGroupKeyIndex>(
+      std::vector<std::shared_ptr<const BaseColumn>>{column_int_null, column_int});
+
+  const auto positions = [](auto begin, auto end) { return std::set<ChunkOffset>(begin, end); };
+  EXPECT_EQ(positions(index->lower_bound({1}), index->upper_bound({3})), (std::set<ChunkOffset>{0, 2, 3, 5}));
+  EXPECT_EQ(positions(index->lower_bound({2}), index->cend()), (std::set<ChunkOffset>{1, 2, 4, 5}));
+  EXPECT_EQ(index->lower_bound({4}), index->upper_bound({4}));
+  EXPECT_EQ(index->lower_bound({4, 2}), index->upper_bound({4, 2}));
+  EXPECT_EQ(positions(index->lower_bound({3, 0}), index->upper_bound({3, 3})), std::set<ChunkOffset>{2});
+}
+
 }  // namespace opossum
@@ -1,7 +1,9 @@
 #include <boost/hana/at_key.hpp>
 
+#include <algorithm>
 #include <memory>
 #include <random>
+#include <vector>
 
 #include "base_test.hpp"
 #include "gtest/gtest.h"
@@ -188,4 +190,28 @@ TYPED_TEST(EncodedColumnTest, SequanciallyReadNullableIntColumnWithShuffledChunk
   });
 }
 
+TYPED_TEST(EncodedColumnTest, DecodeNullableIntColumnBlockwise) {
+  auto value_column = this->create_int_w_null_value_column();
+  auto encoded_column = this->encode_value_column(DataType::Int, value_column);
+
+  // The block size does not divide the row count, so that the last block is only partially filled
+  constexpr auto block_size = size_t{64u};
+  auto values = std::vector<int32_t>(block_size);
+  auto null_values = std::unique_ptr<bool[]>(new bool[block_size]);
+
+  for (auto begin = ChunkOffset{0u}; begin < encoded_column->size(); begin += block_size) {
+    const auto count = std::min(block_size, encoded_column->size() - begin);
+    encoded_column->decode_block(begin, count, values.data(), null_values.get());
+
+    for (auto index = size_t{0u}; index < count; ++index) {
+      const auto chunk_offset = static_cast<ChunkOffset>(begin + index);
+      EXPECT_EQ(null_values[index], value_column->is_null(chunk_offset));
+
+      if (!null_values[index]) {
+        EXPECT_EQ(values[index], value_column->values()[chunk_offset]);
+      }
+    }
+  }
+}
+
 }  // namespace opossum
@@ -0,0 +1,160 @@
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "storage/chunk.hpp"
+#include "storage/column_encoding_utils.hpp"
+#include "storage/encoding_advisor.hpp"
+#include "storage/value_column.hpp"
+
+namespace opossum {
+
+class EncodingAdvisorTest : public BaseTest {
+ protected:
+  static constexpr auto row_count = 10'000u;
+};
+
+TEST_F(EncodingAdvisorTest, LongRunsAreRunLengthEncoded) {
+  auto column = std::make_shared<ValueColumn<int32_t>>();
+  for (auto row = 0u; row < row_count; ++row) {
+    column->append(static_cast<int32_t>(row / 1'000u));
+  }
+
+  const auto decision = EncodingAdvisor{}.advise_column(column, DataType::Int);
+
+  ASSERT_TRUE(decision.statistics);
+  EXPECT_EQ(decision.encoding_spec.encoding_type, EncodingType::RunLength);
+  EXPECT_TRUE(decision.statistics->is_sorted);
+  EXPECT_GT(decision.statistics->estimated_average_run_length, 100.0f);
+  EXPECT_EQ(decision.statistics->min_value, AllTypeVariant{0});
+  EXPECT_EQ(decision.statistics->max_value, AllTypeVariant{9});
+}
+
+TEST_F(EncodingAdvisorTest, RunLengthOfSortedColumnsFollowsFromDistinctCount) {
+  auto column = std::make_shared<ValueColumn<int32_t>>();
+  for (auto row = 0u; row < row_count; ++row) {
+    column->append(static_cast<int32_t>(row / 50u));
+  }
+
+  const auto decision = EncodingAdvisor{}.advise_column(column, DataType::Int);
+
+  ASSERT_TRUE(decision.statistics);
+  EXPECT_TRUE(decision.statistics->is_sorted);
+  EXPECT_EQ(decision.statistics->estimated_distinct_count, 200u);
+  EXPECT_FLOAT_EQ(decision.statistics->estimated_average_run_length, 50.0f);
+  EXPECT_EQ(decision.encoding_spec.encoding_type, EncodingType::RunLength);
+}
+
+TEST_F(EncodingAdvisorTest, ValueRangeLimitsDistinctCount) {
+  // The strided sample contains many singletons, which GEE alone would extrapolate to more than 3'000 values
+  auto column = std::make_shared<ValueColumn<int32_t>>();
+  for (auto row = 0u; row < row_count; ++row) {
+    column->append(static_cast<int32_t>((row * 7'919u) % 3'000u));
+  }
+
+  const auto decision = EncodingAdvisor{}.advise_column(column, DataType::Int);
+
+  ASSERT_TRUE(decision.statistics);
+  EXPECT_EQ(decision.statistics->min_value, AllTypeVariant{0});
+  EXPECT_EQ(decision.statistics->max_value, AllTypeVariant{2'999});
+  EXPECT_EQ(decision.statistics->estimated_distinct_count, 3'000u);
+}
+
+TEST_F(EncodingAdvisorTest, FewDistinctValuesAreDictionaryEncoded) {
+  auto column = std::make_shared<ValueColumn<std::string>>();
+  for (auto row = 0u; row < row_count; ++row) {
+    column->append(std::string{"a rather long string value #"} + std::to_string(row % 7u));
+  }
+
+  const auto decision = EncodingAdvisor{}.advise_column(column, DataType::String);
+
+  ASSERT_TRUE(decision.statistics);
+  EXPECT_EQ(decision.encoding_spec.encoding_type, EncodingType::Dictionary);
+  EXPECT_EQ(decision.statistics->estimated_distinct_count, 7u);
+  EXPECT_FALSE(decision.statistics->is_sorted);
+}
+
+TEST_F(EncodingAdvisorTest, UniqueValuesStayUnencoded) {
+  auto column = std::make_shared<ValueColumn<int32_t>>();
+  for (auto row = 0u; row < row_count; ++row) {
+    column->append(static_cast<int32_t>((row * 7'919u) % row_count));
+  }
+
+  const auto sampled_decision = EncodingAdvisor{}.advise_column(column, DataType::Int);
+
+  ASSERT_TRUE(sampled_decision.statistics);
+  EXPECT_EQ(sampled_decision.encoding_spec.encoding_type, EncodingType::Unencoded);
+  EXPECT_GT(sampled_decision.statistics->estimated_distinct_count, sampled_decision.statistics->sampled_row_count);
+
+  auto config = EncodingAdvisorConfig{};
+  config.sample_size = row_count;
+  const auto exact_decision = EncodingAdvisor{config}.advise_column(column, DataType::Int);
+
+  ASSERT_TRUE(exact_decision.statistics);
+  EXPECT_EQ(exact_decision.encoding_spec.encoding_type, EncodingType::Unencoded);
+  EXPECT_EQ(exact_decision.statistics->estimated_distinct_count, row_count);
+}
+
+TEST_F(EncodingAdvisorTest, ScanCostBudgetIsRespected) {
+  auto column = std::make_shared<ValueColumn<int32_t>>();
+  for (auto row = 0u; row < row_count; ++row) {
+    column->append(static_cast<int32_t>(row % 1'000u));
+  }
+
+  auto config = EncodingAdvisorConfig{};
+
+  config.max_relative_scan_cost = 2.0f;
+  const auto compact_decision = EncodingAdvisor{config}.advise_column(column, DataType::Int);
+  EXPECT_EQ(compact_decision.encoding_spec.encoding_type, EncodingType::Dictionary);
+  EXPECT_EQ(compact_decision.encoding_spec.vector_compression_type, VectorCompressionType::SimdBp128);
+
+  config.max_relative_scan_cost = 1.0f;
+  const auto fast_decision = EncodingAdvisor{config}.advise_column(column, DataType::Int);
+  EXPECT_EQ(fast_decision.encoding_spec.encoding_type, EncodingType::Dictionary);
+  EXPECT_EQ(fast_decision.encoding_spec.vector_compression_type, VectorCompressionType::FixedSizeByteAligned);
+
+  EXPECT_LT(compact_decision.estimated_memory_usage, fast_decision.estimated_memory_usage);
+  EXPECT_LE(fast_decision.estimated_relative_scan_cost, 1.0f);
+}
+
+TEST_F(EncodingAdvisorTest, NullValuesAreCounted) {
+  auto column = std::make_shared<ValueColumn<float>>(true);
+  for (auto row = 0u; row < row_count; ++row) {
+    if (row % 2u == 0u) {
+      column->append(NULL_VALUE);
+    } else {
+      column->append(1.5f);
+    }
+  }
+
+  auto config = EncodingAdvisorConfig{};
+  config.sample_size = row_count;
+  const auto decision = EncodingAdvisor{config}.advise_column(column, DataType::Float);
+
+  ASSERT_TRUE(decision.statistics);
+  EXPECT_EQ(decision.statistics->estimated_null_count, row_count / 2u);
+  EXPECT_EQ(decision.statistics->estimated_distinct_count, 1u);
+  EXPECT_FLOAT_EQ(decision.statistics->estimated_average_run_length, 1.0f);
+}
+
+TEST_F(EncodingAdvisorTest, EncodedColumnsAreLeftUntouched) {
+  auto value_column = std::make_shared<ValueColumn<int32_t>>();
+  value_column->append(1);
+
+  auto chunk = std::make_shared<Chunk>();
+  chunk->add_column(value_column);
+  chunk->add_column(encode_column(EncodingType::RunLength, DataType::Int, value_column));
+
+  const auto chunk_decision = EncodingAdvisor{}.advise_chunk(chunk, {DataType::Int, DataType::Int});
+
+  ASSERT_EQ(chunk_decision.size(), 2u);
+  EXPECT_TRUE(chunk_decision[0].statistics);
+  EXPECT_FALSE(chunk_decision[1].statistics);
+
+  const auto chunk_encoding_spec = EncodingAdvisor::encoding_spec(chunk_decision);
+  EXPECT_EQ(chunk_encoding_spec[1].encoding_type, EncodingType::Unencoded);
+}
+
+}  // namespace opossum
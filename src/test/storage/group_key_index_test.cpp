@@ -10,7 +10,8 @@
 
 #include "../lib/storage/base_column.hpp"
 #include "../lib/storage/chunk.hpp"
-#include "../lib/storage/deprecated_dictionary_column.hpp"
+#include "../lib/storage/column_encoding_utils.hpp"
+#include "../lib/storage/dictionary_column.hpp"
 #include "../lib/storage/index/group_key/group_key_index.hpp"
 #include "../lib/types.hpp"
 
@@ -21,7 +22,11 @@ class GroupKeyIndexTest : public BaseTest {
   void SetUp() override {
     dict_col = BaseTest::create_dict_column_by_type<std::string>(
         DataType::String, {"hotel", "delta", "frank", "delta", "apple", "charlie", "charlie", "inbox"});
-    index = std::make_shared<GroupKeyIndex>(std::vector<std::shared_ptr<const BaseColumn>>({dict_col}));
+    create_index(dict_col);
+  }
+
+  void create_index(const std::shared_ptr<const BaseColumn>& column) {
+    index = std::make_shared<GroupKeyIndex>(std::vector<std::shared_ptr<const BaseColumn>>({column}));
 
     index_offsets = &(index->_index_offsets);
     index_postings = &(index->_index_postings);
@@ -58,4 +63,18 @@ TEST_F(GroupKeyIndexTest, IndexPostings) {
   }
 }
 
+TEST_F(GroupKeyIndexTest, NullValuesAreNotIndexed) {
+  auto value_column = std::make_shared<ValueColumn<int32_t>>(true);
+  value_column->append(3);
+  value_column->append(NULL_VALUE);
+  value_column->append(1);
+  value_column->append(NULL_VALUE);
+  value_column->append(3);
+
+  create_index(encode_column(EncodingType::Dictionary, DataType::Int, value_column));
+
+  EXPECT_EQ(*index_offsets, (std::vector<size_t>{0, 1, 3}));
+  EXPECT_EQ(*index_postings, (std::vector<ChunkOffset>{2, 0, 4}));
+}
+
 }  // namespace opossum
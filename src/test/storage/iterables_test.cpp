@@ -1,6 +1,7 @@
 #include <cstdint>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 #include <vector>
@@ -119,7 +120,7 @@ TEST_F(IterablesTest, ValueColumnNullableReferencedIteratorWithIterators) {
 }
 
 TEST_F(IterablesTest, DeprecatedDictionaryColumnIteratorWithIterators) {
-  ChunkEncoder::encode_all_chunks(table);
+  ChunkEncoder::encode_all_chunks(table, EncodingType::DeprecatedDictionary);
 
   auto chunk = table->get_chunk(ChunkID{0u});
 
@@ -135,7 +136,7 @@ TEST_F(IterablesTest, DeprecatedDictionaryColumnIteratorWithIterators) {
 }
 
 TEST_F(IterablesTest, DeprecatedDictionaryColumnReferencedIteratorWithIterators) {
-  ChunkEncoder::encode_all_chunks(table);
+  ChunkEncoder::encode_all_chunks(table, EncodingType::DeprecatedDictionary);
 
   auto chunk = table->get_chunk(ChunkID{0u});
 
@@ -201,6 +202,30 @@ TEST_F(IterablesTest, ReferenceColumnIteratorWithIterators) {
   EXPECT_EQ(sum, 24'825u);
 }
 
+TEST_F(IterablesTest, ReferenceColumnIteratorMultipleChunks) {
+  // The referenced column is only looked up when the chunk changes. The second chunk is dictionary encoded.
+  auto chunked_table = load_table("src/test/tables/int_float6.tbl", 2);
+  ChunkEncoder::encode_chunks(chunked_table, {ChunkID{1u}});
+
+  auto pos_list = PosList{RowID{ChunkID{1u}, 1u}, NULL_ROW_ID, RowID{ChunkID{0u}, 0u}, RowID{ChunkID{0u}, 1u},
+                          RowID{ChunkID{1u}, 0u}};
+
+  auto reference_column =
+      std::make_unique<ReferenceColumn>(chunked_table, ColumnID{0u}, std::make_shared<PosList>(std::move(pos_list)));
+
+  auto iterable = ReferenceColumnIterable<int>{*reference_column};
+
+  auto values = std::vector<std::optional<int>>{};
+  auto chunk_offsets = std::vector<ChunkOffset>{};
+  iterable.for_each([&](const auto& value) {
+    values.emplace_back(value.is_null() ? std::nullopt : std::optional<int>{value.value()});
+    chunk_offsets.emplace_back(value.chunk_offset());
+  });
+
+  EXPECT_EQ(values, (std::vector<std::optional<int>>{12, std::nullopt, 12345, 12345, 123}));
+  EXPECT_EQ(chunk_offsets, (std::vector<ChunkOffset>{0u, 1u, 2u, 3u, 4u}));
+}
+
 TEST_F(IterablesTest, ConstantValueIteratorWithIterators) {
   auto iterable = ConstantValueIterable<int>{2u};
 
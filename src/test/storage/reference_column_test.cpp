@@ -110,6 +110,48 @@ TEST_F(ReferenceColumnTest, RetrieveNullValueFromNullRowID) {
   EXPECT_EQ(ref_column[3], column[2]);
 }
 
+TEST_F(ReferenceColumnTest, DecodeBlockFromEncodedAndUnencodedChunks) {
+  // The first two chunks of _test_table_dict are encoded, the third one is not
+  auto pos_list = std::make_shared<PosList>(std::initializer_list<RowID>(
+      {RowID{ChunkID{2u}, ChunkOffset{1u}}, RowID{ChunkID{0u}, ChunkOffset{3u}}, NULL_ROW_ID,
+       RowID{ChunkID{1u}, ChunkOffset{0u}}, RowID{ChunkID{1u}, ChunkOffset{4u}}}));
+
+  auto ref_column = ReferenceColumn(_test_table_dict, ColumnID{0u}, pos_list);
+
+  int values[4];
+  bool null_values[4];
+  ref_column.decode_block(ChunkOffset{1u}, 4u, values, null_values);
+
+  EXPECT_FALSE(null_values[0]);
+  EXPECT_TRUE(null_values[1]);
+  EXPECT_FALSE(null_values[2]);
+  EXPECT_FALSE(null_values[3]);
+  EXPECT_EQ(values[0], 6);
+  EXPECT_EQ(values[2], 10);
+  EXPECT_EQ(values[3], 18);
+
+  ref_column.decode_block(ChunkOffset{0u}, 1u, values, null_values);
+  EXPECT_FALSE(null_values[0]);
+  EXPECT_EQ(values[0], 22);
+}
+
+TEST_F(ReferenceColumnTest, MaterializeValuesFromEncodedAndUnencodedChunks) {
+  // The first two chunks of _test_table_dict are encoded, the third one is not
+  auto pos_list = std::make_shared<PosList>(std::initializer_list<RowID>(
+      {RowID{ChunkID{2u}, ChunkOffset{1u}}, RowID{ChunkID{0u}, ChunkOffset{3u}}, NULL_ROW_ID,
+       RowID{ChunkID{0u}, ChunkOffset{4u}}, RowID{ChunkID{1u}, ChunkOffset{0u}}}));
+
+  auto ref_column = ReferenceColumn(_test_table_dict, ColumnID{0u}, pos_list);
+
+  const auto values = ref_column.materialize_values<int>();
+  ASSERT_EQ(values.size(), 5u);
+  EXPECT_EQ(values[0], 22);
+  EXPECT_EQ(values[1], 6);
+  EXPECT_EQ(values[2], std::nullopt);
+  EXPECT_EQ(values[3], 8);
+  EXPECT_EQ(values[4], 10);
+}
+
 TEST_F(ReferenceColumnTest, MemoryUsageEstimation) {
   /**
    * WARNING: Since it's hard to assert what constitutes a correct "estimation", this just tests basic sanity of the
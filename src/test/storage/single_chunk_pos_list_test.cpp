@@ -0,0 +1,243 @@
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "../base_test.hpp"
+#include "gtest/gtest.h"
+
+#include "operators/join_hash.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/union_positions.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/create_iterable_from_column.hpp"
+#include "storage/reference_column.hpp"
+#include "storage/reference_column/single_chunk_pos_list.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class SingleChunkPosListTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    _table = std::make_shared<Table>(200);
+    _table->add_column("a", DataType::Int, true);
+    _table->add_column("b", DataType::Int);
+    for (auto value = 0; value < 400; ++value) {
+      _table->append({value % 10 == 0 ? NULL_VALUE : AllTypeVariant{value}, value < 200 ? value % 97 : -1});
+    }
+
+    // The second chunk is dictionary encoded, the first one is not
+    ChunkEncoder::encode_chunks(_table, {ChunkID{1}});
+  }
+
+  // The positions of the list, retrieved by advancing from position to position like iterators do
+  std::vector<ChunkOffset> _advance_through(const SingleChunkPosList& pos_list) {
+    auto chunk_offsets = std::vector<ChunkOffset>{};
+    if (pos_list.size() == 0) return chunk_offsets;
+
+    chunk_offsets.emplace_back(pos_list.first_chunk_offset());
+    for (auto index = size_t{1}; index < pos_list.size(); ++index) {
+      chunk_offsets.emplace_back(pos_list.next_chunk_offset(index - 1, chunk_offsets.back()));
+    }
+    EXPECT_EQ(pos_list.next_chunk_offset(pos_list.size() - 1, chunk_offsets.back()), INVALID_CHUNK_OFFSET);
+    return chunk_offsets;
+  }
+
+  std::shared_ptr<Table> _table;
+};
+
+TEST_F(SingleChunkPosListTest, CreatePicksMostCompactRepresentation) {
+  EXPECT_EQ(SingleChunkPosList::create(ChunkID{0}, {})->type(), SingleChunkPosListType::Range);
+  EXPECT_EQ(SingleChunkPosList::create(ChunkID{0}, {1000})->type(), SingleChunkPosListType::Range);
+  EXPECT_EQ(SingleChunkPosList::create(ChunkID{0}, {3, 4, 5, 6})->type(), SingleChunkPosListType::Range);
+  EXPECT_EQ(SingleChunkPosList::create(ChunkID{0}, {0, 2, 4, 6})->type(), SingleChunkPosListType::Bitmap);
+  EXPECT_EQ(SingleChunkPosList::create(ChunkID{0}, {5, 1000})->type(), SingleChunkPosListType::ChunkOffsets);
+  EXPECT_EQ(SingleChunkPosList::create(ChunkID{0}, {4, 2})->type(), SingleChunkPosListType::ChunkOffsets);
+  EXPECT_EQ(SingleChunkPosList::create(ChunkID{0}, {2, 2})->type(), SingleChunkPosListType::ChunkOffsets);
+}
+
+TEST_F(SingleChunkPosListTest, PositionsOfAllRepresentations) {
+  const auto chunk_offsets_per_type = std::vector<std::pair<SingleChunkPosListType, std::vector<ChunkOffset>>>{
+      {SingleChunkPosListType::Range, {7, 8, 9, 10}},
+      {SingleChunkPosListType::Bitmap, {1, 63, 64, 65, 130}},
+      {SingleChunkPosListType::ChunkOffsets, {130, 1, 64, 1}}};
+
+  for (const auto& [type, chunk_offsets] : chunk_offsets_per_type) {
+    const auto pos_list = SingleChunkPosList::create(ChunkID{3}, chunk_offsets);
+    EXPECT_EQ(pos_list->type(), type);
+    EXPECT_EQ(pos_list->chunk_id(), ChunkID{3});
+    EXPECT_EQ(pos_list->size(), chunk_offsets.size());
+    EXPECT_EQ(pos_list->chunk_offsets(), chunk_offsets);
+    EXPECT_EQ(_advance_through(*pos_list), chunk_offsets);
+
+    auto expected_row_ids = PosList{};
+    for (const auto chunk_offset : chunk_offsets) expected_row_ids.emplace_back(RowID{ChunkID{3}, chunk_offset});
+    for (auto index = size_t{0}; index < chunk_offsets.size(); ++index) {
+      EXPECT_EQ((*pos_list)[index], expected_row_ids[index]);
+    }
+
+    // Once the RowIDs are materialized, they count towards the memory usage
+    const auto compact_memory_usage = pos_list->estimate_memory_usage();
+    EXPECT_EQ(*pos_list->row_ids(), expected_row_ids);
+    EXPECT_GE(pos_list->estimate_memory_usage(), compact_memory_usage + chunk_offsets.size() * sizeof(RowID));
+
+    // Every range of positions, for the bitmap also ones starting or ending in a later word
+    for (auto begin_index = size_t{0}; begin_index <= chunk_offsets.size(); ++begin_index) {
+      for (auto end_index = begin_index; end_index <= chunk_offsets.size(); ++end_index) {
+        auto range_chunk_offsets = std::vector<ChunkOffset>{};
+        pos_list->for_each_chunk_offset(begin_index, end_index, [&](const ChunkOffset chunk_offset) {
+          range_chunk_offsets.emplace_back(chunk_offset);
+        });
+        EXPECT_EQ(range_chunk_offsets, std::vector<ChunkOffset>(chunk_offsets.begin() + begin_index,
+                                                                chunk_offsets.begin() + end_index));
+      }
+    }
+
+    // The RowIDs are only materialized once
+    EXPECT_EQ(pos_list->row_ids(), pos_list->row_ids());
+  }
+}
+
+TEST_F(SingleChunkPosListTest, AccessBitmapsSpanningSeveralBlocks) {
+  auto chunk_offsets = std::vector<ChunkOffset>{};
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < 3'000; chunk_offset += chunk_offset % 700 < 100 ? 1 : 3) {
+    chunk_offsets.emplace_back(chunk_offset);
+  }
+
+  const auto pos_list = SingleChunkPosList::create(ChunkID{0}, chunk_offsets);
+  ASSERT_EQ(pos_list->type(), SingleChunkPosListType::Bitmap);
+  for (auto index = size_t{0}; index < chunk_offsets.size(); ++index) {
+    EXPECT_EQ((*pos_list)[index], (RowID{ChunkID{0}, chunk_offsets[index]}));
+  }
+}
+
+TEST_F(SingleChunkPosListTest, IterateReferenceColumn) {
+  const auto chunk_offsets_per_type = std::vector<std::vector<ChunkOffset>>{
+      {20, 21, 22, 23, 24, 25}, {0, 1, 5, 10, 63, 64, 100, 150, 199}, {199, 0, 30, 31, 7}};
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    const auto& column = *_table->get_chunk(chunk_id)->get_column(ColumnID{0});
+
+    for (const auto& chunk_offsets : chunk_offsets_per_type) {
+      const auto reference_column =
+          ReferenceColumn(_table, ColumnID{0}, SingleChunkPosList::create(chunk_id, chunk_offsets));
+
+      auto index = ChunkOffset{0};
+      create_iterable_from_column<int32_t>(reference_column).for_each([&](const auto& value) {
+        const auto expected = column[chunk_offsets[index]];
+        EXPECT_EQ(value.chunk_offset(), index);
+        EXPECT_EQ(value.is_null(), variant_is_null(expected));
+        if (!value.is_null()) {
+          EXPECT_EQ(value.value(), type_cast<int32_t>(expected));
+        }
+        ++index;
+      });
+      EXPECT_EQ(index, chunk_offsets.size());
+    }
+  }
+}
+
+TEST_F(SingleChunkPosListTest, DecodeBlocksOfReferenceColumn) {
+  const auto chunk_offsets_per_type = std::vector<std::vector<ChunkOffset>>{
+      {20, 21, 22, 23, 24, 25}, {0, 1, 5, 10, 63, 64, 100, 150, 199}, {199, 0, 30, 31, 7}};
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < _table->chunk_count(); ++chunk_id) {
+    const auto& column = *_table->get_chunk(chunk_id)->get_column(ColumnID{0});
+
+    for (const auto& chunk_offsets : chunk_offsets_per_type) {
+      const auto reference_column =
+          ReferenceColumn(_table, ColumnID{0}, SingleChunkPosList::create(chunk_id, chunk_offsets));
+
+      // Blocks of every length starting at every position
+      for (auto begin = ChunkOffset{0}; begin < chunk_offsets.size(); ++begin) {
+        for (auto count = size_t{1}; begin + count <= chunk_offsets.size(); ++count) {
+          auto values = std::vector<int32_t>(count);
+          auto null_values = std::make_unique<bool[]>(count);
+          reference_column.decode_block(begin, count, values.data(), null_values.get());
+
+          for (auto index = size_t{0}; index < count; ++index) {
+            const auto expected = column[chunk_offsets[begin + index]];
+            EXPECT_EQ(null_values[index], variant_is_null(expected));
+            if (!null_values[index]) {
+              EXPECT_EQ(values[index], type_cast<int32_t>(expected));
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+TEST_F(SingleChunkPosListTest, TableScanOutput) {
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+
+  // All matches of the following scans are in the first chunk
+  const auto pos_list_type = [](const std::shared_ptr<const Table>& table) {
+    EXPECT_EQ(table->chunk_count(), 1u);
+    const auto column = table->get_chunk(ChunkID{0})->get_column(ColumnID{0});
+    const auto pos_list = std::static_pointer_cast<const ReferenceColumn>(column)->abstract_pos_list();
+    return std::dynamic_pointer_cast<const SingleChunkPosList>(pos_list)->type();
+  };
+
+  // Contiguous matches (1 to 9) are stored as a range
+  auto scan_range = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, PredicateCondition::LessThan, 10);
+  scan_range->execute();
+  EXPECT_EQ(pos_list_type(scan_range->get_output()), SingleChunkPosListType::Range);
+  EXPECT_EQ(scan_range->get_output()->row_count(), 9u);
+
+  // Matches selecting most rows of the chunk are stored as a bitmap
+  auto scan_bitmap = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, PredicateCondition::LessThan, 100);
+  scan_bitmap->execute();
+  EXPECT_EQ(pos_list_type(scan_bitmap->get_output()), SingleChunkPosListType::Bitmap);
+  EXPECT_EQ(scan_bitmap->get_output()->row_count(), 90u);
+
+  // Few matches (5, 102, and 199) are stored as chunk offsets
+  auto scan_offsets = std::make_shared<TableScan>(table_wrapper, ColumnID{1}, PredicateCondition::Equals, 5);
+  scan_offsets->execute();
+  EXPECT_EQ(pos_list_type(scan_offsets->get_output()), SingleChunkPosListType::ChunkOffsets);
+  EXPECT_EQ(scan_offsets->get_output()->row_count(), 3u);
+
+  // Scans of compact position lists produce compact position lists again. Of the rows with b >= 90, only those with a
+  // from 91 to 96 are part of the input.
+  auto scan_scan = std::make_shared<TableScan>(scan_bitmap, ColumnID{1}, PredicateCondition::GreaterThanEquals, 90);
+  scan_scan->execute();
+  EXPECT_EQ(pos_list_type(scan_scan->get_output()), SingleChunkPosListType::Range);
+
+  const auto& column = *scan_scan->get_output()->get_chunk(ChunkID{0})->get_column(ColumnID{0});
+  ASSERT_EQ(column.size(), 6u);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < column.size(); ++chunk_offset) {
+    EXPECT_EQ(column[chunk_offset], AllTypeVariant{static_cast<int32_t>(91 + chunk_offset)});
+  }
+}
+
+TEST_F(SingleChunkPosListTest, OperatorsDoNotMaterializeRowIDs) {
+  auto table_wrapper = std::make_shared<TableWrapper>(_table);
+  table_wrapper->execute();
+
+  auto scan = std::make_shared<TableScan>(table_wrapper, ColumnID{0}, PredicateCondition::LessThan, 100);
+  scan->execute();
+
+  const auto column = scan->get_output()->get_chunk(ChunkID{0})->get_column(ColumnID{0});
+  const auto pos_list = std::static_pointer_cast<const ReferenceColumn>(column)->abstract_pos_list();
+  const auto memory_usage = pos_list->estimate_memory_usage();
+
+  auto sort = std::make_shared<Sort>(scan, ColumnID{1});
+  sort->execute();
+  EXPECT_EQ(sort->get_output()->row_count(), 90u);
+
+  auto union_positions = std::make_shared<UnionPositions>(scan, scan);
+  union_positions->execute();
+  EXPECT_EQ(union_positions->get_output()->row_count(), 90u);
+
+  auto join_hash = std::make_shared<JoinHash>(scan, table_wrapper, JoinMode::Inner,
+                                              ColumnIDPair{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals);
+  join_hash->execute();
+  EXPECT_EQ(join_hash->get_output()->row_count(), 90u);
+
+  EXPECT_EQ(pos_list->estimate_memory_usage(), memory_usage);
+}
+
+}  // namespace opossum
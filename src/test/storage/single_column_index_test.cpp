@@ -9,7 +9,7 @@
 
 #include "../lib/storage/base_column.hpp"
 #include "../lib/storage/chunk.hpp"
-#include "../lib/storage/deprecated_dictionary_column.hpp"
+#include "../lib/storage/dictionary_column.hpp"
 #include "../lib/storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
 #include "../lib/storage/index/group_key/composite_group_key_index.hpp"
 #include "../lib/storage/index/group_key/group_key_index.hpp"
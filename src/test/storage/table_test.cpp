@@ -8,6 +8,7 @@
 #include "gtest/gtest.h"
 
 #include "../lib/resolve_type.hpp"
+#include "../lib/storage/chunk_encoder.hpp"
 #include "../lib/storage/deprecated_dictionary_column.hpp"
 #include "../lib/storage/table.hpp"
 
@@ -51,6 +52,40 @@ TEST_F(StorageTableTest, RowCount) {
   EXPECT_EQ(t.row_count(), 3u);
 }
 
+TEST_F(StorageTableTest, AppendRows) {
+  const auto int_column = std::make_shared<ValueColumn<int32_t>>();
+  const auto string_column = std::make_shared<ValueColumn<std::string>>();
+  for (const auto& [int_value, string_value] : {std::pair{4, "Hello,"}, std::pair{6, "world"}, std::pair{3, "!"}}) {
+    int_column->append(int_value);
+    string_column->append(string_value);
+  }
+
+  t.append({1, "first"});
+  t.append_rows({int_column, string_column}, CommitID{0u});
+
+  EXPECT_EQ(t.chunk_count(), 2u);
+  EXPECT_EQ(t.row_count(), 4u);
+  EXPECT_EQ(t.get_value<int32_t>(ColumnID{0}, 1u), 4);
+  EXPECT_EQ(t.get_value<std::string>(ColumnID{1}, 3u), "!");
+  EXPECT_EQ(t.get_chunk(ChunkID{1})->mvcc_columns()->begin_cids[1], CommitID{0u});
+}
+
+TEST_F(StorageTableTest, AppendRowsAfterEncodedChunk) {
+  const auto int_column = std::make_shared<ValueColumn<int32_t>>();
+  const auto string_column = std::make_shared<ValueColumn<std::string>>();
+  int_column->append(4);
+  string_column->append("Hello,");
+
+  // The last chunk is not full, but as it is encoded, the rows go into a new chunk
+  t.append({1, "first"});
+  ChunkEncoder::encode_chunk(t.get_chunk(ChunkID{0}), t.column_types());
+  t.append_rows({int_column, string_column});
+
+  EXPECT_EQ(t.chunk_count(), 2u);
+  EXPECT_EQ(t.get_chunk(ChunkID{0})->size(), 1u);
+  EXPECT_EQ(t.get_value<int32_t>(ColumnID{0}, 1u), 4);
+}
+
 TEST_F(StorageTableTest, GetColumnName) {
   EXPECT_EQ(t.column_name(ColumnID{0}), "col_1");
   EXPECT_EQ(t.column_name(ColumnID{1}), "col_2");
@@ -151,6 +186,23 @@ TEST_F(StorageTableTest, EmplaceChunkReplacesFirstChunkIfNoRows) {
   EXPECT_EQ(t.chunk_count(), 1u);
 }
 
+TEST_F(StorageTableTest, EmplaceChunkKeepsReplacedChunkAliveForReaders) {
+  const auto initial_chunk = t.get_chunk(ChunkID{0});
+
+  auto c = std::make_shared<Chunk>(UseMvcc::Yes);
+  c->add_column(make_shared_by_data_type<BaseColumn, ValueColumn>(DataType::Int));
+  c->add_column(make_shared_by_data_type<BaseColumn, ValueColumn>(DataType::String));
+  t.emplace_chunk(c);
+
+  EXPECT_EQ(initial_chunk->column_count(), 2u);
+  EXPECT_EQ(t.get_chunk(ChunkID{0}), c);
+
+  // Appends go to the published tail chunk, i.e., the replacement
+  t.append({4, "Hello,"});
+  EXPECT_EQ(c->size(), 1u);
+  EXPECT_EQ(initial_chunk->size(), 0u);
+}
+
 TEST_F(StorageTableTest, EmplaceChunkDoesNotReplaceIfNumberOfChunksGreaterOne) {
   EXPECT_EQ(t.chunk_count(), 1u);
 
@@ -5,6 +5,7 @@
 #include "../base_test.hpp"
 #include "gtest/gtest.h"
 
+#include "../lib/storage/column_encoding_utils.hpp"
 #include "../lib/storage/value_column.hpp"
 
 namespace opossum {
@@ -96,6 +97,58 @@ TEST_F(StorageValueColumnTest, ArraySubscriptOperatorReturnsNullValue) {
   EXPECT_TRUE(variant_is_null(vc_double[0]));
 }
 
+TEST_F(StorageValueColumnTest, DecodeBlock) {
+  vc_int = ValueColumn<int>{true};
+  vc_int.append(1);
+  vc_int.append(NULL_VALUE);
+  vc_int.append(3);
+  vc_int.append(4);
+
+  int values[3];
+  bool null_values[3];
+  vc_int.decode_block(ChunkOffset{1u}, 3u, values, null_values);
+
+  EXPECT_TRUE(null_values[0]);
+  EXPECT_FALSE(null_values[1]);
+  EXPECT_FALSE(null_values[2]);
+  EXPECT_EQ(values[1], 3);
+  EXPECT_EQ(values[2], 4);
+
+  vc_double.append(1.5);
+  vc_double.append(2.5);
+
+  double double_values[2];
+  bool double_null_values[2] = {true, true};
+  vc_double.decode_block(ChunkOffset{0u}, 2u, double_values, double_null_values);
+
+  EXPECT_FALSE(double_null_values[0]);
+  EXPECT_FALSE(double_null_values[1]);
+  EXPECT_EQ(double_values[0], 1.5);
+  EXPECT_EQ(double_values[1], 2.5);
+}
+
+TEST_F(StorageValueColumnTest, AppendValuesFromEncodedColumn) {
+  auto source = std::make_shared<ValueColumn<int>>(true);
+  source->append(1);
+  source->append(NULL_VALUE);
+  source->append(3);
+  const auto encoded_source = encode_column(EncodingType::RunLength, DataType::Int, source);
+
+  vc_int = ValueColumn<int>{true};
+  vc_int.append(0);
+  vc_int.append_values(*encoded_source, ChunkOffset{1u}, 2u);
+
+  EXPECT_EQ(vc_int.size(), 3u);
+  EXPECT_EQ(vc_int[0], AllTypeVariant{0});
+  EXPECT_TRUE(variant_is_null(vc_int[1]));
+  EXPECT_EQ(vc_int[2], AllTypeVariant{3});
+
+  // NULLs cannot be copied into a column that is not nullable
+  auto not_nullable_column = ValueColumn<int>{};
+  EXPECT_NO_THROW(not_nullable_column.append_values(*encoded_source, ChunkOffset{0u}, 1u));
+  EXPECT_THROW(not_nullable_column.append_values(*source, ChunkOffset{0u}, 2u), std::logic_error);
+}
+
 TEST_F(StorageValueColumnTest, StringTooLong) {
   EXPECT_THROW(vc_str.append(std::string(std::numeric_limits<StringLength>::max() + 1ul, 'A')), std::exception);
 }
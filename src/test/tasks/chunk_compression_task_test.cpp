@@ -9,7 +9,9 @@
 #include "operators/get_table.hpp"
 #include "operators/insert.hpp"
 #include "operators/validate.hpp"
-#include "storage/base_deprecated_dictionary_column.hpp"
+#include "storage/base_dictionary_column.hpp"
+#include "storage/base_encoded_column.hpp"
+#include "storage/base_value_column.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/storage_manager.hpp"
 #include "tasks/chunk_compression_task.hpp"
@@ -45,7 +47,7 @@ TEST_F(ChunkCompressionTaskTest, CompressionPreservesTableContent) {
     for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
       auto column = chunk->get_column(column_id);
 
-      auto dict_column = std::dynamic_pointer_cast<const BaseDeprecatedDictionaryColumn>(column);
+      auto dict_column = std::dynamic_pointer_cast<const BaseDictionaryColumn>(column);
       ASSERT_NE(dict_column, nullptr);
     }
   }
@@ -69,7 +71,7 @@ TEST_F(ChunkCompressionTaskTest, DictionarySize) {
     for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
       auto column = chunk->get_column(column_id);
 
-      auto dict_column = std::dynamic_pointer_cast<const BaseDeprecatedDictionaryColumn>(column);
+      auto dict_column = std::dynamic_pointer_cast<const BaseDictionaryColumn>(column);
       ASSERT_NE(dict_column, nullptr);
 
       EXPECT_EQ(dict_column->unique_values_count(), dictionary_sizes[chunk_id][column_id]);
@@ -96,7 +98,7 @@ TEST_F(ChunkCompressionTaskTest, CompressionWithAbortedInsert) {
 
   for (auto i = ChunkID{0}; i < table->chunk_count() - 1; ++i) {
     auto dict_column =
-        std::dynamic_pointer_cast<const BaseDeprecatedDictionaryColumn>(table->get_chunk(i)->get_column(ColumnID{0}));
+        std::dynamic_pointer_cast<const BaseDictionaryColumn>(table->get_chunk(i)->get_column(ColumnID{0}));
     ASSERT_NE(dict_column, nullptr);
   }
 
@@ -109,4 +111,41 @@ TEST_F(ChunkCompressionTaskTest, CompressionWithAbortedInsert) {
   EXPECT_EQ(validate->get_output()->row_count(), 12u);
 }
 
+TEST_F(ChunkCompressionTaskTest, CompressionUsingEncodingAdvisor) {
+  auto table = load_table("src/test/tables/compression_input.tbl", 6u);
+  StorageManager::get().add_table("table_advised", table);
+
+  auto table_expected = load_table("src/test/tables/compression_input.tbl", 6u);
+
+  auto compression = std::make_unique<ChunkCompressionTask>(
+      "table_advised", std::vector<ChunkID>{ChunkID{0}, ChunkID{1}}, EncodingAdvisorConfig{});
+  compression->execute();
+
+  ASSERT_TRUE(check_table_equal(table, table_expected, OrderSensitivity::Yes, TypeCmpMode::Strict,
+                                FloatComparisonMode::AbsoluteDifference));
+
+  const auto& decisions = compression->encoding_decisions();
+  ASSERT_EQ(decisions.size(), 2u);
+
+  for (const auto& [chunk_id, chunk_decision] : decisions) {
+    const auto chunk = table->get_chunk(chunk_id);
+    ASSERT_EQ(chunk_decision.size(), chunk->column_count());
+
+    for (ColumnID column_id{0}; column_id < chunk->column_count(); ++column_id) {
+      const auto& column_decision = chunk_decision[column_id];
+      ASSERT_TRUE(column_decision.statistics);
+      EXPECT_EQ(column_decision.statistics->row_count, 6u);
+
+      const auto column = chunk->get_column(column_id);
+      if (column_decision.encoding_spec.encoding_type == EncodingType::Unencoded) {
+        EXPECT_NE(std::dynamic_pointer_cast<const BaseValueColumn>(column), nullptr);
+      } else {
+        const auto encoded_column = std::dynamic_pointer_cast<const BaseEncodedColumn>(column);
+        ASSERT_NE(encoded_column, nullptr);
+        EXPECT_EQ(encoded_column->encoding_type(), column_decision.encoding_spec.encoding_type);
+      }
+    }
+  }
+}
+
 }  // namespace opossum